@@ -45,17 +45,6 @@ namespace FIFE
             assert(value <= static_cast<uint64_t>(std::numeric_limits<ALsizei>::max()));
             return static_cast<ALsizei>(value);
         }
-
-        [[nodiscard]] uint32_t toStreamId(std::size_t const value)
-        {
-            assert(value <= static_cast<std::size_t>(std::numeric_limits<uint32_t>::max()));
-            return static_cast<uint32_t>(value);
-        }
-
-        [[nodiscard]] double bytesPerSampleFrame(SoundDecoder const * decoder)
-        {
-            return (static_cast<double>(decoder->getBitResolution()) / 8.0) * (decoder->isStereo() ? 2.0 : 1.0);
-        }
     } // namespace
 
     SoundClip::SoundClip(IResourceLoader* loader) : IResource(createUniqueClipName(), loader), m_isStream(false)
@@ -118,8 +107,7 @@ namespace FIFE
 
             m_decoder->releaseBuffer();
 
-            // push the buffer information to the vector
-            m_buffervec.push_back(std::move(ptr));
+            m_buffers = std::move(ptr);
         }
 
         m_state = IResource::RES_LOADED;
@@ -127,23 +115,13 @@ namespace FIFE
 
     void SoundClip::free()
     {
-        if (m_state == IResource::RES_LOADED) {
-            if (m_isStream) {
-                // erase all elements from the list
-                for (auto& buf : m_buffervec) {
-                    if (buf && buf->buffers.at(0) != 0) {
-                        alDeleteBuffers(BUFFER_NUM, buf->buffers.data());
-                    }
-                }
-            } else {
-                // for non-streaming soundclips
-                SoundBufferEntry const * ptr = m_buffervec.at(0).get();
-                for (uint32_t i = 0; i < ptr->usedbufs; i++) {
-                    alDeleteBuffers(1, &ptr->buffers.at(i));
-                }
+        if (m_state == IResource::RES_LOADED && m_buffers) {
+            // streams own their buffers, only non-streaming soundclips have some here
+            for (uint32_t i = 0; i < m_buffers->usedbufs; i++) {
+                alDeleteBuffers(1, &m_buffers->buffers.at(i));
             }
-            m_buffervec.clear();
         }
+        m_buffers.reset();
         m_state = IResource::RES_NOT_LOADED;
     }
 
@@ -154,146 +132,18 @@ namespace FIFE
 
     uint32_t SoundClip::countBuffers() const
     {
-        return m_buffervec.at(0)->usedbufs;
-    }
-
-    ALuint* SoundClip::getBuffers(uint32_t streamid) const
-    {
-        return m_buffervec.at(streamid)->buffers.data();
-    }
-
-    uint32_t SoundClip::beginStreaming()
-    {
-        SoundBufferEntry* ptr = nullptr;
-        uint32_t id           = 0;
-        for (uint32_t i = 0; i < m_buffervec.size(); i++) {
-            if (m_buffervec.at(i) == nullptr) {
-                auto newEntry     = std::make_unique<SoundBufferEntry>();
-                ptr               = newEntry.get();
-                m_buffervec.at(i) = std::move(newEntry);
-                id                = i;
-                break;
-            }
-        }
-        // create new sound buffer entry
-        if (ptr == nullptr) {
-            auto newEntry = std::make_unique<SoundBufferEntry>();
-            ptr           = newEntry.get();
-            m_buffervec.push_back(std::move(newEntry));
-            id = toStreamId(m_buffervec.size() - 1);
-        }
-
-        ptr->usedbufs  = 0;
-        ptr->deccursor = 0;
-        alGenBuffers(BUFFER_NUM, ptr->buffers.data());
-
-        CHECK_OPENAL_LOG(_log(), LogManager::LEVEL_ERROR, "error creating streaming-buffers")
-
-        return id;
-    }
-
-    bool SoundClip::setStreamPos(uint32_t streamid, SoundPositionType type, float value)
-    {
-        uint64_t pos = 0;
-        // convert position to bytes
-        switch (type) {
-        case SD_BYTE_POS:
-            pos = static_cast<uint64_t>(value);
-            break;
-        case SD_TIME_POS:
-            value /= static_cast<float>(m_decoder->getSampleRate());
-            [[fallthrough]];
-        case SD_SAMPLE_POS:
-            pos = static_cast<uint64_t>(bytesPerSampleFrame(m_decoder.get()) * static_cast<double>(value));
-            break;
-        }
-
-        if (pos > m_decoder->getDecodedLength()) {
-            // EOF!
-            m_buffervec.at(streamid)->deccursor = m_decoder->getDecodedLength();
-            return true;
-        }
-
-        // set cursor position
-        m_buffervec.at(streamid)->deccursor = pos;
-        return false;
-    }
-
-    float SoundClip::getStreamPos(uint32_t streamid, SoundPositionType type) const
-    {
-        uint64_t const pos = m_buffervec.at(streamid)->deccursor;
-        switch (type) {
-        case SD_BYTE_POS:
-            return static_cast<float>(pos);
-        case SD_SAMPLE_POS:
-            return static_cast<float>(static_cast<double>(pos) / bytesPerSampleFrame(m_decoder.get()));
-        case SD_TIME_POS:
-            return static_cast<float>(
-                static_cast<double>(pos) /
-                (bytesPerSampleFrame(m_decoder.get()) * static_cast<double>(m_decoder->getSampleRate())));
-        }
-        return 0.0F;
-    }
-
-    void SoundClip::acquireStream(uint32_t streamid)
-    {
-        SoundBufferEntry const * ptr = m_buffervec.at(streamid).get();
-
-        bool const reachedEOF = // NOLINT(cppcoreguidelines-init-variables)
-            std::ranges::any_of(ptr->buffers, [&](unsigned int buffer) {
-                return getStream(streamid, buffer);
-            });
-        (void)reachedEOF;
-    }
-
-    bool SoundClip::getStream(uint32_t streamid, ALuint buffer)
-    {
-        SoundBufferEntry* ptr = m_buffervec.at(streamid).get();
-
-        if (ptr->deccursor >= m_decoder->getDecodedLength()) {
-            // EOF!
-            return true;
-        }
-
-        // set cursor of decoder
-        if (!m_decoder->setCursor(ptr->deccursor)) {
-            return true;
-        }
-
-        // Error while decoding file?
-        if (m_decoder->decode(BUFFER_LEN)) {
-            throw Exception("error while reading from audio file");
-        }
-
-        // fill the buffer with data
-        alBufferData(
-            buffer,
-            m_decoder->getALFormat(),
-            m_decoder->getBuffer(),
-            toOpenALSize(m_decoder->getBufferSize()),
-            toOpenALSize(m_decoder->getSampleRate()));
-
-        // update cursor
-        ptr->deccursor += m_decoder->getBufferSize();
-
-        m_decoder->releaseBuffer();
-
-        CHECK_OPENAL_LOG(_log(), LogManager::LEVEL_ERROR, "error catching stream")
-
-        return false;
+        return m_buffers->usedbufs;
     }
 
-    void SoundClip::quitStreaming(uint32_t streamid)
+    ALuint* SoundClip::getBuffers() const
     {
-        // release the buffers
-        SoundBufferEntry* ptr = m_buffervec.at(streamid).get();
-        alDeleteBuffers(BUFFER_NUM, ptr->buffers.data());
-        ptr->buffers.at(0) = 0;
+        return m_buffers->buffers.data();
     }
 
-    void SoundClip::endStreaming(uint32_t streamid)
+    std::unique_ptr<SoundDecoder> SoundClip::createStreamDecoder() const
     {
-        m_buffervec.at(streamid).reset();
+        assert(m_decoder);
+        return m_decoder->clone();
     }
 
     void SoundClip::adobtDecoder(SoundDecoder* decoder) // cppcheck-suppress constParameterPointer
@@ -11,7 +11,6 @@
 #include <array>
 #include <memory>
 #include <string>
-#include <vector>
 
 // 3rd party library includes
 
@@ -35,8 +34,7 @@ namespace FIFE
     struct FIFE_API SoundBufferEntry
     {
             std::array<ALuint, BUFFER_NUM> buffers{};
-            uint32_t usedbufs;
-            uint64_t deccursor;
+            uint32_t usedbufs{0};
     };
 
     /**  Class to handle the buffers of an audio file
@@ -66,45 +64,16 @@ namespace FIFE
             uint32_t countBuffers() const;
 
             /** Returns the array of buffers for queuing
-             *
-             */
-            ALuint* getBuffers(uint32_t streamid = 0) const;
-
-            /** Starts streaming the soundclip
-             * @return Returns the streamid
-             */
-            uint32_t beginStreaming();
-
-            /** Fills the streaming-buffers with initial data
-             *
-             * @param streamid The stream ID
-             */
-            void acquireStream(uint32_t streamid);
-
-            /** Sets the stream position
-             * @return True if position is invalid (EOF has been reached)
-             */
-            bool setStreamPos(uint32_t streamid, SoundPositionType type, float value);
-
-            /** Gets the stream position
+             * (only for non-streaming sound clips)
              */
-            float getStreamPos(uint32_t streamid, SoundPositionType type) const;
+            ALuint* getBuffers() const;
 
-            /** Refill a processed buffer with new data
+            /** Creates a decoder of its own for a new stream of this clip.
              *
-             *  @return True if file was EOF
-             *  @param streamid The stream ID
-             *  @param buffer The OpenAL buffer ID
-             */
-            bool getStream(uint32_t streamid, ALuint buffer);
-
-            /** Quits Streaming
-             */
-            void quitStreaming(uint32_t streamid);
-
-            /** Ends streaming, invalidate also the stream id.
+             * Streams are decoded by the SoundStreamer worker, one decoder per stream,
+             * so emitters playing the same clip never seek a shared decoder.
              */
-            void endStreaming(uint32_t streamid);
+            std::unique_ptr<SoundDecoder> createStreamDecoder() const;
 
             /** Adopts a decoder to use so DONT delete it
              */
@@ -128,7 +97,8 @@ namespace FIFE
             bool m_isStream;
             // attached decoder
             std::unique_ptr<SoundDecoder> m_decoder;
-            std::vector<std::unique_ptr<SoundBufferEntry>> m_buffervec;
+            // buffers of a non-streaming clip
+            std::unique_ptr<SoundBufferEntry> m_buffers;
 
             std::string createUniqueClipName();
     };
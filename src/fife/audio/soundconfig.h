@@ -177,9 +177,18 @@ namespace FIFE
     // The length of one buffer. (bytes)
     uint32_t const BUFFER_LEN = 1048576;
 
+    // The interval in which the stream worker refills buffers. (milliseconds)
+    uint32_t const STREAM_POLL_INTERVAL = 10;
+
     // The max. number of OpenAL sources.
     uint16_t const MAX_SOURCES = 64;
 
+    /* Factor on the audibility of emitters that already have a source.
+     * Keeps emitters of nearly equal audibility from taking the sources
+     * from each other every frame.
+     */
+    float const SOURCE_PRIORITY_HYSTERESIS = 1.25F;
+
     // The max. number of OpenAL effect slots.
     uint16_t const MAX_EFFECT_SLOTS = 32;
 } // namespace FIFE
@@ -8,6 +8,8 @@
 #include "platform.h"
 
 // Standard C++ library includes
+#include <memory>
+
 // 3rd party library includes
 
 // FIFE includes
@@ -64,6 +66,13 @@ namespace FIFE
              */
             virtual uint64_t getBufferSize() = 0;
 
+            /** Creates an independent decoder for the same audio data, positioned at the start.
+             *
+             * Every stream decodes through its own instance, so streams of one clip
+             * never move the cursor of each other's decoder.
+             */
+            virtual std::unique_ptr<SoundDecoder> clone() const = 0;
+
             /** Releases the buffer returned by getBuffer()
              */
             virtual void releaseBuffer() = 0;
@@ -20,6 +20,7 @@
 // FIFE includes
 #include "soundclipmanager.h"
 #include "soundmanager.h"
+#include "soundstreamer.h"
 #include "util/base/exception.h"
 #include "util/log/logger.h"
 #include "util/time/sdltimecompat.h"
@@ -97,6 +98,7 @@ namespace FIFE
 
         m_soundClipId(0),
         m_streamId(0),
+        m_streamSeek(0),
         m_emitterId(uid),
 
         m_samplesOffset(0),
@@ -130,11 +132,17 @@ namespace FIFE
     void SoundEmitter::setSource(ALuint source)
     {
         if ((source == 0U) && (m_source != 0U)) {
-            alSourceStop(m_source);
+            if (m_streamId != 0) {
+                // the stream worker stops the source and takes its buffers back
+                m_manager->getStreamer()->close(m_streamId);
+                m_streamId = 0;
+            } else {
+                alSourceStop(m_source);
 
-            // Release all buffers
-            alSourcei(m_source, AL_BUFFER, AL_NONE);
-            alGetError();
+                // Release all buffers
+                alSourcei(m_source, AL_BUFFER, AL_NONE);
+                alGetError();
+            }
 
             deactivateEffects();
         }
@@ -166,49 +174,35 @@ namespace FIFE
         if (m_fadeIn || m_fadeOut) {
             checkFade();
         }
-        // non streaming
-        if (!m_soundClip->isStream()) {
-            if (getState() == SD_STOPPED_STATE) {
-                stop();
-            }
+        // streams are refilled by the SoundStreamer, it reports their end by processStreamStatus()
+        if (m_soundClip->isStream()) {
             return;
         }
+        if (getState() == SD_STOPPED_STATE) {
+            stop();
+        }
+    }
 
-        ALint procs   = 0;
-        ALint bufs    = 0;
-        ALuint buffer = 0;
-        alGetSourcei(m_source, AL_BUFFERS_PROCESSED, &procs);
-
-        while ((procs--) != 0) {
+    void SoundEmitter::processStreamStatus(SoundStreamStatus const & status)
+    {
+        // ignore messages of closed streams and of positions before the last seek
+        if (status.stream != m_streamId || status.seek != m_streamSeek) {
+            return;
+        }
+        switch (status.type) {
+        case SSS_PROCESSED:
             // needed for correct cursor position
-            float samplesOffset = 0.0F;
-            float newOffset     = 0.0F;
-            alGetSourcef(m_source, AL_SAMPLE_OFFSET, &samplesOffset);
-
-            alSourceUnqueueBuffers(m_source, 1, &buffer);
-
-            alGetSourcef(m_source, AL_SAMPLE_OFFSET, &newOffset);
-            m_samplesOffset += (samplesOffset - newOffset);
-
-            if (m_soundClip->getStream(m_streamId, buffer)) {
-                // EOF!
-                if (m_internData.loop) {
-                    // play again from the beginning
-                    m_soundClip->setStreamPos(m_streamId, SD_BYTE_POS, 0);
-                    m_soundClip->getStream(m_streamId, buffer);
-                } else {
-                    // check if the playback has been finished
-                    alGetSourcei(m_source, AL_BUFFERS_QUEUED, &bufs);
-                    if (bufs == 0) {
-                        stop();
-                    }
-                    continue;
-                }
-            }
-            alSourceQueueBuffers(m_source, 1, &buffer);
+            m_samplesOffset += status.samples;
+            break;
+        case SSS_FINISHED:
+            stop();
+            break;
+        case SSS_ERROR:
+            FL_ERR(_log(), "error while streaming");
+            break;
+        default:
+            break;
         }
-
-        CHECK_OPENAL_LOG(_log(), LogManager::LEVEL_ERROR, "error while streaming")
     }
 
     uint32_t SoundEmitter::getId() const
@@ -222,6 +216,7 @@ namespace FIFE
             alSourcei(m_source, AL_SOURCE_RELATIVE, relative ? AL_TRUE : AL_FALSE);
         }
         m_internData.relative = relative;
+        m_manager->updateEmitterPosition(this);
     }
 
     bool SoundEmitter::isRelativePositioning() const
@@ -288,17 +283,15 @@ namespace FIFE
         }
         // release buffer and source handle
         if (isActive()) {
-            alSourceStop(m_source);
-            alSourcei(m_source, AL_BUFFER, AL_NONE);
-            alGetError();
+            if (m_streamId == 0) {
+                alSourceStop(m_source);
+                alSourcei(m_source, AL_BUFFER, AL_NONE);
+                alGetError();
+            }
             m_manager->releaseSource(this);
         }
         // reset clip
         if (m_soundClip) {
-            if (m_soundClip->isStream()) {
-                m_soundClip->quitStreaming(m_streamId);
-                m_streamId = 0;
-            }
             m_soundClipId = 0;
             // release the soundClip
             // SoundClipManager::instance()->free(m_soundClipId);
@@ -311,6 +304,7 @@ namespace FIFE
             if (isActive()) {
                 syncData();
             }
+            m_manager->updateEmitterPosition(this);
         }
 
         if (!m_group.empty()) {
@@ -364,15 +358,16 @@ namespace FIFE
             alSourcei(m_source, AL_LOOPING, m_internData.loop ? AL_TRUE : AL_FALSE);
 
         } else {
-            // streaming
-            m_streamId = m_soundClip->beginStreaming();
-            m_soundClip->acquireStream(m_streamId);
+            // streaming, the stream worker decodes and queues the buffers
             if (!isActive()) {
                 return;
             }
-            // queue initial buffers
-            alSourceQueueBuffers(m_source, BUFFER_NUM, m_soundClip->getBuffers(m_streamId));
-            alSourcei(m_source, AL_LOOPING, AL_FALSE);
+            SoundStreamer* streamer = m_manager->getStreamer();
+            if (m_streamId != 0) {
+                streamer->close(m_streamId);
+            }
+            m_streamSeek = 0;
+            m_streamId   = streamer->open(m_emitterId, m_source, m_soundClip->createStreamDecoder(), m_internData.loop);
         }
 
         CHECK_OPENAL_LOG(_log(), LogManager::LEVEL_ERROR, "error attaching sound clip")
@@ -388,13 +383,14 @@ namespace FIFE
             stop();
         }
         if (isActive()) {
-            // detach all buffers
-            alSourcei(m_source, AL_BUFFER, AL_NONE);
-            CHECK_OPENAL_LOG(_log(), LogManager::LEVEL_ERROR, "error detaching sound clip");
-        }
-        if (m_soundClip->isStream()) {
-            m_soundClip->quitStreaming(m_streamId);
-            m_streamId = 0;
+            if (m_streamId != 0) {
+                // only the stream worker may touch the source now, the next clip gets a fresh one
+                m_manager->releaseSource(this);
+            } else {
+                // detach all buffers
+                alSourcei(m_source, AL_BUFFER, AL_NONE);
+                CHECK_OPENAL_LOG(_log(), LogManager::LEVEL_ERROR, "error detaching sound clip");
+            }
         }
         m_soundClipId = 0;
         m_soundClip.reset();
@@ -403,10 +399,10 @@ namespace FIFE
     void SoundEmitter::setLooping(bool loop)
     {
         if (m_soundClip && isActive()) {
-            if (!m_soundClip->isStream()) {
+            if (m_streamId != 0) {
+                m_manager->getStreamer()->setLooping(m_streamId, loop);
+            } else if (!m_soundClip->isStream()) {
                 alSourcei(m_source, AL_LOOPING, loop ? AL_TRUE : AL_FALSE);
-            } else {
-                alSourcei(m_source, AL_LOOPING, AL_FALSE);
             }
         }
         m_internData.loop = loop;
@@ -420,10 +416,11 @@ namespace FIFE
     void SoundEmitter::play()
     {
         if (m_soundClip && isActive()) {
-            alSourcePlay(m_source);
+            playSource();
         }
         m_internData.playTimestamp = TimeManager::instance()->now64();
         m_playCheckDifference      = 0;
+        m_manager->addPlayCheck(this);
         // resume
         if (m_internData.soundState == SD_PAUSED_STATE) {
             m_internData.playTimestamp =
@@ -458,7 +455,11 @@ namespace FIFE
     void SoundEmitter::stop()
     {
         if (m_soundClip && isActive()) {
-            alSourceStop(m_source);
+            if (m_streamId != 0) {
+                m_manager->getStreamer()->stop(m_streamId);
+            } else {
+                alSourceStop(m_source);
+            }
             rewind();
         }
         m_internData.soundState    = SD_STOPPED_STATE;
@@ -477,7 +478,11 @@ namespace FIFE
     void SoundEmitter::pause()
     {
         if (m_soundClip && isActive()) {
-            alSourcePause(m_source);
+            if (m_streamId != 0) {
+                m_manager->getStreamer()->pause(m_streamId);
+            } else {
+                alSourcePause(m_source);
+            }
         }
         m_internData.soundState = SD_PAUSED_STATE;
     }
@@ -509,6 +514,11 @@ namespace FIFE
         return m_internData.volume;
     }
 
+    float SoundEmitter::getTargetGain() const
+    {
+        return (m_fadeIn || m_fadeOut) ? m_origGain : m_internData.volume;
+    }
+
     void SoundEmitter::setMaxGain(float gain)
     {
         if (isActive()) {
@@ -615,8 +625,6 @@ namespace FIFE
             return;
         }
 
-        ALint state = 0;
-
         if (!m_soundClip->isStream()) {
             switch (type) {
             case SD_BYTE_POS:
@@ -631,7 +639,7 @@ namespace FIFE
             }
 
             CHECK_OPENAL_LOG(_log(), LogManager::LEVEL_ERROR, "error setting cursor position")
-        } else {
+        } else if (m_streamId != 0) {
             switch (type) {
             case SD_BYTE_POS:
                 m_samplesOffset = value / sampleFrameBytes(this);
@@ -643,25 +651,12 @@ namespace FIFE
                 m_samplesOffset = value * static_cast<float>(getSampleRate());
                 break;
             }
-            alGetSourcei(m_source, AL_SOURCE_STATE, &state);
-            if (state == AL_PLAYING || state == AL_PAUSED) {
-                alSourceStop(m_source);
-            }
-
-            m_soundClip->setStreamPos(m_streamId, type, value);
-
-            // detach all buffers
-            alSourcei(m_source, AL_BUFFER, 0);
-
-            // queue the buffers with new data
-            m_soundClip->acquireStream(m_streamId);
-            alSourceQueueBuffers(m_source, BUFFER_NUM, m_soundClip->getBuffers(m_streamId));
-
-            if (state == AL_PLAYING) {
-                alSourcePlay(m_source);
-            }
+            m_samplesOffset = std::max(m_samplesOffset, 0.0F);
 
-            CHECK_OPENAL_LOG(_log(), LogManager::LEVEL_ERROR, "error setting stream cursor position")
+            // the worker refills the buffers from the new position, newer status messages carry this seek
+            ++m_streamSeek;
+            m_manager->getStreamer()->seek(
+                m_streamId, static_cast<uint64_t>(m_samplesOffset * sampleFrameBytes(this)), m_streamSeek);
         }
     }
 
@@ -715,6 +710,7 @@ namespace FIFE
                 static_cast<ALfloat>(position.z));
         }
         m_internData.position = position;
+        m_manager->updateEmitterPosition(this);
     }
 
     AudioSpaceCoordinate const & SoundEmitter::getPosition() const
@@ -815,7 +811,8 @@ namespace FIFE
 
     SoundStateType SoundEmitter::getState() const
     {
-        if (!isActive()) {
+        // the source of a stream may run dry or be restarted by the worker at any time
+        if (!isActive() || m_streamId != 0) {
             return m_internData.soundState;
         }
         ALint state = 0;
@@ -884,11 +881,20 @@ namespace FIFE
             setCursor(SD_TIME_POS, time);
             if (m_soundClip && isActive()) {
                 m_internData.playTimestamp = TimeManager::instance()->now64() - timediff;
-                alSourcePlay(m_source);
+                playSource();
             }
         }
     }
 
+    void SoundEmitter::playSource()
+    {
+        if (m_streamId != 0) {
+            m_manager->getStreamer()->play(m_streamId);
+        } else {
+            alSourcePlay(m_source);
+        }
+    }
+
     void SoundEmitter::resetInternData()
     {
         m_internData.volume         = 1.0;
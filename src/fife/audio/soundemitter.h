@@ -48,6 +48,7 @@ namespace FIFE
     class SoundEffect;
     class SoundFilter;
     class SoundManager;
+    struct SoundStreamStatus;
 
     /** The class for playing audio files
      */
@@ -73,6 +74,10 @@ namespace FIFE
              */
             void update();
 
+            /** Called from the SoundManager for status messages of the stream worker.
+             */
+            void processStreamStatus(SoundStreamStatus const & status);
+
             /** Returns the emitter-id
              */
             uint32_t getId() const;
@@ -188,6 +193,11 @@ namespace FIFE
              */
             float getGain() const;
 
+            /** Returns the gain the emitter plays with once a running fade is done.
+             *  Used from the SoundManager to rank the emitters by audibility.
+             */
+            float getTargetGain() const;
+
             /** Sets the max. gain of the emitter
              *
              * @param gain The gain value. 0=silence ... 1.0=normal loudness.
@@ -315,6 +325,9 @@ namespace FIFE
             float getConeOuterGain() const;
 
             /** Returns the state of the audio file
+             *
+             * For streams this is the state set by the last play, pause or stop call,
+             * the stream worker reports the end of the stream.
              */
             SoundStateType getState() const;
 
@@ -397,6 +410,10 @@ namespace FIFE
              */
             void callOnSoundFinished();
 
+            /** Starts the source, or lets the stream worker start it.
+             */
+            void playSource();
+
             //! Access to the SoundManager
             SoundManager* m_manager;
             //! The openAL-source
@@ -407,8 +424,10 @@ namespace FIFE
             SoundClipPtr m_soundClip;
             //! Id of the attached sound clip
             uint32_t m_soundClipId;
-            //! The id of the stream
+            //! The id of the stream at the SoundStreamer, 0 if there is none
             uint32_t m_streamId;
+            //! Incremented by every seek of the stream
+            uint32_t m_streamSeek;
             //! The emitter-id
             uint32_t m_emitterId;
 
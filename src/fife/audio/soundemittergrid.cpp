@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Corresponding header include
+#include "soundemittergrid.h"
+
+// Standard C++ library includes
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// Platform specific includes
+
+// 3rd party library includes
+
+// FIFE includes
+
+namespace FIFE
+{
+    namespace
+    {
+        [[nodiscard]] uint64_t packCell(int32_t x, int32_t y)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32U) | static_cast<uint32_t>(y);
+        }
+
+        void eraseId(std::vector<uint32_t>& ids, uint32_t id)
+        {
+            auto it = std::ranges::find(ids, id);
+            if (it != ids.end()) {
+                *it = ids.back();
+                ids.pop_back();
+            }
+        }
+    } // namespace
+
+    SoundEmitterGrid::SoundEmitterGrid(double cellSize) : m_cellSize(1.0), m_size(0)
+    {
+        setCellSize(cellSize);
+    }
+
+    void SoundEmitterGrid::setCellSize(double cellSize)
+    {
+        double const size = (std::isfinite(cellSize) && cellSize > 0.0) ? cellSize : 1.0;
+        if (size == m_cellSize) {
+            return;
+        }
+        m_cellSize = size;
+        m_cells.clear();
+        for (size_t id = 0; id < m_entries.size(); ++id) {
+            Entry& entry = m_entries[id];
+            if (entry.used && !entry.global) {
+                entry.cell = toCell(entry.position);
+                link(static_cast<uint32_t>(id), entry);
+            }
+        }
+    }
+
+    double SoundEmitterGrid::getCellSize() const
+    {
+        return m_cellSize;
+    }
+
+    void SoundEmitterGrid::update(uint32_t id, AudioSpaceCoordinate const & position, bool global)
+    {
+        if (id >= m_entries.size()) {
+            m_entries.resize(static_cast<size_t>(id) + 1);
+        }
+        Entry& entry         = m_entries[id];
+        uint64_t const cell  = global ? 0 : toCell(position);
+        bool const unchanged = entry.used && entry.global == global && (global || entry.cell == cell);
+        entry.position       = position;
+        if (unchanged) {
+            return;
+        }
+        if (entry.used) {
+            unlink(id, entry);
+        } else {
+            entry.used = true;
+            ++m_size;
+        }
+        entry.global = global;
+        entry.cell   = cell;
+        link(id, entry);
+    }
+
+    void SoundEmitterGrid::remove(uint32_t id)
+    {
+        if (id >= m_entries.size() || !m_entries[id].used) {
+            return;
+        }
+        unlink(id, m_entries[id]);
+        m_entries[id] = Entry();
+        --m_size;
+    }
+
+    void SoundEmitterGrid::query(AudioSpaceCoordinate const & center, double radius, std::vector<uint32_t>& ids) const
+    {
+        ids.assign(m_global.begin(), m_global.end());
+        if (m_cells.empty()) {
+            return;
+        }
+
+        int32_t const minX = toCellCoord(center.x - radius);
+        int32_t const maxX = toCellCoord(center.x + radius);
+        int32_t const minY = toCellCoord(center.y - radius);
+        int32_t const maxY = toCellCoord(center.y + radius);
+
+        uint64_t const spanX = static_cast<uint64_t>(static_cast<int64_t>(maxX) - minX) + 1;
+        uint64_t const spanY = static_cast<uint64_t>(static_cast<int64_t>(maxY) - minY) + 1;
+        if (spanX * spanY > m_cells.size()) {
+            // the square covers more cells than are used, visit the used ones
+            for (auto const & [key, cell] : m_cells) {
+                auto const x = static_cast<int32_t>(static_cast<uint32_t>(key >> 32U));
+                auto const y = static_cast<int32_t>(static_cast<uint32_t>(key));
+                if (x >= minX && x <= maxX && y >= minY && y <= maxY) {
+                    ids.insert(ids.end(), cell.begin(), cell.end());
+                }
+            }
+            return;
+        }
+
+        for (int64_t x = minX; x <= maxX; ++x) {
+            for (int64_t y = minY; y <= maxY; ++y) {
+                auto it = m_cells.find(packCell(static_cast<int32_t>(x), static_cast<int32_t>(y)));
+                if (it != m_cells.end()) {
+                    ids.insert(ids.end(), it->second.begin(), it->second.end());
+                }
+            }
+        }
+    }
+
+    size_t SoundEmitterGrid::size() const
+    {
+        return m_size;
+    }
+
+    int32_t SoundEmitterGrid::toCellCoord(double value) const
+    {
+        double const cell = std::floor(value / m_cellSize);
+        if (!(cell > static_cast<double>(std::numeric_limits<int32_t>::min()))) {
+            return std::numeric_limits<int32_t>::min();
+        }
+        if (cell >= static_cast<double>(std::numeric_limits<int32_t>::max())) {
+            return std::numeric_limits<int32_t>::max();
+        }
+        return static_cast<int32_t>(cell);
+    }
+
+    uint64_t SoundEmitterGrid::toCell(AudioSpaceCoordinate const & position) const
+    {
+        return packCell(toCellCoord(position.x), toCellCoord(position.y));
+    }
+
+    void SoundEmitterGrid::link(uint32_t id, Entry const & entry)
+    {
+        if (entry.global) {
+            m_global.push_back(id);
+        } else {
+            m_cells[entry.cell].push_back(id);
+        }
+    }
+
+    void SoundEmitterGrid::unlink(uint32_t id, Entry const & entry)
+    {
+        if (entry.global) {
+            eraseId(m_global, id);
+            return;
+        }
+        auto it = m_cells.find(entry.cell);
+        if (it != m_cells.end()) {
+            eraseId(it->second, id);
+            if (it->second.empty()) {
+                m_cells.erase(it);
+            }
+        }
+    }
+} // namespace FIFE
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+#ifndef FIFE_SOUNDEMITTERGRID_H
+#define FIFE_SOUNDEMITTERGRID_H
+
+// Platform specific includes
+#include "platform.h"
+
+// Standard C++ library includes
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// 3rd party library includes
+
+// FIFE includes
+#include "model/metamodel/modelcoords.h"
+
+namespace FIFE
+{
+
+    /** Uniform grid over the x/y plane of the audio space, used by the SoundManager
+     * to find the emitters around the listener without visiting all of them.
+     *
+     * Emitters are identified by their emitter id. Global emitters (not positional
+     * or positioned relative to the listener) are not sorted into cells, every query
+     * returns them.
+     */
+    class FIFE_API SoundEmitterGrid
+    {
+        public:
+            explicit SoundEmitterGrid(double cellSize);
+
+            /** Sets the edge length of the cells and sorts all emitters in again.
+             */
+            void setCellSize(double cellSize);
+
+            /** Returns the edge length of the cells.
+             */
+            double getCellSize() const;
+
+            /** Adds the emitter or moves it to its new position.
+             *
+             * @param id The emitter id.
+             * @param position The position of the emitter, ignored for global emitters.
+             * @param global True if the emitter has to be returned by every query.
+             */
+            void update(uint32_t id, AudioSpaceCoordinate const & position, bool global);
+
+            /** Removes the emitter.
+             */
+            void remove(uint32_t id);
+
+            /** Collects the ids of all global emitters and of the emitters in the cells touched by
+             *  the square around center. The caller does the exact distance test.
+             *
+             * @param center The center of the query, usually the listener position.
+             * @param radius Half the edge length of the square.
+             * @param ids Cleared and filled with the emitter ids.
+             */
+            void query(AudioSpaceCoordinate const & center, double radius, std::vector<uint32_t>& ids) const;
+
+            /** Returns the number of emitters in the grid.
+             */
+            size_t size() const;
+
+        private:
+            struct Entry
+            {
+                    uint64_t cell{0};
+                    AudioSpaceCoordinate position;
+                    bool global{false};
+                    bool used{false};
+            };
+
+            using Cell = std::vector<uint32_t>;
+
+            int32_t toCellCoord(double value) const;
+            uint64_t toCell(AudioSpaceCoordinate const & position) const;
+            void link(uint32_t id, Entry const & entry);
+            void unlink(uint32_t id, Entry const & entry);
+
+            //! edge length of a cell
+            double m_cellSize;
+            //! entries by emitter id
+            std::vector<Entry> m_entries;
+            //! ids of the emitters in a cell, empty cells are removed
+            std::unordered_map<uint64_t, Cell> m_cells;
+            //! ids of the global emitters
+            Cell m_global;
+            //! number of used entries
+            size_t m_size;
+    };
+} // namespace FIFE
+
+#endif
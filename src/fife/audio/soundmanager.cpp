@@ -8,6 +8,8 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <cmath>
+#include <cstddef>
 #include <limits>
 #include <map>
 #include <memory>
@@ -23,8 +25,10 @@
 #include "audio/effects/soundeffectmanager.h"
 #include "soundclipmanager.h"
 #include "soundemitter.h"
+#include "soundstreamer.h"
 #include "util/base/exception.h"
 #include "util/log/logger.h"
+#include "util/time/profiler.h"
 #include "vfs/vfs.h"
 
 namespace FIFE
@@ -36,6 +40,43 @@ namespace FIFE
             static Logger log(LM_AUDIO);
             return log;
         }
+
+        /** Gain factor of the distance models, as OpenAL 1.1 computes it.
+         */
+        [[nodiscard]] float attenuation(SoundDistanceModelType model, SoundEmitter const & emitter, float distance)
+        {
+            float const ref     = emitter.getReferenceDistance();
+            float const rolloff = emitter.getRolloff();
+            float const maxDist = std::max(emitter.getMaxDistance(), ref);
+            switch (model) {
+            case SD_DISTANCE_INVERSE_CLAMPED:
+                distance = std::clamp(distance, ref, maxDist);
+                [[fallthrough]];
+            case SD_DISTANCE_INVERSE: {
+                float const denominator = ref + (rolloff * (distance - ref));
+                return denominator > 0.0F ? ref / denominator : 1.0F;
+            }
+            case SD_DISTANCE_LINEAR_CLAMPED:
+                distance = std::clamp(distance, ref, maxDist);
+                [[fallthrough]];
+            case SD_DISTANCE_LINEAR:
+                if (maxDist <= ref) {
+                    return 1.0F;
+                }
+                return std::clamp(1.0F - (rolloff * (distance - ref) / (maxDist - ref)), 0.0F, 1.0F);
+            case SD_DISTANCE_EXPONENT_CLAMPED:
+                distance = std::clamp(distance, ref, maxDist);
+                [[fallthrough]];
+            case SD_DISTANCE_EXPONENT:
+                if (ref <= 0.0F || distance <= 0.0F) {
+                    return 1.0F;
+                }
+                return std::pow(distance / ref, -rolloff);
+            case SD_DISTANCE_NONE:
+            default:
+                return 1.0F;
+            }
+        }
     } // namespace
 
     SoundManager::SoundManager() :
@@ -47,15 +88,19 @@ namespace FIFE
         m_distanceModel(SD_DISTANCE_INVERSE_CLAMPED),
         m_state(SM_STATE_INACTIV),
         m_sources(),
-        m_createdSources(0)
+        m_createdSources(0),
+        m_emitterGrid(static_cast<double>(m_maxDistance))
     {
     }
 
     SoundManager::~SoundManager()
     {
+        m_emitterVec.clear();
+        // joins the worker, it frees the buffers of the remaining streams
+        m_streamer.reset();
+
         // delete all sources
         alDeleteSources(m_createdSources, &m_sources[0]);
-        m_emitterVec.clear();
 
         if (m_device != nullptr) {
             alcDestroyContext(m_context);
@@ -113,7 +158,8 @@ namespace FIFE
             m_freeSources.push(m_source);
             m_createdSources++;
         }
-        m_state = SM_STATE_PLAY;
+        m_streamer = std::make_unique<SoundStreamer>();
+        m_state    = SM_STATE_PLAY;
     }
 
     bool SoundManager::isActive() const
@@ -126,6 +172,11 @@ namespace FIFE
         return m_context;
     }
 
+    SoundStreamer* SoundManager::getStreamer() const
+    {
+        return m_streamer.get();
+    }
+
     void SoundManager::setVolume(float vol)
     {
         m_volume  = vol;
@@ -323,6 +374,8 @@ namespace FIFE
     void SoundManager::setListenerMaxDistance(float distance)
     {
         m_maxDistance = distance;
+        // a query then touches at most 3x3 cells
+        m_emitterGrid.setCellSize(static_cast<double>(distance));
     }
 
     float SoundManager::getListenerMaxDistance() const
@@ -332,53 +385,124 @@ namespace FIFE
 
     void SoundManager::update()
     {
+        FIFE_PROFILE_ZONE("SoundManager::update");
+        // also while paused, released sources have to come back
+        processStreamStatus();
+
         if (m_state != SM_STATE_PLAY) {
             return;
         }
-        AudioSpaceCoordinate const listenerPos = getListenerPosition();
-        auto maxDistance                       = static_cast<double>(m_maxDistance);
 
-        // first check emitters
-        for (auto& emitter : m_emitterVec) {
-            if (emitter == nullptr) {
-                continue;
+        for (uint32_t const id : m_playChecks) {
+            if (id < m_emitterVec.size() && m_emitterVec[id]) {
+                m_emitterVec[id]->setCheckDifference();
             }
-            emitter->setCheckDifference();
-
-            bool const active = emitter->isActive();
-            bool const clip   = static_cast<bool>(emitter->getSoundClip());
-            bool const plays  = !emitter->isFinished();
-            // remove active without clip or stopped
-            if (!clip || !plays) {
-                if (active) {
-                    emitter->update();
-                    releaseSource(emitter.get());
-                }
+        }
+        m_playChecks.clear();
+
+        // remove active without clip or stopped
+        m_expiredEmitters.clear();
+        for (auto const & [emitter, source] : m_activeEmitters) {
+            if (!emitter->getSoundClip() || emitter->isFinished()) {
+                m_expiredEmitters.push_back(emitter);
+            }
+        }
+        for (SoundEmitter* emitter : m_expiredEmitters) {
+            emitter->update();
+            releaseSource(emitter);
+        }
+
+        collectAudibleEmitters();
+        assignSources();
+
+        // then update active
+        for (auto& m_activeEmitter : m_activeEmitters) {
+            m_activeEmitter.first->update();
+        }
+    }
+
+    uint32_t SoundManager::getActiveEmitterCount() const
+    {
+        return static_cast<uint32_t>(m_activeEmitters.size());
+    }
+
+    void SoundManager::collectAudibleEmitters()
+    {
+        AudioSpaceCoordinate const listenerPos = getListenerPosition();
+        auto const maxDistance                 = static_cast<double>(m_maxDistance);
+        double const maxDistanceSq             = maxDistance * maxDistance;
+
+        m_audibleEmitters.clear();
+        m_emitterGrid.query(listenerPos, maxDistance, m_gridResult);
+        for (uint32_t const id : m_gridResult) {
+            SoundEmitter* emitter = m_emitterVec[id].get();
+            if (!emitter->getSoundClip() || emitter->isFinished()) {
                 continue;
             }
 
-            bool inRange = true;
+            double distanceSq = 0.0;
             if (emitter->isPosition()) {
-                AudioSpaceCoordinate const emitterPos = emitter->getPosition();
-                double const rx                       = listenerPos.x - emitterPos.x;
-                double const ry                       = listenerPos.y - emitterPos.y;
-                double const rz                       = listenerPos.z - emitterPos.z;
-                inRange                               = maxDistance >= Mathd::Sqrt((rx * rx) + (ry * ry) + (rz * rz));
-            }
-            // remove active not in range
-            if (!inRange) {
-                if (active) {
-                    releaseSource(emitter.get());
+                AudioSpaceCoordinate const & emitterPos = emitter->getPosition();
+                // relative emitters are positioned around the listener
+                AudioSpaceCoordinate const origin =
+                    emitter->isRelativePositioning() ? AudioSpaceCoordinate(0.0, 0.0, 0.0) : listenerPos;
+                double const rx = origin.x - emitterPos.x;
+                double const ry = origin.y - emitterPos.y;
+                double const rz = origin.z - emitterPos.z;
+                distanceSq      = (rx * rx) + (ry * ry) + (rz * rz);
+                // remove not in range
+                if (distanceSq > maxDistanceSq) {
+                    continue;
                 }
-                continue;
             }
-            if (!active && !m_freeSources.empty()) {
-                setEmitterSource(emitter.get());
+
+            float priority = emitter->getTargetGain() *
+                             attenuation(m_distanceModel, *emitter, static_cast<float>(Mathd::Sqrt(distanceSq)));
+            if (emitter->isActive()) {
+                priority *= SOURCE_PRIORITY_HYSTERESIS;
             }
+            m_audibleEmitters.push_back(AudibleEmitter{.emitter = emitter, .priority = priority});
         }
-        // then update active
-        for (auto& m_activeEmitter : m_activeEmitters) {
-            m_activeEmitter.first->update();
+    }
+
+    void SoundManager::assignSources()
+    {
+        // the most audible first, ties are broken by id so the result does not depend on the grid order
+        auto const moreAudible = [](AudibleEmitter const & lhs, AudibleEmitter const & rhs) {
+            if (lhs.priority != rhs.priority) {
+                return lhs.priority > rhs.priority;
+            }
+            return lhs.emitter->getId() < rhs.emitter->getId();
+        };
+        size_t const sources = m_createdSources;
+        if (m_audibleEmitters.size() > sources) {
+            auto const last = m_audibleEmitters.begin() + static_cast<std::ptrdiff_t>(sources);
+            std::ranges::nth_element(m_audibleEmitters, last, moreAudible);
+            m_audibleEmitters.erase(last, m_audibleEmitters.end());
+        }
+        std::ranges::sort(m_audibleEmitters, moreAudible);
+
+        // virtualize active emitters that are out of range or less audible than others
+        m_expiredEmitters.clear();
+        for (auto const & [emitter, source] : m_activeEmitters) {
+            bool const keep = std::ranges::any_of(m_audibleEmitters, [emitter](AudibleEmitter const & audible) {
+                return audible.emitter == emitter;
+            });
+            if (!keep) {
+                m_expiredEmitters.push_back(emitter);
+            }
+        }
+        for (SoundEmitter* emitter : m_expiredEmitters) {
+            releaseSource(emitter);
+        }
+
+        for (AudibleEmitter const & audible : m_audibleEmitters) {
+            if (m_freeSources.empty()) {
+                break;
+            }
+            if (!audible.emitter->isActive()) {
+                setEmitterSource(audible.emitter);
+            }
         }
     }
 
@@ -406,6 +530,8 @@ namespace FIFE
             ptr             = newEmitter.get();
             m_emitterVec.push_back(std::move(newEmitter));
         }
+        // a new emitter is not positional until it gets a position
+        m_emitterGrid.update(ptr->getId(), AudioSpaceCoordinate(0.0, 0.0, 0.0), true);
         return ptr;
     }
 
@@ -423,6 +549,7 @@ namespace FIFE
             releaseSource(ptr.get());
         }
         ptr.reset();
+        m_emitterGrid.remove(emitterId);
     }
 
     void SoundManager::deleteEmitter(SoundEmitter* emitter) // cppcheck-suppress constParameterPointer
@@ -446,15 +573,49 @@ namespace FIFE
         if (emitter->isActive()) {
             auto it = m_activeEmitters.find(emitter);
             if (it != m_activeEmitters.end()) {
-                m_freeSources.push(it->second);
+                ALuint const source = it->second;
                 m_activeEmitters.erase(it);
                 emitter->setSource(0);
+                if (m_streamer) {
+                    // the worker may still be busy with a stream on it, reused once the worker answers
+                    m_streamer->releaseSource(source);
+                } else {
+                    m_freeSources.push(source);
+                }
             } else {
                 // FL_WARN(_log(), "SoundEmitter can not release source handler");
             }
         }
     }
 
+    void SoundManager::updateEmitterPosition(SoundEmitter const * emitter)
+    {
+        bool const global = !emitter->isPosition() || emitter->isRelativePositioning();
+        m_emitterGrid.update(emitter->getId(), emitter->getPosition(), global);
+    }
+
+    void SoundManager::addPlayCheck(SoundEmitter const * emitter)
+    {
+        m_playChecks.push_back(emitter->getId());
+    }
+
+    void SoundManager::processStreamStatus()
+    {
+        if (!m_streamer) {
+            return;
+        }
+        SoundStreamStatus status;
+        while (m_streamer->pollStatus(status)) {
+            if (status.type == SSS_SOURCE_RELEASED) {
+                m_freeSources.push(status.source);
+                continue;
+            }
+            if (status.emitter < m_emitterVec.size() && m_emitterVec.at(status.emitter)) {
+                m_emitterVec.at(status.emitter)->processStreamStatus(status);
+            }
+        }
+    }
+
     SoundEffect* SoundManager::createSoundEffect(SoundEffectType type)
     {
         if (!m_effectManager) {
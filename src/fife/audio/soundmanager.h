@@ -19,6 +19,7 @@
 #include "fife_openal.h"
 #include "model/metamodel/modelcoords.h"
 #include "soundconfig.h"
+#include "soundemittergrid.h"
 #include "util/base/singleton.h"
 
 namespace FIFE
@@ -51,6 +52,7 @@ namespace FIFE
     class SoundEffect;
     class SoundFilter;
     class SoundEmitter;
+    class SoundStreamer;
 
     class FIFE_API SoundManager : public DynamicSingleton<SoundManager>
     {
@@ -74,6 +76,10 @@ namespace FIFE
              */
             ALCcontext* getContext() const;
 
+            /** Returns the worker that feeds streaming emitters, nullptr if the audio module is inactive.
+             */
+            SoundStreamer* getStreamer() const;
+
             /** Sets the Master Volume
              *
              * @param vol The volume value. 0=silence ... 1.0=normal loudness.
@@ -150,6 +156,7 @@ namespace FIFE
 
             /** Sets the maximal listener distance.
              *  If it is larger the emitter turns off, or on if it is smaller.
+             *  Also the cell size of the grid that finds the emitters around the listener.
              */
             void setListenerMaxDistance(float distance);
 
@@ -158,9 +165,18 @@ namespace FIFE
             float getListenerMaxDistance() const;
 
             /** Called once a frame and updates the sound objects.
+             *
+             * Only emitters in range of the listener are visited. If they are more than
+             * sources exist, the most audible ones (gain times distance attenuation) get
+             * the sources. The others stay virtual, they keep their play timestamp and
+             * continue at the right position once they get a source again.
              */
             void update();
 
+            /** Returns the number of emitters that currently hold an OpenAL source.
+             */
+            uint32_t getActiveEmitterCount() const;
+
             /** Returns a pointer to an emitter-instance given by emitterId
              *
              * @param emitterId The id of the Emitter
@@ -196,6 +212,20 @@ namespace FIFE
              */
             void releaseSource(SoundEmitter* emitter);
 
+            /** Sorts the emitter into the emitter grid again.
+             *  Called from the emitter after its position or positioning type changed.
+             *
+             * @param emitter The emitter-instance.
+             */
+            void updateEmitterPosition(SoundEmitter const * emitter);
+
+            /** Lets the next update() measure the time between play and the first check.
+             *  Called from the emitter after a play() call.
+             *
+             * @param emitter The emitter-instance.
+             */
+            void addPlayCheck(SoundEmitter const * emitter);
+
             /** Creates SoundEffect of the specific type.
              * @param type See SoundEffectType
              */
@@ -358,6 +388,25 @@ namespace FIFE
              */
             void setEmitterSource(SoundEmitter* emitter);
 
+            /** Passes the status messages of the stream worker to the emitters.
+             */
+            void processStreamStatus();
+
+            /** Collects the playing emitters in range of the listener together with their audibility.
+             */
+            void collectAudibleEmitters();
+
+            /** Gives the sources to the most audible emitters, the others are released.
+             */
+            void assignSources();
+
+            //! Playing emitter in range of the listener, see collectAudibleEmitters()
+            struct AudibleEmitter
+            {
+                    SoundEmitter* emitter;
+                    float priority;
+            };
+
             //! emitter-vector, holds all emitters
             std::vector<std::unique_ptr<SoundEmitter>> m_emitterVec;
             //! OpenAL context
@@ -383,8 +432,18 @@ namespace FIFE
             std::queue<ALuint> m_freeSources;
             //! Map that holds active Emitters together with the used source handle
             std::map<SoundEmitter*, ALuint> m_activeEmitters;
+            //! Finds the emitters in range of the listener
+            SoundEmitterGrid m_emitterGrid;
+            //! Ids of emitters that were played since the last update
+            std::vector<uint32_t> m_playChecks;
+            //! Per frame buffers, kept to avoid allocations
+            std::vector<uint32_t> m_gridResult;
+            std::vector<AudibleEmitter> m_audibleEmitters;
+            std::vector<SoundEmitter*> m_expiredEmitters;
 
             std::unique_ptr<SoundEffectManager> m_effectManager;
+            //! Refills the buffers of streaming emitters
+            std::unique_ptr<SoundStreamer> m_streamer;
 
             //! A map that holds the groups together with the appended emitters.
             EmitterGroups m_groups;
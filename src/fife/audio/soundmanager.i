@@ -178,6 +178,9 @@ namespace FIFE {
 		void setListenerMaxDistance(float distance);
 		float getListenerMaxDistance() const;
 
+		void update();
+		uint32_t getActiveEmitterCount() const;
+
 		SoundEffect* createSoundEffect(SoundEffectType  type);
 		SoundEffect* createSoundEffectPreset(SoundEffectPreset type);
 		void deleteSoundEffect(SoundEffect* effect);
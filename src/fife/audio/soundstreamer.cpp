@@ -0,0 +1,386 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Corresponding header include
+#include "soundstreamer.h"
+
+// Standard C++ library includes
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Platform specific includes
+
+// 3rd party library includes
+
+// FIFE includes
+
+namespace FIFE
+{
+    namespace
+    {
+        [[nodiscard]] ALsizei toOpenALSize(uint64_t const value)
+        {
+            assert(value <= static_cast<uint64_t>(std::numeric_limits<ALsizei>::max()));
+            return static_cast<ALsizei>(value);
+        }
+
+        constexpr auto BUFFER_COUNT = static_cast<uint32_t>(BUFFER_NUM);
+    } // namespace
+
+    SoundStreamer::SoundStreamer() : m_lastStream(0), m_running(true)
+    {
+        m_thread = std::thread(&SoundStreamer::run, this);
+    }
+
+    SoundStreamer::~SoundStreamer()
+    {
+        m_running.store(false, std::memory_order_release);
+        wake();
+        if (m_thread.joinable()) {
+            m_thread.join();
+        }
+    }
+
+    uint32_t SoundStreamer::open(uint32_t emitter, ALuint source, std::unique_ptr<SoundDecoder> decoder, bool loop)
+    {
+        assert(decoder);
+        // 0 is reserved for "no stream"
+        if (++m_lastStream == 0) {
+            ++m_lastStream;
+        }
+        send(SoundStreamCommand{
+            .type     = SSC_OPEN,
+            .stream   = m_lastStream,
+            .emitter  = emitter,
+            .source   = source,
+            .seek     = 0,
+            .position = 0,
+            .flag     = loop,
+            .decoder  = decoder.release()});
+        return m_lastStream;
+    }
+
+    void SoundStreamer::close(uint32_t stream)
+    {
+        send(SoundStreamCommand{.type = SSC_CLOSE, .stream = stream});
+    }
+
+    void SoundStreamer::play(uint32_t stream)
+    {
+        send(SoundStreamCommand{.type = SSC_PLAY, .stream = stream});
+    }
+
+    void SoundStreamer::pause(uint32_t stream)
+    {
+        send(SoundStreamCommand{.type = SSC_PAUSE, .stream = stream});
+    }
+
+    void SoundStreamer::stop(uint32_t stream)
+    {
+        send(SoundStreamCommand{.type = SSC_STOP, .stream = stream});
+    }
+
+    void SoundStreamer::seek(uint32_t stream, uint64_t position, uint32_t seek)
+    {
+        send(SoundStreamCommand{.type = SSC_SEEK, .stream = stream, .seek = seek, .position = position});
+    }
+
+    void SoundStreamer::setLooping(uint32_t stream, bool loop)
+    {
+        send(SoundStreamCommand{.type = SSC_LOOP, .stream = stream, .flag = loop});
+    }
+
+    void SoundStreamer::releaseSource(ALuint source)
+    {
+        send(SoundStreamCommand{.type = SSC_RELEASE_SOURCE, .source = source});
+    }
+
+    bool SoundStreamer::pollStatus(SoundStreamStatus& status)
+    {
+        return m_status.pop(status);
+    }
+
+    void SoundStreamer::send(SoundStreamCommand const & command)
+    {
+        while (!m_commands.push(command)) {
+            wake();
+            std::this_thread::yield();
+        }
+        wake();
+    }
+
+    void SoundStreamer::wake()
+    {
+        // the worker tests its predicate under the mutex, notifying under it too means it either
+        // sees the new state or is already waiting and gets the notification, no wakeup is lost
+        std::scoped_lock const lock(m_wakeMutex);
+        m_wake.notify_one();
+    }
+
+    void SoundStreamer::run()
+    {
+        while (m_running.load(std::memory_order_acquire)) {
+            processCommands();
+            for (auto& stream : m_streams) {
+                service(*stream);
+            }
+            flushStatus();
+
+            std::unique_lock<std::mutex> lock(m_wakeMutex);
+            m_wake.wait_for(lock, std::chrono::milliseconds(STREAM_POLL_INTERVAL), [this] {
+                return !m_commands.empty() || !m_running.load(std::memory_order_acquire);
+            });
+        }
+
+        // take over the decoders of commands sent during shutdown, then free everything
+        processCommands();
+        for (auto& stream : m_streams) {
+            closeStream(*stream);
+        }
+        m_streams.clear();
+    }
+
+    void SoundStreamer::processCommands()
+    {
+        SoundStreamCommand command;
+        while (m_commands.pop(command)) {
+            execute(command);
+        }
+    }
+
+    void SoundStreamer::execute(SoundStreamCommand const & command)
+    {
+        if (command.type == SSC_OPEN) {
+            auto stream = std::make_unique<Stream>();
+            stream->id         = command.stream;
+            stream->emitter    = command.emitter;
+            stream->source     = command.source;
+            stream->seek       = command.seek;
+            stream->decoder.reset(command.decoder);
+            stream->cursor     = 0;
+            stream->frameBytes = static_cast<uint32_t>(stream->decoder->getBitResolution() / 8) *
+                                 (stream->decoder->isStereo() ? 2U : 1U);
+            stream->loop       = command.flag;
+            stream->playing    = false;
+            stream->eof        = false;
+
+            // alGetError() would read and clear the error state the main thread shares with the worker,
+            // a failed alGenBuffers() leaves the names at 0 instead
+            stream->buffers.fill(0);
+            alGenBuffers(BUFFER_NUM, stream->buffers.data());
+            if (std::ranges::find(stream->buffers, 0U) != stream->buffers.end()) {
+                post(SoundStreamStatus{
+                    .type = SSS_ERROR, .stream = stream->id, .emitter = stream->emitter, .source = stream->source});
+                return;
+            }
+            stream->idle      = stream->buffers;
+            stream->idleCount = BUFFER_COUNT;
+            // looping is done by rewinding the decoder, the source only sees an endless queue
+            alSourcei(stream->source, AL_LOOPING, AL_FALSE);
+            m_streams.push_back(std::move(stream));
+            return;
+        }
+
+        if (command.type == SSC_RELEASE_SOURCE) {
+            post(SoundStreamStatus{.type = SSS_SOURCE_RELEASED, .source = command.source});
+            return;
+        }
+
+        Stream* stream = findStream(command.stream);
+        if (stream == nullptr) {
+            return;
+        }
+
+        switch (command.type) {
+        case SSC_CLOSE: {
+            closeStream(*stream);
+            auto it = std::ranges::find_if(m_streams, [stream](auto const & entry) {
+                return entry.get() == stream;
+            });
+            m_streams.erase(it);
+            break;
+        }
+        case SSC_PLAY:
+            stream->playing = true;
+            prime(*stream);
+            alSourcePlay(stream->source);
+            break;
+        case SSC_PAUSE:
+            stream->playing = false;
+            alSourcePause(stream->source);
+            break;
+        case SSC_STOP:
+            stream->playing = false;
+            alSourceStop(stream->source);
+            break;
+        case SSC_SEEK: {
+            ALint state = 0;
+            alGetSourcei(stream->source, AL_SOURCE_STATE, &state);
+            alSourceStop(stream->source);
+            // detach all buffers, they are refilled from the new position
+            alSourcei(stream->source, AL_BUFFER, 0);
+            stream->idle      = stream->buffers;
+            stream->idleCount = BUFFER_COUNT;
+            stream->seek      = command.seek;
+            rewindDecoder(*stream, command.position);
+            prime(*stream);
+            if (state == AL_PLAYING) {
+                alSourcePlay(stream->source);
+            }
+            break;
+        }
+        case SSC_LOOP:
+            stream->loop = command.flag;
+            if (stream->loop && stream->eof) {
+                rewindDecoder(*stream, 0);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    void SoundStreamer::service(Stream& stream)
+    {
+        // asked first: once stopped, every buffer counted below has been played
+        ALint state = 0;
+        alGetSourcei(stream.source, AL_SOURCE_STATE, &state);
+
+        ALint processed = 0;
+        alGetSourcei(stream.source, AL_BUFFERS_PROCESSED, &processed);
+
+        float samples = 0.0F;
+        while ((processed--) > 0 && stream.idleCount < BUFFER_COUNT) {
+            ALuint buffer = 0;
+            alSourceUnqueueBuffers(stream.source, 1, &buffer);
+
+            ALint size = 0;
+            alGetBufferi(buffer, AL_SIZE, &size);
+            samples += static_cast<float>(size) / static_cast<float>(stream.frameBytes);
+
+            stream.idle.at(stream.idleCount++) = buffer;
+        }
+        if (samples > 0.0F) {
+            post(SoundStreamStatus{
+                .type    = SSS_PROCESSED,
+                .stream  = stream.id,
+                .emitter = stream.emitter,
+                .source  = stream.source,
+                .seek    = stream.seek,
+                .samples = samples});
+        }
+
+        prime(stream);
+
+        if (stream.playing) {
+            if (state == AL_STOPPED) {
+                ALint queued = 0;
+                alGetSourcei(stream.source, AL_BUFFERS_QUEUED, &queued);
+                if (queued > 0) {
+                    // all buffers ran out before they could be refilled, continue with the new ones
+                    alSourcePlay(stream.source);
+                } else {
+                    stream.playing = false;
+                    post(SoundStreamStatus{
+                        .type    = SSS_FINISHED,
+                        .stream  = stream.id,
+                        .emitter = stream.emitter,
+                        .source  = stream.source,
+                        .seek    = stream.seek});
+                }
+            }
+        }
+    }
+
+    void SoundStreamer::prime(Stream& stream)
+    {
+        while (stream.idleCount > 0) {
+            ALuint const buffer = stream.idle.at(stream.idleCount - 1);
+            if (!refill(stream, buffer)) {
+                break;
+            }
+            alSourceQueueBuffers(stream.source, 1, &buffer);
+            --stream.idleCount;
+        }
+    }
+
+    bool SoundStreamer::refill(Stream& stream, ALuint buffer)
+    {
+        SoundDecoder* decoder = stream.decoder.get();
+        if (stream.cursor >= decoder->getDecodedLength() && stream.loop && !stream.eof) {
+            // play again from the beginning
+            rewindDecoder(stream, 0);
+        }
+        if (stream.eof || stream.cursor >= decoder->getDecodedLength()) {
+            stream.eof = true;
+            return false;
+        }
+
+        if (decoder->decode(BUFFER_LEN)) {
+            stream.eof = true;
+            post(SoundStreamStatus{
+                .type = SSS_ERROR, .stream = stream.id, .emitter = stream.emitter, .source = stream.source});
+            return false;
+        }
+
+        alBufferData(
+            buffer,
+            decoder->getALFormat(),
+            decoder->getBuffer(),
+            toOpenALSize(decoder->getBufferSize()),
+            toOpenALSize(decoder->getSampleRate()));
+        stream.cursor += decoder->getBufferSize();
+        decoder->releaseBuffer();
+        return true;
+    }
+
+    void SoundStreamer::rewindDecoder(Stream& stream, uint64_t position)
+    {
+        uint64_t const length = stream.decoder->getDecodedLength();
+        stream.cursor         = std::min(position, length);
+        stream.eof            = false;
+        if (stream.cursor < length && !stream.decoder->setCursor(stream.cursor)) {
+            stream.eof = true;
+        }
+    }
+
+    void SoundStreamer::closeStream(Stream& stream)
+    {
+        alSourceStop(stream.source);
+        alSourcei(stream.source, AL_BUFFER, 0);
+        alDeleteBuffers(BUFFER_NUM, stream.buffers.data());
+        stream.decoder.reset();
+    }
+
+    SoundStreamer::Stream* SoundStreamer::findStream(uint32_t stream)
+    {
+        auto it = std::ranges::find_if(m_streams, [stream](auto const & entry) {
+            return entry->id == stream;
+        });
+        return it != m_streams.end() ? it->get() : nullptr;
+    }
+
+    void SoundStreamer::post(SoundStreamStatus const & status)
+    {
+        // keep the order, nothing may overtake the backlog
+        if (!m_pendingStatus.empty() || !m_status.push(status)) {
+            m_pendingStatus.push_back(status);
+        }
+    }
+
+    void SoundStreamer::flushStatus()
+    {
+        auto it = m_pendingStatus.begin();
+        while (it != m_pendingStatus.end() && m_status.push(*it)) {
+            ++it;
+        }
+        m_pendingStatus.erase(m_pendingStatus.begin(), it);
+    }
+} // namespace FIFE
@@ -0,0 +1,217 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+#ifndef FIFE_SOUNDSTREAMER_H
+#define FIFE_SOUNDSTREAMER_H
+
+// Platform specific includes
+#include "platform.h"
+
+// Standard C++ library includes
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// 3rd party library includes
+
+// FIFE includes
+#include "fife_openal.h"
+#include "soundconfig.h"
+#include "sounddecoder.h"
+#include "util/structures/spscqueue.h"
+
+namespace FIFE
+{
+
+    /** Commands sent from the main thread to the SoundStreamer worker
+     */
+    enum SoundStreamCommandType : uint8_t
+    {
+        SSC_OPEN,
+        SSC_CLOSE,
+        SSC_PLAY,
+        SSC_PAUSE,
+        SSC_STOP,
+        SSC_SEEK,
+        SSC_LOOP,
+        SSC_RELEASE_SOURCE
+    };
+
+    /** Status messages sent from the SoundStreamer worker to the main thread
+     */
+    enum SoundStreamStatusType : uint8_t
+    {
+        //! Buffers of the stream have been played, samples holds their length
+        SSS_PROCESSED,
+        //! A non looping stream played its last buffer
+        SSS_FINISHED,
+        //! The stream could not be decoded any further or got no buffers
+        SSS_ERROR,
+        //! The source is no longer touched by the worker and can be reused
+        SSS_SOURCE_RELEASED
+    };
+
+    struct SoundStreamCommand
+    {
+            SoundStreamCommandType type{SSC_OPEN};
+            uint32_t stream{0};
+            uint32_t emitter{0};
+            ALuint source{0};
+            //! Seek generation, echoed in the status messages of this stream
+            uint32_t seek{0};
+            //! Byte position for SSC_SEEK
+            uint64_t position{0};
+            //! Looping for SSC_OPEN and SSC_LOOP
+            bool flag{false};
+            //! Decoder for SSC_OPEN, the worker takes ownership
+            SoundDecoder* decoder{nullptr};
+    };
+
+    struct SoundStreamStatus
+    {
+            SoundStreamStatusType type{SSS_PROCESSED};
+            uint32_t stream{0};
+            uint32_t emitter{0};
+            ALuint source{0};
+            uint32_t seek{0};
+            float samples{0.0F};
+    };
+
+    /** Background worker that keeps the buffers of streaming sources filled.
+     *
+     * Every stream owns its decoder and OpenAL buffers. Once a stream is opened
+     * the worker is the only one queuing buffers on its source, the main thread
+     * controls it by commands and learns about its progress by status messages.
+     * Both travel through lock-free single producer / single consumer queues,
+     * so neither side ever waits for the other and a long frame on the main
+     * thread does not let a stream run dry.
+     *
+     * Sources are handed back by SSC_RELEASE_SOURCE. The worker answers with
+     * SSS_SOURCE_RELEASED once it finished all earlier commands, only then the
+     * source may be given to another emitter.
+     *
+     * OpenAL keeps one error state per context and the worker shares the
+     * context of the main thread, so the worker never calls alGetError().
+     * It reports its failures through SSS_ERROR only.
+     */
+    class FIFE_API SoundStreamer
+    {
+        public:
+            SoundStreamer();
+
+            ~SoundStreamer();
+
+            SoundStreamer(SoundStreamer const &)            = delete;
+            SoundStreamer& operator=(SoundStreamer const &) = delete;
+
+            /** Starts streaming on source, the stream is primed but not played.
+             *
+             * @param emitter Id of the emitter, returned with every status message.
+             * @param source The OpenAL source, owned by the worker until the stream is closed.
+             * @param decoder Decoder for this stream only, see SoundClip::createStreamDecoder().
+             * @param loop Restart the stream when it reaches the end.
+             * @return The stream id, never 0.
+             */
+            uint32_t open(uint32_t emitter, ALuint source, std::unique_ptr<SoundDecoder> decoder, bool loop);
+
+            /** Stops the stream and frees its buffers and decoder.
+             */
+            void close(uint32_t stream);
+
+            void play(uint32_t stream);
+            void pause(uint32_t stream);
+            void stop(uint32_t stream);
+
+            /** Moves the stream to the given byte position.
+             * @param seek New seek generation, status messages older than it are stale.
+             */
+            void seek(uint32_t stream, uint64_t position, uint32_t seek);
+
+            void setLooping(uint32_t stream, bool loop);
+
+            /** Queues the release of a source, see SSS_SOURCE_RELEASED.
+             */
+            void releaseSource(ALuint source);
+
+            /** Returns the next status message from the worker.
+             * @return False if there is none.
+             */
+            bool pollStatus(SoundStreamStatus& status);
+
+        private:
+            struct Stream
+            {
+                    uint32_t id;
+                    uint32_t emitter;
+                    ALuint source;
+                    uint32_t seek;
+                    std::unique_ptr<SoundDecoder> decoder;
+                    std::array<ALuint, BUFFER_NUM> buffers;
+                    // buffers that are not queued on the source
+                    std::array<ALuint, BUFFER_NUM> idle;
+                    uint32_t idleCount;
+                    uint64_t cursor;
+                    // frame size for converting buffer sizes to samples
+                    uint32_t frameBytes;
+                    bool loop;
+                    bool playing;
+                    bool eof;
+            };
+
+            using CommandQueue = SpscQueue<SoundStreamCommand, 1024>;
+            using StatusQueue  = SpscQueue<SoundStreamStatus, 1024>;
+
+            /** Pushes a command, waits only if the worker is a full queue behind.
+             */
+            void send(SoundStreamCommand const & command);
+
+            /** Wakes the worker up, see run().
+             */
+            void wake();
+
+            void run();
+            void processCommands();
+            void execute(SoundStreamCommand const & command);
+            void service(Stream& stream);
+
+            /** Fills as many idle buffers as possible and queues them on the source.
+             */
+            void prime(Stream& stream);
+
+            /** Decodes the next part of the stream into buffer.
+             * @return False if nothing was decoded (EOF or error).
+             */
+            bool refill(Stream& stream, ALuint buffer);
+
+            /** Moves the decoder of the stream, the next refill starts at position.
+             */
+            void rewindDecoder(Stream& stream, uint64_t position);
+            void closeStream(Stream& stream);
+            Stream* findStream(uint32_t stream);
+            void post(SoundStreamStatus const & status);
+            void flushStatus();
+
+            //! main thread -> worker
+            CommandQueue m_commands;
+            //! worker -> main thread
+            StatusQueue m_status;
+            //! status messages that did not fit into m_status yet, worker only
+            std::vector<SoundStreamStatus> m_pendingStatus;
+            //! streams, worker only
+            std::vector<std::unique_ptr<Stream>> m_streams;
+            //! last handed out stream id, main thread only
+            uint32_t m_lastStream;
+
+            std::atomic<bool> m_running;
+            std::mutex m_wakeMutex;
+            std::condition_variable m_wake;
+            std::thread m_thread;
+    };
+} // namespace FIFE
+
+#endif
@@ -6,6 +6,7 @@
 
 // Standard C++ library includes
 #include <algorithm>
+#include <chrono>
 #include <format>
 #include <iostream>
 #include <memory>
@@ -21,10 +22,13 @@
 #include "audio/soundclipmanager.h"
 #include "audio/soundmanager.h"
 #include "eventchannel/eventmanager.h"
+#include "eventchannel/eventrecording.h"
 #include "gui/fifechan/fifechanmanager.h"
 #include "gui/guimanager.h"
 #include "util/base/exception.h"
+#include "util/base/jobpool.h"
 #include "util/log/logger.h"
+#include "util/time/profiler.h"
 #include "util/time/timemanager.h"
 #include "vfs/directoryprovider.h"
 #include "vfs/filesystemassetprovider.h"
@@ -175,6 +179,10 @@ namespace FIFE
         FL_LOG(_log(), "================== Engine initialize start =================");
         m_timemanager = std::make_unique<TimeManager>();
         FL_LOG(_log(), "Time manager created");
+        m_profiler = std::make_unique<Profiler>();
+        FL_LOG(_log(), "Profiler created");
+        m_jobpool = std::make_unique<JobPool>(m_settings.getJobThreads());
+        FL_LOG(_log(), std::format("Job pool created with {} worker threads", m_jobpool->getWorkerCount()));
 
         FL_LOG(_log(), "Creating VFS");
         m_vfs = std::make_unique<VFS>();
@@ -475,6 +483,16 @@ namespace FIFE
 
     void Engine::pump()
     {
+        using Clock        = std::chrono::steady_clock;
+        auto const elapsed = [](Clock::time_point from, Clock::time_point to) {
+            return std::chrono::duration<double, std::milli>(to - from).count();
+        };
+        Clock::time_point const start = Clock::now();
+        if (Profiler::isEnabled()) {
+            m_profiler->beginFrame();
+        }
+        FIFE_PROFILE_ZONE("Engine::pump");
+
         if (m_eventmanager) {
             bool const f11down = m_eventmanager->isKeyPressed(Keys::F11);
             if (f11down && !m_lastF11State) {
@@ -495,23 +513,102 @@ namespace FIFE
         if (m_window != nullptr) {
             m_window->updateDPIScaleIfNeeded();
         }
+        Clock::time_point const events = Clock::now();
+
+        if (m_replay != nullptr) {
+            size_t const frame = m_eventmanager->getReplayedFrameCount();
+            if (frame > 0 && frame <= m_replay->getFrameCount()) {
+                // the first frame of a recording has no delta, the clock has to move on anyway
+                m_timemanager->setFixedTimeDelta(std::max<uint64_t>(m_replay->getFrame(frame - 1).timeDelta, 1));
+            }
+        }
         m_timemanager->update();
+        if (m_recording != nullptr) {
+            m_recording->setTimeDelta(m_timemanager->getTimeDelta64());
+        }
+        if (m_replay != nullptr && m_eventmanager->getReplayedFrameCount() >= m_replay->getFrameCount()) {
+            stopReplay();
+        }
+        Clock::time_point const time = Clock::now();
+
         m_soundmanager->update();
+        Clock::time_point const audio = Clock::now();
 
         m_targetrenderer->render();
-        if (m_model->getActiveCameraCount() == 0) {
+        Clock::time_point const target = Clock::now();
+        double cameraRenderList         = 0.0;
+        double cameraRender             = 0.0;
+        bool const offscreen            = m_model->getActiveCameraCount() == 0;
+        if (offscreen) {
             m_renderbackend->clearBackBuffer();
             m_offrenderer->render();
         } else {
             m_model->update();
+            cameraRenderList = m_model->getRenderListTime();
+            cameraRender     = m_model->getRenderTime();
         }
+        Clock::time_point const model = Clock::now();
 
         if (m_guimanager != nullptr) {
             m_guimanager->turn();
         }
+        Clock::time_point const gui = Clock::now();
 
         m_cursor->draw();
         m_renderbackend->endFrame();
+        Clock::time_point const end = Clock::now();
+
+        double const modelTime = elapsed(target, model);
+        if (offscreen) {
+            cameraRender = modelTime;
+        }
+        m_frameStats.events     = elapsed(start, events);
+        m_frameStats.time       = elapsed(events, time);
+        m_frameStats.audio      = elapsed(time, audio);
+        m_frameStats.model      = offscreen ? 0.0 : std::max(modelTime - cameraRenderList - cameraRender, 0.0);
+        m_frameStats.renderList = cameraRenderList;
+        m_frameStats.render     = elapsed(audio, target) + cameraRender + elapsed(gui, end);
+        m_frameStats.gui        = elapsed(model, gui);
+        m_frameStats.total      = elapsed(start, end);
+    }
+
+    void Engine::startRecording()
+    {
+        m_recording = std::make_unique<EventRecording>();
+        m_eventmanager->setRecording(m_recording.get());
+    }
+
+    bool Engine::stopRecording(std::string const & filename)
+    {
+        if (m_recording == nullptr) {
+            return false;
+        }
+        m_eventmanager->setRecording(nullptr);
+        bool const saved = m_recording->save(filename);
+        m_recording.reset();
+        return saved;
+    }
+
+    bool Engine::startReplay(std::string const & filename)
+    {
+        auto replay = std::make_unique<EventRecording>();
+        if (!replay->load(filename)) {
+            return false;
+        }
+        m_replay = std::move(replay);
+        m_eventmanager->setReplay(m_replay.get());
+        FL_LOG(_log(), std::format("Replaying {} frames from {}", m_replay->getFrameCount(), filename));
+        return true;
+    }
+
+    void Engine::stopReplay()
+    {
+        if (m_replay == nullptr) {
+            return;
+        }
+        m_eventmanager->setReplay(nullptr);
+        m_timemanager->setFixedTimeDelta(0);
+        m_replay.reset();
     }
 
     void Engine::finalizePumping()
@@ -31,12 +31,15 @@ namespace FIFE
 
     class SoundManager;
     class RenderBackend;
+    class EventRecording;
     class IGUIManager;
     class Window;
     class VFS;
     class VFSSourceFactory;
     class EventManager;
     class TimeManager;
+    class Profiler;
+    class JobPool;
     class Model;
     class LogManager;
     class Cursor;
@@ -65,6 +68,25 @@ namespace FIFE
             }
     };
 
+    /** Durations of the phases of a pump() call in milliseconds.
+     */
+    struct FIFE_API EngineFrameStats
+    {
+            //! input events and window updates
+            double events{0.0};
+            //! TimeManager update and the time events
+            double time{0.0};
+            double audio{0.0};
+            //! Model update without the parts of the cameras
+            double model{0.0};
+            //! render list build of the cameras
+            double renderList{0.0};
+            //! cameras, off and target renderer, cursor and the end of the frame
+            double render{0.0};
+            double gui{0.0};
+            double total{0.0};
+    };
+
     /** Engine acts as a controller to the whole system
      * Responsibilities of the engine are:
      *  - Construct and initialize engine internals
@@ -124,6 +146,44 @@ namespace FIFE
              */
             void pump();
 
+            /** Returns how long the phases of the last pump() call took.
+             */
+            EngineFrameStats const & getFrameStats() const
+            {
+                return m_frameStats;
+            }
+
+            /** Starts recording the input events and time deltas of every pump() call.
+             */
+            void startRecording();
+
+            /** Stops recording and writes the recording to a file.
+             *
+             * @return False if nothing was recorded or the file could not be written.
+             */
+            bool stopRecording(std::string const & filename);
+
+            /** Replays a recording made by startRecording().
+             *
+             * Every pump() call dispatches the input events of the next recorded frame
+             * and advances the time by its recorded delta, the real input is ignored.
+             * The replay stops by itself after the last frame.
+             *
+             * @return False if the recording could not be loaded.
+             */
+            bool startReplay(std::string const & filename);
+
+            /** Stops the replay, input and time come from SDL again.
+             */
+            void stopReplay();
+
+            /** Returns true while a replay is running.
+             */
+            bool isReplaying() const
+            {
+                return m_replay != nullptr;
+            }
+
             /** Provides access point to the SoundManager
              */
             SoundManager* getSoundManager() const
@@ -145,6 +205,13 @@ namespace FIFE
                 return m_timemanager.get();
             }
 
+            /** Provides access point to the Profiler
+             */
+            Profiler* getProfiler() const
+            {
+                return m_profiler.get();
+            }
+
             /** Sets the GUI Manager to use.  Engine takes
              * ownership of the manager so DONT DELETE IT!
              */
@@ -267,6 +334,8 @@ namespace FIFE
             std::unique_ptr<EventManager> m_eventmanager;
             std::unique_ptr<SoundManager> m_soundmanager;
             std::unique_ptr<TimeManager> m_timemanager;
+            std::unique_ptr<Profiler> m_profiler;
+            std::unique_ptr<JobPool> m_jobpool;
             std::unique_ptr<ImageManager> m_imagemanager;
             std::unique_ptr<AnimationManager> m_animationmanager;
             std::unique_ptr<SoundClipManager> m_soundclipmanager;
@@ -290,6 +359,10 @@ namespace FIFE
 
             std::vector<IEngineChangeListener*> m_changelisteners;
 
+            EngineFrameStats m_frameStats;
+            std::unique_ptr<EventRecording> m_recording;
+            std::unique_ptr<EventRecording> m_replay;
+
 #ifdef USE_COCOA
             id m_autoreleasePool;
 #endif
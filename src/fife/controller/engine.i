@@ -16,6 +16,7 @@ namespace FIFE {
 	class SoundManager;
 	class EventManager;
 	class TimeManager;
+	class Profiler;
 	class IGUIManager;
 	class RenderBackend;
 	class Model;
@@ -118,11 +119,24 @@ namespace FIFE {
 		bool isNativeImageCursorEnabled() const;
 		void setJoystickSupport(bool support);
 		bool isJoystickSupport() const;
+		void setJobThreads(uint32_t threads);
+		uint32_t getJobThreads() const;
 
 	private:
 		EngineSettings();
 	};	
 	
+	struct EngineFrameStats {
+		double events;
+		double time;
+		double audio;
+		double model;
+		double renderList;
+		double render;
+		double gui;
+		double total;
+	};
+
 	%feature("director") IEngineChangeListener;
 	class IEngineChangeListener {
 	public:
@@ -138,6 +152,12 @@ namespace FIFE {
 		void initializePumping();
 		void finalizePumping();
 		void pump();
+		const EngineFrameStats& getFrameStats() const;
+		void startRecording();
+		bool stopRecording(const std::string& filename);
+		bool startReplay(const std::string& filename);
+		void stopReplay();
+		bool isReplaying() const;
 
 		EngineSettings& getSettings();
 		const DeviceCaps& getDeviceCaps() const;
@@ -150,6 +170,7 @@ namespace FIFE {
 		SoundManager* getSoundManager();
 		EventManager* getEventManager();
 		TimeManager* getTimeManager();
+		Profiler* getProfiler();
 		IGUIManager* getGuiManager();
 		ImageManager* getImageManager();
 		AnimationManager* getAnimationManager();
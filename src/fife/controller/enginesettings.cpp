@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <format>
 #include <string>
+#include <thread>
 #include <vector>
 
 // 3rd party library includes
@@ -79,7 +80,8 @@ namespace FIFE
         m_mousesensitivity(0.0F),
         m_mouseacceleration(false),
         m_nativeimagecursor(false),
-        m_joystickSupport(false)
+        m_joystickSupport(false),
+        m_jobThreads(std::max(std::thread::hardware_concurrency(), 1U) - 1)
     {
     }
 
@@ -375,4 +377,14 @@ namespace FIFE
     {
         return m_joystickSupport;
     }
+
+    void EngineSettings::setJobThreads(uint32_t threads)
+    {
+        m_jobThreads = threads;
+    }
+
+    uint32_t EngineSettings::getJobThreads() const
+    {
+        return m_jobThreads;
+    }
 } // namespace FIFE
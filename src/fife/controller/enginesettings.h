@@ -628,6 +628,18 @@ namespace FIFE
              */
             bool isJoystickSupport() const;
 
+            /**
+             * Sets the number of worker threads for parallel work inside a frame,
+             * e.g. building the render lists. 0 keeps everything on the main thread.
+             * Defaults to one less than the number of hardware threads.
+             */
+            void setJobThreads(uint32_t threads);
+
+            /**
+             * Gets the number of worker threads for parallel work inside a frame.
+             */
+            uint32_t getJobThreads() const;
+
         private:
             uint8_t m_bitsperpixel;
             bool m_fullscreen;
@@ -669,6 +681,7 @@ namespace FIFE
             bool m_mouseacceleration;
             bool m_nativeimagecursor;
             bool m_joystickSupport;
+            uint32_t m_jobThreads;
     };
 
 } // namespace FIFE
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+#ifndef FIFE_EVENTCHANNEL_LISTENERLIST_H
+#define FIFE_EVENTCHANNEL_LISTENERLIST_H
+
+// Platform specific includes
+#include "platform.h"
+
+// Standard C++ library includes
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// 3rd party library includes
+//
+
+// FIFE includes
+//
+
+namespace FIFE
+{
+    /** Listeners of a controller, dispatched from a copy-on-write snapshot.
+     *
+     * Adding or removing a listener builds a new vector, dispatching only shares the current one.
+     * So listeners can change the list while an event is dispatched, without a copy per event.
+     * Listeners removed meanwhile are still in the snapshot and skipped by IListener::isActive().
+     */
+    template <typename T>
+    class ListenerList
+    {
+        public:
+            using Snapshot = std::shared_ptr<std::vector<T*> const>;
+
+            ListenerList() : m_listeners(std::make_shared<std::vector<T*> const>())
+            {
+            }
+
+            void pushBack(T* listener)
+            {
+                auto listeners = std::make_shared<std::vector<T*>>();
+                listeners->reserve(m_listeners->size() + 1);
+                listeners->assign(m_listeners->begin(), m_listeners->end());
+                listeners->push_back(listener);
+                m_listeners = std::move(listeners);
+            }
+
+            void pushFront(T* listener)
+            {
+                auto listeners = std::make_shared<std::vector<T*>>();
+                listeners->reserve(m_listeners->size() + 1);
+                listeners->push_back(listener);
+                listeners->insert(listeners->end(), m_listeners->begin(), m_listeners->end());
+                m_listeners = std::move(listeners);
+            }
+
+            /** Removes the first occurrence of the listener.
+             * @return True if the listener was found.
+             */
+            bool remove(T* listener)
+            {
+                auto it = std::ranges::find(*m_listeners, listener);
+                if (it == m_listeners->end()) {
+                    return false;
+                }
+                auto listeners = std::make_shared<std::vector<T*>>(m_listeners->begin(), it);
+                listeners->insert(listeners->end(), it + 1, m_listeners->end());
+                m_listeners = std::move(listeners);
+                return true;
+            }
+
+            /** Returns the current listeners, they stay unchanged while the snapshot is held.
+             */
+            Snapshot snapshot() const
+            {
+                return m_listeners;
+            }
+
+            std::size_t size() const
+            {
+                return m_listeners->size();
+            }
+
+            bool empty() const
+            {
+                return m_listeners->empty();
+            }
+
+        private:
+            Snapshot m_listeners;
+    };
+
+} // namespace FIFE
+
+#endif
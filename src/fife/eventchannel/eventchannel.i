@@ -354,6 +354,14 @@ Example::
 		virtual ~IJoystickListener();
 	};
 
+	enum EventCoalescing {
+		COALESCE_NONE = 0,
+		COALESCE_MOUSE_MOTION = 1,
+		COALESCE_MOUSE_WHEEL = 2,
+		COALESCE_AXIS_MOTION = 4,
+		COALESCE_ALL = 7
+	};
+
 	class EventManager {
 	public:
 		EventManager();
@@ -384,6 +392,8 @@ Example::
 		EventSourceType getEventSourceType();
 		void dispatchCommand(Command& command);
 		void setKeyFilter(IKeyFilter* keyFilter);
+		void setEventCoalescing(uint8_t kinds);
+		uint8_t getEventCoalescing() const;
 
 		void setMouseSensitivity(float sensitivity);
 		float getMouseSensitivity() const;
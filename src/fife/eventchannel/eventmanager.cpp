@@ -6,16 +6,17 @@
 
 // Standard C++ library includes
 #include <algorithm>
-#include <deque>
 #include <format>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <vector>
 
 // 3rd party library includes
 
 // FIFE includes
 #include "eventchannel/command/command.h"
+#include "eventchannel/eventrecording.h"
 #include "eventchannel/joystick/joystickmanager.h"
 #include "eventchannel/key/ikeyfilter.h"
 #include "eventchannel/key/key.h"
@@ -50,7 +51,12 @@ namespace FIFE
         m_oldX(0),
         m_oldY(0),
         m_lastTicks(0),
-        m_oldVelocity(0.0)
+        m_oldVelocity(0.0),
+        m_coalescing(COALESCE_MOUSE_MOTION),
+        m_recording(nullptr),
+        m_replay(nullptr),
+        m_replayFrame(0),
+        m_replayEvent(0)
     {
     }
 
@@ -59,128 +65,126 @@ namespace FIFE
     namespace
     {
         template <typename T>
-        void addListener(std::deque<T>& vec, T& listener)
+        void addListener(ListenerList<T>& list, T* listener)
         {
             if (!listener->isActive()) {
                 listener->setActive(true);
-                vec.push_back(listener);
+                list.pushBack(listener);
             }
         }
 
         template <typename T>
-        void addListenerFront(std::deque<T>& vec, T& listener)
+        void addListenerFront(ListenerList<T>& list, T* listener)
         {
             if (!listener->isActive()) {
                 listener->setActive(true);
-                vec.push_front(listener);
+                list.pushFront(listener);
             }
         }
 
         template <typename T>
-        void removeListener(std::deque<T>& vec, T& listener)
+        void removeListener(ListenerList<T>& list, T* listener)
         {
             if (listener->isActive()) {
                 listener->setActive(false);
-
-                auto it = std::find_if(vec.begin(), vec.end(), [&](T const & item) {
-                    return item == listener;
-                });
-
-                if (it != vec.end()) {
-                    vec.erase(it);
-                }
+                list.remove(listener);
             }
         }
+
+        int32_t sign(float value)
+        {
+            return static_cast<int32_t>(value > 0.0F) - static_cast<int32_t>(value < 0.0F);
+        }
     } // namespace
 
     void EventManager::addCommandListener(ICommandListener* listener)
     {
-        addListener<ICommandListener*>(m_commandListeners, listener);
+        addListener(m_commandListeners, listener);
     }
 
     void EventManager::addCommandListenerFront(ICommandListener* listener)
     {
-        addListenerFront<ICommandListener*>(m_commandListeners, listener);
+        addListenerFront(m_commandListeners, listener);
     }
 
     void EventManager::removeCommandListener(ICommandListener* listener)
     {
-        removeListener<ICommandListener*>(m_commandListeners, listener);
+        removeListener(m_commandListeners, listener);
     }
 
     void EventManager::addKeyListener(IKeyListener* listener)
     {
-        addListener<IKeyListener*>(m_keyListeners, listener);
+        addListener(m_keyListeners, listener);
     }
 
     void EventManager::addKeyListenerFront(IKeyListener* listener)
     {
-        addListenerFront<IKeyListener*>(m_keyListeners, listener);
+        addListenerFront(m_keyListeners, listener);
     }
 
     void EventManager::removeKeyListener(IKeyListener* listener)
     {
-        removeListener<IKeyListener*>(m_keyListeners, listener);
+        removeListener(m_keyListeners, listener);
     }
 
     void EventManager::addTextListener(ITextListener* listener)
     {
-        addListener<ITextListener*>(m_textListeners, listener);
+        addListener(m_textListeners, listener);
     }
 
     void EventManager::addTextListenerFront(ITextListener* listener)
     {
-        addListenerFront<ITextListener*>(m_textListeners, listener);
+        addListenerFront(m_textListeners, listener);
     }
 
     void EventManager::removeTextListener(ITextListener* listener)
     {
-        removeListener<ITextListener*>(m_textListeners, listener);
+        removeListener(m_textListeners, listener);
     }
 
     void EventManager::addMouseListener(IMouseListener* listener)
     {
-        addListener<IMouseListener*>(m_mouseListeners, listener);
+        addListener(m_mouseListeners, listener);
     }
 
     void EventManager::addMouseListenerFront(IMouseListener* listener)
     {
-        addListenerFront<IMouseListener*>(m_mouseListeners, listener);
+        addListenerFront(m_mouseListeners, listener);
     }
 
     void EventManager::removeMouseListener(IMouseListener* listener)
     {
-        removeListener<IMouseListener*>(m_mouseListeners, listener);
+        removeListener(m_mouseListeners, listener);
     }
 
     void EventManager::addSdlEventListener(ISdlEventListener* listener)
     {
-        addListener<ISdlEventListener*>(m_sdleventListeners, listener);
+        addListener(m_sdleventListeners, listener);
     }
 
     void EventManager::addSdlEventListenerFront(ISdlEventListener* listener)
     {
-        addListenerFront<ISdlEventListener*>(m_sdleventListeners, listener);
+        addListenerFront(m_sdleventListeners, listener);
     }
 
     void EventManager::removeSdlEventListener(ISdlEventListener* listener)
     {
-        removeListener<ISdlEventListener*>(m_sdleventListeners, listener);
+        removeListener(m_sdleventListeners, listener);
     }
 
     void EventManager::addDropListener(IDropListener* listener)
     {
-        addListener<IDropListener*>(m_dropListeners, listener);
+        addListener(m_dropListeners, listener);
     }
 
     void EventManager::addDropListenerFront(IDropListener* listener)
     {
-        addListenerFront<IDropListener*>(m_dropListeners, listener);
+        addListenerFront(m_dropListeners, listener);
     }
 
     void EventManager::removeDropListener(IDropListener* listener)
     {
-        removeListener<IDropListener*>(m_dropListeners, listener);
+        removeListener(m_dropListeners, listener);
     }
 
     void EventManager::addJoystickListener(IJoystickListener* listener)
@@ -206,9 +210,8 @@ namespace FIFE
 
     void EventManager::dispatchCommand(Command& command)
     {
-        std::deque<ICommandListener*> listeners = m_commandListeners;
-        auto i                                  = listeners.begin();
-        for (; i != listeners.end(); ++i) {
+        auto const listeners = m_commandListeners.snapshot();
+        for (auto i = listeners->begin(); i != listeners->end(); ++i) {
             if (!(*i)->isActive()) {
                 continue;
             }
@@ -221,9 +224,8 @@ namespace FIFE
 
     void EventManager::dispatchKeyEvent(KeyEvent& evt)
     {
-        std::deque<IKeyListener*> listeners = m_keyListeners;
-        auto i                              = listeners.begin();
-        for (; i != listeners.end(); ++i) {
+        auto const listeners = m_keyListeners.snapshot();
+        for (auto i = listeners->begin(); i != listeners->end(); ++i) {
             if (!(*i)->isActive() || (evt.isConsumedByWidgets() && !(*i)->isGlobalListener())) {
                 continue;
             }
@@ -247,9 +249,8 @@ namespace FIFE
 
     void EventManager::dispatchTextEvent(TextEvent& evt)
     {
-        std::deque<ITextListener*> listeners = m_textListeners;
-        auto i                               = listeners.begin();
-        for (; i != listeners.end(); ++i) {
+        auto const listeners = m_textListeners.snapshot();
+        for (auto i = listeners->begin(); i != listeners->end(); ++i) {
             if (!(*i)->isActive()) {
                 continue;
             }
@@ -273,9 +274,8 @@ namespace FIFE
 
     void EventManager::dispatchMouseEvent(MouseEvent& evt)
     {
-        std::deque<IMouseListener*> listeners = m_mouseListeners;
-        auto i                                = listeners.begin();
-        for (; i != listeners.end(); ++i) {
+        auto const listeners = m_mouseListeners.snapshot();
+        for (auto i = listeners->begin(); i != listeners->end(); ++i) {
             if (!(*i)->isActive() || (evt.isConsumedByWidgets() && !(*i)->isGlobalListener())) {
                 continue;
             }
@@ -326,10 +326,9 @@ namespace FIFE
 
     bool EventManager::dispatchSdlEvent(SDL_Event& evt)
     {
-        bool ret                                 = false;
-        std::deque<ISdlEventListener*> listeners = m_sdleventListeners;
-        auto i                                   = listeners.begin();
-        for (; i != listeners.end(); ++i) {
+        bool ret             = false;
+        auto const listeners = m_sdleventListeners.snapshot();
+        for (auto i = listeners->begin(); i != listeners->end(); ++i) {
             if (!(*i)->isActive()) {
                 continue;
             }
@@ -340,9 +339,8 @@ namespace FIFE
 
     void EventManager::dispatchDropEvent(DropEvent& evt)
     {
-        std::deque<IDropListener*> listeners = m_dropListeners;
-        auto i                               = listeners.begin();
-        for (; i != listeners.end(); ++i) {
+        auto const listeners = m_dropListeners.snapshot();
+        for (auto i = listeners->begin(); i != listeners->end(); ++i) {
             if (!(*i)->isActive()) {
                 continue;
             }
@@ -355,116 +353,239 @@ namespace FIFE
 
     bool EventManager::combineEvents(SDL_Event& event1, SDL_Event const & event2)
     {
-        if (event1.type == event2.type) {
-            switch (event1.type) {
-            case SDL_EVENT_MOUSE_MOTION:
-                if (event1.motion.state == event2.motion.state) {
-                    event1.motion.x = event2.motion.x;
-                    event1.motion.y = event2.motion.y;
-                    event1.motion.xrel += event2.motion.xrel;
-                    event1.motion.yrel += event2.motion.yrel;
-                    return true;
-                }
+        if (event1.type != event2.type) {
+            return false;
+        }
+        switch (event1.type) {
+        case SDL_EVENT_MOUSE_MOTION:
+            if (event1.motion.state == event2.motion.state && event1.motion.which == event2.motion.which &&
+                event1.motion.windowID == event2.motion.windowID) {
+                event1.motion.timestamp = event2.motion.timestamp;
+                event1.motion.x         = event2.motion.x;
+                event1.motion.y         = event2.motion.y;
+                event1.motion.xrel += event2.motion.xrel;
+                event1.motion.yrel += event2.motion.yrel;
+                return true;
+            }
+            return false;
+        case SDL_EVENT_MOUSE_WHEEL:
+            // the direction is kept, so the merged event is a wheel move of the same kind
+            if (event1.wheel.which == event2.wheel.which && event1.wheel.windowID == event2.wheel.windowID &&
+                event1.wheel.direction == event2.wheel.direction &&
+                sign(event1.wheel.x) == sign(event2.wheel.x) &&
+                sign(event1.wheel.y) == sign(event2.wheel.y)) {
+                event1.wheel.timestamp = event2.wheel.timestamp;
+                event1.wheel.x += event2.wheel.x;
+                event1.wheel.y += event2.wheel.y;
+                event1.wheel.mouse_x = event2.wheel.mouse_x;
+                event1.wheel.mouse_y = event2.wheel.mouse_y;
+                return true;
+            }
+            return false;
+        case SDL_EVENT_JOYSTICK_AXIS_MOTION:
+            if (event1.jaxis.which == event2.jaxis.which && event1.jaxis.axis == event2.jaxis.axis) {
+                event1.jaxis.timestamp = event2.jaxis.timestamp;
+                event1.jaxis.value     = event2.jaxis.value;
+                return true;
+            }
+            return false;
+        case SDL_EVENT_GAMEPAD_AXIS_MOTION:
+            if (event1.gaxis.which == event2.gaxis.which && event1.gaxis.axis == event2.gaxis.axis) {
+                event1.gaxis.timestamp = event2.gaxis.timestamp;
+                event1.gaxis.value     = event2.gaxis.value;
+                return true;
+            }
+            return false;
+        default:
+            return false;
+        }
+    }
+
+    bool EventManager::isCoalesced(SDL_Event const & event) const
+    {
+        switch (event.type) {
+        case SDL_EVENT_MOUSE_MOTION:
+            return (m_coalescing & COALESCE_MOUSE_MOTION) != 0;
+        case SDL_EVENT_MOUSE_WHEEL:
+            return (m_coalescing & COALESCE_MOUSE_WHEEL) != 0;
+        case SDL_EVENT_JOYSTICK_AXIS_MOTION:
+        case SDL_EVENT_GAMEPAD_AXIS_MOTION:
+            return (m_coalescing & COALESCE_AXIS_MOTION) != 0;
+        default:
+            return false;
+        }
+    }
+
+    bool EventManager::coalesceEvent(SDL_Event const & event)
+    {
+        bool const mouse = event.type == SDL_EVENT_MOUSE_MOTION || event.type == SDL_EVENT_MOUSE_WHEEL;
+        for (auto it = m_coalescedEvents.rbegin(); it != m_coalescedEvents.rend(); ++it) {
+            if (combineEvents(*it, event)) {
+                return true;
+            }
+            // mouse events keep their order, the position of a wheel move or a button state change matters
+            if (mouse && (it->type == SDL_EVENT_MOUSE_MOTION || it->type == SDL_EVENT_MOUSE_WHEEL)) {
                 return false;
-            default:
-                break;
             }
         }
         return false;
     }
 
-    void EventManager::processEvents()
+    void EventManager::processCoalescedEvents()
     {
-        // The double SDL_PollEvent calls don't throw away events,
-        // but try to combine (mouse motion) events.
-        SDL_Event event;
-        SDL_Event next_event;
-        bool has_next_event = SDL_PollEvent(&event);
-        while (has_next_event) {
-            has_next_event = SDL_PollEvent(&next_event);
-            if (has_next_event && combineEvents(event, next_event)) {
-                continue;
+        for (SDL_Event const & event : m_coalescedEvents) {
+            processEvent(event);
+        }
+        m_coalescedEvents.clear();
+    }
+
+    void EventManager::setRecording(EventRecording* recording)
+    {
+        m_recording = recording;
+    }
+
+    void EventManager::setReplay(EventRecording const * replay)
+    {
+        m_replay      = replay;
+        m_replayFrame = 0;
+        m_replayEvent = 0;
+    }
+
+    size_t EventManager::getReplayedFrameCount() const
+    {
+        return m_replayFrame;
+    }
+
+    bool EventManager::pollEvent(SDL_Event& event)
+    {
+        if (m_replay == nullptr) {
+            if (!SDL_PollEvent(&event)) {
+                return false;
             }
-            switch (event.type) {
-            case SDL_EVENT_QUIT: {
-                Command cmd;
-                cmd.setSource(this);
-                cmd.setCommandType(CMD_QUIT_GAME);
-                dispatchCommand(cmd);
-            } break;
-
-            case SDL_EVENT_WINDOW_CLOSE_REQUESTED:
-            case SDL_EVENT_WINDOW_DISPLAY_CHANGED:
-            case SDL_EVENT_WINDOW_MOVED:
-            case SDL_EVENT_WINDOW_RESIZED:
-            case SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED:
-            case SDL_EVENT_WINDOW_MINIMIZED:
-            case SDL_EVENT_WINDOW_RESTORED:
-            case SDL_EVENT_WINDOW_MAXIMIZED:
-            case SDL_EVENT_WINDOW_SHOWN:
-            case SDL_EVENT_WINDOW_HIDDEN:
-            case SDL_EVENT_WINDOW_EXPOSED:
-            case SDL_EVENT_WINDOW_MOUSE_ENTER:
-            case SDL_EVENT_WINDOW_MOUSE_LEAVE:
-            case SDL_EVENT_WINDOW_FOCUS_GAINED:
-            case SDL_EVENT_WINDOW_FOCUS_LOST:
-                processWindowEvent(event);
-                break;
-
-            case SDL_EVENT_KEY_DOWN:
-            case SDL_EVENT_KEY_UP:
-                processKeyEvent(event);
-                break;
-
-            // case SDL_EVENT_TEXT_EDITING: // is buggy with SDL 2.0.1
-            case SDL_EVENT_TEXT_INPUT:
-                processTextEvent(event);
-                break;
-
-            case SDL_EVENT_MOUSE_WHEEL:
-            case SDL_EVENT_MOUSE_BUTTON_UP:
-            case SDL_EVENT_MOUSE_MOTION:
-            case SDL_EVENT_MOUSE_BUTTON_DOWN:
-                processMouseEvent(event);
-                break;
-
-            case SDL_EVENT_DROP_FILE:
-                processDropEvent(event);
-                break;
-
-            case SDL_EVENT_JOYSTICK_BUTTON_DOWN:
-            case SDL_EVENT_JOYSTICK_BUTTON_UP:
-            case SDL_EVENT_JOYSTICK_AXIS_MOTION:
-            case SDL_EVENT_JOYSTICK_HAT_MOTION:
-            case SDL_EVENT_JOYSTICK_ADDED:
-            case SDL_EVENT_JOYSTICK_REMOVED: {
-                if (m_joystickManager != nullptr) {
-                    m_joystickManager->processJoystickEvent(event);
-                }
-                break;
+            if (m_recording != nullptr) {
+                m_recording->addEvent(event);
             }
-            case SDL_EVENT_DISPLAY_ADDED:
-            case SDL_EVENT_DISPLAY_REMOVED:
-            case SDL_EVENT_DISPLAY_ORIENTATION:
-            case SDL_EVENT_DISPLAY_MOVED:
-            case SDL_EVENT_DISPLAY_DESKTOP_MODE_CHANGED:
-            case SDL_EVENT_DISPLAY_CURRENT_MODE_CHANGED:
-                processWindowEvent(event);
-                break;
-            case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
-            case SDL_EVENT_GAMEPAD_BUTTON_UP:
-            case SDL_EVENT_GAMEPAD_AXIS_MOTION: {
-                if (m_joystickManager != nullptr) {
-                    m_joystickManager->processControllerEvent(event);
+            return true;
+        }
+
+        if (m_replayFrame == 0 || m_replayFrame > m_replay->getFrameCount()) {
+            return false;
+        }
+        std::vector<RecordedEvent> const & events = m_replay->getFrame(m_replayFrame - 1).events;
+        if (m_replayEvent >= events.size()) {
+            return false;
+        }
+        event = EventRecording::restoreEvent(events[m_replayEvent]);
+        ++m_replayEvent;
+        return true;
+    }
+
+    void EventManager::processEvents()
+    {
+        if (m_recording != nullptr) {
+            m_recording->addFrame();
+        }
+        if (m_replay != nullptr) {
+            // only the recorded input is dispatched
+            SDL_PumpEvents();
+            SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+            ++m_replayFrame;
+            m_replayEvent = 0;
+        }
+
+        // Events that can be merged wait until another kind of event comes in or the queue is empty.
+        SDL_Event event;
+        while (pollEvent(event)) {
+            if (isCoalesced(event)) {
+                if (!coalesceEvent(event)) {
+                    m_coalescedEvents.push_back(event);
                 }
-                break;
+                continue;
             }
-            default:
-                break;
+            processCoalescedEvents();
+            processEvent(event);
+        }
+        processCoalescedEvents();
+    }
+
+    void EventManager::processEvent(SDL_Event const & event)
+    {
+        switch (event.type) {
+        case SDL_EVENT_QUIT: {
+            Command cmd;
+            cmd.setSource(this);
+            cmd.setCommandType(CMD_QUIT_GAME);
+            dispatchCommand(cmd);
+        } break;
+
+        case SDL_EVENT_WINDOW_CLOSE_REQUESTED:
+        case SDL_EVENT_WINDOW_DISPLAY_CHANGED:
+        case SDL_EVENT_WINDOW_MOVED:
+        case SDL_EVENT_WINDOW_RESIZED:
+        case SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED:
+        case SDL_EVENT_WINDOW_MINIMIZED:
+        case SDL_EVENT_WINDOW_RESTORED:
+        case SDL_EVENT_WINDOW_MAXIMIZED:
+        case SDL_EVENT_WINDOW_SHOWN:
+        case SDL_EVENT_WINDOW_HIDDEN:
+        case SDL_EVENT_WINDOW_EXPOSED:
+        case SDL_EVENT_WINDOW_MOUSE_ENTER:
+        case SDL_EVENT_WINDOW_MOUSE_LEAVE:
+        case SDL_EVENT_WINDOW_FOCUS_GAINED:
+        case SDL_EVENT_WINDOW_FOCUS_LOST:
+            processWindowEvent(event);
+            break;
+
+        case SDL_EVENT_KEY_DOWN:
+        case SDL_EVENT_KEY_UP:
+            processKeyEvent(event);
+            break;
+
+        // case SDL_EVENT_TEXT_EDITING: // is buggy with SDL 2.0.1
+        case SDL_EVENT_TEXT_INPUT:
+            processTextEvent(event);
+            break;
+
+        case SDL_EVENT_MOUSE_WHEEL:
+        case SDL_EVENT_MOUSE_BUTTON_UP:
+        case SDL_EVENT_MOUSE_MOTION:
+        case SDL_EVENT_MOUSE_BUTTON_DOWN:
+            processMouseEvent(event);
+            break;
+
+        case SDL_EVENT_DROP_FILE:
+            processDropEvent(event);
+            break;
+
+        case SDL_EVENT_JOYSTICK_BUTTON_DOWN:
+        case SDL_EVENT_JOYSTICK_BUTTON_UP:
+        case SDL_EVENT_JOYSTICK_AXIS_MOTION:
+        case SDL_EVENT_JOYSTICK_HAT_MOTION:
+        case SDL_EVENT_JOYSTICK_ADDED:
+        case SDL_EVENT_JOYSTICK_REMOVED: {
+            if (m_joystickManager != nullptr) {
+                m_joystickManager->processJoystickEvent(event);
             }
-            if (has_next_event) {
-                event = next_event;
+            break;
+        }
+        case SDL_EVENT_DISPLAY_ADDED:
+        case SDL_EVENT_DISPLAY_REMOVED:
+        case SDL_EVENT_DISPLAY_ORIENTATION:
+        case SDL_EVENT_DISPLAY_MOVED:
+        case SDL_EVENT_DISPLAY_DESKTOP_MODE_CHANGED:
+        case SDL_EVENT_DISPLAY_CURRENT_MODE_CHANGED:
+            processWindowEvent(event);
+            break;
+        case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
+        case SDL_EVENT_GAMEPAD_BUTTON_UP:
+        case SDL_EVENT_GAMEPAD_AXIS_MOTION: {
+            if (m_joystickManager != nullptr) {
+                m_joystickManager->processControllerEvent(event);
             }
+            break;
+        }
+        default:
+            break;
         }
     }
 
@@ -772,6 +893,16 @@ namespace FIFE
         m_keyfilter = keyFilter;
     }
 
+    void EventManager::setEventCoalescing(uint8_t kinds)
+    {
+        m_coalescing = kinds & COALESCE_ALL;
+    }
+
+    uint8_t EventManager::getEventCoalescing() const
+    {
+        return m_coalescing;
+    }
+
     void EventManager::setMouseSensitivity(float sensitivity)
     {
         if (sensitivity < -0.99F) {
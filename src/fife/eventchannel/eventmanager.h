@@ -8,16 +8,18 @@
 #include "platform.h"
 
 // Standard C++ library includes
+#include <cstddef>
 #include <cstdint>
-#include <deque>
 #include <list>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 // 3rd party library includes
 
 // FIFE includes
+#include "eventchannel/base/listenerlist.h"
 #include "eventchannel/command/command.h"
 #include "eventchannel/command/icommandcontroller.h"
 #include "eventchannel/command/icommandlistener.h"
@@ -42,6 +44,7 @@
 namespace FIFE
 {
 
+    class EventRecording;
     class ICommandListener;
     class InputEvent;
     class IJoystickListener;
@@ -52,6 +55,23 @@ namespace FIFE
     class IKeyFilter;
     class DropEvent;
 
+    /** Kinds of input events that EventManager::processEvents() merges.
+     *
+     * Events are merged with an earlier event of the same frame, as long as no other kind of event came in
+     * between, e.g. a key or a mouse button. Mouse motion and wheel events are not merged across each other.
+     */
+    enum EventCoalescing : uint8_t
+    {
+        COALESCE_NONE = 0,
+        //! mouse motion with the same buttons held, the relative motion is summed up
+        COALESCE_MOUSE_MOTION = 1,
+        //! wheel events in the same direction, the scroll amount is summed up
+        COALESCE_MOUSE_WHEEL = 2,
+        //! joystick and gamepad axis motion of the same axis, the last value is kept
+        COALESCE_AXIS_MOTION = 4,
+        COALESCE_ALL         = COALESCE_MOUSE_MOTION | COALESCE_MOUSE_WHEEL | COALESCE_AXIS_MOTION
+    };
+
     /**  Event Manager manages all events related to FIFE
      */
     class FIFE_API EventManager :
@@ -110,8 +130,37 @@ namespace FIFE
              */
             void processEvents();
 
+            /** Adds the events of every processEvents() call to the recording, as a new frame.
+             *
+             * @param recording The recording to add to, nullptr stops recording.
+             */
+            void setRecording(EventRecording* recording);
+
+            /** Replays the recorded frames instead of polling SDL.
+             *
+             * Every processEvents() call dispatches the events of the next frame,
+             * the events that arrive from SDL in the meantime are dropped. Once all
+             * frames are replayed no input events are dispatched anymore.
+             *
+             * @param replay The recording to replay, nullptr returns to the SDL events.
+             */
+            void setReplay(EventRecording const * replay);
+
+            /** Returns the number of frames replayed so far.
+             */
+            size_t getReplayedFrameCount() const;
+
             void setKeyFilter(IKeyFilter* keyFilter);
 
+            /** Sets the kinds of events that are merged, see EventCoalescing.
+             * By default only mouse motion is merged.
+             */
+            void setEventCoalescing(uint8_t kinds);
+
+            /** Returns the kinds of events that are merged.
+             */
+            uint8_t getEventCoalescing() const;
+
             /** Sets mouse sensitivity
              * The sensitivity is limited to the range -0.99 - 10.0.
              */
@@ -187,12 +236,17 @@ namespace FIFE
 
         private:
             // Helpers for processEvents
+            void processEvent(SDL_Event const & event);
             void processWindowEvent(SDL_Event event);
             void processKeyEvent(SDL_Event event);
             void processTextEvent(SDL_Event event);
             void processMouseEvent(SDL_Event event);
             void processDropEvent(SDL_Event event);
             bool combineEvents(SDL_Event& event1, SDL_Event const & event2);
+            bool isCoalesced(SDL_Event const & event) const;
+            bool coalesceEvent(SDL_Event const & event);
+            void processCoalescedEvents();
+            bool pollEvent(SDL_Event& event);
 
             // Events dispatchers - only dispatchSdlevent may reject the event.
             bool dispatchSdlEvent(SDL_Event& evt);
@@ -208,12 +262,12 @@ namespace FIFE
             void fillMouseEvent(SDL_Event const & sdlevt, MouseEvent& mouseevt);
 
             // Listeners
-            std::deque<ICommandListener*> m_commandListeners;
-            std::deque<IKeyListener*> m_keyListeners;
-            std::deque<ITextListener*> m_textListeners;
-            std::deque<IMouseListener*> m_mouseListeners;
-            std::deque<ISdlEventListener*> m_sdleventListeners;
-            std::deque<IDropListener*> m_dropListeners;
+            ListenerList<ICommandListener> m_commandListeners;
+            ListenerList<IKeyListener> m_keyListeners;
+            ListenerList<ITextListener> m_textListeners;
+            ListenerList<IMouseListener> m_mouseListeners;
+            ListenerList<ISdlEventListener> m_sdleventListeners;
+            ListenerList<IDropListener> m_dropListeners;
 
             std::map<int32_t, bool> m_keystatemap;
             IKeyFilter* m_keyfilter;
@@ -233,6 +287,16 @@ namespace FIFE
             float m_oldVelocity;
 
             std::unique_ptr<JoystickManager> m_joystickManager;
+
+            uint8_t m_coalescing;
+            // Events of the frame that wait for more events to merge with.
+            std::vector<SDL_Event> m_coalescedEvents;
+
+            EventRecording* m_recording;
+            EventRecording const * m_replay;
+            // Index of the replayed frame and of its next event.
+            size_t m_replayFrame;
+            size_t m_replayEvent;
     };
 } // namespace FIFE
 
@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Corresponding header include
+#include "eventrecording.h"
+
+// Standard C++ library includes
+#include <array>
+#include <format>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// 3rd party library includes
+#include <SDL3/SDL.h>
+
+// FIFE includes
+#include "util/log/logger.h"
+
+namespace FIFE
+{
+    namespace
+    {
+        Logger& _log()
+        {
+            static Logger log(LM_EVTCHANNEL);
+            return log;
+        }
+
+        // bump whenever the layout of the file changes
+        constexpr uint32_t FORMAT_VERSION   = 1;
+        constexpr std::array<char, 8> MAGIC = {'F', 'I', 'F', 'E', 'R', 'E', 'C', '\0'};
+
+        template <typename T>
+        void write(std::ofstream& file, T const & value)
+        {
+            file.write(reinterpret_cast<char const *>(&value), sizeof(T));
+        }
+
+        template <typename T>
+        bool read(std::ifstream& file, T& value)
+        {
+            return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+        }
+    } // namespace
+
+    void EventRecording::addFrame()
+    {
+        m_frames.emplace_back();
+    }
+
+    void EventRecording::addEvent(SDL_Event const & event)
+    {
+        if (m_frames.empty()) {
+            addFrame();
+        }
+        RecordedEvent recorded{.event = event, .text = {}};
+        switch (event.type) {
+        case SDL_EVENT_TEXT_INPUT:
+            recorded.text            = event.text.text != nullptr ? event.text.text : "";
+            recorded.event.text.text = nullptr;
+            break;
+        case SDL_EVENT_TEXT_EDITING:
+            recorded.text            = event.edit.text != nullptr ? event.edit.text : "";
+            recorded.event.edit.text = nullptr;
+            break;
+        case SDL_EVENT_DROP_FILE:
+        case SDL_EVENT_DROP_TEXT:
+        case SDL_EVENT_DROP_BEGIN:
+        case SDL_EVENT_DROP_COMPLETE:
+        case SDL_EVENT_DROP_POSITION:
+            recorded.text              = event.drop.data != nullptr ? event.drop.data : "";
+            recorded.event.drop.data   = nullptr;
+            recorded.event.drop.source = nullptr;
+            break;
+        case SDL_EVENT_TEXT_EDITING_CANDIDATES:
+        case SDL_EVENT_CLIPBOARD_UPDATE:
+            // only point to data of the system
+            return;
+        default:
+            break;
+        }
+        m_frames.back().events.push_back(std::move(recorded));
+    }
+
+    void EventRecording::setTimeDelta(uint64_t delta)
+    {
+        if (m_frames.empty()) {
+            addFrame();
+        }
+        m_frames.back().timeDelta = delta;
+    }
+
+    SDL_Event EventRecording::restoreEvent(RecordedEvent const & recorded)
+    {
+        SDL_Event event = recorded.event;
+        switch (event.type) {
+        case SDL_EVENT_TEXT_INPUT:
+            event.text.text = recorded.text.c_str();
+            break;
+        case SDL_EVENT_TEXT_EDITING:
+            event.edit.text = recorded.text.c_str();
+            break;
+        case SDL_EVENT_DROP_FILE:
+        case SDL_EVENT_DROP_TEXT:
+        case SDL_EVENT_DROP_BEGIN:
+        case SDL_EVENT_DROP_COMPLETE:
+        case SDL_EVENT_DROP_POSITION:
+            event.drop.data = recorded.text.c_str();
+            break;
+        default:
+            break;
+        }
+        return event;
+    }
+
+    void EventRecording::clear()
+    {
+        m_frames.clear();
+    }
+
+    bool EventRecording::save(std::string const & filename) const
+    {
+        std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+        file.write(MAGIC.data(), MAGIC.size());
+        write(file, FORMAT_VERSION);
+        write(file, static_cast<uint32_t>(sizeof(SDL_Event)));
+        write(file, static_cast<uint64_t>(m_frames.size()));
+        for (RecordedFrame const & frame : m_frames) {
+            write(file, frame.timeDelta);
+            write(file, static_cast<uint32_t>(frame.events.size()));
+            for (RecordedEvent const & recorded : frame.events) {
+                write(file, recorded.event);
+                write(file, static_cast<uint32_t>(recorded.text.size()));
+                file.write(recorded.text.data(), static_cast<std::streamsize>(recorded.text.size()));
+            }
+        }
+        if (!file) {
+            FL_WARN(_log(), std::format("Could not write event recording {}", filename));
+            return false;
+        }
+        return true;
+    }
+
+    bool EventRecording::load(std::string const & filename)
+    {
+        m_frames.clear();
+        std::ifstream file(filename, std::ios::binary | std::ios::ate);
+        // texts can not be larger than the rest of the file
+        std::streamoff const fileSize = file.tellg();
+        file.seekg(0);
+        std::array<char, MAGIC.size()> magic{};
+        uint32_t version    = 0;
+        uint32_t eventSize  = 0;
+        uint64_t frameCount = 0;
+        if (!file.read(magic.data(), magic.size()) || !read(file, version) || !read(file, eventSize) ||
+            !read(file, frameCount)) {
+            FL_WARN(_log(), std::format("Could not read event recording {}", filename));
+            return false;
+        }
+        if (magic != MAGIC || version != FORMAT_VERSION || eventSize != sizeof(SDL_Event)) {
+            FL_WARN(_log(), std::format("Event recording {} was written by an incompatible build", filename));
+            return false;
+        }
+
+        bool valid = true;
+        for (uint64_t i = 0; valid && i < frameCount; ++i) {
+            RecordedFrame frame;
+            uint32_t eventCount = 0;
+            valid               = read(file, frame.timeDelta) && read(file, eventCount);
+            for (uint32_t j = 0; valid && j < eventCount; ++j) {
+                RecordedEvent recorded{};
+                uint32_t textSize = 0;
+                valid             = read(file, recorded.event) && read(file, textSize) &&
+                    std::cmp_less_equal(textSize, fileSize - static_cast<std::streamoff>(file.tellg()));
+                if (valid) {
+                    recorded.text.resize(textSize);
+                    valid = static_cast<bool>(file.read(recorded.text.data(), textSize));
+                }
+                frame.events.push_back(std::move(recorded));
+            }
+            m_frames.push_back(std::move(frame));
+        }
+        if (!valid) {
+            FL_WARN(_log(), std::format("Event recording {} is truncated", filename));
+            m_frames.clear();
+            return false;
+        }
+        return true;
+    }
+
+} // namespace FIFE
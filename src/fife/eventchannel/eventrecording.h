@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+#ifndef FIFE_EVENTCHANNEL_EVENTRECORDING_H
+#define FIFE_EVENTCHANNEL_EVENTRECORDING_H
+
+// Platform specific includes
+#include "platform.h"
+
+// Standard C++ library includes
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 3rd party library includes
+#include <SDL3/SDL.h>
+
+// FIFE includes
+
+namespace FIFE
+{
+
+    /** An SDL event of a recording.
+     *
+     * The strings of text input and drop events are owned by the SDL event queue,
+     * so they are kept next to the event and set again when the event is replayed.
+     */
+    struct FIFE_API RecordedEvent
+    {
+            SDL_Event event;
+            std::string text;
+    };
+
+    /** The input events polled and the time passed in one engine frame.
+     */
+    struct FIFE_API RecordedFrame
+    {
+            uint64_t timeDelta{0};
+            std::vector<RecordedEvent> events;
+    };
+
+    /** Input of an engine session, frame by frame.
+     *
+     * The EventManager adds the polled SDL events, the Engine adds the time
+     * deltas of the TimeManager. Replaying the frames with a fixed clock runs the
+     * session again without depending on the input devices or the wall clock.
+     *
+     * The events are stored as they are in memory, so a recording is only meant
+     * to be replayed by the build that recorded it.
+     */
+    class FIFE_API EventRecording
+    {
+        public:
+            EventRecording() = default;
+
+            /** Starts a new frame, the following events are added to it.
+             */
+            void addFrame();
+
+            /** Adds an event to the last frame.
+             */
+            void addEvent(SDL_Event const & event);
+
+            /** Sets the time delta of the last frame.
+             */
+            void setTimeDelta(uint64_t delta);
+
+            /** Returns the event with its strings pointing into the recording.
+             */
+            static SDL_Event restoreEvent(RecordedEvent const & recorded);
+
+            size_t getFrameCount() const
+            {
+                return m_frames.size();
+            }
+
+            RecordedFrame const & getFrame(size_t index) const
+            {
+                return m_frames[index];
+            }
+
+            void clear();
+
+            /** Writes the recording to a file.
+             *
+             * @return False if the file could not be written.
+             */
+            bool save(std::string const & filename) const;
+
+            /** Replaces the recording with the one stored in a file.
+             *
+             * @return False if the file could not be read or was written by
+             * an incompatible build, the recording is empty then.
+             */
+            bool load(std::string const & filename);
+
+        private:
+            std::vector<RecordedFrame> m_frames;
+    };
+
+} // namespace FIFE
+
+#endif
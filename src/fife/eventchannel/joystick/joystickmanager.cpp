@@ -7,7 +7,6 @@
 // Standard C++ library includes
 #include <algorithm>
 #include <array>
-#include <deque>
 #include <iostream>
 #include <limits>
 #include <map>
@@ -208,22 +207,19 @@ namespace FIFE
 
     void JoystickManager::addJoystickListener(IJoystickListener* listener)
     {
-        m_joystickListeners.push_back(listener);
+        m_joystickListeners.pushBack(listener);
     }
 
     void JoystickManager::addJoystickListenerFront(IJoystickListener* listener)
     {
-        m_joystickListeners.push_front(listener);
+        m_joystickListeners.pushFront(listener);
     }
 
     void JoystickManager::removeJoystickListener(IJoystickListener* listener)
     {
         if (listener->isActive()) {
             listener->setActive(false);
-            auto it = std::ranges::find(m_joystickListeners, listener);
-            if (it != m_joystickListeners.end()) {
-                m_joystickListeners.erase(it);
-            }
+            m_joystickListeners.remove(listener);
         }
     }
 
@@ -344,9 +340,8 @@ namespace FIFE
 
     void JoystickManager::dispatchJoystickEvent(JoystickEvent& evt)
     {
-        std::deque<IJoystickListener*> listeners = m_joystickListeners;
-        auto i                                   = listeners.begin();
-        for (; i != listeners.end(); ++i) {
+        auto const listeners = m_joystickListeners.snapshot();
+        for (auto i = listeners->begin(); i != listeners->end(); ++i) {
             if (!(*i)->isActive()) {
                 continue;
             }
@@ -8,7 +8,6 @@
 #include "platform.h"
 
 // Standard C++ library includes
-#include <deque>
 #include <list>
 #include <map>
 #include <memory>
@@ -18,6 +17,7 @@
 // 3rd party library includes
 
 // FIFE includes
+#include "eventchannel/base/listenerlist.h"
 #include "ijoystickcontroller.h"
 #include "ijoysticklistener.h"
 #include "joystick.h"
@@ -141,7 +141,7 @@ namespace FIFE
             std::map<std::string, uint8_t> m_gamepadGuids;
 
             //! The Joystick listeners.
-            std::deque<IJoystickListener*> m_joystickListeners;
+            ListenerList<IJoystickListener> m_joystickListeners;
     };
 } // namespace FIFE
 
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+#ifndef FIFE_GUI_RENDERCACHE_H
+#define FIFE_GUI_RENDERCACHE_H
+
+// Platform specific includes
+#include "platform.h"
+
+// Standard C++ library includes
+#include <functional>
+
+// 3rd party library includes
+
+// FIFE includes
+
+namespace fcn
+{
+    class Widget;
+} // namespace fcn
+
+namespace FIFE
+{
+    /** Interface of gui graphics that keep the drawing of widgets in textures.
+     *
+     * Widgets with many children, like windows, draw through it. The graphics render the texture instead of drawing
+     * the widget again until the widget or one of its children is invalidated.
+     */
+    class FIFE_API IGuiRenderCache
+    {
+        public:
+            IGuiRenderCache()          = default;
+            virtual ~IGuiRenderCache() = default;
+
+            IGuiRenderCache(IGuiRenderCache const &)            = delete;
+            IGuiRenderCache& operator=(IGuiRenderCache const &) = delete;
+
+            /** Draws a widget, with its children.
+             * @param widget The widget, it owns the texture.
+             * @param draw Draws the widget on the graphics, nested cached widgets are drawn directly.
+             */
+            virtual void drawCached(fcn::Widget* widget, std::function<void()> const & draw) = 0;
+
+            /** Marks the texture of the cached widget that contains the widget as outdated.
+             * @param widget The widget that changed its drawing, the widget itself or one of its ancestors is cached.
+             */
+            virtual void invalidate(fcn::Widget* widget) = 0;
+    };
+} // namespace FIFE
+
+#endif
@@ -5,16 +5,23 @@
 #include "opengl_gui_graphics.h"
 
 // Standard C++ library includes
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <format>
+#include <functional>
 #include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 // GLEW must be included first before any OpenGL headers
 #include <SDL3/SDL.h>
 
 #include <fifechan/backends/opengl/graphics.hpp>
+#include <fifechan/event.hpp>
 #include <fifechan/font.hpp>
+#include <fifechan/widget.hpp>
 
 #include "video/opengl/fife_opengl.h"
 
@@ -37,6 +44,12 @@ namespace FIFE
             return log;
         }
 
+        // windows larger than this are drawn directly
+        constexpr int32_t maxCacheSize = 4096;
+        // windows that had to be rendered this often in a row are drawn directly for a while
+        constexpr uint32_t maxCacheMisses  = 2;
+        constexpr uint32_t skipCacheFrames = 30;
+
         bool shouldLogShowHideBand(int32_t x, int32_t y, [[maybe_unused]] int32_t width, int32_t height)
         {
             return x == 216 && height == 16 && (y == 354 || y == 370);
@@ -44,12 +57,22 @@ namespace FIFE
     } // namespace
 
     OpenGLGuiGraphics::OpenGLGuiGraphics() :
-        m_renderbackend(dynamic_cast<RenderBackendOpenGL*>(RenderBackend::instance()))
+        m_renderbackend(dynamic_cast<RenderBackendOpenGL*>(RenderBackend::instance())),
+        m_cacheEnabled(false),
+        m_cacheDepth(0),
+        m_frame(0)
     {
         mColor = fcn::Color(255, 255, 255, 255);
         setTargetPlane(static_cast<int>(m_renderbackend->getWidth()), static_cast<int>(m_renderbackend->getHeight()));
     }
 
+    OpenGLGuiGraphics::~OpenGLGuiGraphics()
+    {
+        for (auto const & item : m_cache) {
+            item.first->removeDeathListener(this);
+        }
+    }
+
     void OpenGLGuiGraphics::updateTarget()
     {
         setTargetPlane(static_cast<int>(m_renderbackend->getWidth()), static_cast<int>(m_renderbackend->getHeight()));
@@ -327,6 +350,7 @@ namespace FIFE
 
     void OpenGLGuiGraphics::_beginDraw()
     {
+        ++m_frame;
         fcn::Rectangle const area(0, 0, mWidth, mHeight);
         pushClipArea(area);
         m_renderbackend->pushClipArea(Rect(0, 0, mWidth, mHeight), false);
@@ -339,13 +363,23 @@ namespace FIFE
         // Cleanup
         popClipArea();
         m_renderbackend->popClipArea();
+
+        // forget the windows that were not drawn, e.g. hidden ones
+        for (auto it = m_cache.begin(); it != m_cache.end();) {
+            if (it->second.lastUse != m_frame) {
+                if (it->second.image) {
+                    ImageManager::instance()->remove(it->second.image);
+                }
+                it->first->removeDeathListener(this);
+                it = m_cache.erase(it);
+            } else {
+                ++it;
+            }
+        }
     }
 
     bool OpenGLGuiGraphics::pushClipArea(fcn::Rectangle area)
     {
-        // Render what we gathered so far
-        m_renderbackend->renderVertexArrays();
-
         // Use the generic fcn clip-stack logic. The fcn::opengl::Graphics
         // popClipArea implementation in current dependencies is recursive.
         fcn::opengl::Graphics::pushClipArea(area);
@@ -353,6 +387,7 @@ namespace FIFE
         // Due to some odd conception in guiChan some of area
         // has xOffset and yOffset > 0. And if it happens we
         // need to offset our clip area. Or we can use Fifechan stack.
+        // The batched objects keep their clip area, so nothing has to be rendered yet.
         fcn::ClipRectangle const & top = mClipStack.top();
 
         m_renderbackend->pushClipArea(Rect(top.x, top.y, top.width, top.height), false);
@@ -362,9 +397,6 @@ namespace FIFE
 
     void OpenGLGuiGraphics::popClipArea()
     {
-        // Render what we gathered so far
-        m_renderbackend->renderVertexArrays();
-
         // Use the generic fcn clip-stack logic. The fcn::opengl::Graphics
         // popClipArea implementation in current dependencies is recursive.
         fcn::opengl::Graphics::popClipArea();
@@ -376,4 +408,143 @@ namespace FIFE
     {
         mColor = color;
     }
+
+    void OpenGLGuiGraphics::drawCached(fcn::Widget* widget, std::function<void()> const & draw)
+    {
+        int32_t const width  = widget->getWidth();
+        int32_t const height = widget->getHeight();
+        if (!m_cacheEnabled || m_cacheDepth > 0 || width <= 0 || height <= 0 || width > maxCacheSize ||
+            height > maxCacheSize) {
+            draw();
+            return;
+        }
+
+        auto [it, inserted] = m_cache.try_emplace(widget);
+        if (inserted) {
+            // a deleted widget must not leave its texture to a new one at the same address
+            widget->addDeathListener(this);
+        }
+        CacheEntry& entry = it->second;
+        entry.lastUse     = m_frame;
+        if (entry.skip > 0) {
+            --entry.skip;
+            entry.dirty = true;
+            draw();
+            return;
+        }
+
+        // the clip area of the widget, the offset is its position on the screen
+        fcn::ClipRectangle const & top = mClipStack.top();
+        Rect const area(top.xOffset, top.yOffset, width, height);
+        // the visible part of the widget, relative to it
+        Rect const clip(top.x - top.xOffset, top.y - top.yOffset, top.width, top.height);
+
+        // an image of another size is replaced
+        bool const sized = entry.image && std::cmp_equal(entry.image->getWidth(), width) &&
+                           std::cmp_equal(entry.image->getHeight(), height);
+        if (sized && clip != entry.clip) {
+            entry.dirty = true;
+        }
+        for (GLuint const texId : entry.textures) {
+            if (m_renderbackend->getTextureStamp(texId) > entry.stamp) {
+                // an image of the widget was changed, e.g. a text was rendered again
+                entry.dirty = true;
+                break;
+            }
+        }
+
+        if (!sized || entry.dirty) {
+            RenderBackendOpenGL::BatchMark const mark = m_renderbackend->markBatch();
+            ++m_cacheDepth;
+            draw();
+            --m_cacheDepth;
+
+            if (!m_renderbackend->isBatchIntact(mark)) {
+                // a part was rendered right away, e.g. a surface
+                entry.skip = skipCacheFrames;
+                return;
+            }
+
+            if (!sized) {
+                if (entry.image) {
+                    ImageManager::instance()->remove(entry.image);
+                }
+                entry.image = ImageManager::instance()->loadBlank(
+                    static_cast<uint32_t>(width), static_cast<uint32_t>(height));
+            }
+            entry.textures = m_renderbackend->getBatchTextures(mark);
+            entry.stamp    = 0;
+            for (GLuint const texId : entry.textures) {
+                entry.stamp = std::max(entry.stamp, m_renderbackend->getTextureStamp(texId));
+            }
+            if (!m_renderbackend->renderBatchTo(mark, entry.image, Point(area.x, area.y))) {
+                FL_WARN(_log(), "OpenGLGuiGraphics::drawCached() - No framebuffer objects, render cache disabled");
+                m_cacheEnabled = false;
+                return;
+            }
+            entry.clip  = clip;
+            entry.dirty = false;
+            if (++entry.misses >= maxCacheMisses) {
+                entry.misses = 0;
+                entry.skip   = skipCacheFrames;
+            }
+        } else {
+            entry.misses = 0;
+        }
+
+        // the image is premultiplied with its alpha
+        entry.image->render(area);
+        m_renderbackend->changeRenderInfos(RENDER_DATA_WITHOUT_Z, 1, 1, 5, true, false, 0, KEEP, ALWAYS);
+    }
+
+    void OpenGLGuiGraphics::invalidate(fcn::Widget* widget)
+    {
+        // the widget is drawn into the texture of its outermost cached ancestor
+        for (fcn::Widget* current = widget; current != nullptr; current = current->getParent()) {
+            auto const it = m_cache.find(current);
+            if (it != m_cache.end()) {
+                it->second.dirty = true;
+            }
+        }
+    }
+
+    void OpenGLGuiGraphics::death(fcn::Event const & event)
+    {
+        auto const it = m_cache.find(event.getSource());
+        if (it != m_cache.end()) {
+            if (it->second.image) {
+                ImageManager::instance()->remove(it->second.image);
+            }
+            m_cache.erase(it);
+        }
+    }
+
+    void OpenGLGuiGraphics::setRenderCacheEnabled(bool enabled)
+    {
+        m_cacheEnabled = enabled;
+        if (!enabled) {
+            clearRenderCache();
+        }
+    }
+
+    bool OpenGLGuiGraphics::isRenderCacheEnabled() const
+    {
+        return m_cacheEnabled;
+    }
+
+    std::size_t OpenGLGuiGraphics::getRenderCacheSize() const
+    {
+        return m_cache.size();
+    }
+
+    void OpenGLGuiGraphics::clearRenderCache()
+    {
+        for (auto& item : m_cache) {
+            if (item.second.image) {
+                ImageManager::instance()->remove(item.second.image);
+            }
+            item.first->removeDeathListener(this);
+        }
+        m_cache.clear();
+    }
 } // namespace FIFE
@@ -8,30 +8,47 @@
 #include "platform.h"
 
 // Standard C++ library includes
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 // FIFE includes - GLEW must be included before OpenGL headers
 #include "video/opengl/fife_opengl.h"
 
 // 3rd party library includes
 #include <fifechan/backends/opengl/graphics.hpp>
+#include <fifechan/deathlistener.hpp>
 
 // FIFE includes
 // First block: files included from the FIFE root src dir
+#include "gui/fifechan/base/gui_rendercache.h"
+#include "util/structures/rect.h"
+#include "video/image.h"
 
 namespace FIFE
 {
     class RenderBackendOpenGL;
 
     /** Overrides Fifechan Graphics to enable usage of normal fife images & related facilities
+     *
+     * Clip areas are passed on to the renderbackend without a flush, so the whole gui is rendered in few batches.
+     * If the render cache is enabled, windows are kept in textures and only drawn again after they were invalidated.
      */
-    class FIFE_API OpenGLGuiGraphics : public fcn::opengl::Graphics
+    class FIFE_API OpenGLGuiGraphics :
+        public fcn::opengl::Graphics,
+        public IGuiRenderCache,
+        public fcn::DeathListener
     {
         public:
             /** Constructor
              */
             OpenGLGuiGraphics();
 
+            ~OpenGLGuiGraphics() override;
+
             OpenGLGuiGraphics(OpenGLGuiGraphics const &)            = delete;
             OpenGLGuiGraphics& operator=(OpenGLGuiGraphics const &) = delete;
 
@@ -67,8 +84,50 @@ namespace FIFE
 
             void setColor(fcn::Color const & color) override;
 
+            void drawCached(fcn::Widget* widget, std::function<void()> const & draw) override;
+            void invalidate(fcn::Widget* widget) override;
+
+            /** Forgets the texture of a deleted widget.
+             */
+            void death(fcn::Event const & event) override;
+
+            /** Enables keeping windows in textures, disabled by default.
+             * It needs framebuffer objects, without them it is disabled again when a window is drawn.
+             */
+            void setRenderCacheEnabled(bool enabled);
+            bool isRenderCacheEnabled() const;
+
+            /** Returns the number of widgets with a texture.
+             */
+            std::size_t getRenderCacheSize() const;
+
         private:
+            struct CacheEntry
+            {
+                    ImagePtr image;
+                    // the widget was invalidated since the image was rendered
+                    bool dirty = true;
+                    // visible part of the widget in the image, relative to the widget
+                    Rect clip;
+                    // textures the image was rendered from and the stamp of their last change then
+                    std::vector<GLuint> textures;
+                    uint64_t stamp = 0;
+                    // last frame the widget was drawn
+                    uint64_t lastUse = 0;
+                    // renders of the image in a row
+                    uint32_t misses = 0;
+                    // frames the widget is drawn without the image, it changed too often
+                    uint32_t skip = 0;
+            };
+
+            void clearRenderCache();
+
             RenderBackendOpenGL* m_renderbackend;
+            bool m_cacheEnabled;
+            // nesting of drawCached(), inner widgets are part of the outer texture
+            uint32_t m_cacheDepth;
+            uint64_t m_frame;
+            std::unordered_map<fcn::Widget*, CacheEntry> m_cache;
     };
 } // namespace FIFE
 
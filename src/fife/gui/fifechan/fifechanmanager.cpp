@@ -32,6 +32,7 @@
 #include "eventchannel/key/keyevent.h"
 #include "eventchannel/mouse/mouseevent.h"
 #include "gui/fifechan/base/gui_imageloader.h"
+#include "gui/fifechan/base/gui_rendercache.h"
 #include "gui/fifechan/base/sdl/sdl_gui_graphics.h"
 #include "gui/fifechan/console/console.h"
 #include "util/base/exception.h"
@@ -70,7 +71,8 @@ namespace FIFE
         m_fontsize(0),
         m_widgets(),
         m_logic_executed(false),
-        m_enabled_console(true)
+        m_enabled_console(true),
+        m_render_cache(false)
     {
 
         m_fcn_gui->setInput(m_input.get());
@@ -95,6 +97,10 @@ namespace FIFE
         bool const overWidget = // NOLINT(cppcoreguidelines-init-variables)
             m_fcn_topcontainer->getWidgetAt(m_lastMotionX, m_lastMotionY) != nullptr;
 
+        if (m_render_cache) {
+            invalidateInputWidgets();
+        }
+
         switch (evt.type) {
         case SDL_EVENT_MOUSE_WHEEL:
         case SDL_EVENT_MOUSE_BUTTON_DOWN:
@@ -124,6 +130,10 @@ namespace FIFE
         case SDL_EVENT_MOUSE_MOTION:
             m_lastMotionX = static_cast<int32_t>(evt.motion.x);
             m_lastMotionY = static_cast<int32_t>(evt.motion.y);
+            if (m_render_cache) {
+                // the widget the mouse enters changes too
+                invalidateInputWidgets();
+            }
             if (m_fcn_topcontainer->getWidgetAt(static_cast<int>(evt.motion.x), static_cast<int>(evt.motion.y)) !=
                 nullptr) {
                 m_had_mouse = true;
@@ -225,6 +235,7 @@ namespace FIFE
         }
 #endif
         m_backend = backend;
+        setRenderCacheEnabled(m_render_cache);
 
         m_fcn_gui->setGraphics(m_gui_graphics.get());
         if (m_enabled_console) {
@@ -430,6 +441,36 @@ namespace FIFE
         return m_fcn_gui->isTabbingEnabled();
     }
 
+    void FifechanManager::setRenderCacheEnabled(bool cache)
+    {
+        m_render_cache = cache;
+#ifdef HAVE_OPENGL
+        if (m_backend == "OpenGL") {
+            dynamic_cast<OpenGLGuiGraphics*>(m_gui_graphics.get())->setRenderCacheEnabled(cache);
+        }
+#endif
+    }
+
+    bool FifechanManager::isRenderCacheEnabled() const
+    {
+        return m_render_cache;
+    }
+
+    void FifechanManager::invalidateWidget(fcn::Widget* widget)
+    {
+        auto* cache = dynamic_cast<IGuiRenderCache*>(m_gui_graphics.get());
+        if (cache != nullptr && widget != nullptr) {
+            cache->invalidate(widget);
+        }
+    }
+
+    void FifechanManager::invalidateInputWidgets()
+    {
+        invalidateWidget(m_fcn_topcontainer->getWidgetAt(m_lastMotionX, m_lastMotionY));
+        invalidateWidget(m_focushandler->getFocused());
+        invalidateWidget(m_focushandler->getDraggedWidget());
+    }
+
     int32_t FifechanManager::convertFifechanKeyToFifeKey(int32_t value)
     {
         // Both fifechan and fifengine now use the same SDL3 keycodes 1:1.
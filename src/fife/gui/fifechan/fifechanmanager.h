@@ -206,10 +206,42 @@ namespace FIFE
              */
             bool isTabbingEnabled() const;
 
+            /**
+             * Sets whether windows are kept in textures and only drawn again after they were
+             * invalidated. Only the OpenGL backend supports it, disabled by default.
+             *
+             * @param cache True if the render cache should be enabled, false otherwise.
+             * @see isRenderCacheEnabled
+             */
+            void setRenderCacheEnabled(bool cache);
+
+            /**
+             * Checks if the render cache is enabled.
+             *
+             * @return True if the render cache is enabled, false otherwise.
+             * @see setRenderCacheEnabled
+             */
+            bool isRenderCacheEnabled() const;
+
+            /**
+             * Marks the cached window that contains the widget as changed, so it is drawn
+             * again. Input events invalidate the widgets they reach by themselves.
+             *
+             * @param widget The widget that changed its drawing.
+             * @see setRenderCacheEnabled
+             */
+            void invalidateWidget(fcn::Widget* widget);
+
         protected:
             static int32_t convertFifechanKeyToFifeKey(int32_t value);
 
         private:
+            /**
+             * Invalidates the widgets an input event can change: the ones under the
+             * mouse, the focused and the dragged widget.
+             */
+            void invalidateInputWidgets();
+
             // The Fifechan GUI.
             std::unique_ptr<fcn::Gui> m_fcn_gui;
             // Fifechan Graphics
@@ -251,6 +283,8 @@ namespace FIFE
             bool m_logic_executed;
             // True if the console should be created
             bool m_enabled_console;
+            // True if windows should be kept in textures
+            bool m_render_cache;
 
             std::string m_backend;
     };
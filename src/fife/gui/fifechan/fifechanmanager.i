@@ -50,6 +50,9 @@ namespace FIFE {
 
 		void setTabbingEnabled(bool tabbing);
 		bool isTabbingEnabled() const;
+		void setRenderCacheEnabled(bool cache);
+		bool isRenderCacheEnabled() const;
+		void invalidateWidget(fcn::Widget* widget);
 	private:
 		virtual void turn();
 		virtual void resizeTopContainer(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
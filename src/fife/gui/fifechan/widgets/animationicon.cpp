@@ -12,6 +12,7 @@
 
 // FIFE includes
 #include "gui/fifechan/base/gui_image.h"
+#include "gui/fifechan/fifechanmanager.h"
 #include "util/base/exception.h"
 #include "util/time/sdltimecompat.h"
 #include "util/time/timemanager.h"
@@ -76,6 +77,7 @@ namespace fcn
             setImage(mCurrentImage.get());
         }
         adjustSize();
+        FIFE::FifechanManager::instance()->invalidateWidget(this);
     }
 
     FIFE::AnimationPtr AnimationIcon::getAnimation() const
@@ -120,6 +122,7 @@ namespace fcn
             mFrameIndex   = 0;
             mCurrentImage = std::make_unique<FIFE::GuiImage>(mAnimation->getFrame(mFrameIndex));
             setImage(mCurrentImage.get());
+            FIFE::FifechanManager::instance()->invalidateWidget(this);
         }
     }
 
@@ -144,6 +147,8 @@ namespace fcn
                     mCurrentImage = std::make_unique<FIFE::GuiImage>(mAnimation->getFrame(mFrameIndex));
                 }
                 setImage(mCurrentImage.get());
+                // a cached window around the icon has to draw the new frame
+                FIFE::FifechanManager::instance()->invalidateWidget(this);
             }
         }
     }
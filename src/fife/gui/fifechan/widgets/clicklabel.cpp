@@ -147,14 +147,15 @@ namespace fcn
                 }
                 mWrappedText = mGuiFont->splitTextToWidth(mCaption, textW);
             } else {
-                FIFE::Image const * image = mGuiFont->getAsImageMultiline(mCaption);
+                FIFE::Point const textSize = mGuiFont->getTextSize(mCaption);
 
                 w = static_cast<int32_t>(
-                    image->getWidth() + (2 * getBorderSize()) + getPaddingLeft() + getPaddingRight());
+                    static_cast<uint32_t>(textSize.x) + (2 * getBorderSize()) + getPaddingLeft() + getPaddingRight());
             }
-            std::string const & text  = isTextWrapping() ? mWrappedText : mCaption;
-            FIFE::Image const * image = mGuiFont->getAsImageMultiline(text);
-            h = static_cast<int32_t>((2 * getBorderSize()) + getPaddingTop() + getPaddingBottom() + image->getHeight());
+            std::string const & text   = isTextWrapping() ? mWrappedText : mCaption;
+            FIFE::Point const textSize = mGuiFont->getTextSize(text);
+            h                          = static_cast<int32_t>(
+                (2 * getBorderSize()) + getPaddingTop() + getPaddingBottom() + static_cast<uint32_t>(textSize.y));
             setSize(w, h);
         }
     }
@@ -190,14 +191,14 @@ namespace fcn
 
         if (mGuiFont != nullptr) {
             graphics->setColor(getForegroundColor());
-            std::string const & text  = isTextWrapping() ? mWrappedText : mCaption;
-            FIFE::Image const * image = mGuiFont->getAsImageMultiline(text);
+            std::string const & text   = isTextWrapping() ? mWrappedText : mCaption;
+            FIFE::Point const textSize = mGuiFont->getTextSize(text);
 
             int32_t textX = 0;
             int32_t const textY =
                 offsetRec.y + static_cast<int32_t>(getPaddingTop()) +
                 ((getHeight() - offsetRec.height - static_cast<int32_t>(getPaddingTop()) -
-                  static_cast<int32_t>(getPaddingBottom()) - static_cast<int32_t>(image->getHeight())) /
+                  static_cast<int32_t>(getPaddingBottom()) - textSize.y) /
                  2);
 
             switch (getAlignment()) {
@@ -207,12 +208,11 @@ namespace fcn
             case Graphics::Alignment::Center:
                 textX = offsetRec.x + static_cast<int32_t>(getPaddingLeft()) +
                         ((getWidth() - offsetRec.width - static_cast<int32_t>(getPaddingLeft()) -
-                          static_cast<int32_t>(getPaddingRight()) - static_cast<int32_t>(image->getWidth())) /
+                          static_cast<int32_t>(getPaddingRight()) - textSize.x) /
                          2);
                 break;
             case Graphics::Alignment::Right:
-                textX = getWidth() - offsetRec.x - static_cast<int32_t>(getPaddingRight()) -
-                        static_cast<int32_t>(image->getWidth());
+                textX = getWidth() - offsetRec.x - static_cast<int32_t>(getPaddingRight()) - textSize.x;
                 break;
             default:
                 fcn::throwException("Unknown alignment.");
@@ -9,12 +9,15 @@
  */
 
 // Standard C++ library includes
+#include <algorithm>
 
 // 3rd party library includes
 #include <fifechan/graphics.hpp>
 #include <fifechan/rectangle.hpp>
 
 // FIFE includes
+#include "gui/fifechan/fifechanmanager.h"
+
 namespace fcn
 {
 
@@ -51,17 +54,13 @@ namespace fcn
 
     void PercentageBar::setValue(int32_t value)
     {
-        if (value > 100) {
-            mValue = 100;
+        value = std::clamp(value, 0, 100);
+        if (value == mValue) {
             return;
         }
-
-        if (value < 0) {
-            mValue = 0;
-            return;
-        }
-
         mValue = value;
+        // a cached window around the bar has to draw it again
+        FIFE::FifechanManager::instance()->invalidateWidget(this);
     }
 
     int32_t PercentageBar::getValue() const
@@ -12,6 +12,7 @@
 // 3rd party library includes
 
 // FIFE includes
+#include "gui/fifechan/base/gui_rendercache.h"
 #include "gui/fifechan/fifechanmanager.h"
 #include "gui/fifechan/widgets/resizablewindow.h"
 #include "util/base/exception.h"
@@ -303,6 +304,18 @@ namespace fcn
         }
     }
 
+    void ResizableWindow::draw(Graphics* graphics)
+    {
+        auto* cache = dynamic_cast<FIFE::IGuiRenderCache*>(graphics);
+        if (cache == nullptr) {
+            Window::draw(graphics);
+            return;
+        }
+        cache->drawCached(this, [this, graphics]() {
+            Window::draw(graphics);
+        });
+    }
+
     void ResizableWindow::mouseEntered(MouseEvent& mouseEvent)
     {
         if (m_resizable && !m_resizing) {
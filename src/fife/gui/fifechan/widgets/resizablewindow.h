@@ -159,6 +159,10 @@ namespace fcn
 
             virtual void resizeToContent(bool recursiv = true);
 
+            /** Draws the window with its children, through the render cache of the graphics if they have one.
+             */
+            virtual void draw(Graphics* graphics);
+
             // Inherited from FocusListener
 
             virtual void focusLost(Event const & event);
@@ -16,6 +16,7 @@
 #include "sounddecoder_ogg.h"
 #include "util/base/exception.h"
 #include "util/log/logger.h"
+#include "vfs/raw/rawdata.h"
 #include "vfs/vfs.h"
 
 namespace FIFE
@@ -7,9 +7,12 @@
 // Standard C++ library includes
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <span>
+#include <utility>
+#include <vector>
 
 // Platform specific includes
 
@@ -18,6 +21,7 @@
 // FIFE includes
 #include "util/base/exception.h"
 #include "util/log/logger.h"
+#include "vfs/raw/rawdata.h"
 
 namespace FIFE
 {
@@ -36,46 +40,40 @@ namespace FIFE
          */
         size_t read(void* ptr, size_t size, size_t nmemb, void* datasource)
         {
-            auto* rdp            = static_cast<RawData*>(datasource);
-            size_t const restlen = rdp->getDataLength() - rdp->getCurrentIndex();
+            auto* source         = static_cast<SoundDecoderOgg::Source*>(datasource);
+            size_t const restlen = source->data->size() - source->index;
             size_t const len     = (restlen <= size * nmemb) ? restlen : size * nmemb;
             if (len != 0U) {
-                rdp->readInto(static_cast<uint8_t*>(ptr), len);
+                std::memcpy(ptr, source->data->data() + source->index, len);
+                source->index += len;
             }
             return len;
         }
 
         int seek(void* datasource, ogg_int64_t offset, int whence)
         {
-            auto* rdp                 = static_cast<RawData*>(datasource);
-            int64_t const data_length = static_cast<int64_t>(rdp->getDataLength());
+            auto* source              = static_cast<SoundDecoderOgg::Source*>(datasource);
+            int64_t const data_length = static_cast<int64_t>(source->data->size());
 
+            int64_t target_index = 0;
             switch (whence) {
-            case SEEK_SET: {
-                if (offset < 0 || offset >= data_length) {
-                    return -1;
-                }
-                rdp->setIndex(static_cast<uint32_t>(offset));
-                return 0;
-            }
+            case SEEK_SET:
+                target_index = offset;
+                break;
             case SEEK_CUR:
-                if (offset < static_cast<ogg_int64_t>(std::numeric_limits<int32_t>::min()) ||
-                    offset > static_cast<ogg_int64_t>(std::numeric_limits<int32_t>::max())) {
-                    return -1;
-                }
-                rdp->moveIndex(static_cast<int32_t>(offset));
-                return 0;
-            case SEEK_END: {
-                int64_t const target_index = data_length - 1 + static_cast<int64_t>(offset);
-                if (target_index < 0 || target_index >= data_length) {
-                    return -1;
-                }
-                rdp->setIndex(static_cast<uint32_t>(target_index));
-                return 0;
-            }
+                target_index = static_cast<int64_t>(source->index) + offset;
+                break;
+            case SEEK_END:
+                target_index = data_length + offset;
+                break;
             default:
                 return -1;
             }
+            if (target_index < 0 || target_index > data_length) {
+                return -1;
+            }
+            source->index = static_cast<size_t>(target_index);
+            return 0;
         }
 
         int close(void* datasource)
@@ -87,17 +85,30 @@ namespace FIFE
         // Required by ov_callbacks::tell_func ABI from libvorbis.
         long tell(void* datasource) // NOLINT(runtime/int)
         {
-            auto* rdp = static_cast<RawData*>(datasource);
-            return static_cast<long>((*rdp).getCurrentIndex()); // NOLINT(runtime/int)
+            auto const * source = static_cast<SoundDecoderOgg::Source const *>(datasource);
+            return static_cast<long>(source->index); // NOLINT(runtime/int)
         }
     } // namespace
 
-    SoundDecoderOgg::SoundDecoderOgg(RawData* rdp) : m_file(rdp), m_ovf{}
+    SoundDecoderOgg::SoundDecoderOgg(RawData* rdp) : m_declength(0), m_datasize(0), m_ovf{}
     {
+        std::unique_ptr<RawData> const file(rdp);
+        m_source.data = std::make_shared<std::vector<uint8_t> const>(file->getDataInBytes());
+        open();
+    }
+
+    SoundDecoderOgg::SoundDecoderOgg(std::shared_ptr<std::vector<uint8_t> const> data) :
+        m_declength(0), m_datasize(0), m_ovf{}
+    {
+        m_source.data = std::move(data);
+        open();
+    }
 
+    void SoundDecoderOgg::open()
+    {
         ov_callbacks const ocb = {.read_func = read, .seek_func = seek, .close_func = close, .tell_func = tell};
 
-        if (0 > ov_open_callbacks(m_file.get(), &m_ovf, nullptr, 0, ocb)) {
+        if (0 > ov_open_callbacks(&m_source, &m_ovf, nullptr, 0, ocb)) {
             throw InvalidFormat("Error opening OggVorbis file");
         }
 
@@ -179,4 +190,9 @@ namespace FIFE
     {
         m_data.reset();
     }
+
+    std::unique_ptr<SoundDecoder> SoundDecoderOgg::clone() const
+    {
+        return std::unique_ptr<SoundDecoder>(new SoundDecoderOgg(m_source.data));
+    }
 } // namespace FIFE
@@ -8,19 +8,28 @@
 #include "platform.h"
 
 // Standard C++ library includes
+#include <cstdint>
 #include <memory>
+#include <vector>
+
 // 3rd party library includes
 #include <vorbis/vorbisfile.h>
 
 // FIFE includes
 #include "audio/sounddecoder.h"
-#include "vfs/raw/rawdata.h"
 
 namespace FIFE
 {
+    class RawData;
+
     class FIFE_API SoundDecoderOgg : public SoundDecoder
     {
         public:
+            /** Constructor
+             *
+             * Reads the complete compressed file into memory and takes ownership of rdp.
+             * Clones share these bytes, so every stream only adds its own Vorbis state.
+             */
             explicit SoundDecoderOgg(RawData* rdp);
 
             SoundDecoderOgg(SoundDecoderOgg const &)            = delete;
@@ -68,8 +77,25 @@ namespace FIFE
              */
             void releaseBuffer() override;
 
+            std::unique_ptr<SoundDecoder> clone() const override;
+
+            /** Read position of one decoder in the shared compressed data.
+             *  Passed to the OggVorbis callbacks as datasource.
+             */
+            struct Source
+            {
+                    std::shared_ptr<std::vector<uint8_t> const> data;
+                    size_t index = 0;
+            };
+
         private:
-            std::unique_ptr<RawData> m_file;
+            explicit SoundDecoderOgg(std::shared_ptr<std::vector<uint8_t> const> data);
+
+            /** Opens the Vorbis stream on m_source and reads the stream properties.
+             */
+            void open();
+
+            Source m_source;
             uint64_t m_declength;
             uint64_t m_datasize;
             std::unique_ptr<char[]> m_data;
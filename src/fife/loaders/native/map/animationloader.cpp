@@ -11,13 +11,12 @@
 #include <vector>
 
 // FIFE includes
+#include "assetdatabase.h"
 #include "util/base/exception.h"
 #include "util/log/logger.h"
 #include "util/resource/resource.h"
 #include "util/resource/resourcemanager.h"
-#include "util/xml/xmlhelper.h"
 #include "vfs/filesystem.h"
-#include "vfs/raw/rawdata.h"
 #include "vfs/vfs.h"
 #include "video/animation.h"
 #include "video/animationmanager.h"
@@ -42,64 +41,25 @@ namespace FIFE
 
     bool AnimationLoader::isLoadable(std::string const & filename)
     {
-        fs::path const animPath(filename);
-
-        std::string const animationFilename = animPath.string();
-        XML::Document animFile;
-
+        AssetFileRecord storage;
+        AssetFileRecord const * file = nullptr;
         try {
-            auto data = m_vfs->open(animationFilename);
-
-            if (data != nullptr) {
-                if (data->getDataLength() != 0) {
-                    // TODO - this could be expanded to do more checks
-                    std::string const xml = data->readString(data->getDataLength());
-
-                    if (!XML::Parse(animFile, xml)) {
-                        return false;
-                    }
-                }
-            }
+            file = AssetDatabase::read(m_vfs, filename, storage);
         } catch (NotFound&) {
             return false;
         }
 
-        // if we get here then loading the file went well
-        XML::Element* root = animFile.RootElement();
-
-        if (XML::HasName(root, "assets")) {
-            if (root->FirstChildElement("animation") != nullptr) {
-                return true;
-            }
-        }
-
-        if (XML::HasName(root, "animation")) {
-            return true;
-        }
-
-        return false;
+        return file != nullptr && !file->animations.empty();
     }
 
     AnimationPtr AnimationLoader::load(std::string const & filename)
     {
-        std::string const & animationFilename = filename;
-
-        XML::Document doc;
-
+        AssetFileRecord storage;
+        AssetFileRecord const * file = nullptr;
         AnimationPtr animation;
 
         try {
-            auto data = m_vfs->open(animationFilename);
-
-            if (data != nullptr) {
-                if (data->getDataLength() != 0) {
-                    std::string const xml = data->readString(data->getDataLength());
-
-                    if (!XML::Parse(doc, xml)) {
-                        return animation;
-                    }
-                }
-            }
+            file = AssetDatabase::read(m_vfs, filename, storage);
         } catch (NotFound& e) {
             FL_ERR(_log(), e.what());
 
@@ -110,18 +70,9 @@ namespace FIFE
             return animation;
         }
 
-        // if we get here then everything loaded properly
-        // so we can just parse out the contents
-        XML::Element* root = doc.RootElement();
-
-        XML::Element* animElem = nullptr;
-        if (XML::HasName(root, "assets")) {
-            animElem = root->FirstChildElement("animation");
-        } else if (XML::HasName(root, "animation")) {
-            animElem = root;
-        }
-        if (animElem != nullptr) {
-            animation = loadAnimation(filename, animElem);
+        // the first animation of an <assets> file or the <animation> root
+        if (file != nullptr && !file->animations.empty()) {
+            animation = loadAnimation(filename, file->animations.front());
         }
 
         return animation;
@@ -129,26 +80,12 @@ namespace FIFE
 
     std::vector<AnimationPtr> AnimationLoader::loadMultiple(std::string const & filename)
     {
-        fs::path const animPath(filename);
-
-        std::string const animationFile = animPath.string();
-
-        XML::Document doc;
-
+        AssetFileRecord storage;
+        AssetFileRecord const * file = nullptr;
         std::vector<AnimationPtr> animationVector;
 
         try {
-            auto data = m_vfs->open(animationFile);
-
-            if (data != nullptr) {
-                if (data->getDataLength() != 0) {
-                    std::string const xml = data->readString(data->getDataLength());
-
-                    if (!XML::Parse(doc, xml)) {
-                        return animationVector;
-                    }
-                }
-            }
+            file = AssetDatabase::read(m_vfs, filename, storage);
         } catch (NotFound& e) {
             FL_ERR(_log(), e.what());
 
@@ -159,14 +96,9 @@ namespace FIFE
             return animationVector;
         }
 
-        // if we get here then everything loaded properly
-        // so we can just parse out the contents
-        XML::Element* root = doc.RootElement();
-
-        if (XML::HasName(root, "assets")) {
-            for (XML::Element* animationElem = root->FirstChildElement("animation"); animationElem != nullptr;
-                 animationElem               = animationElem->NextSiblingElement("animation")) {
-                AnimationPtr const animation = loadAnimation(filename, animationElem);
+        if (file != nullptr && file->root == AssetFileRecord::RootAssets) {
+            for (AnimationRecord const & record : file->animations) {
+                AnimationPtr const animation = loadAnimation(filename, record);
                 if (animation) {
                     animationVector.push_back(animation);
                 }
@@ -176,24 +108,20 @@ namespace FIFE
         return animationVector;
     }
 
-    AnimationPtr AnimationLoader::loadAnimation(std::string const & filename, tinyxml2::XMLElement* animationElem)
+    AnimationPtr AnimationLoader::loadAnimation(std::string const & filename, AnimationRecord const & record)
     {
         AnimationPtr animation;
-        if (animationElem == nullptr) {
-            return animation;
-        }
 
         fs::path animPath(filename);
         std::string const animationFile = GetFilenameFromPath(animPath);
 
         bool alreadyLoaded = false;
         // first try to use the id, if no id exists it use the filename as fallback
-        char const * animationId = XML::Attribute(animationElem, "id");
-        if (animationId != nullptr) {
-            if (!m_animationManager->exists(animationId)) {
-                animation = m_animationManager->create(animationId);
+        if (record.id) {
+            if (!m_animationManager->exists(*record.id)) {
+                animation = m_animationManager->create(*record.id);
             } else {
-                animation     = m_animationManager->getPtr(animationId);
+                animation     = m_animationManager->getPtr(*record.id);
                 alreadyLoaded = animation->getFrameCount() != 0;
             }
         } else {
@@ -214,33 +142,21 @@ namespace FIFE
             return animation;
         }
 
-        int direction   = 0;
-        int actionFrame = -1;
-        int animDelay   = 0;
-        int animXoffset = 0;
-        int animYoffset = 0;
-
-        int success = XML::QueryAttribute(animationElem, "direction", &direction);
-        if (success == XML::SUCCESS) {
-            assert(direction >= 0);
-            animation->setDirection(static_cast<uint32_t>(direction));
+        if (record.direction) {
+            assert(*record.direction >= 0);
+            animation->setDirection(static_cast<uint32_t>(*record.direction));
         }
-        success = XML::QueryAttribute(animationElem, "action_frame", &actionFrame);
-        if (success == XML::SUCCESS) {
-            animation->setActionFrame(actionFrame);
+        if (record.actionFrame) {
+            animation->setActionFrame(*record.actionFrame);
         }
-        XML::QueryAttribute(animationElem, "delay", &animDelay);
-        XML::QueryAttribute(animationElem, "x_offset", &animXoffset);
-        XML::QueryAttribute(animationElem, "y_offset", &animYoffset);
 
         // Check for atlas-based animation (shared sub-images from a sprite sheet)
-        char const * atlasSource = XML::Attribute(animationElem, "atlas");
-        if (atlasSource != nullptr) {
+        if (record.atlas) {
             fs::path atlasPath(filename);
             if (HasParentPath(atlasPath)) {
-                atlasPath = GetParentPath(atlasPath) / atlasSource;
+                atlasPath = GetParentPath(atlasPath) / *record.atlas;
             } else {
-                atlasPath = fs::path(atlasSource);
+                atlasPath = fs::path(*record.atlas);
             }
 
             ImagePtr atlasImgPtr;
@@ -250,109 +166,45 @@ namespace FIFE
                 atlasImgPtr = m_imageManager->getPtr(atlasPath.string());
             }
 
-            int animFrameWidth  = 0;
-            int animFrameHeight = 0;
-            XML::QueryAttribute(animationElem, "width", &animFrameWidth);
-            XML::QueryAttribute(animationElem, "height", &animFrameHeight);
-
-            for (XML::Element* frameElement = animationElem->FirstChildElement("frame"); frameElement != nullptr;
-                 frameElement               = frameElement->NextSiblingElement("frame")) {
-                char const * sourceId = XML::Attribute(frameElement, "source");
-                if (sourceId == nullptr) {
-                    continue;
-                }
-
-                int xpos = 0;
-                int ypos = 0;
-                int fw   = animFrameWidth;
-                int fh   = animFrameHeight;
-                XML::QueryAttribute(frameElement, "xpos", &xpos);
-                XML::QueryAttribute(frameElement, "ypos", &ypos);
-                XML::QueryAttribute(frameElement, "width", &fw);
-                XML::QueryAttribute(frameElement, "height", &fh);
-
+            for (AnimationFrameRecord const & frame : record.frames) {
                 ImagePtr imagePtr;
-                if (!m_imageManager->exists(sourceId)) {
-                    imagePtr = m_imageManager->create(sourceId);
-                    imagePtr->useSharedImage(atlasImgPtr, Rect(xpos, ypos, fw, fh));
+                if (!m_imageManager->exists(frame.source)) {
+                    imagePtr = m_imageManager->create(frame.source);
+                    imagePtr->useSharedImage(atlasImgPtr, frame.region);
                 } else {
-                    imagePtr = m_imageManager->getPtr(sourceId);
+                    imagePtr = m_imageManager->getPtr(frame.source);
                 }
 
                 if (imagePtr) {
-                    int frameXoffset = 0;
-                    success          = XML::QueryAttribute(frameElement, "x_offset", &frameXoffset);
-                    if (success == XML::SUCCESS) {
-                        imagePtr->setXShift(frameXoffset);
-                    } else {
-                        imagePtr->setXShift(animXoffset);
-                    }
-
-                    int frameYoffset = 0;
-                    success          = XML::QueryAttribute(frameElement, "y_offset", &frameYoffset);
-                    if (success == XML::SUCCESS) {
-                        imagePtr->setYShift(frameYoffset);
-                    } else {
-                        imagePtr->setYShift(animYoffset);
-                    }
-
-                    int frameDelay = 0;
-                    success        = XML::QueryAttribute(frameElement, "delay", &frameDelay);
-                    if (success == XML::SUCCESS) {
-                        animation->addFrame(imagePtr, static_cast<uint32_t>(frameDelay));
-                    } else {
-                        animation->addFrame(imagePtr, static_cast<uint32_t>(animDelay));
-                    }
+                    imagePtr->setXShift(frame.xOffset);
+                    imagePtr->setYShift(frame.yOffset);
+                    animation->addFrame(imagePtr, static_cast<uint32_t>(frame.delay));
                 }
             }
         } else {
-            for (XML::Element* frameElement = animationElem->FirstChildElement("frame"); frameElement != nullptr;
-                 frameElement               = frameElement->NextSiblingElement("frame")) {
-                char const * sourceId = XML::Attribute(frameElement, "source");
-                if (sourceId != nullptr) {
-                    fs::path framePath(filename);
-
-                    if (HasParentPath(framePath)) {
-                        framePath = GetParentPath(framePath) / sourceId;
-                        if (!fs::exists(framePath)) {
-                            framePath = fs::path(sourceId);
-                        }
-                    } else {
-                        framePath = fs::path(sourceId);
-                    }
+            for (AnimationFrameRecord const & frame : record.frames) {
+                fs::path framePath(filename);
 
-                    ImagePtr imagePtr;
-                    if (!m_imageManager->exists(framePath.string())) {
-                        imagePtr = m_imageManager->create(framePath.string());
-                    } else {
-                        imagePtr = m_imageManager->getPtr(framePath.string());
+                if (HasParentPath(framePath)) {
+                    framePath = GetParentPath(framePath) / frame.source;
+                    if (!fs::exists(framePath)) {
+                        framePath = fs::path(frame.source);
                     }
+                } else {
+                    framePath = fs::path(frame.source);
+                }
 
-                    if (imagePtr) {
-                        int frameXoffset = 0;
-                        success          = XML::QueryAttribute(frameElement, "x_offset", &frameXoffset);
-                        if (success == XML::SUCCESS) {
-                            imagePtr->setXShift(frameXoffset);
-                        } else {
-                            imagePtr->setXShift(animXoffset);
-                        }
-
-                        int frameYoffset = 0;
-                        success          = XML::QueryAttribute(frameElement, "y_offset", &frameYoffset);
-                        if (success == XML::SUCCESS) {
-                            imagePtr->setYShift(frameYoffset);
-                        } else {
-                            imagePtr->setYShift(animYoffset);
-                        }
-
-                        int frameDelay = 0;
-                        success        = XML::QueryAttribute(frameElement, "delay", &frameDelay);
-                        if (success == XML::SUCCESS) {
-                            animation->addFrame(imagePtr, static_cast<uint32_t>(frameDelay));
-                        } else {
-                            animation->addFrame(imagePtr, static_cast<uint32_t>(animDelay));
-                        }
-                    }
+                ImagePtr imagePtr;
+                if (!m_imageManager->exists(framePath.string())) {
+                    imagePtr = m_imageManager->create(framePath.string());
+                } else {
+                    imagePtr = m_imageManager->getPtr(framePath.string());
+                }
+
+                if (imagePtr) {
+                    imagePtr->setXShift(frame.xOffset);
+                    imagePtr->setYShift(frame.yOffset);
+                    animation->addFrame(imagePtr, static_cast<uint32_t>(frame.delay));
                 }
             }
         }
@@ -17,17 +17,13 @@
 #include "ianimationloader.h"
 #include "video/animation.h"
 
-namespace tinyxml2
-{
-    class XMLElement;
-}
-
 namespace FIFE
 {
 
     class VFS;
     class ImageManager;
     class AnimationManager;
+    struct AnimationRecord;
 
     class FIFE_API AnimationLoader : public IAnimationLoader
     {
@@ -44,7 +40,7 @@ namespace FIFE
             std::vector<AnimationPtr> loadMultiple(std::string const & filename) override;
 
         private:
-            AnimationPtr loadAnimation(std::string const & filename, tinyxml2::XMLElement* animationElem);
+            AnimationPtr loadAnimation(std::string const & filename, AnimationRecord const & record);
 
             VFS* m_vfs;
             ImageManager* m_imageManager;
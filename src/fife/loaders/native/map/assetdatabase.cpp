@@ -0,0 +1,1204 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Corresponding header include
+#include "assetdatabase.h"
+
+// Standard C++ library includes
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Platform specific includes
+#ifdef FIFE_OS_WINDOWS
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+// 3rd party library includes
+
+// FIFE includes
+#include "util/base/exception.h"
+#include "util/log/logger.h"
+#include "util/xml/xmlhelper.h"
+#include "vfs/filesystem.h"
+#include "vfs/raw/rawdata.h"
+#include "vfs/vfs.h"
+
+namespace FIFE
+{
+    namespace
+    {
+        /** Logger to use for this source file.
+         *  @relates Logger
+         */
+        Logger& _log()
+        {
+            static Logger log(LM_NATIVE_LOADERS);
+            return log;
+        }
+
+        // bump whenever a record changes
+        constexpr uint32_t FORMAT_VERSION = 2;
+        constexpr char MAGIC[8]           = {'F', 'I', 'F', 'E', 'A', 'D', 'B', '\0'};
+        // the database is read in native byte order
+        constexpr uint32_t ENDIAN_MARKER = 0x01020304;
+
+        std::vector<AssetDatabase*>& openDatabases()
+        {
+            static std::vector<AssetDatabase*> databases;
+            return databases;
+        }
+
+        /** Returns the part of filename below directory, nullopt if it is not inside.
+         *
+         * The directory itself is inside with an empty key.
+         */
+        std::optional<std::string> relativeKey(std::string const & directory, std::string const & filename)
+        {
+            if (directory.empty() || filename == directory) {
+                return filename.substr(directory.size());
+            }
+            if (filename.size() <= directory.size() + 1 || !filename.starts_with(directory)) {
+                return std::nullopt;
+            }
+            char const separator = filename[directory.size()];
+            if (separator != '/' && separator != '\\') {
+                return std::nullopt;
+            }
+            return filename.substr(directory.size() + 1);
+        }
+
+        // FNV-1a
+        uint64_t hashContent(std::string_view content)
+        {
+            uint64_t hash = 14695981039346656037ULL;
+            for (char const c : content) {
+                hash ^= static_cast<uint8_t>(c);
+                hash *= 1099511628211ULL;
+            }
+            return hash;
+        }
+
+        /** Appends records to a byte string.
+         */
+        class Writer
+        {
+            public:
+                static constexpr bool LOADING = false;
+
+                explicit Writer(std::string& out) : m_out(out)
+                {
+                }
+
+                template <typename T>
+                void value(T& value)
+                {
+                    if constexpr (std::is_same_v<T, bool>) {
+                        m_out.push_back(value ? 1 : 0);
+                    } else {
+                        m_out.append(reinterpret_cast<char const *>(&value), sizeof(T));
+                    }
+                }
+
+                void string(std::string& value)
+                {
+                    auto size = static_cast<uint32_t>(value.size());
+                    this->value(size);
+                    m_out.append(value);
+                }
+
+                uint32_t count(uint32_t size)
+                {
+                    return size;
+                }
+
+            private:
+                std::string& m_out;
+        };
+
+        /** Reads records back, throws InvalidFormat instead of reading past the end.
+         */
+        class Reader
+        {
+            public:
+                static constexpr bool LOADING = true;
+
+                explicit Reader(std::string_view data) : m_data(data), m_position(0)
+                {
+                }
+
+                template <typename T>
+                void value(T& value)
+                {
+                    if constexpr (std::is_same_v<T, bool>) {
+                        uint8_t byte = 0;
+                        this->value(byte);
+                        value = byte != 0;
+                    } else {
+                        std::memcpy(&value, take(sizeof(T)), sizeof(T));
+                    }
+                }
+
+                void string(std::string& value)
+                {
+                    uint32_t size = 0;
+                    this->value(size);
+                    value.assign(take(size), size);
+                }
+
+                /** Checks an element count before anything is allocated for it.
+                 */
+                uint32_t count(uint32_t size)
+                {
+                    // every element takes at least one byte
+                    if (size > m_data.size() - m_position) {
+                        throw InvalidFormat("asset database entry is damaged");
+                    }
+                    return size;
+                }
+
+            private:
+                char const * take(size_t size)
+                {
+                    if (size > m_data.size() - m_position) {
+                        throw InvalidFormat("asset database entry is damaged");
+                    }
+                    char const * data = m_data.data() + m_position;
+                    m_position += size;
+                    return data;
+                }
+
+                std::string_view m_data;
+                size_t m_position;
+        };
+
+        /** Entry of the index at the end of the database file.
+         */
+        struct IndexRecord
+        {
+                std::string key;
+                uint64_t hash;
+                std::optional<FileStamp> stamp;
+                uint64_t offset;
+                uint64_t size;
+        };
+
+        template <typename Archive, typename T>
+            requires std::is_arithmetic_v<T> || std::is_enum_v<T>
+        void transfer(Archive& archive, T& value)
+        {
+            archive.value(value);
+        }
+
+        template <typename Archive>
+        void transfer(Archive& archive, std::string& value)
+        {
+            archive.string(value);
+        }
+
+        template <typename Archive, typename T>
+        void transfer(Archive& archive, std::optional<T>& value);
+        template <typename Archive, typename T>
+        void transfer(Archive& archive, std::vector<T>& values);
+        template <typename Archive>
+        void transfer(Archive& archive, Rect& rect);
+        template <typename Archive>
+        void transfer(Archive& archive, AtlasRegionRecord& record);
+        template <typename Archive>
+        void transfer(Archive& archive, AtlasRecord& record);
+        template <typename Archive>
+        void transfer(Archive& archive, AnimationFrameRecord& record);
+        template <typename Archive>
+        void transfer(Archive& archive, AnimationRecord& record);
+        template <typename Archive>
+        void transfer(Archive& archive, ImportRecord& record);
+        template <typename Archive>
+        void transfer(Archive& archive, ActionSoundRecord& record);
+        template <typename Archive>
+        void transfer(Archive& archive, SpriteDirectionRecord& record);
+        template <typename Archive>
+        void transfer(Archive& archive, ActionAnimationRecord& record);
+        template <typename Archive>
+        void transfer(Archive& archive, ActionRecord& record);
+        template <typename Archive>
+        void transfer(Archive& archive, ObjectImageRecord& record);
+        template <typename Archive>
+        void transfer(Archive& archive, MultiPartCoordinateRecord& record);
+        template <typename Archive>
+        void transfer(Archive& archive, ObjectRecord& record);
+        template <typename Archive>
+        void transfer(Archive& archive, AssetFileRecord& record);
+        template <typename Archive>
+        void transfer(Archive& archive, FileStamp& stamp);
+        template <typename Archive>
+        void transfer(Archive& archive, IndexRecord& record);
+
+        template <typename Archive, typename T>
+        void transfer(Archive& archive, std::optional<T>& value)
+        {
+            bool present = value.has_value();
+            transfer(archive, present);
+            if (present) {
+                if constexpr (Archive::LOADING) {
+                    value.emplace();
+                }
+                transfer(archive, *value);
+            }
+        }
+
+        template <typename Archive, typename T>
+        void transfer(Archive& archive, std::vector<T>& values)
+        {
+            auto size = static_cast<uint32_t>(values.size());
+            transfer(archive, size);
+            if constexpr (Archive::LOADING) {
+                values.clear();
+                values.resize(archive.count(size));
+            }
+            for (auto& value : values) {
+                transfer(archive, value);
+            }
+        }
+
+        template <typename Archive>
+        void transfer(Archive& archive, Rect& rect)
+        {
+            transfer(archive, rect.x);
+            transfer(archive, rect.y);
+            transfer(archive, rect.w);
+            transfer(archive, rect.h);
+        }
+
+        template <typename Archive>
+        void transfer(Archive& archive, AtlasRegionRecord& record)
+        {
+            transfer(archive, record.name);
+            transfer(archive, record.region);
+        }
+
+        template <typename Archive>
+        void transfer(Archive& archive, AtlasRecord& record)
+        {
+            transfer(archive, record.source);
+            transfer(archive, record.regions);
+        }
+
+        template <typename Archive>
+        void transfer(Archive& archive, AnimationFrameRecord& record)
+        {
+            transfer(archive, record.source);
+            transfer(archive, record.region);
+            transfer(archive, record.xOffset);
+            transfer(archive, record.yOffset);
+            transfer(archive, record.delay);
+        }
+
+        template <typename Archive>
+        void transfer(Archive& archive, AnimationRecord& record)
+        {
+            transfer(archive, record.id);
+            transfer(archive, record.direction);
+            transfer(archive, record.actionFrame);
+            transfer(archive, record.atlas);
+            transfer(archive, record.frames);
+        }
+
+        template <typename Archive>
+        void transfer(Archive& archive, ImportRecord& record)
+        {
+            transfer(archive, record.directory);
+            transfer(archive, record.file);
+        }
+
+        template <typename Archive>
+        void transfer(Archive& archive, ActionSoundRecord& record)
+        {
+            transfer(archive, record.source);
+            transfer(archive, record.group);
+            transfer(archive, record.volume);
+            transfer(archive, record.maxVolume);
+            transfer(archive, record.minVolume);
+            transfer(archive, record.referenceDistance);
+            transfer(archive, record.maxDistance);
+            transfer(archive, record.rolloff);
+            transfer(archive, record.pitch);
+            transfer(archive, record.coneInnerAngle);
+            transfer(archive, record.coneOuterAngle);
+            transfer(archive, record.coneOuterGain);
+            transfer(archive, record.looping);
+            transfer(archive, record.relativePosition);
+            transfer(archive, record.direction);
+            transfer(archive, record.xVelocity);
+            transfer(archive, record.yVelocity);
+            transfer(archive, record.zVelocity);
+        }
+
+        template <typename Archive>
+        void transfer(Archive& archive, SpriteDirectionRecord& record)
+        {
+            transfer(archive, record.direction);
+            transfer(archive, record.frames);
+            transfer(archive, record.delay);
+            transfer(archive, record.xOffset);
+            transfer(archive, record.yOffset);
+            transfer(archive, record.actionFrame);
+        }
+
+        template <typename Archive>
+        void transfer(Archive& archive, ActionAnimationRecord& record)
+        {
+            transfer(archive, record.animationId);
+            transfer(archive, record.atlas);
+            transfer(archive, record.frameWidth);
+            transfer(archive, record.frameHeight);
+            transfer(archive, record.directions);
+            transfer(archive, record.source);
+            transfer(archive, record.direction);
+        }
+
+        template <typename Archive>
+        void transfer(Archive& archive, ActionRecord& record)
+        {
+            transfer(archive, record.id);
+            transfer(archive, record.isDefault);
+            transfer(archive, record.sound);
+            transfer(archive, record.animations);
+        }
+
+        template <typename Archive>
+        void transfer(Archive& archive, ObjectImageRecord& record)
+        {
+            transfer(archive, record.source);
+            transfer(archive, record.xOffset);
+            transfer(archive, record.yOffset);
+            transfer(archive, record.direction);
+        }
+
+        template <typename Archive>
+        void transfer(Archive& archive, MultiPartCoordinateRecord& record)
+        {
+            transfer(archive, record.rotation);
+            transfer(archive, record.x);
+            transfer(archive, record.y);
+            transfer(archive, record.z);
+        }
+
+        template <typename Archive>
+        void transfer(Archive& archive, ObjectRecord& record)
+        {
+            transfer(archive, record.id);
+            transfer(archive, record.nameSpace);
+            transfer(archive, record.parent);
+            transfer(archive, record.blocking);
+            transfer(archive, record.isStatic);
+            transfer(archive, record.pather);
+            transfer(archive, record.costId);
+            transfer(archive, record.cost);
+            transfer(archive, record.areaId);
+            transfer(archive, record.speed);
+            transfer(archive, record.walkableAreas);
+            transfer(archive, record.cellStack);
+            transfer(archive, record.anchorX);
+            transfer(archive, record.anchorY);
+            transfer(archive, record.restrictedRotation);
+            transfer(archive, record.zStepLimit);
+            transfer(archive, record.multiPartIds);
+            transfer(archive, record.multiPartCoordinates);
+            transfer(archive, record.images);
+            transfer(archive, record.actions);
+        }
+
+        template <typename Archive>
+        void transfer(Archive& archive, AssetFileRecord& record)
+        {
+            transfer(archive, record.root);
+            if constexpr (Archive::LOADING) {
+                if (record.root > AssetFileRecord::RootOther) {
+                    throw InvalidFormat("asset database entry is damaged");
+                }
+            }
+            transfer(archive, record.atlases);
+            transfer(archive, record.animations);
+            transfer(archive, record.imports);
+            transfer(archive, record.objects);
+        }
+
+        template <typename Archive>
+        void transfer(Archive& archive, FileStamp& stamp)
+        {
+            transfer(archive, stamp.size);
+            transfer(archive, stamp.version);
+        }
+
+        template <typename Archive>
+        void transfer(Archive& archive, IndexRecord& record)
+        {
+            transfer(archive, record.key);
+            transfer(archive, record.hash);
+            transfer(archive, record.stamp);
+            transfer(archive, record.offset);
+            transfer(archive, record.size);
+        }
+
+        std::optional<std::string> stringAttribute(XML::Element const * element, char const * name)
+        {
+            char const * value = XML::Attribute(element, name);
+            if (value == nullptr) {
+                return std::nullopt;
+            }
+            return std::string(value);
+        }
+
+        template <typename T>
+        std::optional<T> valueAttribute(XML::Element const * element, char const * name)
+        {
+            T value{};
+            if (XML::QueryAttribute(element, name, &value) == XML::SUCCESS) {
+                return value;
+            }
+            return std::nullopt;
+        }
+
+        /** Returns the attribute or fallback if it is missing.
+         */
+        int32_t intAttribute(XML::Element const * element, char const * name, int32_t fallback)
+        {
+            return valueAttribute<int>(element, name).value_or(fallback);
+        }
+
+        AtlasRecord compileAtlas(XML::Element const * atlasElem)
+        {
+            AtlasRecord atlas;
+            char const * atlasSource = XML::Attribute(atlasElem, "source");
+            if (atlasSource == nullptr) {
+                return atlas;
+            }
+            atlas.source = atlasSource;
+
+            char const * atlasId = XML::Attribute(atlasElem, "id");
+            if (atlasElem->FirstChildElement("subimage") != nullptr) {
+                // subimages with given id and individual position and size
+                for (XML::Element const * imageElem = atlasElem->FirstChildElement("subimage"); imageElem != nullptr;
+                     imageElem                      = imageElem->NextSiblingElement("subimage")) {
+                    char const * subimageId = XML::Attribute(imageElem, "id");
+                    if (subimageId == nullptr) {
+                        continue;
+                    }
+                    AtlasRegionRecord region;
+                    XML::QueryAttribute(imageElem, "xpos", &region.region.x);
+                    XML::QueryAttribute(imageElem, "ypos", &region.region.y);
+                    XML::QueryAttribute(imageElem, "width", &region.region.w);
+                    XML::QueryAttribute(imageElem, "height", &region.region.h);
+                    // atlas id is optional here
+                    region.name = atlasId != nullptr ? std::string(atlasId) + ":" + subimageId : subimageId;
+                    atlas.regions.push_back(std::move(region));
+                }
+                return atlas;
+            }
+
+            // subimages with automatic id and same size
+            int32_t const atlasWidth     = intAttribute(atlasElem, "atlas_width", 0);
+            int32_t const atlasHeight    = intAttribute(atlasElem, "atlas_height", 0);
+            int32_t const subimageWidth  = intAttribute(atlasElem, "subimage_width", 0);
+            int32_t const subimageHeight = intAttribute(atlasElem, "subimage_height", 0);
+            if (atlasWidth == 0 || atlasHeight == 0 || subimageWidth == 0 || subimageHeight == 0) {
+                return atlas;
+            }
+            // file extension of the atlas is also used as subimage extension
+            std::string const extension = GetExtension(std::string(atlasSource));
+            std::string const prefix    = atlasId != nullptr ? atlasId : atlasSource;
+            int32_t const xRows         = atlasWidth / subimageWidth;
+            int32_t const yRows         = atlasHeight / subimageHeight;
+            int frame                   = 0;
+            for (int32_t y = 0; y < yRows; ++y) {
+                for (int32_t x = 0; x < xRows; ++x) {
+                    atlas.regions.push_back(
+                        {.name   = std::format("{}:{:04d}{}", prefix, frame, extension),
+                         .region = Rect(x * subimageWidth, y * subimageHeight, subimageWidth, subimageHeight)});
+                    ++frame;
+                }
+            }
+            return atlas;
+        }
+
+        AnimationRecord compileAnimation(XML::Element const * animationElem)
+        {
+            AnimationRecord animation;
+            animation.id          = stringAttribute(animationElem, "id");
+            animation.direction   = valueAttribute<int>(animationElem, "direction");
+            animation.actionFrame = valueAttribute<int>(animationElem, "action_frame");
+            animation.atlas       = stringAttribute(animationElem, "atlas");
+
+            int32_t const animDelay       = intAttribute(animationElem, "delay", 0);
+            int32_t const animXoffset     = intAttribute(animationElem, "x_offset", 0);
+            int32_t const animYoffset     = intAttribute(animationElem, "y_offset", 0);
+            int32_t const animFrameWidth  = intAttribute(animationElem, "width", 0);
+            int32_t const animFrameHeight = intAttribute(animationElem, "height", 0);
+
+            for (XML::Element const * frameElement = animationElem->FirstChildElement("frame"); frameElement != nullptr;
+                 frameElement                      = frameElement->NextSiblingElement("frame")) {
+                char const * sourceId = XML::Attribute(frameElement, "source");
+                if (sourceId == nullptr) {
+                    continue;
+                }
+                AnimationFrameRecord frame;
+                frame.source = sourceId;
+                if (animation.atlas) {
+                    frame.region = Rect(
+                        intAttribute(frameElement, "xpos", 0),
+                        intAttribute(frameElement, "ypos", 0),
+                        intAttribute(frameElement, "width", animFrameWidth),
+                        intAttribute(frameElement, "height", animFrameHeight));
+                }
+                frame.xOffset = intAttribute(frameElement, "x_offset", animXoffset);
+                frame.yOffset = intAttribute(frameElement, "y_offset", animYoffset);
+                frame.delay   = intAttribute(frameElement, "delay", animDelay);
+                animation.frames.push_back(std::move(frame));
+            }
+            return animation;
+        }
+
+        std::optional<ActionSoundRecord> compileSound(XML::Element const * soundElement)
+        {
+            char const * clip = XML::Attribute(soundElement, "source");
+            if (clip == nullptr) {
+                return std::nullopt;
+            }
+            ActionSoundRecord sound{};
+            sound.source            = clip;
+            sound.group             = stringAttribute(soundElement, "group");
+            sound.volume            = valueAttribute<float>(soundElement, "volume");
+            sound.maxVolume         = valueAttribute<float>(soundElement, "max_volume");
+            sound.minVolume         = valueAttribute<float>(soundElement, "min_volume");
+            sound.referenceDistance = valueAttribute<float>(soundElement, "ref_distance");
+            sound.maxDistance       = valueAttribute<float>(soundElement, "max_distance");
+            sound.rolloff           = valueAttribute<float>(soundElement, "rolloff");
+            sound.pitch             = valueAttribute<float>(soundElement, "pitch");
+            sound.coneInnerAngle    = valueAttribute<float>(soundElement, "cone_inner_angle");
+            sound.coneOuterAngle    = valueAttribute<float>(soundElement, "cone_outer_angle");
+            sound.coneOuterGain     = valueAttribute<float>(soundElement, "cone_outer_gain");
+            if (auto const looping = valueAttribute<int>(soundElement, "looping")) {
+                sound.looping = *looping != 0;
+            }
+            if (auto const relative = valueAttribute<int>(soundElement, "relative_position")) {
+                sound.relativePosition = *relative != 0;
+            }
+            if (auto const direction = valueAttribute<int>(soundElement, "direction")) {
+                sound.direction = *direction != 0;
+            }
+            sound.xVelocity = valueAttribute<double>(soundElement, "x_velocity");
+            sound.yVelocity = valueAttribute<double>(soundElement, "y_velocity");
+            sound.zVelocity = valueAttribute<double>(soundElement, "z_velocity").value_or(0.0);
+            return sound;
+        }
+
+        ActionAnimationRecord compileActionAnimation(XML::Element const * animElement)
+        {
+            ActionAnimationRecord animation{};
+            animation.animationId = stringAttribute(animElement, "animation_id");
+            animation.atlas       = stringAttribute(animElement, "atlas");
+            animation.source      = stringAttribute(animElement, "source");
+            animation.direction   = valueAttribute<int>(animElement, "direction");
+            if (!animation.atlas) {
+                return animation;
+            }
+
+            animation.frameWidth     = intAttribute(animElement, "width", 0);
+            animation.frameHeight    = intAttribute(animElement, "height", 0);
+            int32_t const animFrames = intAttribute(animElement, "frames", 0);
+            int32_t const animDelay  = intAttribute(animElement, "delay", 0);
+            int32_t const animXoff   = intAttribute(animElement, "x_offset", 0);
+            int32_t const animYoff   = intAttribute(animElement, "y_offset", 0);
+            for (XML::Element const * dirElement = animElement->FirstChildElement("direction"); dirElement != nullptr;
+                 dirElement                      = dirElement->NextSiblingElement("direction")) {
+                animation.directions.push_back(
+                    {.direction   = intAttribute(dirElement, "dir", 0),
+                     .frames      = intAttribute(dirElement, "frames", animFrames),
+                     .delay       = intAttribute(dirElement, "delay", animDelay),
+                     .xOffset     = intAttribute(dirElement, "x_offset", animXoff),
+                     .yOffset     = intAttribute(dirElement, "y_offset", animYoff),
+                     .actionFrame = valueAttribute<int>(dirElement, "action_frame")});
+            }
+            return animation;
+        }
+
+        ObjectRecord compileObject(XML::Element const * root, XML::Element const * objectElem)
+        {
+            ObjectRecord object{};
+            object.id                 = stringAttribute(objectElem, "id");
+            object.nameSpace          = stringAttribute(objectElem, "namespace");
+            object.parent             = stringAttribute(objectElem, "parent");
+            object.blocking           = intAttribute(objectElem, "blocking", 0) != 0;
+            object.isStatic           = intAttribute(objectElem, "static", 0) != 0;
+            object.pather             = stringAttribute(objectElem, "pather");
+            object.costId             = stringAttribute(objectElem, "cost_id");
+            object.cost               = valueAttribute<double>(objectElem, "cost");
+            object.areaId             = stringAttribute(objectElem, "area_id");
+            object.speed              = valueAttribute<double>(root, "speed");
+            object.cellStack          = intAttribute(objectElem, "cellstack", 0);
+            object.anchorX            = valueAttribute<double>(objectElem, "anchor_x");
+            object.anchorY            = valueAttribute<double>(objectElem, "anchor_y");
+            object.restrictedRotation = intAttribute(objectElem, "restricted_rotation", 0) != 0;
+            object.zStepLimit         = valueAttribute<int>(objectElem, "z_step_limit");
+
+            for (XML::Element const * walkableElement = objectElem->FirstChildElement("walkable_area");
+                 walkableElement != nullptr;
+                 walkableElement = walkableElement->NextSiblingElement("walkable_area")) {
+                if (char const * walkableId = XML::Attribute(walkableElement, "id")) {
+                    object.walkableAreas.emplace_back(walkableId);
+                }
+            }
+
+            for (XML::Element const * multiElement = objectElem->FirstChildElement("multipart");
+                 multiElement != nullptr;
+                 multiElement = multiElement->NextSiblingElement("multipart")) {
+                if (char const * partId = XML::Attribute(multiElement, "id")) {
+                    object.multiPartIds.emplace_back(partId);
+                }
+                for (XML::Element const * multiRotation = multiElement->FirstChildElement("rotation");
+                     multiRotation != nullptr;
+                     multiRotation = multiRotation->NextSiblingElement("rotation")) {
+                    int32_t const rotation = intAttribute(multiRotation, "rot", 0);
+                    // relative coordinates which are used to position the object
+                    for (XML::Element const * multiCoordinate = multiRotation->FirstChildElement("occupied_coord");
+                         multiCoordinate != nullptr;
+                         multiCoordinate = multiCoordinate->NextSiblingElement("occupied_coord")) {
+                        auto const x = valueAttribute<int>(multiCoordinate, "x");
+                        auto const y = valueAttribute<int>(multiCoordinate, "y");
+                        if (x && y) {
+                            object.multiPartCoordinates.push_back(
+                                {.rotation = rotation, .x = *x, .y = *y, .z = intAttribute(multiCoordinate, "z", 0)});
+                        }
+                    }
+                }
+            }
+
+            for (XML::Element const * imageElement = objectElem->FirstChildElement("image"); imageElement != nullptr;
+                 imageElement                      = imageElement->NextSiblingElement("image")) {
+                char const * sourceId = XML::Attribute(imageElement, "source");
+                if (sourceId != nullptr) {
+                    object.images.push_back(
+                        {.source    = sourceId,
+                         .xOffset   = valueAttribute<int>(imageElement, "x_offset"),
+                         .yOffset   = valueAttribute<int>(imageElement, "y_offset"),
+                         .direction = valueAttribute<int>(imageElement, "direction")});
+                }
+            }
+
+            for (XML::Element const * actionElement = objectElem->FirstChildElement("action");
+                 actionElement != nullptr;
+                 actionElement = actionElement->NextSiblingElement("action")) {
+                char const * actionId = XML::Attribute(actionElement, "id");
+                if (actionId == nullptr) {
+                    continue;
+                }
+                ActionRecord action{};
+                action.id        = actionId;
+                action.isDefault = intAttribute(actionElement, "default", 0) != 0;
+                if (XML::Element const * soundElement = actionElement->FirstChildElement("sound")) {
+                    action.sound = compileSound(soundElement);
+                }
+                for (XML::Element const * animElement = actionElement->FirstChildElement("animation");
+                     animElement != nullptr;
+                     animElement = animElement->NextSiblingElement("animation")) {
+                    action.animations.push_back(compileActionAnimation(animElement));
+                }
+                object.actions.push_back(std::move(action));
+            }
+            return object;
+        }
+    } // namespace
+
+    struct AssetDatabase::Mapping
+    {
+            void const * address = nullptr;
+            size_t size          = 0;
+
+            Mapping() = default;
+
+            Mapping(Mapping const &)            = delete;
+            Mapping& operator=(Mapping const &) = delete;
+
+            ~Mapping()
+            {
+                if (address == nullptr) {
+                    return;
+                }
+#ifdef FIFE_OS_WINDOWS
+                UnmapViewOfFile(address);
+#else
+                munmap(const_cast<void*>(address), size);
+#endif
+            }
+
+            std::string_view data() const
+            {
+                return {static_cast<char const *>(address), size};
+            }
+
+            /** Maps a whole file read only, nullptr if that fails or the file is empty.
+             */
+            static std::unique_ptr<Mapping> map(std::string const & path)
+            {
+                auto mapping = std::make_unique<Mapping>();
+#ifdef FIFE_OS_WINDOWS
+                HANDLE file = CreateFileA(
+                    path.c_str(),
+                    GENERIC_READ,
+                    FILE_SHARE_READ,
+                    nullptr,
+                    OPEN_EXISTING,
+                    FILE_ATTRIBUTE_NORMAL,
+                    nullptr);
+                if (file == INVALID_HANDLE_VALUE) {
+                    return nullptr;
+                }
+                LARGE_INTEGER size;
+                if (GetFileSizeEx(file, &size) == 0 || size.QuadPart == 0) {
+                    CloseHandle(file);
+                    return nullptr;
+                }
+                HANDLE view = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                CloseHandle(file);
+                if (view == nullptr) {
+                    return nullptr;
+                }
+                // the view keeps the file mapping alive
+                mapping->address = MapViewOfFile(view, FILE_MAP_READ, 0, 0, 0);
+                CloseHandle(view);
+                if (mapping->address == nullptr) {
+                    return nullptr;
+                }
+                mapping->size = static_cast<size_t>(size.QuadPart);
+#else
+                int const file = ::open(path.c_str(), O_RDONLY);
+                if (file < 0) {
+                    return nullptr;
+                }
+                struct stat status{};
+                if (fstat(file, &status) != 0 || status.st_size == 0) {
+                    close(file);
+                    return nullptr;
+                }
+                auto const size = static_cast<size_t>(status.st_size);
+                void* address   = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+                // the mapping keeps the file alive
+                close(file);
+                if (address == MAP_FAILED) {
+                    return nullptr;
+                }
+                mapping->address = address;
+                mapping->size    = size;
+#endif
+                return mapping;
+            }
+    };
+
+    std::unique_ptr<AssetDatabase> AssetDatabase::open(VFS* vfs, std::string const & directory)
+    {
+        std::string const path = (fs::path(directory) / FILENAME).string();
+        if (!vfs->exists(path) || vfs->isDirectory(path)) {
+            return nullptr;
+        }
+        auto database = std::make_unique<AssetDatabase>(vfs, directory);
+        database->load();
+        return database;
+    }
+
+    AssetDatabase* AssetDatabase::find(std::string const & filename)
+    {
+        AssetDatabase* found = nullptr;
+        for (AssetDatabase* database : openDatabases()) {
+            // the innermost directory wins
+            if (relativeKey(database->m_directory, filename) &&
+                (found == nullptr || database->m_directory.size() > found->m_directory.size())) {
+                found = database;
+            }
+        }
+        return found;
+    }
+
+    AssetFileRecord const * AssetDatabase::read(VFS* vfs, std::string const & filename, AssetFileRecord& storage)
+    {
+        if (AssetDatabase* database = find(filename)) {
+            if (AssetFileRecord const * file = database->get(filename)) {
+                return file;
+            }
+        }
+
+        auto data = vfs->open(filename);
+        if (data == nullptr) {
+            return nullptr;
+        }
+        std::string xml;
+        if (data->getDataLength() != 0) {
+            xml = data->readString(data->getDataLength());
+        }
+        storage = compile(xml);
+        return &storage;
+    }
+
+    AssetFileRecord AssetDatabase::compile(std::string const & xml)
+    {
+        AssetFileRecord file{};
+        file.root = AssetFileRecord::RootInvalid;
+
+        XML::Document doc;
+        if (xml.empty() || !XML::Parse(doc, xml)) {
+            return file;
+        }
+        XML::Element const * root = doc.RootElement();
+        if (root == nullptr) {
+            return file;
+        }
+
+        if (XML::HasName(root, "assets")) {
+            file.root = AssetFileRecord::RootAssets;
+        } else if (XML::HasName(root, "animation")) {
+            file.root = AssetFileRecord::RootAnimation;
+        } else {
+            file.root = AssetFileRecord::RootOther;
+        }
+
+        for (XML::Element const * importElement = root->FirstChildElement("import"); importElement != nullptr;
+             importElement                      = importElement->NextSiblingElement("import")) {
+            file.imports.push_back(
+                {.directory = stringAttribute(importElement, "dir"), .file = stringAttribute(importElement, "file")});
+        }
+
+        if (file.root == AssetFileRecord::RootAnimation) {
+            file.animations.push_back(compileAnimation(root));
+        }
+        if (file.root != AssetFileRecord::RootAssets) {
+            return file;
+        }
+
+        for (XML::Element const * atlasElem = root->FirstChildElement("atlas"); atlasElem != nullptr;
+             atlasElem                      = atlasElem->NextSiblingElement("atlas")) {
+            file.atlases.push_back(compileAtlas(atlasElem));
+        }
+        for (XML::Element const * animationElem = root->FirstChildElement("animation"); animationElem != nullptr;
+             animationElem                      = animationElem->NextSiblingElement("animation")) {
+            file.animations.push_back(compileAnimation(animationElem));
+        }
+        for (XML::Element const * objectElem = root->FirstChildElement("object"); objectElem != nullptr;
+             objectElem                      = objectElem->NextSiblingElement("object")) {
+            file.objects.push_back(compileObject(root, objectElem));
+        }
+        return file;
+    }
+
+    AssetDatabase::AssetDatabase(VFS* vfs, std::string directory) :
+        m_vfs(vfs),
+        m_directory(std::move(directory)),
+        m_path((fs::path(m_directory) / FILENAME).string()),
+        m_complete(false),
+        m_hits(0),
+        m_compiles(0)
+    {
+        openDatabases().push_back(this);
+    }
+
+    AssetDatabase::~AssetDatabase()
+    {
+        std::erase(openDatabases(), this);
+    }
+
+    bool AssetDatabase::load()
+    {
+        m_index.clear();
+        m_mapping = Mapping::map(m_path);
+        if (!m_mapping) {
+            return false;
+        }
+
+        std::string_view const data = m_mapping->data();
+        try {
+            Reader header(data);
+            char magic[sizeof(MAGIC)];
+            for (char& c : magic) {
+                header.value(c);
+            }
+            uint32_t version      = 0;
+            uint32_t endianMarker = 0;
+            header.value(version);
+            header.value(endianMarker);
+            if (std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 || version != FORMAT_VERSION ||
+                endianMarker != ENDIAN_MARKER) {
+                FL_LOG(_log(), std::format("Asset database {} is outdated and will be rebuilt", m_path));
+                m_mapping.reset();
+                return false;
+            }
+            uint64_t indexOffset = 0;
+            uint64_t indexSize   = 0;
+            header.value(indexOffset);
+            header.value(indexSize);
+            if (indexOffset > data.size() || indexSize > data.size() - indexOffset) {
+                throw InvalidFormat(std::format("index of asset database {} is out of bounds", m_path));
+            }
+
+            Reader reader(data.substr(indexOffset, indexSize));
+            std::vector<IndexRecord> records;
+            transfer(reader, records);
+            for (IndexRecord& record : records) {
+                if (record.offset > indexOffset || record.size > indexOffset - record.offset) {
+                    throw InvalidFormat(std::format("entry of asset database {} is out of bounds", m_path));
+                }
+                m_index.emplace(
+                    std::move(record.key),
+                    IndexEntry{
+                        .hash = record.hash, .stamp = record.stamp, .blob = data.substr(record.offset, record.size)});
+            }
+        } catch (InvalidFormat&) {
+            m_index.clear();
+            m_mapping.reset();
+            return false;
+        }
+        return true;
+    }
+
+    bool AssetDatabase::save()
+    {
+        bool const changed = std::ranges::any_of(m_checked, [this](auto const & entry) {
+            auto const indexed = m_index.find(entry.first);
+            if (indexed == m_index.end()) {
+                return entry.second.compiled;
+            }
+            // compiled, no longer readable, or the same content under a new stamp
+            return entry.second.compiled || !entry.second.record || indexed->second.stamp != entry.second.stamp;
+        });
+        bool const pruned = m_complete && std::ranges::any_of(m_index, [this](auto const & entry) {
+            return !m_checked.contains(entry.first);
+        });
+        if (m_mapping && !changed && !pruned) {
+            return true;
+        }
+
+        std::vector<std::pair<std::string const *, IndexEntry>> entries;
+        std::vector<std::string> blobs;
+        blobs.reserve(m_checked.size());
+        for (auto& [key, entry] : m_checked) {
+            if (!entry.record) {
+                continue;
+            }
+            if (entry.compiled) {
+                blobs.emplace_back();
+                Writer writer(blobs.back());
+                transfer(writer, *entry.record);
+                entries.emplace_back(&key, IndexEntry{.hash = entry.hash, .stamp = entry.stamp, .blob = blobs.back()});
+            } else {
+                IndexEntry indexed = m_index.at(key);
+                indexed.stamp      = entry.stamp;
+                entries.emplace_back(&key, indexed);
+            }
+        }
+        if (!m_complete) {
+            for (auto const & [key, entry] : m_index) {
+                if (!m_checked.contains(key)) {
+                    entries.emplace_back(&key, entry);
+                }
+            }
+        }
+        // keeps the file the same for the same contents
+        std::ranges::sort(entries, [](auto const & a, auto const & b) {
+            return *a.first < *b.first;
+        });
+
+        std::string out;
+        Writer writer(out);
+        for (char c : MAGIC) {
+            writer.value(c);
+        }
+        uint32_t version      = FORMAT_VERSION;
+        uint32_t endianMarker = ENDIAN_MARKER;
+        writer.value(version);
+        writer.value(endianMarker);
+        size_t const headerSize = out.size() + (2 * sizeof(uint64_t));
+        out.resize(headerSize);
+
+        std::vector<IndexRecord> records;
+        records.reserve(entries.size());
+        for (auto const & [key, entry] : entries) {
+            records.push_back(
+                {.key    = *key,
+                 .hash   = entry.hash,
+                 .stamp  = entry.stamp,
+                 .offset = out.size(),
+                 .size   = entry.blob.size()});
+            out.append(entry.blob);
+        }
+        uint64_t const indexOffset = out.size();
+        transfer(writer, records);
+        uint64_t const indexSize = out.size() - indexOffset;
+        std::memcpy(out.data() + headerSize - (2 * sizeof(uint64_t)), &indexOffset, sizeof(uint64_t));
+        std::memcpy(out.data() + headerSize - sizeof(uint64_t), &indexSize, sizeof(uint64_t));
+
+        std::string const tempPath = m_path + ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            file.write(out.data(), static_cast<std::streamsize>(out.size()));
+            if (!file) {
+                FL_WARN(_log(), std::format("Could not write asset database {}", tempPath));
+                return false;
+            }
+        }
+
+        // the old file cannot be replaced while it is mapped on every platform
+        m_index.clear();
+        m_mapping.reset();
+        std::error_code error;
+        if (!ReplaceFile(tempPath, m_path, error)) {
+            FL_WARN(_log(), std::format("Could not replace asset database {}: {}", m_path, error.message()));
+            load();
+            return false;
+        }
+
+        load();
+        // files that could not be opened are not in the new index
+        std::erase_if(m_checked, [this](auto const & entry) {
+            return !m_index.contains(entry.first);
+        });
+        for (auto& [key, entry] : m_checked) {
+            entry.compiled = false;
+        }
+        FL_LOG(_log(), std::format("Saved asset database {} with {} entries", m_path, records.size()));
+        return true;
+    }
+
+    AssetFileRecord const * AssetDatabase::get(std::string const & filename)
+    {
+        std::optional<std::string> key = relativeKey(m_directory, filename);
+        if (!key) {
+            return nullptr;
+        }
+        auto const checked = m_checked.find(*key);
+        if (checked != m_checked.end()) {
+            return checked->second.record.get();
+        }
+
+        // an unchanged stamp vouches for the content, the file is not even opened
+        std::optional<FileStamp> const stamp = m_vfs->getStamp(filename);
+        auto const indexed                   = m_index.find(*key);
+        if (stamp && indexed != m_index.end() && indexed->second.stamp == stamp) {
+            auto record = std::make_unique<AssetFileRecord>();
+            try {
+                Reader reader(indexed->second.blob);
+                transfer(reader, *record);
+                ++m_hits;
+                AssetFileRecord const * result = record.get();
+                m_checked.emplace(
+                    std::move(*key),
+                    CheckedEntry{
+                        .hash = indexed->second.hash, .stamp = stamp, .record = std::move(record), .compiled = false});
+                return result;
+            } catch (InvalidFormat&) {
+                // damaged entry, compiled from the file below
+            }
+        }
+
+        std::string content;
+        try {
+            auto data = m_vfs->open(filename);
+            if (data == nullptr) {
+                m_checked.emplace(
+                    std::move(*key), CheckedEntry{.hash = 0, .stamp = std::nullopt, .record = nullptr, .compiled = false});
+                return nullptr;
+            }
+            if (data->getDataLength() != 0) {
+                content = data->readString(data->getDataLength());
+            }
+        } catch (NotFound&) {
+            m_checked.emplace(
+                std::move(*key), CheckedEntry{.hash = 0, .stamp = std::nullopt, .record = nullptr, .compiled = false});
+            return nullptr;
+        }
+
+        // sources without stamps, new or touched files and damaged entries are hashed
+        uint64_t const hash = hashContent(content);
+        auto record         = std::make_unique<AssetFileRecord>();
+        bool compiled       = true;
+        if (indexed != m_index.end() && indexed->second.hash == hash) {
+            try {
+                Reader reader(indexed->second.blob);
+                transfer(reader, *record);
+                compiled = false;
+                ++m_hits;
+            } catch (InvalidFormat&) {
+                record = std::make_unique<AssetFileRecord>();
+            }
+        }
+        if (compiled) {
+            *record = compile(content);
+            ++m_compiles;
+        }
+
+        AssetFileRecord const * result = record.get();
+        m_checked.emplace(
+            std::move(*key),
+            CheckedEntry{.hash = hash, .stamp = stamp, .record = std::move(record), .compiled = compiled});
+        return result;
+    }
+
+    void AssetDatabase::compileDirectory()
+    {
+        compileDirectory(m_directory);
+        m_complete = true;
+    }
+
+    void AssetDatabase::compileDirectory(std::string const & directory)
+    {
+        for (std::string const & file : m_vfs->listFiles(directory)) {
+            if (GetExtension(file) == ".xml") {
+                get((fs::path(directory) / file).string());
+            }
+        }
+        for (std::string const & nested : m_vfs->listDirectories(directory)) {
+            // do not attempt to load anything from a .svn directory
+            if (nested.find(".svn") == std::string::npos) {
+                compileDirectory(directory + "/" + nested);
+            }
+        }
+    }
+
+    std::string const & AssetDatabase::getPath() const
+    {
+        return m_path;
+    }
+
+    uint32_t AssetDatabase::getEntryCount() const
+    {
+        return static_cast<uint32_t>(m_index.size());
+    }
+
+    uint32_t AssetDatabase::getHitCount() const
+    {
+        return m_hits;
+    }
+
+    uint32_t AssetDatabase::getCompileCount() const
+    {
+        return m_compiles;
+    }
+} // namespace FIFE
@@ -0,0 +1,349 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+#ifndef FIFE_ASSET_DATABASE_H
+#define FIFE_ASSET_DATABASE_H
+
+// Platform specific includes
+#include "platform.h"
+
+// Standard C++ library includes
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// 3rd party library includes
+
+// FIFE includes
+#include "util/structures/rect.h"
+#include "vfs/vfs.h"
+
+namespace FIFE
+{
+    /** A named region of an atlas image.
+     */
+    struct FIFE_API AtlasRegionRecord
+    {
+            std::string name;
+            Rect region;
+    };
+
+    /** Contents of an <atlas> element, grid atlases are already split into their regions.
+     */
+    struct FIFE_API AtlasRecord
+    {
+            std::optional<std::string> source;
+            std::vector<AtlasRegionRecord> regions;
+    };
+
+    /** One frame of an animation, offsets and delay already fall back to the animation defaults.
+     */
+    struct FIFE_API AnimationFrameRecord
+    {
+            std::string source;
+            // only used by atlas animations
+            Rect region;
+            int32_t xOffset;
+            int32_t yOffset;
+            int32_t delay;
+    };
+
+    /** Contents of an <animation> element.
+     */
+    struct FIFE_API AnimationRecord
+    {
+            std::optional<std::string> id;
+            std::optional<int32_t> direction;
+            std::optional<int32_t> actionFrame;
+            std::optional<std::string> atlas;
+            std::vector<AnimationFrameRecord> frames;
+    };
+
+    /** An <import> element of an object file.
+     */
+    struct FIFE_API ImportRecord
+    {
+            std::optional<std::string> directory;
+            std::optional<std::string> file;
+    };
+
+    /** The <sound> element of an action.
+     */
+    struct FIFE_API ActionSoundRecord
+    {
+            std::string source;
+            std::optional<std::string> group;
+            std::optional<float> volume;
+            std::optional<float> maxVolume;
+            std::optional<float> minVolume;
+            std::optional<float> referenceDistance;
+            std::optional<float> maxDistance;
+            std::optional<float> rolloff;
+            std::optional<float> pitch;
+            std::optional<float> coneInnerAngle;
+            std::optional<float> coneOuterAngle;
+            std::optional<float> coneOuterGain;
+            std::optional<bool> looping;
+            std::optional<bool> relativePosition;
+            std::optional<bool> direction;
+            // x and y velocity have to be given together, z defaults to 0
+            std::optional<double> xVelocity;
+            std::optional<double> yVelocity;
+            double zVelocity;
+    };
+
+    /** A direction of a sprite sheet animation, the values already fall back to the animation defaults.
+     */
+    struct FIFE_API SpriteDirectionRecord
+    {
+            int32_t direction;
+            int32_t frames;
+            int32_t delay;
+            int32_t xOffset;
+            int32_t yOffset;
+            std::optional<int32_t> actionFrame;
+    };
+
+    /** An <animation> element of an action.
+     *
+     * The loader tries the attributes in order: a loaded animation by id, a sprite sheet and
+     * finally an animation file.
+     */
+    struct FIFE_API ActionAnimationRecord
+    {
+            std::optional<std::string> animationId;
+            std::optional<std::string> atlas;
+            int32_t frameWidth;
+            int32_t frameHeight;
+            std::vector<SpriteDirectionRecord> directions;
+            std::optional<std::string> source;
+            std::optional<int32_t> direction;
+    };
+
+    /** An <action> element of an object.
+     */
+    struct FIFE_API ActionRecord
+    {
+            std::string id;
+            bool isDefault;
+            std::optional<ActionSoundRecord> sound;
+            std::vector<ActionAnimationRecord> animations;
+    };
+
+    /** An <image> element of an object.
+     */
+    struct FIFE_API ObjectImageRecord
+    {
+            std::string source;
+            std::optional<int32_t> xOffset;
+            std::optional<int32_t> yOffset;
+            std::optional<int32_t> direction;
+    };
+
+    /** A cell a multi part object occupies for one rotation.
+     */
+    struct FIFE_API MultiPartCoordinateRecord
+    {
+            int32_t rotation;
+            int32_t x;
+            int32_t y;
+            int32_t z;
+    };
+
+    /** Contents of an <object> element.
+     */
+    struct FIFE_API ObjectRecord
+    {
+            std::optional<std::string> id;
+            std::optional<std::string> nameSpace;
+            std::optional<std::string> parent;
+            bool blocking;
+            bool isStatic;
+            std::optional<std::string> pather;
+            std::optional<std::string> costId;
+            std::optional<double> cost;
+            std::optional<std::string> areaId;
+            // taken from the root element, like the xml loader always did
+            std::optional<double> speed;
+            std::vector<std::string> walkableAreas;
+            int32_t cellStack;
+            std::optional<double> anchorX;
+            std::optional<double> anchorY;
+            bool restrictedRotation;
+            std::optional<int32_t> zStepLimit;
+            std::vector<std::string> multiPartIds;
+            std::vector<MultiPartCoordinateRecord> multiPartCoordinates;
+            std::vector<ObjectImageRecord> images;
+            std::vector<ActionRecord> actions;
+    };
+
+    /** Everything the native loaders read from one asset file.
+     */
+    struct FIFE_API AssetFileRecord
+    {
+            enum RootType : uint8_t
+            {
+                // empty file or no valid xml
+                RootInvalid,
+                RootAssets,
+                RootAnimation,
+                RootOther
+            };
+
+            RootType root;
+            std::vector<AtlasRecord> atlases;
+            // children of <assets>, or the root if it is an <animation>
+            std::vector<AnimationRecord> animations;
+            std::vector<ImportRecord> imports;
+            std::vector<ObjectRecord> objects;
+    };
+
+    /** Compiled form of the asset files below an import directory.
+     *
+     * The database is a single file in the import directory that stores the parsed records of
+     * every object, animation and atlas file together with a hash of the file contents and its
+     * VFS stamp (size and modification time, or size and CRC-32 inside an archive). Its index
+     * is read when it is opened, the records of a file are decoded from the memory mapped
+     * database only when a loader asks for them.
+     *
+     * The native loaders look up the open database that covers a file with find() and use its
+     * records instead of parsing the xml. A file whose stamp still matches is not opened at all,
+     * otherwise it is read and hashed. A file whose hash no longer matches is parsed again and
+     * replaces its entry the next time the database is saved.
+     */
+    class FIFE_API AssetDatabase
+    {
+        public:
+            /** Name of the database file inside the import directory.
+             */
+            static constexpr char const * FILENAME = "assets.fifedb";
+
+            /** Opens the database of the directory, if there is one.
+             *
+             * A database from another version or a damaged one is treated as empty.
+             * The database is registered for find() until it is destroyed.
+             * @return The database or nullptr if the directory has no database file.
+             */
+            static std::unique_ptr<AssetDatabase> open(VFS* vfs, std::string const & directory);
+
+            /** Returns the open database whose directory contains filename, nullptr if none does.
+             */
+            static AssetDatabase* find(std::string const & filename);
+
+            /** Returns the records of an asset file.
+             *
+             * The records come from the open database that covers the file if there is one,
+             * otherwise the file is compiled into storage.
+             * @return The records, nullptr if the file could not be opened.
+             * @throws NotFound if the file does not exist.
+             */
+            static AssetFileRecord const * read(VFS* vfs, std::string const & filename, AssetFileRecord& storage);
+
+            /** Parses the contents of an asset file.
+             *
+             * The records do not depend on where the file is, paths stay relative to it.
+             */
+            static AssetFileRecord compile(std::string const & xml);
+
+            /** Constructor, registers an empty database of the directory.
+             *
+             * Nothing is read or written until load() or save() is called.
+             */
+            AssetDatabase(VFS* vfs, std::string directory);
+
+            AssetDatabase(AssetDatabase const &)            = delete;
+            AssetDatabase& operator=(AssetDatabase const &) = delete;
+
+            /** Destructor, unregisters the database without saving it.
+             */
+            ~AssetDatabase();
+
+            /** Maps the database file and reads its index.
+             *
+             * @return False if the file is missing, damaged or from another version.
+             */
+            bool load();
+
+            /** Writes the database file if an entry was compiled, dropped or got a new stamp since it was loaded.
+             *
+             * Nothing is written when every checked file was served from the database unchanged. The new file
+             * replaces the old one only once it is complete.
+             * @return False if the file could not be written.
+             */
+            bool save();
+
+            /** Returns the records of a file.
+             *
+             * The file is checked once per session. If its stamp matches the entry the records are
+             * taken without opening the file, otherwise it is read and hashed. If the database has
+             * no entry with the same hash the file is compiled.
+             * @return The records, or nullptr if the file is not inside the directory or cannot be opened.
+             */
+            AssetFileRecord const * get(std::string const & filename);
+
+            /** Compiles every xml file below the directory.
+             *
+             * Entries of files that no longer exist are dropped on the next save().
+             */
+            void compileDirectory();
+
+            /** Returns the path of the database file.
+             */
+            std::string const & getPath() const;
+
+            /** Returns the number of entries in the loaded index.
+             */
+            uint32_t getEntryCount() const;
+
+            /** Returns the number of files whose records came from the database.
+             */
+            uint32_t getHitCount() const;
+
+            /** Returns the number of files that had to be compiled.
+             */
+            uint32_t getCompileCount() const;
+
+        private:
+            struct Mapping;
+
+            /** Index entry, the blob points into the mapping.
+             */
+            struct IndexEntry
+            {
+                    uint64_t hash;
+                    std::optional<FileStamp> stamp;
+                    std::string_view blob;
+            };
+
+            /** A file that was checked in this session.
+             */
+            struct CheckedEntry
+            {
+                    uint64_t hash;
+                    std::optional<FileStamp> stamp;
+                    // nullptr if the file could not be opened
+                    std::unique_ptr<AssetFileRecord> record;
+                    bool compiled;
+            };
+
+            void compileDirectory(std::string const & directory);
+
+            VFS* m_vfs;
+            std::string m_directory;
+            std::string m_path;
+            std::unique_ptr<Mapping> m_mapping;
+            // keys are relative to m_directory
+            std::unordered_map<std::string, IndexEntry> m_index;
+            std::unordered_map<std::string, CheckedEntry> m_checked;
+            // drop unchecked entries on save
+            bool m_complete;
+            uint32_t m_hits;
+            uint32_t m_compiles;
+    };
+} // namespace FIFE
+
+#endif
@@ -6,21 +6,19 @@
 
 // Standard C++ library includes
 #include <cstdio>
-#include <format>
 #include <memory>
 #include <string>
 #include <vector>
 
 // FIFE includes
+#include "assetdatabase.h"
 #include "model/model.h"
 #include "model/structures/layer.h"
 #include "util/base/exception.h"
 #include "util/log/logger.h"
 #include "util/resource/resource.h"
 #include "util/resource/resourcemanager.h"
-#include "util/xml/xmlhelper.h"
 #include "vfs/filesystem.h"
-#include "vfs/raw/rawdata.h"
 #include "vfs/vfs.h"
 #include "video/animationmanager.h"
 #include "view/visual.h"
@@ -95,66 +93,25 @@ namespace FIFE
 
     bool AtlasLoader::isLoadable(std::string const & filename)
     {
-        fs::path const atlasPath(filename);
-        std::string const atlasFilename = atlasPath.string();
-        XML::Document atlasFile;
-
+        AssetFileRecord storage;
+        AssetFileRecord const * file = nullptr;
         try {
-            auto data = m_vfs->open(atlasFilename);
-
-            if (data != nullptr) {
-                if (data->getDataLength() != 0) {
-                    std::string const xml = data->readString(data->getDataLength());
-
-                    if (!XML::Parse(atlasFile, xml)) {
-                        return false;
-                    }
-                } else {
-                    return false;
-                }
-            }
+            file = AssetDatabase::read(m_vfs, filename, storage);
         } catch (NotFound&) {
             return false;
         }
 
-        // if we get here then loading the file went well
-        XML::Element* root = atlasFile.RootElement();
-
-        if (XML::HasName(root, "assets")) {
-            if (root->FirstChildElement("atlas") != nullptr) {
-                return true;
-            }
-        }
-
-        return false;
+        return file != nullptr && file->root == AssetFileRecord::RootAssets && !file->atlases.empty();
     }
 
     AtlasPtr AtlasLoader::load(std::string const & filename)
     {
-        fs::path const atlasPath(filename);
-        fs::path atlasPathDirectory;
-        std::string const atlasFilename = atlasPath.string();
-
-        if (HasParentPath(atlasPath)) {
-            // save the directory where the atlas file is located
-            atlasPathDirectory = GetParentPath(atlasPath);
-        }
-
-        XML::Document doc;
+        AssetFileRecord storage;
+        AssetFileRecord const * file = nullptr;
         AtlasPtr atlas;
 
         try {
-            auto data = m_vfs->open(atlasFilename);
-
-            if (data != nullptr) {
-                if (data->getDataLength() != 0) {
-                    std::string const xml = data->readString(data->getDataLength());
-
-                    if (!XML::Parse(doc, xml)) {
-                        return atlas;
-                    }
-                }
-            }
+            file = AssetDatabase::read(m_vfs, filename, storage);
         } catch (NotFound& e) {
             FL_ERR(_log(), e.what());
 
@@ -165,12 +122,8 @@ namespace FIFE
             return atlas;
         }
 
-        // if we get here then everything loaded properly
-        // so we can just parse out the contents
-        XML::Element* root = doc.RootElement();
-
-        if (XML::HasName(root, "assets")) {
-            atlas = loadAtlas(filename, root->FirstChildElement("atlas"));
+        if (file != nullptr && file->root == AssetFileRecord::RootAssets && !file->atlases.empty()) {
+            atlas = loadAtlas(filename, file->atlases.front());
         }
 
         return atlas;
@@ -178,30 +131,12 @@ namespace FIFE
 
     std::vector<AtlasPtr> AtlasLoader::loadMultiple(std::string const & filename)
     {
-        fs::path const atlasPath(filename);
-        fs::path atlasPathDirectory;
-        std::string const atlasFilename = atlasPath.string();
-
-        if (HasParentPath(atlasPath)) {
-            // save the directory where the atlas file is located
-            atlasPathDirectory = GetParentPath(atlasPath);
-        }
-
-        XML::Document doc;
+        AssetFileRecord storage;
+        AssetFileRecord const * file = nullptr;
         std::vector<AtlasPtr> atlasVector;
 
         try {
-            auto data = m_vfs->open(atlasFilename);
-
-            if (data != nullptr) {
-                if (data->getDataLength() != 0) {
-                    std::string const xml = data->readString(data->getDataLength());
-
-                    if (!XML::Parse(doc, xml)) {
-                        return atlasVector;
-                    }
-                }
-            }
+            file = AssetDatabase::read(m_vfs, filename, storage);
         } catch (NotFound& e) {
             FL_ERR(_log(), e.what());
 
@@ -212,14 +147,9 @@ namespace FIFE
             return atlasVector;
         }
 
-        // if we get here then everything loaded properly
-        // so we can just parse out the contents
-        XML::Element* root = doc.RootElement();
-
-        if (XML::HasName(root, "assets")) {
-            for (XML::Element* atlasElem = root->FirstChildElement("atlas"); atlasElem != nullptr;
-                 atlasElem               = atlasElem->NextSiblingElement("atlas")) {
-                AtlasPtr const atlas = loadAtlas(filename, atlasElem);
+        if (file != nullptr && file->root == AssetFileRecord::RootAssets) {
+            for (AtlasRecord const & record : file->atlases) {
+                AtlasPtr const atlas = loadAtlas(filename, record);
                 if (atlas) {
                     atlasVector.push_back(atlas);
                 }
@@ -229,115 +159,45 @@ namespace FIFE
         return atlasVector;
     }
 
-    AtlasPtr AtlasLoader::loadAtlas(std::string const & filename, tinyxml2::XMLElement* atlasElem)
+    AtlasPtr AtlasLoader::loadAtlas(std::string const & filename, AtlasRecord const & record)
     {
         AtlasPtr atlas;
-        if (atlasElem == nullptr) {
+        if (!record.source) {
             return atlas;
         }
 
-        char const * atlasSource = XML::Attribute(atlasElem, "source");
-        if (atlasSource != nullptr) {
-            char const * atlasId = XML::Attribute(atlasElem, "id");
-
-            fs::path const atlasPath(filename);
-            fs::path atlasPathDirectory;
-            if (HasParentPath(atlasPath)) {
-                // save the directory where the atlas file is located
-                atlasPathDirectory = GetParentPath(atlasPath);
-            }
+        fs::path const atlasPath(filename);
+        fs::path atlasPathDirectory;
+        if (HasParentPath(atlasPath)) {
+            // save the directory where the atlas file is located
+            atlasPathDirectory = GetParentPath(atlasPath);
+        }
 
-            // Atlas itself doesn't have appended id
-            fs::path const atlasImagePath = atlasPathDirectory / atlasSource;
-            auto atlasTemp                = std::make_unique<Atlas>(atlasImagePath.string());
-            atlas                         = SharedPtr<Atlas>(atlasTemp.release());
+        // Atlas itself doesn't have appended id
+        fs::path const atlasImagePath = atlasPathDirectory / *record.source;
+        auto atlasTemp                = std::make_unique<Atlas>(atlasImagePath.string());
+        atlas                         = SharedPtr<Atlas>(atlasTemp.release());
+
+        // End-user could create the same atlas for the second time.
+        // Since we don't hold any data for Atlases like ImageManager we need to recreate
+        // atlas parameters (to return proper AtlasPtr) but don't reload pixel data (they are held by ImageManager).
+        if (!m_imageManager->exists(atlas->getName())) {
+            atlas->setPackedImage(m_imageManager->create(atlas->getName()));
+        } else {
+            atlas->setPackedImage(m_imageManager->getPtr(atlas->getName()));
+        }
 
-            // End-user could create the same atlas for the second time.
-            // Since we don't hold any data for Atlases like ImageManager we need to recreate
-            // atlas parameters (to return proper AtlasPtr) but don't reload pixel data (they are held by ImageManager).
-            if (!m_imageManager->exists(atlas->getName())) {
-                atlas->setPackedImage(m_imageManager->create(atlas->getName()));
+        for (AtlasRegionRecord const & region : record.regions) {
+            ImagePtr subImage;
+            if (!m_imageManager->exists(region.name)) {
+                subImage = m_imageManager->create(region.name);
             } else {
-                atlas->setPackedImage(m_imageManager->getPtr(atlas->getName()));
+                subImage = m_imageManager->getPtr(region.name);
             }
-            // Create subimages with given id and individual position and size
-            if (atlasElem->FirstChildElement("subimage") != nullptr) {
-                for (XML::Element* imageElem = atlasElem->FirstChildElement("subimage"); imageElem != nullptr;
-                     imageElem               = imageElem->NextSiblingElement("subimage")) {
-
-                    char const * subimageId = XML::Attribute(imageElem, "id");
-                    if (subimageId != nullptr) {
-                        Rect region;
-                        XML::QueryAttribute(imageElem, "xpos", &region.x);
-                        XML::QueryAttribute(imageElem, "ypos", &region.y);
-                        XML::QueryAttribute(imageElem, "width", &region.w);
-                        XML::QueryAttribute(imageElem, "height", &region.h);
-
-                        std::string finalname;
-                        // atlas id is optional here
-                        if (atlasId != nullptr) {
-                            finalname = std::string(atlasId) + ":" + subimageId;
-                        } else {
-                            finalname = subimageId;
-                        }
-                        ImagePtr subImage;
-
-                        if (!m_imageManager->exists(finalname)) {
-                            subImage = m_imageManager->create(finalname);
-                        } else {
-                            subImage = m_imageManager->getPtr(finalname);
-                        }
-                        subImage->useSharedImage(atlas->getPackedImage(), region);
-
-                        AtlasData const atlasData = {.rect = region, .image = subImage};
-                        atlas->addImage(finalname, atlasData);
-                    }
-                }
-            } else {
-                // Create subimages with automatic id and same size
-                int atlasWidth     = 0;
-                int atlasHeight    = 0;
-                int subimageWidth  = 0;
-                int subimageHeight = 0;
-                XML::QueryAttribute(atlasElem, "atlas_width", &atlasWidth);
-                XML::QueryAttribute(atlasElem, "atlas_height", &atlasHeight);
-                XML::QueryAttribute(atlasElem, "subimage_width", &subimageWidth);
-                XML::QueryAttribute(atlasElem, "subimage_height", &subimageHeight);
-                // file extension of the atlas is also used as subimage extension
-                std::string const extension = GetExtension(std::string(atlasSource));
-                // we need an atlas id
-                if (atlasId == nullptr) {
-                    atlasId = atlasSource;
-                }
+            subImage->useSharedImage(atlas->getPackedImage(), region.region);
 
-                if (atlasWidth != 0 && atlasHeight != 0 && subimageWidth != 0 && subimageHeight != 0) {
-                    int const x_rows = atlasWidth / subimageWidth;
-                    int const y_rows = atlasHeight / subimageHeight;
-                    Rect region(0, 0, subimageWidth, subimageHeight);
-                    int frame = 0;
-                    for (int y = 0; y < y_rows; ++y) {
-                        region.y = y * subimageHeight;
-                        for (int x = 0; x < x_rows; ++x) {
-                            region.x = x * subimageWidth;
-
-                            std::string const finalname = std::format("{}:{:04d}{}", atlasId, frame, extension);
-
-                            ImagePtr subImage;
-                            if (!m_imageManager->exists(finalname)) {
-                                subImage = m_imageManager->create(finalname);
-                            } else {
-                                subImage = m_imageManager->getPtr(finalname);
-                            }
-                            subImage->useSharedImage(atlas->getPackedImage(), region);
-
-                            AtlasData const atlasData = {.rect = region, .image = subImage};
-                            atlas->addImage(finalname, atlasData);
-
-                            ++frame;
-                        }
-                    }
-                }
-            }
+            AtlasData const atlasData = {.rect = region.region, .image = subImage};
+            atlas->addImage(region.name, atlasData);
         }
 
         return atlas;
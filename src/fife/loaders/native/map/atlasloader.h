@@ -21,17 +21,13 @@
 #include "video/image.h"
 #include "video/imagemanager.h"
 
-namespace tinyxml2
-{
-    class XMLElement;
-}
-
 namespace FIFE
 {
     class Model;
     class VFS;
     class ImageManager;
     class AnimationManager;
+    struct AtlasRecord;
 
     struct FIFE_API AtlasData
     {
@@ -103,7 +99,7 @@ namespace FIFE
             std::vector<AtlasPtr> loadMultiple(std::string const & filename) override;
 
         private:
-            AtlasPtr loadAtlas(std::string const & filename, tinyxml2::XMLElement* atlasElem);
+            AtlasPtr loadAtlas(std::string const & filename, AtlasRecord const & record);
 
             Model* m_model [[maybe_unused]]; // TODO: implement model loading from atlas
             VFS* m_vfs;
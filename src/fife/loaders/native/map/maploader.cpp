@@ -6,6 +6,7 @@
 
 // Standard C++ library includes
 #include <cassert>
+#include <format>
 #include <limits>
 #include <list>
 #include <map>
@@ -16,6 +17,7 @@
 
 // FIFE includes
 #include "animationloader.h"
+#include "assetdatabase.h"
 #include "atlasloader.h"
 #include "model/metamodel/action.h"
 #include "model/metamodel/grids/cellgrid.h"
@@ -421,6 +423,7 @@ namespace FIFE
                                         }
                                     }
 
+                                    parseTiles(layerElement, layer);
                                     parseLights(layerElement, layer);
                                     parseSounds(layerElement, layer);
                                 }
@@ -758,6 +761,53 @@ namespace FIFE
         return map;
     }
 
+    void MapLoader::parseTiles(XML::Element const * layerElement, Layer* layer)
+    {
+        assert("layerElement required" && layerElement);
+        assert("layer required" && layer);
+
+        XML::Element const * tilesElement = layerElement->FirstChildElement("tiles");
+        if (tilesElement == nullptr) {
+            return;
+        }
+
+        // a missing x continues the row of the previous tile, a missing y keeps its row
+        std::string ns;
+        int curr_x = 0;
+        int curr_y = 0;
+        for (XML::Element const * tileElement = tilesElement->FirstChildElement("t"); tileElement != nullptr;
+             tileElement                      = tileElement->NextSiblingElement("t")) {
+            int x = 0;
+            int y = 0;
+            if (XML::QueryAttribute(tileElement, "x", &x) == XML::SUCCESS) {
+                curr_x = x;
+            } else {
+                x = ++curr_x;
+            }
+            if (XML::QueryAttribute(tileElement, "y", &y) == XML::SUCCESS) {
+                curr_y = y;
+            } else {
+                y = curr_y;
+            }
+
+            char const * namespaceId = XML::Attribute(tileElement, "ns");
+            if (namespaceId != nullptr) {
+                ns = namespaceId;
+            }
+            char const * objectId = XML::Attribute(tileElement, "o");
+            if (objectId == nullptr) {
+                continue;
+            }
+
+            Object* object = m_model->getObject(objectId, ns);
+            if (object == nullptr) {
+                FL_ERR(_log(), std::format("Failed to create tile of unknown object {} : {}", objectId, ns));
+                continue;
+            }
+            layer->setTile(ModelCoordinate(x, y), object);
+        }
+    }
+
     void MapLoader::parseLights(XML::Element const * layerElement, Layer* layer)
     {
         assert("layerElement required" && layerElement);
@@ -1074,6 +1124,12 @@ namespace FIFE
             fs::path const importDirectory(directory);
             std::string const importDirectoryString = importDirectory.string();
 
+            // nested directories use the database of the outer one
+            std::unique_ptr<AssetDatabase> database;
+            if (AssetDatabase::find(importDirectoryString) == nullptr) {
+                database = AssetDatabase::open(m_vfs, importDirectoryString);
+            }
+
             std::set<std::string> const files = m_vfs->listFiles(importDirectoryString);
 
             // load all xml files in the directory
@@ -1094,7 +1150,29 @@ namespace FIFE
                     loadImportDirectory(importDirectoryString + "/" + *iter);
                 }
             }
+
+            if (database) {
+                database->save();
+            }
+        }
+    }
+
+    bool MapLoader::buildAssetDatabase(std::string const & directory)
+    {
+        AssetDatabase database(m_vfs, directory);
+        database.load();
+        database.compileDirectory();
+        if (!database.save()) {
+            return false;
         }
+        FL_LOG(
+            _log(),
+            std::format(
+                "Asset database {}: {} files, {} compiled",
+                database.getPath(),
+                database.getEntryCount(),
+                database.getCompileCount()));
+        return true;
     }
 
     void MapLoader::addPercentDoneListener(PercentDoneListener* listener)
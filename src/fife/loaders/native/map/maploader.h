@@ -95,6 +95,13 @@ namespace FIFE
              */
             void loadImportDirectory(std::string const & directory);
 
+            /** compiles all asset files below directory into its asset database
+             * and writes the database file, creating it if needed. loadImportDirectory()
+             * then reads the records from the database instead of parsing the files.
+             * returns false if the database could not be written
+             */
+            bool buildAssetDatabase(std::string const & directory);
+
             /**
              * allows adding a listener to the map loader
              * for percent completed events
@@ -155,6 +162,7 @@ namespace FIFE
             std::vector<std::string> m_importDirectories;
             std::vector<LightData> m_lightData;
 
+            void parseTiles(tinyxml2::XMLElement const * layerElement, Layer* layer);
             void parseLights(tinyxml2::XMLElement const * layerElement, Layer* layer);
             void parseSounds(tinyxml2::XMLElement const * layerElement, Layer* layer);
             void createLightNodes(Map* map);
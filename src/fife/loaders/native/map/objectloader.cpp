@@ -15,15 +15,14 @@
 
 // FIFE includes
 #include "animationloader.h"
+#include "assetdatabase.h"
 #include "atlasloader.h"
 #include "audio/actionaudio.h"
 #include "model/metamodel/action.h"
 #include "model/metamodel/object.h"
 #include "model/model.h"
 #include "util/log/logger.h"
-#include "util/xml/xmlhelper.h"
 #include "vfs/filesystem.h"
-#include "vfs/raw/rawdata.h"
 #include "vfs/vfs.h"
 #include "video/animationmanager.h"
 #include "video/imagemanager.h"
@@ -99,80 +98,37 @@ namespace FIFE
     {
         fs::path const objectPath(filename);
 
-        XML::Document objectFile;
+        AssetFileRecord storage;
+        AssetFileRecord const * file = nullptr;
 
         try {
-            auto data = m_vfs->open(objectPath.string());
-
-            if (data != nullptr) {
-                if (data->getDataLength() != 0) {
-                    std::string const xml = data->readString(data->getDataLength());
-
-                    if (!XML::Parse(objectFile, xml)) {
-                        std::ostringstream oss;
-                        oss << " Failed to load" << objectPath.string() << " : " << __FILE__ << " [" << __LINE__ << "]"
-                            << '\n';
-                        FL_ERR(_log(), oss.str());
-
-                        return false;
-                    }
-                } else {
-                    std::ostringstream oss;
-                    oss << " Failed to load" << objectPath.string() << " : " << __FILE__ << " [" << __LINE__ << "]"
-                        << '\n';
-                    FL_ERR(_log(), oss.str());
-
-                    return false;
-                }
-            } else {
-                std::ostringstream oss;
-                oss << " Failed to load" << objectPath.string() << " : " << __FILE__ << " [" << __LINE__ << "]" << '\n';
-                FL_ERR(_log(), oss.str());
-
-                return false;
-            }
+            file = AssetDatabase::read(m_vfs, objectPath.string(), storage);
         } catch (NotFound&) {
-            std::ostringstream oss;
-            oss << " Failed to load" << objectPath.string() << " : " << __FILE__ << " [" << __LINE__ << "]" << '\n';
-            FL_ERR(_log(), oss.str());
-
             // TODO - should we abort here
             //        or rethrow the exception
             //        or just keep going
-
-            return false;
         }
 
-        // if we get here then loading the file went well
-        XML::Element* root = objectFile.RootElement();
+        if (file == nullptr || file->root == AssetFileRecord::RootInvalid) {
+            std::ostringstream oss;
+            oss << " Failed to load" << objectPath.string() << " : " << __FILE__ << " [" << __LINE__ << "]" << '\n';
+            FL_ERR(_log(), oss.str());
 
-        if (XML::HasName(root, "assets")) {
-            if (root->FirstChildElement("object") != nullptr) {
-                return true;
-            }
+            return false;
         }
 
-        return false;
+        return file->root == AssetFileRecord::RootAssets && !file->objects.empty();
     }
 
     void ObjectLoader::load(std::string const & filename)
     {
         fs::path const objectPath(filename);
 
-        XML::Document objectFile;
+        AssetFileRecord storage;
+        AssetFileRecord const * file = nullptr;
 
         try {
-            auto data = m_vfs->open(objectPath.string());
-
-            if (data != nullptr) {
-                if (data->getDataLength() != 0) {
-                    std::string const xml = data->readString(data->getDataLength());
-
-                    if (!XML::Parse(objectFile, xml)) {
-                        return;
-                    }
-                }
-            }
+            file = AssetDatabase::read(m_vfs, objectPath.string(), storage);
         } catch (NotFound&) {
             std::ostringstream oss;
             oss << " Failed to load" << objectPath.string() << " : " << __FILE__ << " [" << __LINE__ << "]" << '\n';
@@ -184,498 +140,336 @@ namespace FIFE
 
             return;
         }
+        if (file == nullptr || file->root == AssetFileRecord::RootInvalid) {
+            return;
+        }
+
         std::string objectDirectory;
         if (HasParentPath(objectPath)) {
             objectDirectory = GetParentPath(objectPath).string();
         }
 
-        // if we get here then loading the file went well
-        XML::Element* root = objectFile.RootElement();
-        if (root != nullptr) {
-            for (XML::Element const * importElement = root->FirstChildElement("import"); importElement != nullptr;
-                 importElement                      = importElement->NextSiblingElement("import")) {
-                char const * importDir  = XML::Attribute(importElement, "dir");
-                char const * importFile = XML::Attribute(importElement, "file");
+        for (ImportRecord const & import : file->imports) {
+            if (import.directory && !import.file) {
+                fs::path fullPath(objectDirectory);
+                fullPath /= *import.directory;
+                loadImportDirectory(fullPath.string());
+            } else if (import.file) {
+                fs::path fullFilePath(*import.file);
+                fs::path fullDirPath(import.directory.value_or(""));
+                if (import.directory) {
+                    fullDirPath = fs::path(objectDirectory);
+                    fullDirPath /= *import.directory;
+                } else {
+                    fullFilePath = fs::path(objectDirectory);
+                    fullFilePath /= *import.file;
+                }
+                loadImportFile(fullFilePath.string(), fullDirPath.string());
+            }
+        }
+
+        if (file->root == AssetFileRecord::RootAssets) {
+            for (ObjectRecord const & record : file->objects) {
+                loadObject(filename, record);
+            }
+        }
+    }
 
-                std::string directory;
-                if (importDir != nullptr) {
-                    directory = importDir;
+    void ObjectLoader::loadObject(std::string const & filename, ObjectRecord const & record)
+    {
+        if (!record.id || !record.nameSpace) {
+            return;
+        }
+        std::string const & objectId    = *record.id;
+        std::string const & namespaceId = *record.nameSpace;
+
+        Object* obj = nullptr;
+        if (record.parent) {
+            Object* parent = m_model->getObject(*record.parent, namespaceId);
+            if (parent != nullptr) {
+                try {
+                    obj = m_model->createObject(objectId, namespaceId, parent);
+                } catch (NameClash&) {
+                    // TODO - handle exception
+                    assert(false);
+                }
+            }
+        } else {
+            // this will make sure the object has not already been loaded
+            if (m_model->getObject(objectId, namespaceId) == nullptr) {
+                try {
+                    obj = m_model->createObject(objectId, namespaceId);
+                } catch (NameClash& e) {
+                    FL_ERR(_log(), e.what());
+
+                    // TODO - handle exception
+                    assert(false);
                 }
+            }
+        }
+
+        if (obj == nullptr) {
+            return;
+        }
+
+        obj->setFilename(filename);
+        ObjectVisual::create(obj);
+
+        obj->setBlocking(record.blocking);
+        obj->setStatic(record.isStatic);
+        obj->setPather(m_model->getPather(record.pather.value_or("RoutePather")));
+
+        if (record.costId) {
+            obj->setCostId(*record.costId);
+            if (record.cost) {
+                obj->setCost(*record.cost);
+            }
+        }
+
+        if (record.areaId) {
+            obj->setArea(*record.areaId);
+        }
+
+        if (record.speed) {
+            obj->setSpeed(*record.speed);
+        }
+
+        // loop over all walkable areas
+        for (std::string const & walkableId : record.walkableAreas) {
+            obj->addWalkableArea(walkableId);
+        }
+
+        assert(record.cellStack >= 0);
+        assert(std::cmp_less_equal(record.cellStack, std::numeric_limits<uint8_t>::max()));
+        obj->setCellStackPosition(static_cast<uint8_t>(record.cellStack));
+
+        if (record.anchorX && record.anchorY) {
+            obj->setRotationAnchor(ExactModelCoordinate(*record.anchorX, *record.anchorY, 0.0));
+        }
+
+        obj->setRestrictedRotation(record.restrictedRotation);
+
+        if (record.zStepLimit) {
+            obj->setZStepRange(*record.zStepLimit);
+        }
+
+        // multi parts
+        for (std::string const & partId : record.multiPartIds) {
+            obj->addMultiPartId(partId);
+        }
+        // relative coordinates which are used to position the object
+        for (MultiPartCoordinateRecord const & coordinate : record.multiPartCoordinates) {
+            obj->addMultiPartCoordinate(
+                coordinate.rotation, ModelCoordinate(coordinate.x, coordinate.y, coordinate.z));
+        }
 
-                std::string file;
-                if (importFile != nullptr) {
-                    file = importFile;
+        for (ObjectImageRecord const & image : record.images) {
+            fs::path imagePath(filename);
+
+            if (HasParentPath(imagePath)) {
+                imagePath = GetParentPath(imagePath) / image.source;
+            } else {
+                imagePath = fs::path(image.source);
+            }
+
+            if (!fs::exists(imagePath)) {
+                imagePath = fs::path(image.source);
+            }
+
+            ImagePtr imagePtr;
+            if (!m_imageManager->exists(imagePath.string())) {
+                imagePtr = m_imageManager->create(imagePath.string());
+            } else {
+                imagePtr = m_imageManager->getPtr(imagePath.string());
+            }
+
+            if (imagePtr) {
+                if (image.xOffset) {
+                    imagePtr->setXShift(*image.xOffset);
                 }
+                if (image.yOffset) {
+                    imagePtr->setYShift(*image.yOffset);
+                }
+                if (image.direction) {
+                    auto* objVisual = obj->getVisual<ObjectVisual>();
 
-                if ((importDir != nullptr) && (importFile == nullptr)) {
-                    fs::path fullPath(objectDirectory);
-                    fullPath /= directory;
-                    loadImportDirectory(fullPath.string());
-                } else if (importFile != nullptr) {
-                    fs::path fullFilePath(file);
-                    fs::path fullDirPath(directory);
-                    if (importDir != nullptr) {
-                        fullDirPath = fs::path(objectDirectory);
-                        fullDirPath /= directory;
-                    } else {
-                        fullFilePath = fs::path(objectDirectory);
-                        fullFilePath /= file;
+                    if (objVisual != nullptr) {
+                        assert(*image.direction >= 0);
+                        objVisual->addStaticImage(
+                            static_cast<uint32_t>(*image.direction), static_cast<int32_t>(imagePtr->getHandle()));
                     }
-                    loadImportFile(fullFilePath.string(), fullDirPath.string());
                 }
             }
         }
 
-        if (XML::HasName(root, "assets")) {
-            for (XML::Element* objectElem = root->FirstChildElement("object"); objectElem != nullptr;
-                 objectElem               = objectElem->NextSiblingElement("object")) {
-                char const * objectId    = XML::Attribute(objectElem, "id");
-                char const * namespaceId = XML::Attribute(objectElem, "namespace");
-
-                Object* obj = nullptr;
-                if ((objectId != nullptr) && (namespaceId != nullptr)) {
-                    char const * parentId = XML::Attribute(objectElem, "parent");
-
-                    if (parentId != nullptr) {
-                        Object* parent = m_model->getObject(parentId, namespaceId);
-                        if (parent != nullptr) {
-                            try {
-                                obj = m_model->createObject(objectId, namespaceId, parent);
-                            } catch (NameClash&) {
-                                // TODO - handle exception
-                                assert(false);
-                            }
-                        }
-                    } else {
-                        // this will make sure the object has not already been loaded
-                        if (m_model->getObject(objectId, namespaceId) == nullptr) {
-                            try {
-                                obj = m_model->createObject(objectId, namespaceId);
-                            } catch (NameClash& e) {
-                                FL_ERR(_log(), e.what());
-
-                                // TODO - handle exception
-                                assert(false);
-                            }
-                        }
-                    }
-                }
+        for (ActionRecord const & actionRecord : record.actions) {
+            Action* action = obj->createAction(actionRecord.id, actionRecord.isDefault);
 
-                if (obj != nullptr) {
-                    obj->setFilename(objectPath.string());
-                    ObjectVisual::create(obj);
+            // Fetch ActionAudio data
+            if (actionRecord.sound) {
+                action->adoptAudio(createActionAudio(*actionRecord.sound).release());
+            }
 
-                    int isBlocking = 0;
-                    objectElem->QueryIntAttribute("blocking", &isBlocking);
-                    obj->setBlocking(isBlocking != 0);
+            // Create and fetch ActionVisual
+            ActionVisual::create(action);
 
-                    int isStatic = 0;
-                    objectElem->QueryIntAttribute("static", &isStatic);
-                    obj->setStatic(isStatic != 0);
+            for (ActionAnimationRecord const & animation : actionRecord.animations) {
+                loadActionAnimation(filename, objectId, actionRecord.id, action, animation);
+            }
+        }
+    }
 
-                    char const * pather = XML::Attribute(objectElem, "pather");
+    std::unique_ptr<ActionAudio> ObjectLoader::createActionAudio(ActionSoundRecord const & sound)
+    {
+        auto audio = std::make_unique<ActionAudio>();
+        audio->setSoundFileName(sound.source);
 
-                    if (pather != nullptr) {
-                        obj->setPather(m_model->getPather(pather));
-                    } else {
-                        obj->setPather(m_model->getPather("RoutePather"));
-                    }
+        if (sound.group) {
+            audio->setGroupName(*sound.group);
+        }
+        if (sound.volume) {
+            audio->setGain(*sound.volume);
+        }
+        if (sound.maxVolume) {
+            audio->setMaxGain(*sound.maxVolume);
+        }
+        if (sound.minVolume) {
+            audio->setMinGain(*sound.minVolume);
+        }
+        if (sound.referenceDistance) {
+            audio->setReferenceDistance(*sound.referenceDistance);
+        }
+        if (sound.maxDistance) {
+            audio->setMaxDistance(*sound.maxDistance);
+        }
+        if (sound.rolloff) {
+            audio->setRolloff(*sound.rolloff);
+        }
+        if (sound.pitch) {
+            audio->setPitch(*sound.pitch);
+        }
+        if (sound.coneInnerAngle) {
+            audio->setConeInnerAngle(*sound.coneInnerAngle);
+        }
+        if (sound.coneOuterAngle) {
+            audio->setConeOuterAngle(*sound.coneOuterAngle);
+        }
+        if (sound.coneOuterGain) {
+            audio->setConeOuterGain(*sound.coneOuterGain);
+        }
+        if (sound.looping) {
+            audio->setLooping(*sound.looping);
+        }
+        if (sound.relativePosition) {
+            audio->setRelativePositioning(*sound.relativePosition);
+        }
+        if (sound.direction) {
+            audio->setDirection(*sound.direction);
+        }
+        if (sound.xVelocity && sound.yVelocity) {
+            audio->setVelocity(AudioSpaceCoordinate(*sound.xVelocity, *sound.yVelocity, sound.zVelocity));
+        }
+        return audio;
+    }
 
-                    char const * costId = XML::Attribute(objectElem, "cost_id");
-                    if (costId != nullptr) {
-                        obj->setCostId(costId);
-                        double cost       = 1.0;
-                        int const success = objectElem->QueryDoubleAttribute("cost", &cost);
-                        if (success == XML::SUCCESS) {
-                            obj->setCost(cost);
-                        }
-                    }
+    void ObjectLoader::loadActionAnimation(
+        std::string const & filename,
+        std::string const & objectId,
+        std::string const & actionId,
+        Action* action,
+        ActionAnimationRecord const & record)
+    {
+        auto* actionVisual = action->getVisual<ActionVisual>();
+
+        // Fetch already created animation
+        if (record.animationId) {
+            AnimationPtr const animation = m_animationManager->getPtr(*record.animationId);
+            if (animation && actionVisual != nullptr) {
+                actionVisual->addAnimation(animation->getDirection(), animation);
+                action->setDuration(static_cast<uint32_t>(animation->getDuration()));
+                return;
+            }
+        }
 
-                    char const * areaId = XML::Attribute(objectElem, "area_id");
-                    if (areaId != nullptr) {
-                        obj->setArea(areaId);
-                    }
+        // Create animated spritesheet
+        if (record.atlas) {
+            fs::path atlasPath(filename);
 
-                    double speed = 1.0;
-                    int success  = root->QueryDoubleAttribute("speed", &speed);
-                    if (success == XML::SUCCESS) {
-                        obj->setSpeed(speed);
-                    }
+            if (HasParentPath(atlasPath)) {
+                atlasPath = GetParentPath(atlasPath) / *record.atlas;
+            } else {
+                atlasPath = fs::path(*record.atlas);
+            }
 
-                    // loop over all walkable areas
-                    for (XML::Element* walkableElement = objectElem->FirstChildElement("walkable_area");
-                         walkableElement != nullptr;
-                         walkableElement = walkableElement->NextSiblingElement("walkable_area")) {
-                        char const * walkableId = XML::Attribute(walkableElement, "id");
-                        if (walkableId != nullptr) {
-                            obj->addWalkableArea(walkableId);
-                        }
-                    }
+            ImagePtr atlasImgPtr;
+            // we need to load this since its shared image
+            if (!m_imageManager->exists(atlasPath.string())) {
+                atlasImgPtr = m_imageManager->create(atlasPath.string());
+            } else {
+                atlasImgPtr = m_imageManager->getPtr(atlasPath.string());
+            }
+
+            int nDir = 0;
+            for (SpriteDirectionRecord const & direction : record.directions) {
+                int const dir = direction.direction;
 
-                    int cellStack = 0;
-                    objectElem->QueryIntAttribute("cellstack", &cellStack);
-                    assert(cellStack >= 0);
-                    assert(std::cmp_less_equal(cellStack, std::numeric_limits<uint8_t>::max()));
-                    obj->setCellStackPosition(static_cast<uint8_t>(cellStack));
+                std::string const aniId      = std::format("{}:{}:{:03d}", objectId, actionId, dir);
+                AnimationPtr const animation = m_animationManager->create(aniId);
 
-                    double ax       = 0;
-                    double ay       = 0;
-                    double const az = 0;
+                if (direction.actionFrame) {
+                    animation->setActionFrame(*direction.actionFrame);
+                }
 
-                    int xRetVal = XML::QueryAttribute(objectElem, "anchor_x", &ax);
-                    int yRetVal = XML::QueryAttribute(objectElem, "anchor_y", &ay);
-                    if (xRetVal == XML::SUCCESS && yRetVal == XML::SUCCESS) {
-                        obj->setRotationAnchor(ExactModelCoordinate(ax, ay, az));
+                for (int iframe = 0; iframe < direction.frames; ++iframe) {
+                    std::string const frameId =
+                        std::format("{}:{}:{:03d}:{:04d}", objectId, actionId, dir, iframe);
+                    Rect const region(
+                        record.frameWidth * iframe, record.frameHeight * nDir, record.frameWidth, record.frameHeight);
+                    ImagePtr framePtr;
+                    if (!m_imageManager->exists(frameId)) {
+                        framePtr = m_imageManager->create(frameId);
+                        framePtr->useSharedImage(atlasImgPtr, region);
+                        framePtr->setXShift(direction.xOffset);
+                        framePtr->setYShift(direction.yOffset);
+                    } else {
+                        framePtr = m_imageManager->getPtr(frameId);
                     }
+                    animation->addFrame(framePtr, static_cast<uint32_t>(direction.delay));
+                }
 
-                    int isRestrictedRotation = 0;
-                    objectElem->QueryIntAttribute("restricted_rotation", &isRestrictedRotation);
-                    obj->setRestrictedRotation(isRestrictedRotation != 0);
+                if (actionVisual != nullptr) {
+                    assert(dir >= 0);
+                    actionVisual->addAnimation(static_cast<uint32_t>(dir), animation);
+                    action->setDuration(static_cast<uint32_t>(animation->getDuration()));
+                }
+                ++nDir;
+            }
+            return;
+        }
 
-                    int zStep         = 0;
-                    int const zRetVal = objectElem->QueryIntAttribute("z_step_limit", &zStep);
-                    if (zRetVal == XML::SUCCESS) {
-                        obj->setZStepRange(zStep);
-                    }
+        // Load animation.xml with frames
+        if (record.source) {
+            fs::path animPath(filename);
 
-                    // loop over all multi parts
-                    for (XML::Element* multiElement = objectElem->FirstChildElement("multipart");
-                         multiElement != nullptr;
-                         multiElement = multiElement->NextSiblingElement("multipart")) {
-                        char const * partId = XML::Attribute(multiElement, "id");
-                        if (partId != nullptr) {
-                            obj->addMultiPartId(partId);
-                        }
-                        for (XML::Element* multiRotation = multiElement->FirstChildElement("rotation");
-                             multiRotation != nullptr;
-                             multiRotation = multiRotation->NextSiblingElement("rotation")) {
-                            int rotation = 0;
-                            multiRotation->QueryIntAttribute("rot", &rotation);
-                            // relative coordinates which are used to position the object
-                            for (XML::Element* multiCoordinate = multiRotation->FirstChildElement("occupied_coord");
-                                 multiCoordinate != nullptr;
-                                 multiCoordinate = multiCoordinate->NextSiblingElement("occupied_coord")) {
-                                int x   = 0;
-                                int y   = 0;
-                                xRetVal = XML::QueryAttribute(multiCoordinate, "x", &x);
-                                yRetVal = XML::QueryAttribute(multiCoordinate, "y", &y);
-                                if (xRetVal == XML::SUCCESS && yRetVal == XML::SUCCESS) {
-                                    int z = 0;
-                                    multiCoordinate->QueryIntAttribute("z", &z);
-                                    obj->addMultiPartCoordinate(rotation, ModelCoordinate(x, y, z));
-                                }
-                            }
-                        }
-                    }
+            if (HasParentPath(animPath)) {
+                animPath = GetParentPath(animPath) / *record.source;
+            } else {
+                animPath = fs::path(*record.source);
+            }
 
-                    // loop over all image tags
-                    for (XML::Element* imageElement = objectElem->FirstChildElement("image"); imageElement != nullptr;
-                         imageElement               = imageElement->NextSiblingElement("image")) {
-                        char const * sourceId = XML::Attribute(imageElement, "source");
-
-                        if (sourceId != nullptr) {
-                            fs::path imagePath(filename);
-
-                            if (HasParentPath(imagePath)) {
-                                imagePath = GetParentPath(imagePath) / sourceId;
-                            } else {
-                                imagePath = fs::path(sourceId);
-                            }
-
-                            if (!fs::exists(imagePath)) {
-                                imagePath = fs::path(sourceId);
-                            }
-
-                            ImagePtr imagePtr;
-                            if (!m_imageManager->exists(imagePath.string())) {
-                                imagePtr = m_imageManager->create(imagePath.string());
-                            } else {
-                                imagePtr = m_imageManager->getPtr(imagePath.string());
-                            }
-
-                            if (imagePtr) {
-                                int xOffset = 0;
-                                success     = imageElement->QueryIntAttribute("x_offset", &xOffset);
-
-                                if (success == XML::SUCCESS) {
-                                    imagePtr->setXShift(xOffset);
-                                }
-
-                                int yOffset = 0;
-                                success     = imageElement->QueryIntAttribute("y_offset", &yOffset);
-
-                                if (success == XML::SUCCESS) {
-                                    imagePtr->setYShift(yOffset);
-                                }
-
-                                int direction = 0;
-                                success       = imageElement->QueryIntAttribute("direction", &direction);
-
-                                if (success == XML::SUCCESS) {
-                                    auto* objVisual = obj->getVisual<ObjectVisual>();
-
-                                    if (objVisual != nullptr) {
-                                        assert(direction >= 0);
-                                        objVisual->addStaticImage(
-                                            static_cast<uint32_t>(direction),
-                                            static_cast<int32_t>(imagePtr->getHandle()));
-                                    }
-                                }
-                            }
-                        }
-                    }
+            AnimationPtr animation;
+            if (m_animationLoader && m_animationLoader->isLoadable(animPath.string())) {
+                animation = m_animationLoader->load(animPath.string());
+            }
 
-                    for (XML::Element* actionElement = objectElem->FirstChildElement("action");
-                         actionElement != nullptr;
-                         actionElement = actionElement->NextSiblingElement("action")) {
-                        char const * actionId = XML::Attribute(actionElement, "id");
-
-                        if (actionId != nullptr) {
-                            int isDefault = 0;
-                            actionElement->QueryIntAttribute("default", &isDefault);
-                            Action* action = obj->createAction(actionId, (isDefault != 0));
-
-                            // Fetch ActionAudio data
-                            XML::Element const * soundElement = actionElement->FirstChildElement("sound");
-                            if (soundElement != nullptr) {
-                                char const * clip = XML::Attribute(soundElement, "source");
-                                if (clip != nullptr) {
-                                    auto audio = std::make_unique<ActionAudio>();
-                                    audio->setSoundFileName(clip);
-
-                                    char const * group = XML::Attribute(soundElement, "group");
-                                    if (group != nullptr) {
-                                        audio->setGroupName(group);
-                                    }
-
-                                    float value      = 0;
-                                    int success_attr = XML::QueryAttribute(soundElement, "volume", &value);
-                                    if (success_attr == XML::SUCCESS) {
-                                        audio->setGain(value);
-                                    }
-                                    success_attr = XML::QueryAttribute(soundElement, "max_volume", &value);
-                                    if (success_attr == XML::SUCCESS) {
-                                        audio->setMaxGain(value);
-                                    }
-                                    success_attr = XML::QueryAttribute(soundElement, "min_volume", &value);
-                                    if (success_attr == XML::SUCCESS) {
-                                        audio->setMinGain(value);
-                                    }
-                                    success_attr = XML::QueryAttribute(soundElement, "ref_distance", &value);
-                                    if (success_attr == XML::SUCCESS) {
-                                        audio->setReferenceDistance(value);
-                                    }
-                                    success_attr = XML::QueryAttribute(soundElement, "max_distance", &value);
-                                    if (success_attr == XML::SUCCESS) {
-                                        audio->setMaxDistance(value);
-                                    }
-                                    success_attr = XML::QueryAttribute(soundElement, "rolloff", &value);
-                                    if (success_attr == XML::SUCCESS) {
-                                        audio->setRolloff(value);
-                                    }
-                                    success_attr = XML::QueryAttribute(soundElement, "pitch", &value);
-                                    if (success_attr == XML::SUCCESS) {
-                                        audio->setPitch(value);
-                                    }
-                                    success_attr = XML::QueryAttribute(soundElement, "cone_inner_angle", &value);
-                                    if (success_attr == XML::SUCCESS) {
-                                        audio->setConeInnerAngle(value);
-                                    }
-                                    success_attr = XML::QueryAttribute(soundElement, "cone_outer_angle", &value);
-                                    if (success_attr == XML::SUCCESS) {
-                                        audio->setConeOuterAngle(value);
-                                    }
-                                    success_attr = XML::QueryAttribute(soundElement, "cone_outer_gain", &value);
-                                    if (success_attr == XML::SUCCESS) {
-                                        audio->setConeOuterGain(value);
-                                    }
-
-                                    int boolValue = 0;
-                                    success       = soundElement->QueryIntAttribute("looping", &boolValue);
-                                    if (success == XML::SUCCESS) {
-                                        audio->setLooping(boolValue != 0);
-                                    }
-                                    success = soundElement->QueryIntAttribute("relative_position", &boolValue);
-                                    if (success == XML::SUCCESS) {
-                                        audio->setRelativePositioning(boolValue != 0);
-                                    }
-                                    success = soundElement->QueryIntAttribute("direction", &boolValue);
-                                    if (success == XML::SUCCESS) {
-                                        audio->setDirection(boolValue != 0);
-                                    }
-
-                                    double vx = 0;
-                                    double vy = 0;
-                                    double vz = 0;
-                                    if (XML::QueryAttribute(soundElement, "x_velocity", &vx) == XML::SUCCESS &&
-                                        XML::QueryAttribute(soundElement, "y_velocity", &vy) == XML::SUCCESS) {
-                                        XML::QueryAttribute(soundElement, "z_velocity", &vz);
-                                        audio->setVelocity(AudioSpaceCoordinate(vx, vy, vz));
-                                    }
-
-                                    action->adoptAudio(audio.release());
-                                }
-                            }
-
-                            // Create and fetch ActionVisual
-                            ActionVisual::create(action);
-
-                            for (XML::Element* animElement = actionElement->FirstChildElement("animation");
-                                 animElement != nullptr;
-                                 animElement = animElement->NextSiblingElement("animation")) {
-                                // Fetch already created animation
-                                char const * animationId = XML::Attribute(animElement, "animation_id");
-                                if (animationId != nullptr) {
-                                    AnimationPtr const animation = m_animationManager->getPtr(animationId);
-                                    if (animation) {
-                                        auto* actionVisual = action->getVisual<ActionVisual>();
-                                        if (actionVisual != nullptr) {
-                                            actionVisual->addAnimation(animation->getDirection(), animation);
-                                            action->setDuration(static_cast<uint32_t>(animation->getDuration()));
-                                            continue;
-                                        }
-                                    }
-                                }
-
-                                // Create animated spritesheet
-                                char const * sourceId = XML::Attribute(animElement, "atlas");
-                                if (sourceId != nullptr) {
-                                    fs::path atlasPath(filename);
-
-                                    if (HasParentPath(atlasPath)) {
-                                        atlasPath = GetParentPath(atlasPath) / sourceId;
-                                    } else {
-                                        atlasPath = fs::path(sourceId);
-                                    }
-
-                                    ImagePtr atlasImgPtr;
-                                    // we need to load this since its shared image
-                                    if (!m_imageManager->exists(atlasPath.string())) {
-                                        atlasImgPtr = m_imageManager->create(atlasPath.string());
-                                    } else {
-                                        atlasImgPtr = m_imageManager->getPtr(atlasPath.string());
-                                    }
-
-                                    int animFrames  = 0;
-                                    int animDelay   = 0;
-                                    int animXoffset = 0;
-                                    int animYoffset = 0;
-                                    int frameWidth  = 0;
-                                    int frameHeight = 0;
-
-                                    XML::QueryAttribute(animElement, "width", &frameWidth);
-                                    XML::QueryAttribute(animElement, "height", &frameHeight);
-                                    XML::QueryAttribute(animElement, "frames", &animFrames);
-                                    XML::QueryAttribute(animElement, "delay", &animDelay);
-                                    XML::QueryAttribute(animElement, "x_offset", &animXoffset);
-                                    XML::QueryAttribute(animElement, "y_offset", &animYoffset);
-                                    int nDir = 0;
-
-                                    for (XML::Element* dirElement = animElement->FirstChildElement("direction");
-                                         dirElement != nullptr;
-                                         dirElement = dirElement->NextSiblingElement("direction")) {
-                                        int dir = 0;
-                                        dirElement->QueryIntAttribute("dir", &dir);
-
-                                        std::string const aniId = std::format("{}:{}:{:03d}", objectId, actionId, dir);
-                                        AnimationPtr const animation = m_animationManager->create(aniId);
-
-                                        int frames       = 0;
-                                        int success_attr = XML::QueryAttribute(dirElement, "frames", &frames);
-                                        if (success_attr != XML::SUCCESS) {
-                                            frames = animFrames;
-                                        }
-
-                                        int delay    = 0;
-                                        success_attr = XML::QueryAttribute(dirElement, "delay", &delay);
-                                        if (success_attr != XML::SUCCESS) {
-                                            delay = animDelay;
-                                        }
-
-                                        int xoffset  = 0;
-                                        success_attr = XML::QueryAttribute(dirElement, "x_offset", &xoffset);
-                                        if (success_attr != XML::SUCCESS) {
-                                            xoffset = animXoffset;
-                                        }
-
-                                        int yoffset  = 0;
-                                        success_attr = XML::QueryAttribute(dirElement, "y_offset", &yoffset);
-                                        if (success_attr != XML::SUCCESS) {
-                                            yoffset = animYoffset;
-                                        }
-
-                                        int action_frame = 0;
-                                        success = XML::QueryAttribute(dirElement, "action_frame", &action_frame);
-                                        if (success == XML::SUCCESS) {
-                                            animation->setActionFrame(action_frame);
-                                        }
-
-                                        for (int iframe = 0; iframe < frames; ++iframe) {
-                                            std::string const frameId =
-                                                std::format("{}:{}:{:03d}:{:04d}", objectId, actionId, dir, iframe);
-                                            Rect const region(
-                                                frameWidth * iframe, frameHeight * nDir, frameWidth, frameHeight);
-                                            ImagePtr framePtr;
-                                            if (!m_imageManager->exists(frameId)) {
-                                                framePtr = m_imageManager->create(frameId);
-                                                framePtr->useSharedImage(atlasImgPtr, region);
-                                                framePtr->setXShift(xoffset);
-                                                framePtr->setYShift(yoffset);
-                                            } else {
-                                                framePtr = m_imageManager->getPtr(frameId);
-                                            }
-                                            animation->addFrame(framePtr, static_cast<uint32_t>(delay));
-                                        }
-
-                                        auto* actionVisual = action->getVisual<ActionVisual>();
-                                        if (actionVisual != nullptr) {
-                                            assert(dir >= 0);
-                                            actionVisual->addAnimation(static_cast<uint32_t>(dir), animation);
-                                            action->setDuration(static_cast<uint32_t>(animation->getDuration()));
-                                        }
-                                        ++nDir;
-                                    }
-                                    continue;
-                                }
-
-                                // Load animation.xml with frames
-                                sourceId = XML::Attribute(animElement, "source");
-                                if (sourceId != nullptr) {
-                                    int direction          = 0;
-                                    int const success_attr = XML::QueryAttribute(animElement, "direction", &direction);
-
-                                    fs::path animPath(filename);
-
-                                    if (HasParentPath(animPath)) {
-                                        animPath = GetParentPath(animPath) / sourceId;
-                                    } else {
-                                        animPath = fs::path(sourceId);
-                                    }
-
-                                    AnimationPtr animation;
-                                    if (m_animationLoader && m_animationLoader->isLoadable(animPath.string())) {
-                                        animation = m_animationLoader->load(animPath.string());
-                                    }
-
-                                    if ((action != nullptr) && animation) {
-                                        if (success_attr != XML::SUCCESS) {
-                                            assert(
-                                                animation->getDirection() <=
-                                                static_cast<uint32_t>(std::numeric_limits<int>::max()));
-                                            direction = static_cast<int>(animation->getDirection());
-                                        }
-                                        auto* actionVisual = action->getVisual<ActionVisual>();
-                                        if (actionVisual != nullptr) {
-                                            assert(direction >= 0);
-                                            actionVisual->addAnimation(static_cast<uint32_t>(direction), animation);
-                                            action->setDuration(static_cast<uint32_t>(animation->getDuration()));
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
+            if (animation && actionVisual != nullptr) {
+                uint32_t direction = animation->getDirection();
+                if (record.direction) {
+                    assert(*record.direction >= 0);
+                    direction = static_cast<uint32_t>(*record.direction);
                 }
+                actionVisual->addAnimation(direction, animation);
+                action->setDuration(static_cast<uint32_t>(animation->getDuration()));
             }
         }
     }
@@ -705,6 +499,12 @@ namespace FIFE
             fs::path const importDirectory(directory);
             std::string const importDirectoryString = importDirectory.string();
 
+            // nested directories use the database of the outer one
+            std::unique_ptr<AssetDatabase> database;
+            if (AssetDatabase::find(importDirectoryString) == nullptr) {
+                database = AssetDatabase::open(m_vfs, importDirectoryString);
+            }
+
             std::set<std::string> const files = m_vfs->listFiles(importDirectoryString);
 
             // load all xml files in the directory
@@ -725,6 +525,10 @@ namespace FIFE
                     loadImportDirectory(importDirectoryString + "/" + *iter);
                 }
             }
+
+            if (database) {
+                database->save();
+            }
         }
     }
 } // namespace FIFE
@@ -8,6 +8,7 @@
 #include "platform.h"
 
 // Standard C++ library includes
+#include <memory>
 #include <string>
 
 // 3rd party library includes
@@ -25,6 +26,11 @@ namespace FIFE
     class VFS;
     class ImageManager;
     class AnimationManager;
+    class Action;
+    class ActionAudio;
+    struct ObjectRecord;
+    struct ActionSoundRecord;
+    struct ActionAnimationRecord;
 
     class FIFE_API ObjectLoader : public IObjectLoader
     {
@@ -59,10 +65,28 @@ namespace FIFE
 
             /**
              * Used to load a directory of object, atlas or animation  files recursively
+             *
+             * If the directory contains an AssetDatabase it is used for all files below
+             * and saved afterwards when files changed.
              */
             void loadImportDirectory(std::string const & directory);
 
         private:
+            /** Creates an object from its record, does nothing if it already exists.
+             */
+            void loadObject(std::string const & filename, ObjectRecord const & record);
+
+            static std::unique_ptr<ActionAudio> createActionAudio(ActionSoundRecord const & sound);
+
+            /** Adds one <animation> element of an action to its visual.
+             */
+            void loadActionAnimation(
+                std::string const & filename,
+                std::string const & objectId,
+                std::string const & actionId,
+                Action* action,
+                ActionAnimationRecord const & record);
+
             Model* m_model;
             VFS* m_vfs;
             ImageManager* m_imageManager;
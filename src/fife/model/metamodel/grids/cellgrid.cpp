@@ -5,8 +5,11 @@
 #include "cellgrid.h"
 
 // Standard C++ library includes
+#include <atomic>
 #include <cassert>
+#include <cstddef>
 #include <format>
+#include <span>
 #include <vector>
 
 // 3rd party library includes
@@ -23,6 +26,13 @@ namespace FIFE
             static Logger log(LM_CELLGRID);
             return log;
         }
+
+        // revisions are unique among all cellgrids, 0 is never used
+        uint64_t nextRevision()
+        {
+            static std::atomic<uint64_t> revision{0};
+            return ++revision;
+        }
     } // namespace
 
     CellGrid::CellGrid() :
@@ -33,7 +43,8 @@ namespace FIFE
         m_yscale(1),
         m_zscale(1),
         m_rotation(0),
-        m_allow_diagonals(false)
+        m_allow_diagonals(false),
+        m_revision(0)
     {
         updateMatrices();
     }
@@ -59,6 +70,7 @@ namespace FIFE
         m_matrix.applyScale(m_xscale, m_yscale, m_zscale);
         m_matrix.applyTranslate(m_xshift, m_yshift, m_zshift);
         m_inverse_matrix = m_matrix.inverse();
+        m_revision       = nextRevision();
     }
 
     ExactModelCoordinate CellGrid::toMapCoordinates(ModelCoordinate const & layer_coords)
@@ -66,6 +78,40 @@ namespace FIFE
         return toMapCoordinates(intPt2doublePt(layer_coords));
     }
 
+    void CellGrid::toMapCoordinates(std::span<double> x, std::span<double> y, std::span<double> z)
+    {
+        assert(x.size() == y.size() && x.size() == z.size());
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            ExactModelCoordinate const pt = toMapCoordinates(ExactModelCoordinate(x[i], y[i], z[i]));
+            x[i]                          = pt.x;
+            y[i]                          = pt.y;
+            z[i]                          = pt.z;
+        }
+    }
+
+    void CellGrid::toExactLayerCoordinates(std::span<double> x, std::span<double> y, std::span<double> z)
+    {
+        assert(x.size() == y.size() && x.size() == z.size());
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            ExactModelCoordinate const pt = toExactLayerCoordinates(ExactModelCoordinate(x[i], y[i], z[i]));
+            x[i]                          = pt.x;
+            y[i]                          = pt.y;
+            z[i]                          = pt.z;
+        }
+    }
+
+    void CellGrid::toLayerCoordinatesFromExactLayerCoordinates(
+        std::span<double const> x,
+        std::span<double const> y,
+        std::span<double const> z,
+        std::span<ModelCoordinate> layer_coords)
+    {
+        assert(x.size() == y.size() && x.size() == z.size() && x.size() == layer_coords.size());
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            layer_coords[i] = toLayerCoordinatesFromExactLayerCoordinates(ExactModelCoordinate(x[i], y[i], z[i]));
+        }
+    }
+
     int32_t CellGrid::orientation(
         ExactModelCoordinate const & pt, ExactModelCoordinate const & pt1, ExactModelCoordinate const & pt2)
     {
@@ -9,6 +9,7 @@
 
 // Standard C++ library includes
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -102,6 +103,26 @@ namespace FIFE
             virtual ModelCoordinate toLayerCoordinatesFromExactLayerCoordinates(
                 ExactModelCoordinate const & exact_layer_coords) = 0;
 
+            /** Transforms points from layer coordinates to map coordinates in place
+             *  The points are given as separate arrays of x, y and z values of the same size.
+             *  The default implementation converts one point after the other.
+             */
+            virtual void toMapCoordinates(std::span<double> x, std::span<double> y, std::span<double> z);
+
+            /** Transforms points from map coordinates to exact layer coordinates in place
+             *  @see toMapCoordinates(std::span<double>, std::span<double>, std::span<double>)
+             */
+            virtual void toExactLayerCoordinates(std::span<double> x, std::span<double> y, std::span<double> z);
+
+            /** Transforms points from exact layer coordinates to cell precision layer coordinates
+             *  @param layer_coords receives the cell of each point, of the same size as the input arrays
+             */
+            virtual void toLayerCoordinatesFromExactLayerCoordinates(
+                std::span<double const> x,
+                std::span<double const> y,
+                std::span<double const> z,
+                std::span<ModelCoordinate> layer_coords);
+
             /** Fills given point vector with vertices from selected cell
              *  @param vtx vertices for given cell
              *  @param cell cell to get vertices from
@@ -259,6 +280,15 @@ namespace FIFE
                 return m_allow_diagonals;
             }
 
+            /** Returns the revision of the coordinate transformation
+             *  It changes with every change of shift, scale or rotation and is unique among all cellgrids,
+             *  so it can tell if coordinates computed earlier are still valid.
+             */
+            uint64_t getRevision() const
+            {
+                return m_revision;
+            }
+
             /** Returns clone of this cellgrid
              */
             virtual std::unique_ptr<CellGrid> clone() = 0;
@@ -281,6 +311,7 @@ namespace FIFE
             double m_zscale;
             double m_rotation;
             bool m_allow_diagonals;
+            uint64_t m_revision;
 
         private:
             int32_t orientation(
@@ -7,9 +7,11 @@
 // Standard C++ library includes
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <format>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -52,6 +54,18 @@ namespace FIFE
             static double const val = 1 / Mathd::Sqrt(3);
             return val;
         }();
+
+        // x offset of a non-axial grid, each uneven row has shifted coordinate of 0.5 horizontally
+        // shift has to be gradual on vertical axis, written without branches so loops vectorize
+        double zigzagOffset(double y)
+        {
+            double const ay      = std::abs(y);
+            auto const i_layer_y = static_cast<int32_t>(ay);
+            double const offset  = ay - static_cast<double>(i_layer_y);
+            // offset on even rows, 1 - offset on odd rows
+            auto const odd = static_cast<double>(i_layer_y & 1);
+            return HEX_TO_EDGE * (odd + ((1 - (2 * odd)) * offset));
+        }
     } // namespace
 
     HexGrid::HexGrid(bool axial) : m_axial(axial)
@@ -142,15 +156,7 @@ namespace FIFE
             return HEX_TO_EDGE * y;
         }
 
-        // each uneven row has shifted coordinate of 0.5 horizontally
-        // shift has to be gradual on vertical axis
-        double const ay = std::abs(y);
-        auto i_layer_y  = static_cast<int32_t>(ay);
-        double offset   = ay - static_cast<double>(i_layer_y);
-        if ((i_layer_y % 2) == 1) {
-            offset = 1 - offset;
-        }
-        return HEX_TO_EDGE * offset;
+        return zigzagOffset(y);
     }
 
     ExactModelCoordinate HexGrid::toMapCoordinates(ExactModelCoordinate const & layer_coords)
@@ -161,14 +167,13 @@ namespace FIFE
         ExactModelCoordinate const result = m_matrix * tranformed_coords;
         FL_DBG(
             _log(),
-            std::format(
-                "layercoords ({}, {}, {}) converted to map: ({}, {}, {})",
-                layer_coords.x,
-                layer_coords.y,
-                layer_coords.z,
-                result.x,
-                result.y,
-                result.z));
+            "layercoords ({}, {}, {}) converted to map: ({}, {}, {})",
+            layer_coords.x,
+            layer_coords.y,
+            layer_coords.z,
+            result.x,
+            result.y,
+            result.z);
         return result;
     }
 
@@ -179,14 +184,13 @@ namespace FIFE
         layer_coords.x -= getXZigzagOffset(layer_coords.y);
         FL_DBG(
             _log(),
-            std::format(
-                "mapcoords ({}, {}, {}) converted to layer: ({}, {}, {})",
-                map_coord.x,
-                map_coord.y,
-                map_coord.z,
-                layer_coords.x,
-                layer_coords.y,
-                layer_coords.z));
+            "mapcoords ({}, {}, {}) converted to layer: ({}, {}, {})",
+            map_coord.x,
+            map_coord.y,
+            map_coord.z,
+            layer_coords.x,
+            layer_coords.y,
+            layer_coords.z);
         return layer_coords;
     }
 
@@ -194,11 +198,10 @@ namespace FIFE
     {
         FL_DBG(
             _log(),
-            std::format(
-                "==============\nConverting map coords ({}, {}, {}) to int32_t layer coords...",
-                map_coord.x,
-                map_coord.y,
-                map_coord.z));
+            "==============\nConverting map coords ({}, {}, {}) to int32_t layer coords...",
+            map_coord.x,
+            map_coord.y,
+            map_coord.z);
         ExactModelCoordinate elc = m_inverse_matrix * map_coord;
         elc.y *= VERTICAL_MULTIP_INV;
         return toLayerCoordinatesHelper(elc);
@@ -212,6 +215,55 @@ namespace FIFE
         return toLayerCoordinatesHelper(elc);
     }
 
+    void HexGrid::toMapCoordinates(std::span<double> x, std::span<double> y, std::span<double> z)
+    {
+        assert(x.size() == y.size() && x.size() == z.size());
+        // a local copy, the stores to y could alias the constant otherwise
+        double const multip = VERTICAL_MULTIP;
+        if (m_axial) {
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                x[i] += HEX_TO_EDGE * y[i];
+                y[i] *= multip;
+            }
+        } else {
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                x[i] += zigzagOffset(y[i]);
+                y[i] *= multip;
+            }
+        }
+        m_matrix.transform(x, y, z);
+    }
+
+    void HexGrid::toExactLayerCoordinates(std::span<double> x, std::span<double> y, std::span<double> z)
+    {
+        assert(x.size() == y.size() && x.size() == z.size());
+        m_inverse_matrix.transform(x, y, z);
+        double const multip = VERTICAL_MULTIP;
+        if (m_axial) {
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                y[i] /= multip;
+                x[i] -= HEX_TO_EDGE * y[i];
+            }
+        } else {
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                y[i] /= multip;
+                x[i] -= zigzagOffset(y[i]);
+            }
+        }
+    }
+
+    void HexGrid::toLayerCoordinatesFromExactLayerCoordinates(
+        std::span<double const> x,
+        std::span<double const> y,
+        std::span<double const> z,
+        std::span<ModelCoordinate> layer_coords)
+    {
+        assert(x.size() == y.size() && x.size() == z.size() && x.size() == layer_coords.size());
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            layer_coords[i] = toLayerCoordinatesHelper(ExactModelCoordinate(x[i] + getXZigzagOffset(y[i]), y[i], z[i]));
+        }
+    }
+
     ModelCoordinate HexGrid::toLayerCoordinatesHelper(ExactModelCoordinate const & coords) const
     {
         // this helper method takes exact layer coordinates with zigzag removed
@@ -8,9 +8,11 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -119,6 +121,31 @@ namespace FIFE
         return result;
     }
 
+    void SquareGrid::toMapCoordinates(std::span<double> x, std::span<double> y, std::span<double> z)
+    {
+        m_matrix.transform(x, y, z);
+    }
+
+    void SquareGrid::toExactLayerCoordinates(std::span<double> x, std::span<double> y, std::span<double> z)
+    {
+        m_inverse_matrix.transform(x, y, z);
+    }
+
+    void SquareGrid::toLayerCoordinatesFromExactLayerCoordinates(
+        std::span<double const> x,
+        std::span<double const> y,
+        std::span<double const> z,
+        std::span<ModelCoordinate> layer_coords)
+    {
+        assert(x.size() == y.size() && x.size() == z.size() && x.size() == layer_coords.size());
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            layer_coords[i] = ModelCoordinate(
+                static_cast<int32_t>(round(x[i])),
+                static_cast<int32_t>(round(y[i])),
+                static_cast<int32_t>(round(z[i])));
+        }
+    }
+
     void SquareGrid::getVertices(std::vector<ExactModelCoordinate>& vtx, ModelCoordinate const & cell)
     {
         vtx.clear();
@@ -9,6 +9,7 @@
 
 // Standard C++ library includes
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -40,6 +41,13 @@ namespace FIFE
             ExactModelCoordinate toExactLayerCoordinates(ExactModelCoordinate const & map_coord) override;
             ModelCoordinate toLayerCoordinatesFromExactLayerCoordinates(
                 ExactModelCoordinate const & exact_layer_coords) override;
+            void toMapCoordinates(std::span<double> x, std::span<double> y, std::span<double> z) override;
+            void toExactLayerCoordinates(std::span<double> x, std::span<double> y, std::span<double> z) override;
+            void toLayerCoordinatesFromExactLayerCoordinates(
+                std::span<double const> x,
+                std::span<double const> y,
+                std::span<double const> z,
+                std::span<ModelCoordinate> layer_coords) override;
             void getVertices(std::vector<ExactModelCoordinate>& vtx, ModelCoordinate const & cell) override;
             std::vector<ModelCoordinate> toMultiCoordinates(
                 ModelCoordinate const & position, std::vector<ModelCoordinate> const & orig, bool reverse) override;
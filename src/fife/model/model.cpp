@@ -23,9 +23,11 @@
 #include "structures/instance.h"
 #include "structures/layer.h"
 #include "structures/map.h"
+#include "structures/tilegrid.h"
 #include "util/base/exception.h"
 #include "util/log/logger.h"
 #include "util/structures/purge.h"
+#include "util/time/profiler.h"
 #include "video/renderbackend.h"
 #include "view/rendererbase.h"
 
@@ -251,6 +253,10 @@ namespace FIFE
                         return false;
                     }
                 }
+                TileGrid const * tiles = layer->getTileGrid();
+                if (tiles != nullptr && tiles->hasTilesOf(object)) {
+                    return false;
+                }
             }
         }
 
@@ -275,7 +281,7 @@ namespace FIFE
         for (auto const & m_map : m_maps) {
             auto layers = m_map->getLayers();
             auto jt     = std::ranges::find_if(layers, [](Layer const * layer) {
-                return layer->hasInstances();
+                return layer->hasInstances() || layer->hasTiles();
             });
             if (jt != layers.end()) {
                 return false;
@@ -344,6 +350,7 @@ namespace FIFE
 
     void Model::update()
     {
+        FIFE_PROFILE_ZONE("Model::update");
         auto it = m_maps.begin();
         for (; it != m_maps.end(); ++it) {
             (*it)->update();
@@ -354,4 +361,22 @@ namespace FIFE
         }
     }
 
+    double Model::getRenderListTime() const
+    {
+        double time = 0.0;
+        for (auto const & map : m_maps) {
+            time += map->getRenderListTime();
+        }
+        return time;
+    }
+
+    double Model::getRenderTime() const
+    {
+        double time = 0.0;
+        for (auto const & map : m_maps) {
+            time += map->getRenderTime();
+        }
+        return time;
+    }
+
 } // namespace FIFE
@@ -104,12 +104,12 @@ namespace FIFE
                 std::string const & identifier, std::string const & name_space, Object* parent = nullptr);
 
             /** Attempt to remove an object from the model
-             *  Fails and returns false if the object is referenced by an instance.
+             *  Fails and returns false if the object is referenced by an instance or a tile.
              */
             bool deleteObject(Object*);
 
             /** Attempt to remove all objects from the model
-             *  Fails and returns false if any maps with instances are present.
+             *  Fails and returns false if any maps with instances or tiles are present.
              */
             bool deleteObjects();
 
@@ -145,6 +145,16 @@ namespace FIFE
              */
             void update();
 
+            /** Time the last update spent building the render lists of all maps.
+             * @return Duration in milliseconds.
+             */
+            double getRenderListTime() const;
+
+            /** Time the last update spent rendering the cameras of all maps.
+             * @return Duration in milliseconds.
+             */
+            double getRenderTime() const;
+
             /** Sets speed for the model. With speed 1.0, everything runs with normal speed.
              * With speed 2.0, clock is ticking twice as fast. With 0, everything gets paused.
              * Negavtive values are not supported (throws NotSupported exception).
@@ -6,9 +6,10 @@
 
 // Standard C++ library includes
 #include <algorithm>
+#include <cstdlib>
 #include <list>
 #include <memory>
-#include <set>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -33,25 +34,49 @@ namespace FIFE
         }
     } // namespace
 
-    Cell::Cell(int32_t coordint, ModelCoordinate const & coordinate, Layer* layer) :
-        m_coordId(coordint),
+    namespace
+    {
+        /** Tells the cell with a transition that the target cell gets deleted.
+         */
+        class TransitionTargetListener : public CellDeleteListener
+        {
+            public:
+                explicit TransitionTargetListener(Cell* cell) : m_cell(cell)
+                {
+                }
+
+                void onCellDeleted(Cell* cell) override
+                {
+                    m_cell->onCellDeleted(cell);
+                }
+
+            private:
+                Cell* m_cell;
+        };
+    } // namespace
+
+    Cell::Cell(int32_t coordint, ModelCoordinate const & coordinate, CellCache* cache) :
         m_coordinate(coordinate),
-        m_layer(layer),
+        m_coordId(coordint),
+        m_cache(cache),
         m_zone(nullptr),
-        m_inserted(false),
-        m_protect(false),
-        m_type(CTYPE_NO_BLOCKER)
+        m_instance(nullptr),
+        m_instanceCount(0),
+        m_type(CTYPE_NO_BLOCKER),
+        m_flags(0)
     {
     }
 
     Cell::~Cell()
     {
         // calls CellDeleteListener, e.g. for transition
-        if (!m_deleteListeners.empty()) {
-            auto it = m_deleteListeners.begin();
-            for (; it != m_deleteListeners.end(); ++it) {
-                if (*it != nullptr) {
-                    (*it)->onCellDeleted(this);
+        CellSideData* data = findSideData();
+        if (data != nullptr) {
+            // listeners can add or remove listeners, the entry itself stays in place
+            for (std::size_t i = 0; i < data->deleteListeners.size(); ++i) {
+                CellDeleteListener* listener = data->deleteListeners[i];
+                if (listener != nullptr) {
+                    listener->onCellDeleted(this);
                 }
             }
         }
@@ -59,33 +84,30 @@ namespace FIFE
         if (m_zone != nullptr) {
             m_zone->removeCell(this);
         }
-        if (m_transition) {
-            deleteTransition();
-        }
+        deleteTransition();
         // remove cell from cache (costs, narrow, area)
-        if (m_layer != nullptr) {
-            CellCache* cache = m_layer->getCellCache();
-            if (cache != nullptr) {
-                cache->removeCell(this);
-            }
+        m_cache->removeCell(this);
+        if (m_instanceCount > 1) {
+            m_cache->m_cellInstances.erase(this);
+        }
+        if ((m_flags & CFLAG_SIDE_DATA) != 0) {
+            m_cache->m_cellSideData.erase(this);
         }
     }
 
     void Cell::addInstances(std::list<Instance*> const & instances)
     {
-        CellCache* cache = m_layer->getCellCache();
         for (auto* instance : instances) {
-            std::pair<std::set<Instance*>::iterator, bool> const ret = m_instances.insert(instance);
-            if (ret.second) {
+            if (insertInstance(instance)) {
                 if (instance->isSpecialCost()) {
-                    cache->registerCost(instance->getCostId(), instance->getCost());
-                    cache->addCellToCost(instance->getCostId(), this);
+                    m_cache->registerCost(instance->getCostId(), instance->getCost());
+                    m_cache->addCellToCost(instance->getCostId(), this);
                 }
                 if (instance->isSpecialSpeed()) {
-                    cache->setSpeedMultiplier(this, instance->getSpeed());
+                    m_cache->setSpeedMultiplier(this, instance->getSpeed());
                 }
                 if (!instance->getObject()->getArea().empty()) {
-                    cache->addCellToArea(instance->getObject()->getArea(), this);
+                    m_cache->addCellToArea(instance->getObject()->getArea(), this);
                 }
                 callOnInstanceEntered(instance);
             }
@@ -95,18 +117,16 @@ namespace FIFE
 
     void Cell::addInstance(Instance* instance)
     {
-        std::pair<std::set<Instance*>::iterator, bool> const ret = m_instances.insert(instance);
-        if (ret.second) {
-            CellCache* cache = m_layer->getCellCache();
+        if (insertInstance(instance)) {
             if (instance->isSpecialCost()) {
-                cache->registerCost(instance->getCostId(), instance->getCost());
-                cache->addCellToCost(instance->getCostId(), this);
+                m_cache->registerCost(instance->getCostId(), instance->getCost());
+                m_cache->addCellToCost(instance->getCostId(), this);
             }
             if (instance->isSpecialSpeed()) {
-                cache->setSpeedMultiplier(this, instance->getSpeed());
+                m_cache->setSpeedMultiplier(this, instance->getSpeed());
             }
             if (!instance->getObject()->getArea().empty()) {
-                cache->addCellToArea(instance->getObject()->getArea(), this);
+                m_cache->addCellToArea(instance->getObject()->getArea(), this);
             }
             callOnInstanceEntered(instance);
             updateCellBlockingInfo();
@@ -120,29 +140,25 @@ namespace FIFE
 
     void Cell::removeInstance(Instance* instance)
     {
-        if (m_instances.erase(instance) == 0) {
+        if (!eraseInstance(instance)) {
             FL_ERR(_log(), "Tried to remove an instance from cell, but given instance could not be found.");
             return;
         }
-        CellCache* cache = m_layer->getCellCache();
         if (instance->isSpecialCost()) {
-            cache->removeCellFromCost(instance->getCostId(), this);
+            m_cache->removeCellFromCost(instance->getCostId(), this);
         }
         if (instance->isSpecialSpeed()) {
-            cache->resetSpeedMultiplier(this);
+            m_cache->resetSpeedMultiplier(this);
             // try to find other speed value
-            if (!m_instances.empty()) {
-                auto it = m_instances.begin();
-                for (; it != m_instances.end(); ++it) {
-                    if ((*it)->isSpecialSpeed()) {
-                        cache->setSpeedMultiplier(this, (*it)->getSpeed());
-                        break;
-                    }
+            for (auto* other : getInstances()) {
+                if (other->isSpecialSpeed()) {
+                    m_cache->setSpeedMultiplier(this, other->getSpeed());
+                    break;
                 }
             }
         }
         if (!instance->getObject()->getArea().empty()) {
-            cache->removeCellFromArea(instance->getObject()->getArea(), this);
+            m_cache->removeCellFromArea(instance->getObject()->getArea(), this);
         }
         callOnInstanceExited(instance);
         updateCellBlockingInfo();
@@ -150,39 +166,148 @@ namespace FIFE
 
     bool Cell::isNeighbor(Cell const * cell)
     {
-        auto it = m_neighbors.begin();
-        for (; it != m_neighbors.end(); ++it) {
-            if (*it == cell) {
-                return true;
+        CellNeighbors const neighbors = getNeighbors();
+        return std::ranges::find(neighbors, cell) != neighbors.end();
+    }
+
+    std::span<Instance* const> Cell::getInstances()
+    {
+        // either the inline instance or the ones in the side table
+        if (m_instanceCount > 1) {
+            return m_cache->m_cellInstances.find(this)->second;
+        }
+        return {&m_instance, m_instanceCount};
+    }
+
+    bool Cell::insertInstance(Instance* instance)
+    {
+        if (m_instanceCount == 0) {
+            m_instance      = instance;
+            m_instanceCount = 1;
+            return true;
+        }
+        if (m_instanceCount == 1) {
+            if (m_instance == instance) {
+                return false;
+            }
+            // the second instance moves both into the side table
+            std::vector<Instance*>& stored = m_cache->m_cellInstances[this];
+            stored                         = {m_instance, instance};
+            std::ranges::sort(stored);
+            m_instance      = nullptr;
+            m_instanceCount = 2;
+            return true;
+        }
+        std::vector<Instance*>& stored = m_cache->m_cellInstances.find(this)->second;
+        auto it                        = std::ranges::lower_bound(stored, instance);
+        if (it != stored.end() && *it == instance) {
+            return false;
+        }
+        stored.insert(it, instance);
+        ++m_instanceCount;
+        return true;
+    }
+
+    bool Cell::eraseInstance(Instance* instance)
+    {
+        if (m_instanceCount <= 1) {
+            if (m_instanceCount == 0 || m_instance != instance) {
+                return false;
             }
+            m_instance      = nullptr;
+            m_instanceCount = 0;
+            return true;
+        }
+        auto entry                     = m_cache->m_cellInstances.find(this);
+        std::vector<Instance*>& stored = entry->second;
+        auto it                        = std::ranges::lower_bound(stored, instance);
+        if (it == stored.end() || *it != instance) {
+            return false;
+        }
+        stored.erase(it);
+        --m_instanceCount;
+        if (m_instanceCount == 1) {
+            m_instance = stored.front();
+            m_cache->m_cellInstances.erase(entry);
+        }
+        return true;
+    }
+
+    CellSideData& Cell::sideData()
+    {
+        m_flags |= CFLAG_SIDE_DATA;
+        return m_cache->m_cellSideData[this];
+    }
+
+    CellSideData* Cell::findSideData()
+    {
+        if ((m_flags & CFLAG_SIDE_DATA) == 0) {
+            return nullptr;
+        }
+        return &m_cache->m_cellSideData.find(this)->second;
+    }
+
+    void Cell::releaseSideData()
+    {
+        CellSideData* data = findSideData();
+        if (data == nullptr) {
+            return;
+        }
+        std::erase(data->deleteListeners, nullptr);
+        std::erase(data->changeListeners, nullptr);
+        if (data->deleteListeners.empty() && data->changeListeners.empty() && !data->transition) {
+            m_cache->m_cellSideData.erase(this);
+            m_flags &= ~CFLAG_SIDE_DATA;
+        }
+    }
+
+    void Cell::setFlag(uint8_t flag, bool value)
+    {
+        if (value) {
+            m_flags |= flag;
+        } else {
+            m_flags &= ~flag;
         }
-        return false;
     }
 
     void Cell::updateCellBlockingInfo()
     {
+        if (m_cache->isBulkEdit()) {
+            // updated once at the end of the bulk edit
+            if ((m_flags & CFLAG_BLOCKING_PENDING) == 0) {
+                setFlag(CFLAG_BLOCKING_PENDING, true);
+                m_cache->m_bulkCells.push_back(m_coordinate);
+            }
+            return;
+        }
+        setFlag(CFLAG_BLOCKING_PENDING, false);
         CellTypeInfo const old_type = m_type;
         m_coordinate.z              = static_cast<int>(MIN_CELL_Z);
-        if (!m_instances.empty()) {
-            int32_t pos          = -1;
-            bool const cellblock = (m_type == CTYPE_CELL_NO_BLOCKER || m_type == CTYPE_CELL_BLOCKER);
-            for (auto* m_instance : m_instances) {
+        bool const cellblock        = (m_type == CTYPE_CELL_NO_BLOCKER || m_type == CTYPE_CELL_BLOCKER);
+        bool const tileblock        = (m_flags & CFLAG_TILE_BLOCKER) != 0 && !cellblock;
+        if (tileblock) {
+            // the tile is a static blocker at the bottom of the stack
+            m_type = CTYPE_STATIC_BLOCKER;
+        }
+        if (m_instanceCount != 0) {
+            int32_t pos = tileblock ? 0 : -1;
+            for (auto* instance : getInstances()) {
                 if (cellblock) {
                     continue;
                 }
-                uint8_t const stackpos = m_instance->getCellStackPosition();
+                uint8_t const stackpos = instance->getCellStackPosition();
                 if (std::cmp_less(stackpos, pos)) {
                     continue;
                 }
                 // update cell z
-                if (m_coordinate.z < m_instance->getLocationRef().getLayerCoordinates().z &&
-                    m_instance->getObject()->isStatic()) {
-                    m_coordinate.z = m_instance->getLocationRef().getLayerCoordinates().z;
+                if (m_coordinate.z < instance->getLocationRef().getLayerCoordinates().z &&
+                    instance->getObject()->isStatic()) {
+                    m_coordinate.z = instance->getLocationRef().getLayerCoordinates().z;
                 }
-                if (std::cmp_greater(m_instance->getCellStackPosition(), pos)) {
-                    pos = m_instance->getCellStackPosition();
-                    if (m_instance->isBlocking()) {
-                        if (!m_instance->getObject()->isStatic()) {
+                if (std::cmp_greater(instance->getCellStackPosition(), pos)) {
+                    pos = instance->getCellStackPosition();
+                    if (instance->isBlocking()) {
+                        if (!instance->getObject()->isStatic()) {
                             m_type = CTYPE_DYNAMIC_BLOCKER;
                         } else {
                             m_type = CTYPE_STATIC_BLOCKER;
@@ -192,8 +317,8 @@ namespace FIFE
                     }
                 } else {
                     // if positions are equal then static_blockers win
-                    if (m_instance->isBlocking() && m_type != CTYPE_STATIC_BLOCKER) {
-                        if (!m_instance->getObject()->isStatic()) {
+                    if (instance->isBlocking() && m_type != CTYPE_STATIC_BLOCKER) {
+                        if (!instance->getObject()->isStatic()) {
                             m_type = CTYPE_DYNAMIC_BLOCKER;
                         } else {
                             m_type = CTYPE_STATIC_BLOCKER;
@@ -201,7 +326,7 @@ namespace FIFE
                     }
                 }
             }
-        } else {
+        } else if (!tileblock) {
             if (m_type == CTYPE_STATIC_BLOCKER || m_type == CTYPE_DYNAMIC_BLOCKER) {
                 m_type = CTYPE_NO_BLOCKER;
             }
@@ -213,7 +338,7 @@ namespace FIFE
         if (old_type != m_type) {
             bool const block =
                 (m_type == CTYPE_STATIC_BLOCKER || m_type == CTYPE_DYNAMIC_BLOCKER || m_type == CTYPE_CELL_BLOCKER);
-            m_layer->getCellCache()->setBlockingUpdate(true);
+            m_cache->setBlockingUpdate(true);
             callOnBlockingChanged(block);
         }
     }
@@ -221,55 +346,47 @@ namespace FIFE
     void Cell::updateCellInfo()
     {
         updateCellBlockingInfo();
-
-        if (!m_deleteListeners.empty()) {
-            auto [first, last] = std::ranges::remove(m_deleteListeners, nullptr);
-            m_deleteListeners.erase(first, last);
-        }
-        if (!m_changeListeners.empty()) {
-            auto [first, last] = std::ranges::remove(m_changeListeners, nullptr);
-            m_changeListeners.erase(first, last);
-        }
+        releaseSideData();
     }
 
     bool Cell::defaultCost()
     {
-        return m_layer->getCellCache()->isDefaultCost(this);
+        return m_cache->isDefaultCost(this);
     }
 
     void Cell::setCostMultiplier(double multi)
     {
-        m_layer->getCellCache()->setCostMultiplier(this, multi);
+        m_cache->setCostMultiplier(this, multi);
     }
 
     double Cell::getCostMultiplier()
     {
-        return m_layer->getCellCache()->getCostMultiplier(this);
+        return m_cache->getCostMultiplier(this);
     }
 
     void Cell::resetCostMultiplier()
     {
-        m_layer->getCellCache()->resetCostMultiplier(this);
+        m_cache->resetCostMultiplier(this);
     }
 
     bool Cell::defaultSpeed()
     {
-        return m_layer->getCellCache()->isDefaultSpeed(this);
+        return m_cache->isDefaultSpeed(this);
     }
 
     void Cell::setSpeedMultiplier(double multi)
     {
-        m_layer->getCellCache()->setSpeedMultiplier(this, multi);
+        m_cache->setSpeedMultiplier(this, multi);
     }
 
     double Cell::getSpeedMultiplier()
     {
-        return m_layer->getCellCache()->getSpeedMultiplier(this);
+        return m_cache->getSpeedMultiplier(this);
     }
 
     void Cell::resetSpeedMultiplier()
     {
-        m_layer->getCellCache()->resetSpeedMultiplier(this);
+        m_cache->resetSpeedMultiplier(this);
     }
 
     Zone* Cell::getZone()
@@ -284,28 +401,42 @@ namespace FIFE
 
     void Cell::resetZone()
     {
-        m_inserted = false;
-        m_zone     = nullptr;
+        setFlag(CFLAG_INSERTED, false);
+        m_zone = nullptr;
     }
 
     bool Cell::isInserted() const
     {
-        return m_inserted;
+        return (m_flags & CFLAG_INSERTED) != 0;
     }
 
     void Cell::setInserted(bool inserted)
     {
-        m_inserted = inserted;
+        setFlag(CFLAG_INSERTED, inserted);
     }
 
     bool Cell::isZoneProtected() const
     {
-        return m_protect;
+        return (m_flags & CFLAG_PROTECTED) != 0;
     }
 
     void Cell::setZoneProtected(bool protect)
     {
-        m_protect = protect;
+        setFlag(CFLAG_PROTECTED, protect);
+    }
+
+    bool Cell::isTileBlocking() const
+    {
+        return (m_flags & CFLAG_TILE_BLOCKER) != 0;
+    }
+
+    void Cell::setTileBlocking(bool blocks)
+    {
+        if (blocks == isTileBlocking()) {
+            return;
+        }
+        setFlag(CFLAG_TILE_BLOCKER, blocks);
+        updateCellBlockingInfo();
     }
 
     CellTypeInfo Cell::getCellType() const
@@ -318,9 +449,9 @@ namespace FIFE
         m_type = type;
     }
 
-    std::set<Instance*> const & Cell::getInstances()
+    uint32_t Cell::getInstanceCount() const
     {
-        return m_instances;
+        return m_instanceCount;
     }
 
     void Cell::setCellId(int32_t id)
@@ -338,40 +469,40 @@ namespace FIFE
         return m_coordinate;
     }
 
-    void Cell::addNeighbor(Cell* cell)
-    {
-        m_neighbors.push_back(cell);
-    }
-
-    std::vector<Cell*> const & Cell::getNeighbors()
-    {
-        return m_neighbors;
-    }
-
-    void Cell::resetNeighbors()
+    CellNeighbors Cell::getNeighbors()
     {
-        m_neighbors.clear();
-        if (m_transition) {
-            CellCache* cache = m_transition->m_layer->getCellCache();
-            if (cache != nullptr) {
-                Cell* cell = cache->getCell(m_transition->m_mc);
-                if (cell != nullptr) {
-                    m_neighbors.push_back(cell);
-                }
+        CellNeighbors neighbors;
+        int32_t const maxZ = m_cache->m_neighborZ;
+        for (auto const & offset : m_cache->m_neighborOffsets[m_coordinate.y & 1]) {
+            Cell* cell = m_cache->getCell(ModelCoordinate(m_coordinate.x + offset.x, m_coordinate.y + offset.y));
+            if (cell == nullptr) {
+                continue;
+            }
+            if (maxZ != -1 && std::abs(cell->m_coordinate.z - m_coordinate.z) > maxZ) {
+                continue;
+            }
+            neighbors.push_back(cell);
+        }
+        CellSideData const * data = findSideData();
+        if (data != nullptr && data->transition) {
+            Cell* cell = data->transition->m_layer->getCellCache()->getCell(data->transition->m_mc);
+            if (cell != nullptr) {
+                neighbors.push_back(cell);
             }
         }
+        return neighbors;
     }
 
     Layer* Cell::getLayer()
     {
-        return m_layer;
+        return m_cache->getLayer();
     }
 
     void Cell::createTransition(Layer* layer, ModelCoordinate const & mc, bool immediate)
     {
         auto trans = std::make_unique<TransitionInfo>(layer);
         // if layers are the same then it's a portal
-        if (layer != m_layer) {
+        if (layer != getLayer()) {
             trans->m_difflayer = true;
         }
         trans->m_immediate = immediate;
@@ -381,120 +512,124 @@ namespace FIFE
 
         Cell* c = layer->getCellCache()->getCell(mc);
         if (c != nullptr) {
-            m_neighbors.push_back(c);
-            c->addDeleteListener(this);
-            m_layer->getCellCache()->addTransition(this);
-            m_transition = std::move(trans);
+            CellSideData& data      = sideData();
+            data.transitionListener = std::make_unique<TransitionTargetListener>(this);
+            c->addDeleteListener(data.transitionListener.get());
+            m_cache->addTransition(this);
+            data.transition = std::move(trans);
         }
     }
 
     void Cell::deleteTransition()
     {
-        if (m_transition) {
-            Cell* oldc = m_transition->m_layer->getCellCache()->getCell(m_transition->m_mc);
-            auto it    = m_neighbors.begin();
-            for (; it != m_neighbors.end(); ++it) {
-                if (*it == oldc) {
-                    m_neighbors.erase(it);
-                    break;
-                }
-            }
-            oldc->removeDeleteListener(this);
-            m_layer->getCellCache()->removeTransition(this);
-            m_transition.reset();
+        CellSideData* data = findSideData();
+        if (data == nullptr || !data->transition) {
+            return;
+        }
+        Cell* oldc = data->transition->m_layer->getCellCache()->getCell(data->transition->m_mc);
+        if (oldc != nullptr) {
+            oldc->removeDeleteListener(data->transitionListener.get());
         }
+        m_cache->removeTransition(this);
+        data->transition.reset();
+        data->transitionListener.reset();
     }
 
     TransitionInfo* Cell::getTransition()
     {
-        return m_transition.get();
+        CellSideData const * data = findSideData();
+        return data != nullptr ? data->transition.get() : nullptr;
     }
 
     void Cell::addDeleteListener(CellDeleteListener* listener)
     {
-        m_deleteListeners.push_back(listener);
+        sideData().deleteListeners.push_back(listener);
     }
 
     void Cell::removeDeleteListener(CellDeleteListener const * listener)
     {
-        auto it = m_deleteListeners.begin();
-        for (; it != m_deleteListeners.end(); ++it) {
-            if (*it == listener) {
-                *it = nullptr;
-                break;
-            }
+        CellSideData* data = findSideData();
+        if (data == nullptr) {
+            return;
+        }
+        auto it = std::ranges::find(data->deleteListeners, listener);
+        if (it != data->deleteListeners.end()) {
+            *it = nullptr;
         }
     }
 
     void Cell::onCellDeleted(Cell* cell)
     {
-        auto it = m_neighbors.begin();
-        for (; it != m_neighbors.end(); ++it) {
-            if (*it == cell) {
-                deleteTransition();
-                break;
-            }
+        TransitionInfo const * trans = getTransition();
+        if (trans != nullptr && trans->m_layer->getCellCache()->getCell(trans->m_mc) == cell) {
+            deleteTransition();
         }
     }
 
     void Cell::addChangeListener(CellChangeListener* listener)
     {
-        m_changeListeners.push_back(listener);
+        // reuses the slot of a removed listener, observers that come and go do not grow the vector
+        std::vector<CellChangeListener*>& listeners = sideData().changeListeners;
+        auto it                                     = std::ranges::find(listeners, nullptr);
+        if (it != listeners.end()) {
+            *it = listener;
+        } else {
+            listeners.push_back(listener);
+        }
     }
 
     void Cell::removeChangeListener(CellChangeListener const * listener)
     {
-        auto it = m_changeListeners.begin();
-        for (; it != m_changeListeners.end(); ++it) {
-            if (*it == listener) {
-                *it = nullptr;
-                break;
-            }
+        CellSideData* data = findSideData();
+        if (data == nullptr) {
+            return;
+        }
+        auto it = std::ranges::find(data->changeListeners, listener);
+        if (it != data->changeListeners.end()) {
+            *it = nullptr;
         }
     }
 
     void Cell::callOnInstanceEntered(Instance* instance)
     {
-        if (m_changeListeners.empty()) {
+        CellSideData* data = findSideData();
+        if (data == nullptr) {
             return;
         }
-
-        auto i = m_changeListeners.begin();
-        while (i != m_changeListeners.end()) {
-            if (*i != nullptr) {
-                (*i)->onInstanceEnteredCell(this, instance);
+        // listeners can add or remove listeners, the entry itself stays in place
+        for (std::size_t i = 0; i < data->changeListeners.size(); ++i) {
+            CellChangeListener* listener = data->changeListeners[i];
+            if (listener != nullptr) {
+                listener->onInstanceEnteredCell(this, instance);
             }
-            ++i;
         }
     }
 
     void Cell::callOnInstanceExited(Instance* instance)
     {
-        if (m_changeListeners.empty()) {
+        CellSideData* data = findSideData();
+        if (data == nullptr) {
             return;
         }
-
-        auto i = m_changeListeners.begin();
-        while (i != m_changeListeners.end()) {
-            if (*i != nullptr) {
-                (*i)->onInstanceExitedCell(this, instance);
+        for (std::size_t i = 0; i < data->changeListeners.size(); ++i) {
+            CellChangeListener* listener = data->changeListeners[i];
+            if (listener != nullptr) {
+                listener->onInstanceExitedCell(this, instance);
             }
-            ++i;
         }
     }
 
     void Cell::callOnBlockingChanged(bool blocks)
     {
-        if (m_changeListeners.empty()) {
+        CellSideData* data = findSideData();
+        if (data == nullptr) {
             return;
         }
-
-        auto i = m_changeListeners.begin();
-        while (i != m_changeListeners.end()) {
-            if (*i != nullptr) {
-                (*i)->onBlockingChangedCell(this, m_type, blocks);
+        for (std::size_t i = 0; i < data->changeListeners.size(); ++i) {
+            CellChangeListener* listener = data->changeListeners[i];
+            if (listener != nullptr) {
+                listener->onBlockingChangedCell(this, m_type, blocks);
             }
-            ++i;
         }
     }
 } // namespace FIFE
@@ -8,17 +8,18 @@
 #include "platform.h"
 
 // Standard C++ library includes
+#include <array>
+#include <cassert>
+#include <cstddef>
 #include <list>
-#include <map>
 #include <memory>
-#include <set>
+#include <span>
 #include <vector>
 
 // 3rd party library includes
 
 // FIFE includes
 #include "model/metamodel/modelcoords.h"
-#include "util/base/fifeclass.h"
 
 namespace FIFE
 {
@@ -26,6 +27,7 @@ namespace FIFE
     class Instance;
     class Layer;
     class Cell;
+    class CellCache;
     class Zone;
 
     static double const MIN_CELL_Z = -9999999;
@@ -106,21 +108,89 @@ namespace FIFE
             virtual void onBlockingChangedCell(Cell* cell, CellTypeInfo type, bool blocks) = 0;
     };
 
+    /** The neighbors of a cell: the accessible cells of the grid and the target of a transition.
+     *
+     * Neighbors are not stored, they are looked up in the CellCache each time.
+     */
+    class FIFE_API CellNeighbors
+    {
+        public:
+            //! eight grid neighbors and one transition
+            static constexpr std::size_t MAX_NEIGHBORS = 9;
+
+            void push_back(Cell* cell)
+            {
+                assert(m_size < MAX_NEIGHBORS);
+                m_cells[m_size++] = cell;
+            }
+
+            Cell* const * begin() const
+            {
+                return m_cells.data();
+            }
+
+            Cell* const * end() const
+            {
+                return m_cells.data() + m_size;
+            }
+
+            std::size_t size() const
+            {
+                return m_size;
+            }
+
+            bool empty() const
+            {
+                return m_size == 0;
+            }
+
+            Cell* operator[](std::size_t index) const
+            {
+                return m_cells[index];
+            }
+
+        private:
+            std::array<Cell*, MAX_NEIGHBORS> m_cells{};
+            std::size_t m_size{0};
+    };
+
+    /** Listeners and transition of a cell.
+     * Only few cells have them, so the CellCache keeps them in a side table instead of the cell.
+     */
+    struct FIFE_API CellSideData
+    {
+            //! delete listener
+            std::vector<CellDeleteListener*> deleteListeners;
+            //! change listener
+            std::vector<CellChangeListener*> changeListeners;
+            //! transition from this cell
+            std::unique_ptr<TransitionInfo> transition;
+            //! listens for the deletion of the transition target
+            std::unique_ptr<CellDeleteListener> transitionListener;
+    };
+
     /** A basic cell on a CellCache.
+     *
+     * Cells are created by the CellCache and live in its cell store. The record only holds what
+     * almost every cell needs, neighbors are computed from the grid and everything else is kept
+     * in a side table of the cache.
      */
-    class FIFE_API Cell : public FifeClass, public CellDeleteListener
+    class FIFE_API Cell
     {
         public:
             /** Constructor
              * @param coordint A integer value that represents the cell identifier. Based on coordinates.
              * @param coordinate A ModelCoordinate that specifies the coordinates of the cell.
-             * @param layer A pointer to the layer which is associated with the cell.
+             * @param cache A pointer to the CellCache which holds the cell.
              */
-            Cell(int32_t coordint, ModelCoordinate const & coordinate, Layer* layer);
+            Cell(int32_t coordint, ModelCoordinate const & coordinate, CellCache* cache);
 
             /** Destructor
              */
-            ~Cell() override;
+            ~Cell();
+
+            Cell(Cell const &)            = delete;
+            Cell& operator=(Cell const &) = delete;
 
             /** Adds instances to this cell.
              * @param instances A const reference to list that contains instances.
@@ -226,6 +296,16 @@ namespace FIFE
              */
             void setZoneProtected(bool protect);
 
+            /** Returns whether a blocking tile lies on this cell, see Layer::setTile().
+             * @return True if a tile blocks, otherwise false.
+             */
+            bool isTileBlocking() const;
+
+            /** Marks that a blocking tile lies on this cell. It blocks like a static instance at cell stack position 0.
+             * @param blocks A boolean, true if a tile blocks.
+             */
+            void setTileBlocking(bool blocks);
+
             /** Returns blocker type.
              * @see CellType
              */
@@ -236,10 +316,14 @@ namespace FIFE
              */
             void setCellType(CellTypeInfo type);
 
-            /** Returns all instances on this cell.
-             * @return A const reference to a set that refer to the instances on this cell.
+            /** Returns all instances on this cell, ordered by address.
+             * @return A view of the instances, it is invalidated when an instance enters or leaves the cell.
+             */
+            std::span<Instance* const> getInstances();
+
+            /** Returns the number of instances on this cell.
              */
-            std::set<Instance*> const & getInstances();
+            uint32_t getInstanceCount() const;
 
             /** Sets the cell identifier.
              * @param id A unique int value that is used as identifier. Based on the cell position.
@@ -256,19 +340,10 @@ namespace FIFE
              */
             ModelCoordinate getLayerCoordinates() const;
 
-            /** Adds a neighbor cell to this cell.
-             * @param cell A pointer to the cell that should added as neighbor.
+            /** Returns the neighbors of this cell.
+             * @return The accessible cells around this cell and the target of the transition.
              */
-            void addNeighbor(Cell* cell);
-
-            /** Returns the layer coordinates of this cell.
-             * @return A const reference to a set of all neighbor cells.
-             */
-            std::vector<Cell*> const & getNeighbors();
-
-            /** Removes all neighbors from cell.
-             */
-            void resetNeighbors();
+            CellNeighbors getNeighbors();
 
             /** Returns the current layer.
              * @return A pointer to the currently used layer.
@@ -302,11 +377,10 @@ namespace FIFE
              */
             void removeDeleteListener(CellDeleteListener const * listener);
 
-            /** Called when a cell gets deleted on this cell. If a delete listener was added.
+            /** Called when a transition target of this cell gets deleted.
              * @param cell A pointer to the cell which will be deleted.
-             * @see CellDeleteListener
              */
-            void onCellDeleted(Cell* cell) override;
+            void onCellDeleted(Cell* cell);
 
             /** Adds new cell change listener.
              * @param listener A pointer to the listener.
@@ -339,43 +413,70 @@ namespace FIFE
             void callOnBlockingChanged(bool blocks);
 
         private:
+            enum CellFlags : uint8_t
+            {
+                // already inserted
+                CFLAG_INSERTED  = 0x01,
+                // protected
+                CFLAG_PROTECTED = 0x02,
+                // has an entry in the side table of the cache
+                CFLAG_SIDE_DATA = 0x04,
+                // blocking info waits for the end of a bulk edit
+                CFLAG_BLOCKING_PENDING = 0x08,
+                // a blocking tile lies on the cell
+                CFLAG_TILE_BLOCKER = 0x10
+            };
+
             void updateCellBlockingInfo();
 
-            //! holds coordinate as a unique integer id
-            int32_t m_coordId;
+            /** Inserts the instance into the instance storage.
+             * @return False if the instance was already on this cell.
+             */
+            bool insertInstance(Instance* instance);
+
+            /** Removes the instance from the instance storage.
+             * @return False if the instance was not on this cell.
+             */
+            bool eraseInstance(Instance* instance);
+
+            /** Returns the side table entry, creates it if needed.
+             */
+            CellSideData& sideData();
+
+            /** Returns the side table entry or nullptr if there is none.
+             */
+            CellSideData* findSideData();
+
+            /** Removes the side table entry if nothing uses it anymore.
+             * Removed listeners are only cleared here, they may be removed while the listeners are called.
+             */
+            void releaseSideData();
+
+            void setFlag(uint8_t flag, bool value);
 
             //! holds coordinate
             ModelCoordinate m_coordinate;
 
-            //! parent layer
-            Layer* m_layer;
+            //! holds coordinate as a unique integer id
+            int32_t m_coordId;
+
+            //! the cache which holds this cell
+            CellCache* m_cache;
 
             //! parent Zone
             Zone* m_zone;
 
-            //! Pointer to Transistion
-            std::unique_ptr<TransitionInfo> m_transition;
+            //! the instance if there is only one, the others are in the side table
+            Instance* m_instance;
 
-            //! already inserted
-            bool m_inserted;
-
-            //! protected
-            bool m_protect;
+            //! number of contained instances
+            uint32_t m_instanceCount;
 
             //! CellType
             CellTypeInfo m_type;
 
-            // contained Instances
-            std::set<Instance*> m_instances;
-
-            //! neighbor cells
-            std::vector<Cell*> m_neighbors;
-
-            //! delete listener
-            std::vector<CellDeleteListener*> m_deleteListeners;
-
-            //! change listener
-            std::vector<CellChangeListener*> m_changeListeners;
+            //! CellFlags
+            uint8_t m_flags;
     };
 
 } // namespace FIFE
@@ -37,18 +37,16 @@ namespace FIFE {
 		virtual void onCellDeleted(Cell* cell) = 0;
 	};
 
-	class Cell : public FifeClass {
+	%nodefaultctor Cell;
+	%nodefaultdtor Cell;
+	class Cell {
 		public:
-			Cell(int32_t coordint, ModelCoordinate coordinate, Layer* layer);
-			~Cell();
-
 			void addInstances(const std::list<Instance*>& instances);
 			void addInstance(Instance* instance);
 			void changeInstance(Instance* instance);
 			void removeInstance(Instance* instance);
 
 			bool isNeighbor(Cell* cell);
-			std::vector<Cell*> getNeighbors();
 			void updateCellInfo();
 			int32_t getCellId();
 			const ModelCoordinate getLayerCoordinates() const;
@@ -61,7 +59,7 @@ namespace FIFE {
 			double getSpeedMultiplier();
 			void resetSpeedMultiplier();
 
-			const std::set<Instance*>& getInstances();
+			uint32_t getInstanceCount() const;
 			void setCellType(CellTypeInfo type);
 			CellTypeInfo getCellType();
 			Layer* getLayer();
@@ -73,6 +71,22 @@ namespace FIFE {
 			void addDeleteListener(CellDeleteListener* listener);
 			void removeDeleteListener(CellDeleteListener* listener);
 	};
+
+	%extend Cell {
+		std::set<FIFE::Instance*> getInstances() {
+			std::span<FIFE::Instance* const> const instances = $self->getInstances();
+			return std::set<FIFE::Instance*>(instances.begin(), instances.end());
+		}
+		std::vector<FIFE::Cell*> getNeighbors() {
+			FIFE::CellNeighbors const neighbors = $self->getNeighbors();
+			return std::vector<FIFE::Cell*>(neighbors.begin(), neighbors.end());
+		}
+		bool __eq__(const PyObject *other) { return false; }
+		bool __ne__(const PyObject *other) { return true; }
+		bool __eq__(Cell *other) { return $self == other; }
+		bool __ne__(Cell *other) { return $self != other; }
+		std::size_t __hash__() { return reinterpret_cast<std::size_t>($self); }
+	}
 }
 
 %template(InstanceSet) std::set<FIFE::Instance*>;
@@ -6,14 +6,18 @@
 
 // Standard C++ library includes
 #include <algorithm>
+#include <bitset>
+#include <cassert>
 #include <cmath>
 #include <cstdint>
 #include <list>
 #include <map>
 #include <memory>
 #include <set>
+#include <span>
 #include <stack>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -26,6 +30,8 @@
 #include "layer.h"
 #include "map.h"
 #include "model/metamodel/grids/cellgrid.h"
+#include "tilegrid.h"
+#include "util/base/exception.h"
 #include "util/log/logger.h"
 #include "util/structures/purge.h"
 
@@ -39,8 +45,82 @@ namespace FIFE
             static Logger log(LM_STRUCTURES);
             return log;
         }
+
+        /** Throws if a buffer for the cells of a rect has a different size.
+         */
+        void checkRectBuffer(Rect const & rec, std::size_t size)
+        {
+            std::size_t const expected =
+                static_cast<std::size_t>(std::max(rec.w, 0)) * static_cast<std::size_t>(std::max(rec.h, 0));
+            if (size != expected) {
+                throw IndexOverflow(
+                    "buffer holds " + std::to_string(size) + " values, expected " + std::to_string(expected));
+            }
+        }
     } // namespace
 
+    /** A block of CHUNK_SIZE x CHUNK_SIZE cells.
+     * The cells are constructed and destroyed by the CellCache, the chunk only provides the memory.
+     * A chunk keeps its number while it lives, the ids of its cells are number * CELLS + slot.
+     */
+    struct CellCache::CellChunk
+    {
+            static constexpr int32_t CHUNK_SHIFT = 4;
+            static constexpr int32_t CHUNK_SIZE  = 1 << CHUNK_SHIFT;
+            static constexpr int32_t CHUNK_MASK  = CHUNK_SIZE - 1;
+            static constexpr std::size_t CELLS   = CHUNK_SIZE * CHUNK_SIZE;
+
+            union Slot
+            {
+                    Slot()
+                    {
+                    }
+                    ~Slot()
+                    {
+                    }
+                    Slot(Slot const &)            = delete;
+                    Slot& operator=(Slot const &) = delete;
+
+                    Cell cell;
+            };
+
+            CellChunk(Point const & pos, int32_t num) : position(pos), number(num)
+            {
+            }
+
+            ~CellChunk()
+            {
+                assert("cells have to be destroyed by the cache" && alive.none());
+            }
+
+            CellChunk(CellChunk const &)            = delete;
+            CellChunk& operator=(CellChunk const &) = delete;
+
+            static std::size_t getSlot(ModelCoordinate const & mc)
+            {
+                return static_cast<std::size_t>(((mc.y & CHUNK_MASK) << CHUNK_SHIFT) | (mc.x & CHUNK_MASK));
+            }
+
+            int32_t getCellId(std::size_t slot) const
+            {
+                return (number * static_cast<int32_t>(CELLS)) + static_cast<int32_t>(slot);
+            }
+
+            ModelCoordinate getCoordinate(std::size_t slot) const
+            {
+                int32_t const index = static_cast<int32_t>(slot);
+                return ModelCoordinate(
+                    (position.x * CHUNK_SIZE) + (index & CHUNK_MASK), (position.y * CHUNK_SIZE) + (index >> CHUNK_SHIFT));
+            }
+
+            //! chunk coordinates, the first cell is at position * CHUNK_SIZE
+            Point position;
+            //! index in the chunk numbers of the cache
+            int32_t number;
+            std::array<Slot, CELLS> slots;
+            std::bitset<CELLS> alive;
+    };
+
     class CellCacheChangeListener : public LayerChangeListener
     {
         public:
@@ -230,6 +310,21 @@ namespace FIFE
                 }
             }
 
+            void onTileChanged(Layer* layer, ModelCoordinate const & cell) override
+            {
+                ModelCoordinate mc = cell;
+                if (m_layer != layer) {
+                    mc = m_layer->getCellGrid()->toLayerCoordinates(
+                        layer->getCellGrid()->toMapCoordinates(FIFE::intPt2doublePt(cell)));
+                }
+                // like an instance, a tile creates its cell
+                CellCache* cache = m_layer->getCellCache();
+                Cell* mcCell     = layer->getTile(cell) != nullptr ? cache->createCell(mc) : cache->getCell(mc);
+                if (mcCell != nullptr) {
+                    mcCell->setTileBlocking(cache->isTileBlocking(mc));
+                }
+            }
+
             void onInstanceCreate(Layer* layer, Instance* instance) override
             {
                 ModelCoordinate mc;
@@ -240,12 +335,8 @@ namespace FIFE
                         instance->getLocationRef().getExactLayerCoordinatesRef()));
                 }
 
+                // createCell() grows the cache if the coordinate is out of range
                 CellCache* cache = m_layer->getCellCache();
-                Location loc(m_layer);
-                loc.setLayerCoordinates(mc);
-                if (!cache->isInCellCache(loc)) {
-                    cache->resize();
-                }
                 if (instance->isMultiCell()) {
                     instance->updateMultiInstances();
                     CellGrid* cg                                  = m_layer->getCellGrid();
@@ -256,10 +347,6 @@ namespace FIFE
                             mc, (*it)->getObject()->getMultiPartCoordinates(instance->getRotation()));
                         auto mcit = coordinates.begin();
                         for (; mcit != coordinates.end(); ++mcit) {
-                            loc.setLayerCoordinates(*mcit);
-                            if (!cache->isInCellCache(loc)) {
-                                cache->resize();
-                            }
                             Cell* cell = cache->createCell(*mcit);
                             assert("cell must exist after createCell" && cell != nullptr);
                             cell->addInstance(*it);
@@ -415,12 +502,11 @@ namespace FIFE
                     cell->setZoneProtected(true);
                     m_cache->splitZone(cell);
                 } else {
-                    Zone* z1                             = cell->getZone();
-                    Zone* z2                             = nullptr;
-                    std::vector<Cell*> const & neighbors = cell->getNeighbors();
-                    auto it                              = neighbors.begin();
-                    for (; it != neighbors.end(); ++it) {
-                        Zone* z = (*it)->getZone();
+                    Zone* z1                      = cell->getZone();
+                    Zone* z2                      = nullptr;
+                    CellNeighbors const neighbors = cell->getNeighbors();
+                    for (auto* neighbor : neighbors) {
+                        Zone* z = neighbor->getZone();
                         if ((z != nullptr) && z != z1) {
                             z2 = z;
                         }
@@ -441,7 +527,10 @@ namespace FIFE
         m_defaultCostMulti(1.0),
         m_defaultSpeedMulti(1.0),
         m_cellListener(std::make_unique<CellCacheChangeListener>(m_layer)),
+        m_chunkColumns(0),
+        m_chunkRows(0),
         m_neighborZ(-1),
+        m_bulkEdits(0),
         m_blockingUpdate(false),
         m_sizeUpdate(false),
         m_searchNarrow(true),
@@ -477,10 +566,8 @@ namespace FIFE
         m_width  = static_cast<uint32_t>(std::abs(m_size.w - m_size.x) + 1);
         m_height = static_cast<uint32_t>(std::abs(m_size.h - m_size.y) + 1);
 
-        m_cells.resize(m_width);
-        for (uint32_t i = 0; i < m_width; ++i) {
-            m_cells.at(i).resize(m_height);
-        }
+        layoutChunks();
+        updateNeighborOffsets();
     }
 
     CellCache::~CellCache()
@@ -508,7 +595,29 @@ namespace FIFE
         m_speedMultipliers.clear();
         m_narrowCells.clear();
         m_cellAreas.clear();
-        m_cells.clear();
+        if (m_fieldOfView) {
+            m_fieldOfView->onCellsReset();
+        }
+        // destroy the cells while the store is intact, transitions look up their targets
+        for (auto const & chunk : m_chunks) {
+            if (chunk == nullptr) {
+                continue;
+            }
+            for (std::size_t slot = 0; slot < CellChunk::CELLS; ++slot) {
+                if (chunk->alive.test(slot)) {
+                    chunk->slots[slot].cell.~Cell();
+                    chunk->alive.reset(slot);
+                }
+            }
+        }
+        m_chunks.clear();
+        m_chunkNumbers.clear();
+        m_freeChunkNumbers.clear();
+        m_chunkColumns = 0;
+        m_chunkRows    = 0;
+        m_cellInstances.clear();
+        m_cellSideData.clear();
+        m_bulkCells.clear();
         // reset default cost and speed
         m_defaultCostMulti  = 1.0;
         m_defaultSpeedMulti = 1.0;
@@ -535,108 +644,95 @@ namespace FIFE
     {
         // check if size has changed
         Rect const newsize = rec;
-        if (newsize.x != m_size.x || newsize.y != m_size.y || newsize.w != m_size.w || newsize.h != m_size.h) {
-            uint32_t const w = static_cast<uint32_t>(std::abs(newsize.w - newsize.x) + 1);
-            uint32_t const h = static_cast<uint32_t>(std::abs(newsize.h - newsize.y) + 1);
-
-            std::vector<std::vector<std::unique_ptr<Cell>>> cells;
-            cells.resize(w);
-            for (uint32_t i = 0; i < w; ++i) {
-                cells.at(i).resize(h);
-            }
-            std::vector<Layer*> const & interacts = m_layer->getInteractLayers();
-            for (uint32_t y = 0; y < h; ++y) {
-                for (uint32_t x = 0; x < w; ++x) {
-                    // transfer cells
-                    ModelCoordinate const mc(newsize.x + static_cast<int32_t>(x), newsize.y + static_cast<int32_t>(y));
-                    int32_t const old_x = mc.x - m_size.x;
-                    int32_t const old_y = mc.y - m_size.y;
-                    // out of range in the old size, so we create a new cell
-                    if (old_x < 0 || std::cmp_greater_equal(old_x, m_width) || old_y < 0 ||
-                        std::cmp_greater_equal(old_y, m_height)) {
-                        int32_t const coordId = static_cast<int32_t>(x + (y * w));
-                        auto cell             = std::make_unique<Cell>(coordId, mc, m_layer);
-
-                        std::list<Instance*> cell_instances;
-                        m_layer->getInstanceTree()->findInstances(mc, 0, 0, cell_instances);
-                        if (!interacts.empty()) {
-                            // fill interact Instances into Cell
-                            auto it = interacts.begin();
-                            std::list<Instance*> interact_instances;
-                            for (; it != interacts.end(); ++it) {
-                                // convert coordinates
-                                ExactModelCoordinate const emc(FIFE::intPt2doublePt(mc));
-                                ModelCoordinate const inter_mc = (*it)->getCellGrid()->toLayerCoordinates(
-                                    m_layer->getCellGrid()->toMapCoordinates(emc));
-                                // check interact layer for instances
-                                (*it)->getInstanceTree()->findInstances(inter_mc, 0, 0, interact_instances);
-                                if (!interact_instances.empty()) {
-                                    cell_instances.insert(
-                                        cell_instances.end(), interact_instances.begin(), interact_instances.end());
-                                    interact_instances.clear();
-                                }
-                            }
-                        }
-                        if (!cell_instances.empty()) {
-                            // add instances to cell
-                            cell->addInstances(cell_instances);
-                        }
-                        cells.at(x).at(y) = std::move(cell);
-                    } else {
-                        cells.at(x).at(y) =
-                            std::move(m_cells.at(static_cast<uint32_t>(old_x)).at(static_cast<uint32_t>(old_y)));
-                        int32_t const coordId = static_cast<int32_t>(x + (y * w));
-                        if (cells.at(x).at(y) == nullptr) {
-                            cells.at(x).at(y) = std::make_unique<Cell>(coordId, mc, m_layer);
-                        } else {
-                            cells.at(x).at(y)->setCellId(coordId);
-                            cells.at(x).at(y)->resetNeighbors();
-                        }
+        if (newsize.x == m_size.x && newsize.y == m_size.y && newsize.w == m_size.w && newsize.h == m_size.h) {
+            return;
+        }
+        uint32_t const w = static_cast<uint32_t>(std::abs(newsize.w - newsize.x) + 1);
+        uint32_t const h = static_cast<uint32_t>(std::abs(newsize.h - newsize.y) + 1);
+
+        // delete cells outside of the new size, the other cells stay where they are
+        bool const shrinks = m_width != 0 && m_height != 0 &&
+                             (m_size.x < newsize.x || m_size.y < newsize.y || m_size.w > newsize.w ||
+                              m_size.h > newsize.h);
+        if (shrinks) {
+            for (int32_t y = m_size.y; y <= m_size.h; ++y) {
+                for (int32_t x = m_size.x; x <= m_size.w; ++x) {
+                    if (x >= newsize.x && x <= newsize.w && y >= newsize.y && y <= newsize.h) {
+                        continue;
+                    }
+                    Cell* cell = getCell(ModelCoordinate(x, y));
+                    if (cell != nullptr) {
+                        destroyCell(cell);
                     }
                 }
             }
-            // use new values
-            m_cells  = std::move(cells);
-            m_size   = newsize;
-            m_width  = w;
-            m_height = h;
-
-            bool const zCheck = m_neighborZ != -1;
-            // fill neighbors into cells
-            for (auto const & row : m_cells) {
-                for (auto const & cellPtr : row) {
-                    int32_t const cellZ = cellPtr->getLayerCoordinates().z;
-                    std::vector<ModelCoordinate> coordinates;
-                    m_layer->getCellGrid()->getAccessibleCoordinates(cellPtr->getLayerCoordinates(), coordinates);
-                    for (auto const & coordinate : coordinates) {
-                        Cell* c = getCell(coordinate);
-                        if (cellPtr.get() == c || (c == nullptr)) {
-                            continue;
-                        }
-                        if (zCheck) {
-                            if (std::abs(c->getLayerCoordinates().z - cellZ) > m_neighborZ) {
-                                continue;
-                            }
+        }
+        Rect const oldsize = m_size;
+        bool const hadCells = m_width != 0 && m_height != 0;
+        // use new values
+        m_size   = newsize;
+        m_width  = w;
+        m_height = h;
+        // the chunks keep their numbers, so the ids of the existing cells stay valid
+        layoutChunks();
+
+        // create and fill the cells that were out of range in the old size
+        std::vector<Layer*> const & interacts = m_layer->getInteractLayers();
+        for (int32_t y = newsize.y; y <= newsize.h; ++y) {
+            bool const oldRow = hadCells && y >= oldsize.y && y <= oldsize.h;
+            for (int32_t x = newsize.x; x <= newsize.w; ++x) {
+                if (oldRow && x >= oldsize.x && x <= oldsize.w) {
+                    // skip the span that was already in range
+                    x = oldsize.w;
+                    continue;
+                }
+                ModelCoordinate const mc(x, y);
+                if (getCell(mc) != nullptr) {
+                    continue;
+                }
+                Cell* cell = constructCell(mc);
+                cell->setTileBlocking(isTileBlocking(mc));
+                std::list<Instance*> cell_instances;
+                m_layer->getInstanceTree()->findInstances(mc, 0, 0, cell_instances);
+                if (!interacts.empty()) {
+                    // fill interact Instances into Cell
+                    auto it = interacts.begin();
+                    std::list<Instance*> interact_instances;
+                    for (; it != interacts.end(); ++it) {
+                        // convert coordinates
+                        ExactModelCoordinate const emc(FIFE::intPt2doublePt(mc));
+                        ModelCoordinate const inter_mc =
+                            (*it)->getCellGrid()->toLayerCoordinates(m_layer->getCellGrid()->toMapCoordinates(emc));
+                        // check interact layer for instances
+                        (*it)->getInstanceTree()->findInstances(inter_mc, 0, 0, interact_instances);
+                        if (!interact_instances.empty()) {
+                            cell_instances.insert(
+                                cell_instances.end(), interact_instances.begin(), interact_instances.end());
+                            interact_instances.clear();
                         }
-                        cellPtr->addNeighbor(c);
                     }
                 }
+                if (!cell_instances.empty()) {
+                    // add instances to cell
+                    cell->addInstances(cell_instances);
+                }
             }
         }
+        updateNeighborOffsets();
     } // CellCache::resize
 
     void CellCache::createCells()
     {
+        updateNeighborOffsets();
         std::vector<Layer*> const & interacts = m_layer->getInteractLayers();
         for (uint32_t y = 0; y < m_height; ++y) {
             for (uint32_t x = 0; x < m_width; ++x) {
                 ModelCoordinate const mc(m_size.x + static_cast<int32_t>(x), m_size.y + static_cast<int32_t>(y));
                 Cell* cell = getCell(mc);
                 if (cell == nullptr) {
-                    auto newCell        = std::make_unique<Cell>(convertCoordToInt(mc), mc, m_layer);
-                    cell                = newCell.get();
-                    m_cells.at(x).at(y) = std::move(newCell);
+                    cell = constructCell(mc);
                 }
+                cell->setTileBlocking(isTileBlocking(mc));
                 // fill Instances into Cell
                 std::list<Instance*> cell_instances;
                 m_layer->getInstanceTree()->findInstances(mc, 0, 0, cell_instances);
@@ -664,35 +760,36 @@ namespace FIFE
                 }
             }
         }
-        // fill neighbors into cells
-        for (auto const & row : m_cells) {
-            for (auto const & cellPtr : row) {
+        createZones();
+    }
+
+    void CellCache::createZones()
+    {
+        // search narrow cells
+        for (uint32_t y = 0; y < m_height; ++y) {
+            for (uint32_t x = 0; x < m_width; ++x) {
+                ModelCoordinate const mc(m_size.x + static_cast<int32_t>(x), m_size.y + static_cast<int32_t>(y));
+                Cell* cell         = getCell(mc);
                 uint8_t accessible = 0;
                 bool const selfblocker =
-                    cellPtr->getCellType() == CTYPE_STATIC_BLOCKER || cellPtr->getCellType() == CTYPE_CELL_BLOCKER;
-                std::vector<ModelCoordinate> coordinates;
-                m_layer->getCellGrid()->getAccessibleCoordinates(cellPtr->getLayerCoordinates(), coordinates);
-                for (auto const & coordinate : coordinates) {
-                    Cell* c = getCell(coordinate);
-                    if (cellPtr.get() == c || (c == nullptr)) {
-                        continue;
-                    }
+                    cell->getCellType() == CTYPE_STATIC_BLOCKER || cell->getCellType() == CTYPE_CELL_BLOCKER;
+                for (auto* c : cell->getNeighbors()) {
                     if (!selfblocker && c->getCellType() != CTYPE_STATIC_BLOCKER &&
                         c->getCellType() != CTYPE_CELL_BLOCKER) {
                         ++accessible;
                     }
-                    cellPtr->addNeighbor(c);
                 }
                 // add cell to narrow cells and add listener for zone change
                 if (m_searchNarrow && !selfblocker && accessible < 3) {
-                    addNarrowCell(cellPtr.get());
+                    addNarrowCell(cell);
                 }
             }
         }
         // create Zones
-        for (auto const & row : m_cells) {
-            for (auto const & cellPtr : row) {
-                Cell* cell = cellPtr.get();
+        for (uint32_t y = 0; y < m_height; ++y) {
+            for (uint32_t x = 0; x < m_width; ++x) {
+                ModelCoordinate const mc(m_size.x + static_cast<int32_t>(x), m_size.y + static_cast<int32_t>(y));
+                Cell* cell = getCell(mc);
                 if ((cell->getZone() != nullptr) || cell->isInserted()) {
                     continue;
                 }
@@ -708,8 +805,7 @@ namespace FIFE
                     cellstack.pop();
                     zone->addCell(c);
 
-                    std::vector<Cell*> const & neighbors = c->getNeighbors();
-                    for (auto* nc : neighbors) {
+                    for (auto* nc : c->getNeighbors()) {
                         if (!nc->isInserted() && nc->getCellType() != CTYPE_STATIC_BLOCKER &&
                             nc->getCellType() != CTYPE_CELL_BLOCKER) {
                             nc->setInserted(true);
@@ -723,20 +819,18 @@ namespace FIFE
 
     void CellCache::forceUpdate()
     {
-        for (auto const & row : m_cells) {
-            for (auto const & cellPtr : row) {
-                cellPtr->updateCellInfo();
+        for (auto const & chunk : m_chunks) {
+            if (chunk == nullptr) {
+                continue;
+            }
+            for (std::size_t slot = 0; slot < CellChunk::CELLS; ++slot) {
+                if (chunk->alive.test(slot)) {
+                    chunk->slots[slot].cell.updateCellInfo();
+                }
             }
         }
     }
 
-    void CellCache::addCell(Cell* cell)
-    {
-        ModelCoordinate const mc = cell->getLayerCoordinates();
-        m_cells.at(static_cast<size_t>(mc.x - m_size.x)).at(static_cast<size_t>(mc.y - m_size.y)) =
-            std::unique_ptr<Cell>(cell);
-    }
-
     Cell* CellCache::createCell(ModelCoordinate const & mc)
     {
         Cell* cell = getCell(mc);
@@ -752,10 +846,7 @@ namespace FIFE
             }
             cell = getCell(mc);
             if (cell == nullptr) {
-                auto newCell = std::make_unique<Cell>(convertCoordToInt(mc), mc, m_layer);
-                cell         = newCell.get();
-                m_cells.at(static_cast<size_t>(mc.x - m_size.x)).at(static_cast<size_t>(mc.y - m_size.y)) =
-                    std::move(newCell);
+                cell = constructCell(mc);
             }
         }
         assert("createCell must return a valid cell" && cell != nullptr);
@@ -771,22 +862,193 @@ namespace FIFE
             return nullptr;
         }
 
-        return m_cells.at(static_cast<uint32_t>(x)).at(static_cast<uint32_t>(y)).get();
+        CellChunk* chunk = m_chunks[getChunkIndex(mc)].get();
+        if (chunk == nullptr) {
+            return nullptr;
+        }
+        std::size_t const slot = CellChunk::getSlot(mc);
+        return chunk->alive.test(slot) ? &chunk->slots[slot].cell : nullptr;
+    }
+
+    bool CellCache::isTileBlocking(ModelCoordinate const & mc) const
+    {
+        TileGrid const * tiles = m_layer->getTileGrid();
+        if (tiles != nullptr && tiles->isBlocking(mc)) {
+            return true;
+        }
+        for (Layer const * interact : m_layer->getInteractLayers()) {
+            tiles = interact->getTileGrid();
+            if (tiles == nullptr) {
+                continue;
+            }
+            ExactModelCoordinate const emc(FIFE::intPt2doublePt(mc));
+            ModelCoordinate const inter_mc =
+                interact->getCellGrid()->toLayerCoordinates(m_layer->getCellGrid()->toMapCoordinates(emc));
+            if (tiles->isBlocking(inter_mc)) {
+                return true;
+            }
+        }
+        return false;
     }
 
     std::vector<std::vector<Cell*>> CellCache::getCells()
     {
         std::vector<std::vector<Cell*>> result;
-        result.resize(m_cells.size());
-        for (size_t i = 0; i < m_cells.size(); ++i) {
-            result.at(i).reserve(m_cells.at(i).size());
-            for (auto const & cellPtr : m_cells.at(i)) {
-                result.at(i).push_back(cellPtr.get());
+        result.resize(m_width);
+        for (uint32_t x = 0; x < m_width; ++x) {
+            result.at(x).reserve(m_height);
+            for (uint32_t y = 0; y < m_height; ++y) {
+                result.at(x).push_back(
+                    getCell(ModelCoordinate(m_size.x + static_cast<int32_t>(x), m_size.y + static_cast<int32_t>(y))));
             }
         }
         return result;
     }
 
+    std::size_t CellCache::getChunkIndex(ModelCoordinate const & mc) const
+    {
+        uint32_t const column = static_cast<uint32_t>((mc.x >> CellChunk::CHUNK_SHIFT) - m_chunkOrigin.x);
+        uint32_t const row    = static_cast<uint32_t>((mc.y >> CellChunk::CHUNK_SHIFT) - m_chunkOrigin.y);
+        return (static_cast<std::size_t>(row) * m_chunkColumns) + column;
+    }
+
+    void CellCache::layoutChunks()
+    {
+        int32_t left   = m_size.x >> CellChunk::CHUNK_SHIFT;
+        int32_t top    = m_size.y >> CellChunk::CHUNK_SHIFT;
+        int32_t right  = m_size.w >> CellChunk::CHUNK_SHIFT;
+        int32_t bottom = m_size.h >> CellChunk::CHUNK_SHIFT;
+        if (m_chunkColumns != 0 && m_chunkRows != 0) {
+            int32_t const oldRight  = m_chunkOrigin.x + static_cast<int32_t>(m_chunkColumns) - 1;
+            int32_t const oldBottom = m_chunkOrigin.y + static_cast<int32_t>(m_chunkRows) - 1;
+            if (left >= m_chunkOrigin.x && top >= m_chunkOrigin.y && right <= oldRight && bottom <= oldBottom) {
+                // still fits, give memory back only if most of the capacity is unused
+                int64_t const needed = static_cast<int64_t>(right - left + 1) * (bottom - top + 1);
+                if (needed * 4 >= static_cast<int64_t>(m_chunkColumns) * m_chunkRows) {
+                    return;
+                }
+            } else {
+                // grow by half of the capacity on the exceeded sides, so growing step by step is amortized
+                int32_t const growX = std::max<int32_t>(1, static_cast<int32_t>(m_chunkColumns / 2));
+                int32_t const growY = std::max<int32_t>(1, static_cast<int32_t>(m_chunkRows / 2));
+                left   = left < m_chunkOrigin.x ? std::min(left, m_chunkOrigin.x - growX) : m_chunkOrigin.x;
+                top    = top < m_chunkOrigin.y ? std::min(top, m_chunkOrigin.y - growY) : m_chunkOrigin.y;
+                right  = right > oldRight ? std::max(right, oldRight + growX) : oldRight;
+                bottom = bottom > oldBottom ? std::max(bottom, oldBottom + growY) : oldBottom;
+            }
+        }
+        Point const origin(left, top);
+        uint32_t const columns = static_cast<uint32_t>(right - left + 1);
+        uint32_t const rows    = static_cast<uint32_t>(bottom - top + 1);
+        std::vector<std::unique_ptr<CellChunk>> chunks(static_cast<std::size_t>(columns) * rows);
+        for (uint32_t row = 0; row < m_chunkRows; ++row) {
+            for (uint32_t column = 0; column < m_chunkColumns; ++column) {
+                std::unique_ptr<CellChunk>& chunk = m_chunks[(static_cast<std::size_t>(row) * m_chunkColumns) + column];
+                if (chunk == nullptr) {
+                    continue;
+                }
+                // chunks out of range have no cells anymore and are dropped
+                int32_t const newColumn = m_chunkOrigin.x + static_cast<int32_t>(column) - origin.x;
+                int32_t const newRow    = m_chunkOrigin.y + static_cast<int32_t>(row) - origin.y;
+                if (newColumn >= 0 && std::cmp_less(newColumn, columns) && newRow >= 0 && std::cmp_less(newRow, rows)) {
+                    chunks[(static_cast<std::size_t>(newRow) * columns) + static_cast<std::size_t>(newColumn)] =
+                        std::move(chunk);
+                } else {
+                    m_chunkNumbers[static_cast<std::size_t>(chunk->number)] = nullptr;
+                    m_freeChunkNumbers.push_back(chunk->number);
+                }
+            }
+        }
+        m_chunks       = std::move(chunks);
+        m_chunkOrigin  = origin;
+        m_chunkColumns = columns;
+        m_chunkRows    = rows;
+    }
+
+    Cell* CellCache::constructCell(ModelCoordinate const & mc)
+    {
+        std::unique_ptr<CellChunk>& chunk = m_chunks[getChunkIndex(mc)];
+        if (chunk == nullptr) {
+            // reuse the number of a dropped chunk, so the id range stays as small as the number of chunks
+            int32_t number = static_cast<int32_t>(m_chunkNumbers.size());
+            if (m_freeChunkNumbers.empty()) {
+                m_chunkNumbers.push_back(nullptr);
+            } else {
+                number = m_freeChunkNumbers.back();
+                m_freeChunkNumbers.pop_back();
+            }
+            Point const position(mc.x >> CellChunk::CHUNK_SHIFT, mc.y >> CellChunk::CHUNK_SHIFT);
+            chunk = std::make_unique<CellChunk>(position, number);
+            m_chunkNumbers[static_cast<std::size_t>(number)] = chunk.get();
+        }
+        std::size_t const slot = CellChunk::getSlot(mc);
+        assert("cell slot must be free" && !chunk->alive.test(slot));
+        Cell* cell = std::construct_at(&chunk->slots[slot].cell, chunk->getCellId(slot), mc, this);
+        chunk->alive.set(slot);
+        if (m_fieldOfView) {
+            m_fieldOfView->onCellCreated(cell);
+        }
+        return cell;
+    }
+
+    void CellCache::destroyCell(Cell* cell)
+    {
+        if (m_fieldOfView) {
+            m_fieldOfView->onCellDestroyed(cell);
+        }
+        ModelCoordinate const mc = cell->getLayerCoordinates();
+        CellChunk* chunk         = m_chunks[getChunkIndex(mc)].get();
+        std::destroy_at(cell);
+        chunk->alive.reset(CellChunk::getSlot(mc));
+    }
+
+    void CellCache::updateNeighborOffsets()
+    {
+        // the accessible cells only depend on the parity of the row, hex grids shift every second row
+        std::vector<ModelCoordinate> coordinates;
+        for (int32_t parity = 0; parity < 2; ++parity) {
+            ModelCoordinate const center(0, parity);
+            std::vector<ModelCoordinate>& offsets = m_neighborOffsets[static_cast<std::size_t>(parity)];
+            offsets.clear();
+            m_layer->getCellGrid()->getAccessibleCoordinates(center, coordinates);
+            for (auto const & coordinate : coordinates) {
+                if (coordinate == center) {
+                    continue;
+                }
+                offsets.emplace_back(coordinate.x - center.x, coordinate.y - center.y);
+            }
+        }
+    }
+
+    std::size_t CellCache::getMemoryUsage() const
+    {
+        // every heap block and hash node costs about two pointers of bookkeeping
+        std::size_t constexpr overhead = 2 * sizeof(void*);
+        std::size_t bytes              = m_chunks.capacity() * sizeof(std::unique_ptr<CellChunk>);
+        bytes += m_chunkNumbers.capacity() * sizeof(CellChunk*);
+        bytes += m_freeChunkNumbers.capacity() * sizeof(int32_t);
+        for (auto const & chunk : m_chunks) {
+            if (chunk != nullptr) {
+                bytes += sizeof(CellChunk) + overhead;
+            }
+        }
+        bytes += m_cellInstances.bucket_count() * sizeof(void*);
+        for (auto const & [cell, instances] : m_cellInstances) {
+            bytes += sizeof(std::pair<Cell const * const, std::vector<Instance*>>) + overhead;
+            bytes += (instances.capacity() * sizeof(Instance*)) + overhead;
+        }
+        bytes += m_cellSideData.bucket_count() * sizeof(void*);
+        for (auto const & [cell, data] : m_cellSideData) {
+            bytes += sizeof(std::pair<Cell const * const, CellSideData>) + overhead;
+            bytes += data.deleteListeners.capacity() * sizeof(CellDeleteListener*);
+            bytes += data.changeListeners.capacity() * sizeof(CellChangeListener*);
+            if (data.transition) {
+                bytes += sizeof(TransitionInfo) + overhead;
+            }
+        }
+        return bytes;
+    }
+
     void CellCache::removeCell(Cell* cell)
     {
         if (!m_costsToCells.empty()) {
@@ -879,6 +1141,14 @@ namespace FIFE
         return m_layer;
     }
 
+    FieldOfView* CellCache::getFieldOfView()
+    {
+        if (!m_fieldOfView) {
+            m_fieldOfView = std::make_unique<FieldOfView>(this);
+        }
+        return m_fieldOfView.get();
+    }
+
     Rect const & CellCache::getSize()
     {
         return m_size;
@@ -912,20 +1182,31 @@ namespace FIFE
 
     int32_t CellCache::convertCoordToInt(ModelCoordinate const & coord) const
     {
-        ModelCoordinate const newcoords(coord.x - m_size.x, coord.y - m_size.y);
-        return newcoords.x + (newcoords.y * static_cast<int32_t>(m_width));
+        int32_t const x = coord.x - m_size.x;
+        int32_t const y = coord.y - m_size.y;
+        if (x < 0 || std::cmp_greater_equal(x, m_width) || y < 0 || std::cmp_greater_equal(y, m_height)) {
+            return -1;
+        }
+        CellChunk const * chunk = m_chunks[getChunkIndex(coord)].get();
+        if (chunk == nullptr) {
+            return -1;
+        }
+        return chunk->getCellId(CellChunk::getSlot(coord));
     }
 
     ModelCoordinate CellCache::convertIntToCoord(int32_t const cell) const
     {
-        ModelCoordinate const coord(
-            (cell % static_cast<int32_t>(m_width)) + m_size.x, (cell / static_cast<int32_t>(m_width)) + m_size.y);
-        return coord;
+        std::size_t const number = static_cast<std::size_t>(cell) / CellChunk::CELLS;
+        CellChunk const * chunk  = cell >= 0 && number < m_chunkNumbers.size() ? m_chunkNumbers[number] : nullptr;
+        if (chunk == nullptr) {
+            throw IndexOverflow("no cell with id " + std::to_string(cell));
+        }
+        return chunk->getCoordinate(static_cast<std::size_t>(cell) % CellChunk::CELLS);
     }
 
     int32_t CellCache::getMaxIndex() const
     {
-        int32_t const max_index = static_cast<int32_t>(m_width * m_height);
+        int32_t const max_index = static_cast<int32_t>(m_chunkNumbers.size() * CellChunk::CELLS);
         return max_index;
     }
 
@@ -995,6 +1276,51 @@ namespace FIFE
         return cells;
     }
 
+    void CellCache::getCellTypes(Rect const & rec, std::span<CellTypeInfo> types)
+    {
+        checkRectBuffer(rec, types.size());
+
+        std::size_t index = 0;
+        ModelCoordinate current(rec.x, rec.y);
+        for (; current.y < rec.y + rec.h; ++current.y) {
+            for (current.x = rec.x; current.x < rec.x + rec.w; ++current.x) {
+                Cell const * cell = getCell(current);
+                types[index++]    = cell != nullptr ? cell->getCellType() : CellTypeInfo{CTYPE_CELL_BLOCKER};
+            }
+        }
+    }
+
+    void CellCache::getCostGrid(Rect const & rec, std::span<double> costs, std::string const & costId)
+    {
+        checkRectBuffer(rec, costs.size());
+
+        // resolves the cells of the cost once instead of searching them per cell
+        std::unordered_set<Cell const *> costCells;
+        double const cost = getCost(costId);
+        if (!costId.empty()) {
+            StringCellPair const range = m_costsToCells.equal_range(costId);
+            for (auto it = range.first; it != range.second; ++it) {
+                costCells.insert(it->second);
+            }
+        }
+
+        std::size_t index = 0;
+        ModelCoordinate current(rec.x, rec.y);
+        for (; current.y < rec.y + rec.h; ++current.y) {
+            for (current.x = rec.x; current.x < rec.x + rec.w; ++current.x) {
+                Cell* cell = getCell(current);
+                if (cell == nullptr) {
+                    costs[index++] = -1.0;
+                } else if (costCells.contains(cell)) {
+                    costs[index++] = cost;
+                } else {
+                    auto it        = m_costMultipliers.find(cell);
+                    costs[index++] = it != m_costMultipliers.end() ? it->second : m_defaultCostMulti;
+                }
+            }
+        }
+    }
+
     std::vector<Cell*> CellCache::getCellsInCircle(ModelCoordinate const & center, uint16_t radius)
     {
         std::vector<Cell*> cells;
@@ -1449,8 +1775,8 @@ namespace FIFE
 
         Zone* newZone = createZone();
         std::stack<Cell*> cellstack;
-        std::vector<Cell*> const & neighbors = cell->getNeighbors();
-        auto it                              = std::ranges::find_if(neighbors, [](Cell const * nc) {
+        CellNeighbors const neighbors = cell->getNeighbors();
+        auto it                       = std::ranges::find_if(neighbors, [](Cell const * nc) {
             return nc->isInserted() && !nc->isZoneProtected() && nc->getCellType() != CTYPE_STATIC_BLOCKER &&
                    nc->getCellType() != CTYPE_CELL_BLOCKER;
         });
@@ -1468,8 +1794,7 @@ namespace FIFE
             if (c->isZoneProtected()) {
                 continue;
             }
-            std::vector<Cell*> const & neigh = c->getNeighbors();
-            for (auto* nc : neigh) {
+            for (auto* nc : c->getNeighbors()) {
                 if (nc->getZone() == currentZone && nc->isInserted() && nc->getCellType() != CTYPE_STATIC_BLOCKER &&
                     nc->getCellType() != CTYPE_CELL_BLOCKER) {
                     cellstack.push(nc);
@@ -1686,12 +2011,54 @@ namespace FIFE
         m_sizeUpdate = update;
     }
 
-    void CellCache::update()
+    void CellCache::beginBulkEdit()
     {
+        ++m_bulkEdits;
+    }
+
+    void CellCache::endBulkEdit()
+    {
+        assert("endBulkEdit without beginBulkEdit" && m_bulkEdits > 0);
+        if (--m_bulkEdits != 0) {
+            return;
+        }
         if (m_sizeUpdate) {
             resize();
             m_sizeUpdate = false;
         }
+        if (m_bulkCells.empty()) {
+            return;
+        }
+        // zones are rebuilt below, so the narrow cells must not split and merge them on the way
+        bool const hasZones = !m_zones.empty();
+        if (hasZones) {
+            resetNarrowCells();
+        }
+        std::vector<ModelCoordinate> cells;
+        cells.swap(m_bulkCells);
+        for (auto const & mc : cells) {
+            Cell* cell = getCell(mc);
+            if (cell != nullptr) {
+                cell->updateCellInfo();
+            }
+        }
+        if (hasZones) {
+            m_zones.clear();
+            createZones();
+        }
+    }
+
+    bool CellCache::isBulkEdit() const
+    {
+        return m_bulkEdits != 0;
+    }
+
+    void CellCache::update()
+    {
+        if (m_sizeUpdate && m_bulkEdits == 0) {
+            resize();
+            m_sizeUpdate = false;
+        }
         m_blockingUpdate = false;
     }
 } // namespace FIFE
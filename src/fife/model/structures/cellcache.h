@@ -9,12 +9,16 @@
 
 // Standard C++ library includes
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <list>
 #include <map>
 #include <memory>
 #include <set>
+#include <span>
 #include <stack>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -22,10 +26,12 @@
 
 // FIFE includes
 #include "cell.h"
+#include "fieldofview.h"
 #include "layer.h"
 #include "model/metamodel/modelcoords.h"
 #include "model/metamodel/object.h"
 #include "util/base/fifeclass.h"
+#include "util/structures/point.h"
 #include "util/structures/rect.h"
 
 namespace FIFE
@@ -95,6 +101,9 @@ namespace FIFE
 
     /** A CellCache is an abstract depiction of one or a few layers
      *	and contains additional information, such as different cost and speed and so on.
+     *
+     * The cells are stored in chunks of 16x16 cells, so a cell keeps its address when the cache
+     * is resized. Data that only few cells need is kept in side tables.
      */
     class FIFE_API CellCache : public FifeClass
     {
@@ -133,11 +142,6 @@ namespace FIFE
              */
             void forceUpdate();
 
-            /** Adds cell to this CellCache.
-             * @param cell A pointer to cell which should be added.
-             */
-            void addCell(Cell* cell);
-
             /** Creates cell on this CellCache.
              * @param mc A const reference to ModelCoordinate where the cell should be created.
              * @return A pointer to the new cell.
@@ -150,6 +154,12 @@ namespace FIFE
              */
             Cell* getCell(ModelCoordinate const & mc);
 
+            /** Returns true if a blocking tile of the layer or one of its interact layers lies on the cell.
+             * @param mc A const reference to ModelCoordinate of the cell.
+             * @see Layer::setTile()
+             */
+            bool isTileBlocking(ModelCoordinate const & mc) const;
+
             /** Returns all cells of this CellCache.
              * @return A const reference to a two dimensional vector which contain all cells.
              */
@@ -182,6 +192,11 @@ namespace FIFE
              */
             Layer* getLayer();
 
+            /** Returns the field of view service of this CellCache, it is created on first use.
+             * @return A pointer to the FieldOfView.
+             */
+            FieldOfView* getFieldOfView();
+
             /** Returns CellCache size.
              * @return A const reference to rect that contain the min and max coordinates.
              */
@@ -211,21 +226,31 @@ namespace FIFE
 
             /** Convertes coordinate to unique identifier.
              * @param coord A const reference to ModelCoordinate which should be converted.
-             * @return A integer, the cell identifier.
+             * @return A integer, the cell identifier, or -1 if the coordinate is out of range.
              */
             int32_t convertCoordToInt(ModelCoordinate const & coord) const;
 
             /** Convertes unique identifier to coordinate.
+             * Throws IndexOverflow if no chunk has the id.
              * @param cell A const reference to the integer id which should be converted.
              * @return A ModelCoordinate, contain the cell coordinate.
              */
             ModelCoordinate convertIntToCoord(int32_t cell) const;
 
-            /** Returns the number of cells on this CellCache.
-             * @return A integer value, the number of cells.
+            /** Returns the upper bound of the cell ids.
+             * A cell id is the number of its chunk times the cells per chunk plus its slot. Chunks keep their
+             * number while they live and numbers of dropped chunks are reused, so the ids of existing cells never
+             * change and the bound grows with the number of chunks, not with the capacity.
+             * @return A integer value, every cell id is smaller.
              */
             int32_t getMaxIndex() const;
 
+            /** Returns the bytes used by the cell store and the side tables of the cells.
+             * Zones, areas and cost tables are not included. Heap bookkeeping is estimated.
+             * @return The number of bytes.
+             */
+            std::size_t getMemoryUsage() const;
+
             /** Sets maximal z range for neighbors.
              * @param z The maximal z range as int.
              */
@@ -257,6 +282,22 @@ namespace FIFE
              */
             std::vector<Cell*> getBlockingCellsInRect(Rect const & rec);
 
+            /** Writes the types of the cells in the rect, row by row. Missing cells are written as CTYPE_CELL_BLOCKER.
+             * @param rec A const reference to the Rect which specifies the size.
+             * @param types A buffer with rec.w * rec.h values.
+             * @throws IndexOverflow if the buffer has a different size.
+             */
+            void getCellTypes(Rect const & rec, std::span<CellTypeInfo> types);
+
+            /** Writes the cost multipliers of the cells in the rect, row by row, as used by getAdjacentCost().
+             * Missing cells are written as -1.
+             * @param rec A const reference to the Rect which specifies the size.
+             * @param costs A buffer with rec.w * rec.h values.
+             * @param costId The cost identifier whose cost is used for its cells, empty if none.
+             * @throws IndexOverflow if the buffer has a different size.
+             */
+            void getCostGrid(Rect const & rec, std::span<double> costs, std::string const & costId = "");
+
             /** Returns all cells in the circle.
              * @param center A const reference to the ModelCoordinate where the center of the circle is.
              * @param radius A unsigned integer, radius of the circle.
@@ -602,7 +643,27 @@ namespace FIFE
             void setSizeUpdate(bool update);
             void update();
 
+            /** Starts a bulk edit, e.g. for generating a map at runtime.
+             * Until the matching endBulkEdit() the size is not recalculated after instances were removed,
+             * cells update their blocking info only once and zones are not split or merged.
+             * Bulk edits can be nested.
+             */
+            void beginBulkEdit();
+
+            /** Ends a bulk edit. The outermost call recalculates the size if needed, updates the blocking
+             * info of the changed cells and rebuilds the zones and narrow cells.
+             */
+            void endBulkEdit();
+
+            /** Returns true while a bulk edit is running.
+             */
+            bool isBulkEdit() const;
+
         private:
+            friend class Cell;
+
+            struct CellChunk;
+
             using StringCellMultimap = std::multimap<std::string, Cell*>;
             using StringCellIterator = StringCellMultimap::iterator;
             using StringCellPair     = std::pair<StringCellIterator, StringCellIterator>;
@@ -611,6 +672,33 @@ namespace FIFE
              */
             Rect calculateCurrentSize();
 
+            /** Returns the index of the chunk that holds the coordinate, the coordinate has to be in range.
+             */
+            std::size_t getChunkIndex(ModelCoordinate const & mc) const;
+
+            /** Sets the chunk layout for the current size, keeps the chunks that are still in range.
+             * The capacity grows by half on the exceeded sides and only shrinks if less than a quarter is used.
+             * Dropped chunks give their number back.
+             */
+            void layoutChunks();
+
+            /** Searches the narrow cells and creates the zones of the cells that have none.
+             */
+            void createZones();
+
+            /** Constructs a cell in the store, the coordinate has to be in range and free.
+             * Creates and numbers the chunk if it is the first cell of it.
+             */
+            Cell* constructCell(ModelCoordinate const & mc);
+
+            /** Destroys a cell of the store.
+             */
+            void destroyCell(Cell* cell);
+
+            /** Collects the accessible neighbor offsets of the cell grid.
+             */
+            void updateNeighborOffsets();
+
             //! walkable layer
             Layer* m_layer;
 
@@ -623,8 +711,23 @@ namespace FIFE
             //! change listener
             std::unique_ptr<LayerChangeListener> m_cellListener;
 
-            // cells on this cache
-            std::vector<std::vector<std::unique_ptr<Cell>>> m_cells;
+            //! cell chunks in rows, nullptr if no cell of the chunk was created, covers at least m_size
+            std::vector<std::unique_ptr<CellChunk>> m_chunks;
+
+            //! chunk coordinates of the first chunk
+            Point m_chunkOrigin;
+
+            //! number of chunk columns
+            uint32_t m_chunkColumns;
+
+            //! number of chunk rows
+            uint32_t m_chunkRows;
+
+            //! chunks by number, nullptr if the number is free
+            std::vector<CellChunk*> m_chunkNumbers;
+
+            //! numbers of dropped chunks, reused by the next chunks
+            std::vector<int32_t> m_freeChunkNumbers;
 
             //! Rect holds the min and max size
             //! x = min.x, w = max.x, y = min.y, h = max.y
@@ -639,6 +742,21 @@ namespace FIFE
             //! max z value for neighbors
             int32_t m_neighborZ;
 
+            //! offsets of the accessible neighbors, for even and odd rows
+            std::array<std::vector<ModelCoordinate>, 2> m_neighborOffsets;
+
+            //! instances of the cells with more than one instance, sorted
+            std::unordered_map<Cell const *, std::vector<Instance*>> m_cellInstances;
+
+            //! listeners and transitions of cells
+            std::unordered_map<Cell const *, CellSideData> m_cellSideData;
+
+            //! number of running bulk edits
+            uint32_t m_bulkEdits;
+
+            //! cells whose blocking info waits for the end of the bulk edit
+            std::vector<ModelCoordinate> m_bulkCells;
+
             //! indicates blocking update
             bool m_blockingUpdate;
 
@@ -677,6 +795,9 @@ namespace FIFE
 
             //! holds default speed multiplier, only if it is not default(1.0)
             std::map<Cell*, double> m_speedMultipliers;
+
+            //! field of view, nullptr until requested
+            std::unique_ptr<FieldOfView> m_fieldOfView;
     };
 
 } // namespace FIFE
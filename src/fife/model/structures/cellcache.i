@@ -4,13 +4,42 @@
 %module fife
 %{
 #include "model/structures/cellcache.h"
+#include "model/structures/fieldofview.h"
 %}
 
 namespace FIFE {
 
 	class Cell;
+	class Instance;
 	class Layer;
 
+	class VisibilityMap {
+		public:
+			VisibilityMap();
+
+			bool isVisible(const ModelCoordinate& mc) const;
+			const ModelCoordinate& getOrigin() const;
+			uint16_t getRadius() const;
+			uint32_t getVisibleCount() const;
+			std::vector<ModelCoordinate> getVisibleCells() const;
+	};
+
+	class FieldOfView {
+		public:
+			void setDynamicBlockersOpaque(bool opaque);
+			bool isDynamicBlockersOpaque() const;
+			void computeVisibility(const ModelCoordinate& origin, uint16_t radius, VisibilityMap& visibility);
+			const VisibilityMap& getVisibility(Instance* viewer, uint16_t radius);
+			void updateVisibility(const std::vector<Instance*>& viewers, uint16_t radius);
+			std::vector<ModelCoordinate> getVisibleCells(const std::vector<Instance*>& viewers, uint16_t radius);
+			bool isInLineOfSight(const ModelCoordinate& from, const ModelCoordinate& to);
+			void removeViewer(Instance* viewer);
+			void clear();
+			std::size_t getViewerCount() const;
+		private:
+			FieldOfView(CellCache* cache);
+	};
+
 	class CellCache : public FifeClass {
 		public:
 			CellCache(Layer* layer);
@@ -18,16 +47,17 @@ namespace FIFE {
 			
 			void createCells();
 			void forceUpdate();
-			void addCell(Cell* cell);
 			Cell* createCell(const ModelCoordinate& mc);
 			Cell* getCell(const ModelCoordinate& mc);
 			void addInteractOnRuntime(Layer* interact);
 			void removeInteractOnRuntime(Layer* interact);
+			FieldOfView* getFieldOfView();
 			const Rect& getSize();
 			void setSize(const Rect& rec);
 			uint32_t getWidth();
 			uint32_t getHeight();
 			int32_t getMaxIndex() const;
+			std::size_t getMemoryUsage() const;
 			void setMaxNeighborZ(int32_t z);
 			int32_t getMaxNeighborZ();
 
@@ -70,5 +100,35 @@ namespace FIFE {
 			bool isCellInArea(const std::string& id, Cell* cell);
 			void setStaticSize(bool staticSize);
 			bool isStaticSize();
+			void beginBulkEdit();
+			void endBulkEdit();
+			bool isBulkEdit() const;
 	};
+
+	%extend CellCache {
+		PyObject* getCellTypes(const Rect& rec) {
+			Py_ssize_t const rows = std::max(rec.h, 0);
+			Py_ssize_t const columns = std::max(rec.w, 0);
+			std::size_t const count = static_cast<std::size_t>(rows * columns);
+			uint8_t* data = NULL;
+			PyObject* bytes = fifeNewBuffer(count, &data);
+			if (!bytes) {
+				return NULL;
+			}
+			$self->getCellTypes(rec, std::span<uint8_t>(data, count));
+			return fifeBufferView(bytes, "B", rows, columns);
+		}
+		PyObject* getCostGrid(const Rect& rec, const std::string& costId = "") {
+			Py_ssize_t const rows = std::max(rec.h, 0);
+			Py_ssize_t const columns = std::max(rec.w, 0);
+			std::size_t const count = static_cast<std::size_t>(rows * columns);
+			double* data = NULL;
+			PyObject* bytes = fifeNewBuffer(count, &data);
+			if (!bytes) {
+				return NULL;
+			}
+			$self->getCostGrid(rec, std::span<double>(data, count), costId);
+			return fifeBufferView(bytes, "d", rows, columns);
+		}
+	}
 }
\ No newline at end of file
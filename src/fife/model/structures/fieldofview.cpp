@@ -0,0 +1,540 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Corresponding header include
+#include "fieldofview.h"
+
+// Standard C++ library includes
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <utility>
+#include <vector>
+
+// 3rd party library includes
+
+// FIFE includes
+#include "cellcache.h"
+#include "instance.h"
+#include "layer.h"
+#include "model/metamodel/grids/cellgrid.h"
+
+namespace FIFE
+{
+    namespace
+    {
+        struct Axial
+        {
+                int32_t q;
+                int32_t r;
+        };
+
+        // hex grids without the axial flag shift every odd row to the right
+        Axial toAxial(ModelCoordinate const & mc, bool axial)
+        {
+            if (axial) {
+                return {.q = mc.x, .r = mc.y};
+            }
+            return {.q = mc.x - ((mc.y - (mc.y & 1)) / 2), .r = mc.y};
+        }
+
+        ModelCoordinate fromAxial(Axial const & hex, bool axial)
+        {
+            if (axial) {
+                return ModelCoordinate(hex.q, hex.r);
+            }
+            return ModelCoordinate(hex.q + ((hex.r - (hex.r & 1)) / 2), hex.r);
+        }
+
+        Axial roundAxial(double q, double r)
+        {
+            double const s  = -q - r;
+            double rq       = std::round(q);
+            double rr       = std::round(r);
+            double const rs = std::round(s);
+            double const dq = std::abs(rq - q);
+            double const dr = std::abs(rr - r);
+            double const ds = std::abs(rs - s);
+            if (dq > dr && dq > ds) {
+                rq = -rr - rs;
+            } else if (dr > ds) {
+                rr = -rq - rs;
+            }
+            return {.q = static_cast<int32_t>(rq), .r = static_cast<int32_t>(rr)};
+        }
+
+        uint64_t watchKey(int32_t x, int32_t y)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+        }
+    } // namespace
+
+    VisibilityMap::VisibilityMap() : m_radius(0), m_width(1), m_bits(1, 0)
+    {
+    }
+
+    void VisibilityMap::reset(ModelCoordinate const & origin, uint16_t radius)
+    {
+        m_origin = origin;
+        m_radius = radius;
+        m_width  = (2 * static_cast<int32_t>(radius)) + 1;
+        std::size_t const cells = static_cast<std::size_t>(m_width) * static_cast<std::size_t>(m_width);
+        m_bits.assign((cells + 63) / 64, 0);
+    }
+
+    int64_t VisibilityMap::index(ModelCoordinate const & mc) const
+    {
+        int32_t const x = mc.x - m_origin.x + m_radius;
+        int32_t const y = mc.y - m_origin.y + m_radius;
+        if (x < 0 || y < 0 || x >= m_width || y >= m_width) {
+            return -1;
+        }
+        return (static_cast<int64_t>(y) * m_width) + x;
+    }
+
+    void VisibilityMap::setVisible(ModelCoordinate const & mc)
+    {
+        int64_t const i = index(mc);
+        if (i >= 0) {
+            m_bits[static_cast<std::size_t>(i / 64)] |= uint64_t{1} << (i % 64);
+        }
+    }
+
+    bool VisibilityMap::isVisible(ModelCoordinate const & mc) const
+    {
+        int64_t const i = index(mc);
+        return i >= 0 && (m_bits[static_cast<std::size_t>(i / 64)] & (uint64_t{1} << (i % 64))) != 0;
+    }
+
+    ModelCoordinate const & VisibilityMap::getOrigin() const
+    {
+        return m_origin;
+    }
+
+    uint16_t VisibilityMap::getRadius() const
+    {
+        return m_radius;
+    }
+
+    uint32_t VisibilityMap::getVisibleCount() const
+    {
+        uint32_t count = 0;
+        for (uint64_t const word : m_bits) {
+            count += static_cast<uint32_t>(std::popcount(word));
+        }
+        return count;
+    }
+
+    std::vector<ModelCoordinate> VisibilityMap::getVisibleCells() const
+    {
+        std::vector<ModelCoordinate> cells;
+        cells.reserve(getVisibleCount());
+        for (std::size_t word = 0; word < m_bits.size(); ++word) {
+            uint64_t bits = m_bits[word];
+            while (bits != 0) {
+                int64_t const i = static_cast<int64_t>((word * 64) + static_cast<std::size_t>(std::countr_zero(bits)));
+                cells.emplace_back(
+                    m_origin.x - m_radius + static_cast<int32_t>(i % m_width),
+                    m_origin.y - m_radius + static_cast<int32_t>(i / m_width));
+                bits &= bits - 1;
+            }
+        }
+        return cells;
+    }
+
+    std::vector<uint64_t> const & VisibilityMap::getBits() const
+    {
+        return m_bits;
+    }
+
+    FieldOfView::FieldOfView(CellCache* cache) : m_cache(cache), m_dynamicOpaque(false)
+    {
+    }
+
+    FieldOfView::~FieldOfView()
+    {
+        clear();
+    }
+
+    void FieldOfView::setDynamicBlockersOpaque(bool opaque)
+    {
+        if (m_dynamicOpaque == opaque) {
+            return;
+        }
+        m_dynamicOpaque = opaque;
+        for (auto& [instance, viewer] : m_viewers) {
+            viewer.dirty = true;
+        }
+    }
+
+    bool FieldOfView::isDynamicBlockersOpaque() const
+    {
+        return m_dynamicOpaque;
+    }
+
+    bool FieldOfView::isOpaque(Cell const * cell) const
+    {
+        if (cell == nullptr) {
+            return true;
+        }
+        CellTypeInfo const type = cell->getCellType();
+        return type == CTYPE_STATIC_BLOCKER || type == CTYPE_CELL_BLOCKER ||
+               (m_dynamicOpaque && type == CTYPE_DYNAMIC_BLOCKER);
+    }
+
+    void FieldOfView::computeVisibility(ModelCoordinate const & origin, uint16_t radius, VisibilityMap& visibility)
+    {
+        visibility.reset(ModelCoordinate(origin.x, origin.y), radius);
+        if (m_cache->getCell(origin) == nullptr) {
+            return;
+        }
+        std::string const & type = m_cache->getLayer()->getCellGrid()->getType();
+        if (type == "hexagonal" || type == "hexagonal_axial") {
+            castHexRays(visibility, type == "hexagonal_axial");
+            return;
+        }
+
+        visibility.setVisible(origin);
+        // the eight octants, as multipliers for the row and column offsets
+        static constexpr std::array<std::array<int32_t, 8>, 4> octants = {{
+            {1, 0, 0, -1, -1, 0, 0, 1},
+            {0, 1, -1, 0, 0, -1, 1, 0},
+            {0, 1, 1, 0, 0, -1, -1, 0},
+            {1, 0, 0, 1, -1, 0, 0, -1},
+        }};
+        for (std::size_t i = 0; i < 8; ++i) {
+            castOctant(visibility, 1, 1.0, 0.0, octants[0][i], octants[1][i], octants[2][i], octants[3][i]);
+        }
+    }
+
+    void FieldOfView::castOctant(
+        VisibilityMap& visibility,
+        int32_t row,
+        double start,
+        double end,
+        int32_t xx,
+        int32_t xy,
+        int32_t yx,
+        int32_t yy) const
+    {
+        if (start < end) {
+            return;
+        }
+        ModelCoordinate const & origin = visibility.getOrigin();
+        int32_t const radius           = visibility.getRadius();
+        int64_t const limit            = static_cast<int64_t>(radius) * (radius + 1);
+        double newStart                = 0.0;
+        for (int32_t j = row; j <= radius; ++j) {
+            int32_t const dy = -j;
+            bool blocked     = false;
+            for (int32_t dx = -j; dx <= 0; ++dx) {
+                double const leftSlope  = (dx - 0.5) / (dy + 0.5);
+                double const rightSlope = (dx + 0.5) / (dy - 0.5);
+                if (start < rightSlope) {
+                    continue;
+                }
+                if (end > leftSlope) {
+                    break;
+                }
+                ModelCoordinate const mc(origin.x + (dx * xx) + (dy * xy), origin.y + (dx * yx) + (dy * yy));
+                Cell const * cell = m_cache->getCell(mc);
+                if (cell != nullptr && (static_cast<int64_t>(dx) * dx) + (static_cast<int64_t>(dy) * dy) <= limit) {
+                    visibility.setVisible(mc);
+                }
+                bool const opaque = isOpaque(cell);
+                if (blocked) {
+                    if (opaque) {
+                        newStart = rightSlope;
+                        continue;
+                    }
+                    blocked = false;
+                    start   = newStart;
+                } else if (opaque && j < radius) {
+                    // the cells behind the blocker are scanned with the narrowed slopes
+                    blocked = true;
+                    castOctant(visibility, j + 1, start, leftSlope, xx, xy, yx, yy);
+                    newStart = rightSlope;
+                }
+            }
+            if (blocked) {
+                break;
+            }
+        }
+    }
+
+    void FieldOfView::castHexRays(VisibilityMap& visibility, bool axial) const
+    {
+        ModelCoordinate const & origin = visibility.getOrigin();
+        int32_t const radius           = visibility.getRadius();
+        visibility.setVisible(origin);
+        if (radius == 0) {
+            return;
+        }
+        // the six axial directions, in the order the sides of a ring are walked
+        static constexpr std::array<Axial, 6> directions = {{
+            {.q = 1, .r = 0},
+            {.q = 1, .r = -1},
+            {.q = 0, .r = -1},
+            {.q = -1, .r = 0},
+            {.q = -1, .r = 1},
+            {.q = 0, .r = 1},
+        }};
+        Axial const center = toAxial(origin, axial);
+        Axial target       = {.q = center.q + (directions[4].q * radius), .r = center.r + (directions[4].r * radius)};
+        for (Axial const & direction : directions) {
+            for (int32_t step = 0; step < radius; ++step) {
+                // a ray from the center to the ring cell, the nudge keeps it off the cell edges
+                for (int32_t i = 1; i <= radius; ++i) {
+                    double const t = static_cast<double>(i) / radius;
+                    Axial const hex = roundAxial(
+                        center.q + ((target.q - center.q) * t) + 1e-6, center.r + ((target.r - center.r) * t) + 1e-6);
+                    ModelCoordinate const mc = fromAxial(hex, axial);
+                    Cell const * cell        = m_cache->getCell(mc);
+                    if (cell == nullptr) {
+                        break;
+                    }
+                    visibility.setVisible(mc);
+                    if (isOpaque(cell)) {
+                        break;
+                    }
+                }
+                target.q += direction.q;
+                target.r += direction.r;
+            }
+        }
+    }
+
+    VisibilityMap const & FieldOfView::getVisibility(Instance* viewer, uint16_t radius)
+    {
+        Viewer& entry                = getViewer(viewer);
+        ModelCoordinate const origin = getViewerCoordinate(viewer);
+        updateViewer(entry, origin, radius);
+        return entry.visibility;
+    }
+
+    void FieldOfView::updateVisibility(std::vector<Instance*> const & viewers, uint16_t radius)
+    {
+        // visibilities computed in this call, by origin
+        std::map<std::pair<int32_t, int32_t>, Viewer const *> computed;
+        for (Instance* instance : viewers) {
+            Viewer& entry                = getViewer(instance);
+            ModelCoordinate const origin = getViewerCoordinate(instance);
+            auto const key               = std::make_pair(origin.x, origin.y);
+            auto const it                = computed.find(key);
+            bool const moved =
+                entry.visibility.getOrigin() != origin || entry.visibility.getRadius() != radius;
+            if (it != computed.end() && (entry.dirty || moved)) {
+                if (moved) {
+                    unwatch(entry);
+                }
+                entry.visibility = it->second->visibility;
+                if (!entry.watching) {
+                    watch(entry);
+                }
+                entry.dirty = false;
+                continue;
+            }
+            updateViewer(entry, origin, radius);
+            computed.emplace(key, &entry);
+        }
+    }
+
+    std::vector<ModelCoordinate> FieldOfView::getVisibleCells(std::vector<Instance*> const & viewers, uint16_t radius)
+    {
+        updateVisibility(viewers, radius);
+        std::vector<ModelCoordinate> cells;
+        for (Instance* instance : viewers) {
+            std::vector<ModelCoordinate> const visible = m_viewers[instance].visibility.getVisibleCells();
+            cells.insert(cells.end(), visible.begin(), visible.end());
+        }
+        std::ranges::sort(cells, [](ModelCoordinate const & a, ModelCoordinate const & b) {
+            return a.y != b.y ? a.y < b.y : a.x < b.x;
+        });
+        auto const duplicates = std::ranges::unique(cells, [](ModelCoordinate const & a, ModelCoordinate const & b) {
+            return a.x == b.x && a.y == b.y;
+        });
+        cells.erase(duplicates.begin(), duplicates.end());
+        return cells;
+    }
+
+    bool FieldOfView::isInLineOfSight(ModelCoordinate const & from, ModelCoordinate const & to)
+    {
+        if (m_cache->getCell(from) == nullptr || m_cache->getCell(to) == nullptr) {
+            return false;
+        }
+        std::vector<ModelCoordinate> const coords = m_cache->getLayer()->getCellGrid()->getCoordinatesInLine(from, to);
+        if (coords.size() <= 2) {
+            return true;
+        }
+        return std::none_of(coords.begin() + 1, coords.end() - 1, [this](ModelCoordinate const & mc) {
+            return isOpaque(m_cache->getCell(mc));
+        });
+    }
+
+    void FieldOfView::removeViewer(Instance* viewer)
+    {
+        auto it = m_viewers.find(viewer);
+        if (it != m_viewers.end()) {
+            viewer->removeDeleteListener(this);
+            unwatch(it->second);
+            m_viewers.erase(it);
+        }
+    }
+
+    void FieldOfView::clear()
+    {
+        for (auto& [instance, viewer] : m_viewers) {
+            instance->removeDeleteListener(this);
+            unwatch(viewer);
+        }
+        m_viewers.clear();
+    }
+
+    std::size_t FieldOfView::getViewerCount() const
+    {
+        return m_viewers.size();
+    }
+
+    void FieldOfView::onInstanceEnteredCell(Cell* /*cell*/, Instance* /*instance*/)
+    {
+    }
+
+    void FieldOfView::onInstanceExitedCell(Cell* /*cell*/, Instance* /*instance*/)
+    {
+    }
+
+    void FieldOfView::onBlockingChangedCell(Cell* cell, CellTypeInfo /*type*/, bool /*blocks*/)
+    {
+        invalidate(cell->getLayerCoordinates());
+    }
+
+    void FieldOfView::onInstanceDeleted(Instance* instance)
+    {
+        auto it = m_viewers.find(instance);
+        if (it != m_viewers.end()) {
+            unwatch(it->second);
+            m_viewers.erase(it);
+        }
+    }
+
+    void FieldOfView::onCellCreated(Cell* cell)
+    {
+        WatchedCell* watched = invalidate(cell->getLayerCoordinates());
+        if (watched != nullptr) {
+            watched->cell = cell;
+            cell->addChangeListener(this);
+        }
+    }
+
+    void FieldOfView::onCellDestroyed(Cell* cell)
+    {
+        WatchedCell* watched = invalidate(cell->getLayerCoordinates());
+        if (watched != nullptr) {
+            watched->cell = nullptr;
+        }
+    }
+
+    void FieldOfView::onCellsReset()
+    {
+        // the viewers keep watching the coordinates, cells created later are observed again
+        for (auto& [key, watched] : m_watched) {
+            watched.cell = nullptr;
+        }
+        for (auto& [instance, viewer] : m_viewers) {
+            viewer.dirty = true;
+        }
+    }
+
+    FieldOfView::Viewer& FieldOfView::getViewer(Instance* instance)
+    {
+        auto const [it, inserted] = m_viewers.try_emplace(instance);
+        if (inserted) {
+            instance->addDeleteListener(this);
+        }
+        return it->second;
+    }
+
+    void FieldOfView::updateViewer(Viewer& viewer, ModelCoordinate const & origin, uint16_t radius)
+    {
+        bool const moved = viewer.visibility.getOrigin() != origin || viewer.visibility.getRadius() != radius;
+        if (!viewer.dirty && !moved) {
+            return;
+        }
+        if (moved) {
+            unwatch(viewer);
+        }
+        computeVisibility(origin, radius, viewer.visibility);
+        if (!viewer.watching) {
+            watch(viewer);
+        }
+        viewer.dirty = false;
+    }
+
+    void FieldOfView::watch(Viewer& viewer)
+    {
+        ModelCoordinate const & origin = viewer.visibility.getOrigin();
+        int32_t const radius           = viewer.visibility.getRadius();
+        ModelCoordinate mc;
+        for (mc.y = origin.y - radius; mc.y <= origin.y + radius; ++mc.y) {
+            for (mc.x = origin.x - radius; mc.x <= origin.x + radius; ++mc.x) {
+                WatchedCell& watched = m_watched[watchKey(mc.x, mc.y)];
+                if (watched.viewers.empty()) {
+                    watched.cell = m_cache->getCell(mc);
+                    if (watched.cell != nullptr) {
+                        watched.cell->addChangeListener(this);
+                    }
+                }
+                watched.viewers.push_back(&viewer);
+            }
+        }
+        viewer.watching = true;
+    }
+
+    void FieldOfView::unwatch(Viewer& viewer)
+    {
+        if (!viewer.watching) {
+            return;
+        }
+        ModelCoordinate const & origin = viewer.visibility.getOrigin();
+        int32_t const radius           = viewer.visibility.getRadius();
+        for (int32_t y = origin.y - radius; y <= origin.y + radius; ++y) {
+            for (int32_t x = origin.x - radius; x <= origin.x + radius; ++x) {
+                auto it = m_watched.find(watchKey(x, y));
+                if (it == m_watched.end()) {
+                    continue;
+                }
+                std::erase(it->second.viewers, &viewer);
+                if (it->second.viewers.empty()) {
+                    if (it->second.cell != nullptr) {
+                        it->second.cell->removeChangeListener(this);
+                    }
+                    m_watched.erase(it);
+                }
+            }
+        }
+        viewer.watching = false;
+    }
+
+    FieldOfView::WatchedCell* FieldOfView::invalidate(ModelCoordinate const & mc)
+    {
+        auto it = m_watched.find(watchKey(mc.x, mc.y));
+        if (it == m_watched.end()) {
+            return nullptr;
+        }
+        for (Viewer* viewer : it->second.viewers) {
+            viewer->dirty = true;
+        }
+        return &it->second;
+    }
+
+    ModelCoordinate FieldOfView::getViewerCoordinate(Instance* viewer) const
+    {
+        ModelCoordinate const mc = viewer->getLocationRef().getLayerCoordinates(m_cache->getLayer());
+        return ModelCoordinate(mc.x, mc.y);
+    }
+
+} // namespace FIFE
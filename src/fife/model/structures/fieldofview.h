@@ -0,0 +1,234 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+#ifndef FIFE_FIELDOFVIEW_H
+#define FIFE_FIELDOFVIEW_H
+
+// Platform specific includes
+#include "platform.h"
+
+// Standard C++ library includes
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// 3rd party library includes
+
+// FIFE includes
+#include "cell.h"
+#include "instance.h"
+#include "model/metamodel/modelcoords.h"
+
+namespace FIFE
+{
+
+    class CellCache;
+
+    /** The cells visible from an origin, as a bitmap over the square of cells around the origin.
+     */
+    class FIFE_API VisibilityMap
+    {
+        public:
+            VisibilityMap();
+
+            /** Forgets the visible cells and sets the square the map covers.
+             * @param origin The cell the cells are seen from.
+             * @param radius The distance to the border of the square.
+             */
+            void reset(ModelCoordinate const & origin, uint16_t radius);
+
+            /** Marks a cell as visible, cells outside of the square are ignored.
+             */
+            void setVisible(ModelCoordinate const & mc);
+
+            /** Returns true if the cell is visible.
+             */
+            bool isVisible(ModelCoordinate const & mc) const;
+
+            ModelCoordinate const & getOrigin() const;
+            uint16_t getRadius() const;
+
+            /** Returns the number of visible cells.
+             */
+            uint32_t getVisibleCount() const;
+
+            /** Returns the visible cells, row by row.
+             */
+            std::vector<ModelCoordinate> getVisibleCells() const;
+
+            /** Returns the bitmap. The (2 * radius + 1)^2 cells of the square are numbered row by row from the
+             * upper left, cell i is bit i % 64 of word i / 64.
+             */
+            std::vector<uint64_t> const & getBits() const;
+
+        private:
+            /** Returns the number of the cell or -1 if it is outside of the square.
+             */
+            int64_t index(ModelCoordinate const & mc) const;
+
+            ModelCoordinate m_origin;
+            uint16_t m_radius;
+            int32_t m_width;
+            std::vector<uint64_t> m_bits;
+    };
+
+    /** Field of view and line of sight on a CellCache.
+     *
+     * Cells with a static blocker or the CTYPE_CELL_BLOCKER type block the sight, dynamic blockers
+     * only if enabled. Missing cells block too and are never visible. On square grids the visible cells are found by
+     * recursive shadowcasting, on hex grids by casting a ray to every cell of the outer ring.
+     * The visible area is a circle with the same rounding as CellCache::getCellsInCircle(), on hex
+     * grids all cells within radius steps.
+     *
+     * The visibility of a viewer is cached until it moves or a cell in its range changes its
+     * blocking type, which is observed with a CellChangeListener on these cells. Viewers are
+     * forgotten when their instance is deleted.
+     */
+    class FIFE_API FieldOfView : public CellChangeListener, public InstanceDeleteListener
+    {
+        public:
+            /** Constructor
+             * @param cache The CellCache that holds the cells, the field of view has to be destroyed first.
+             */
+            explicit FieldOfView(CellCache* cache);
+            ~FieldOfView() override;
+
+            FieldOfView(FieldOfView const &)            = delete;
+            FieldOfView& operator=(FieldOfView const &) = delete;
+
+            /** Sets whether dynamic blockers, e.g. moving instances, block the sight. Disabled by default.
+             */
+            void setDynamicBlockersOpaque(bool opaque);
+            bool isDynamicBlockersOpaque() const;
+
+            /** Computes the cells visible from a cell, without caching.
+             * @param origin The cell the cells are seen from, nothing is visible if it does not exist.
+             * @param radius The view range in cells.
+             * @param visibility The map that is filled.
+             */
+            void computeVisibility(ModelCoordinate const & origin, uint16_t radius, VisibilityMap& visibility);
+
+            /** Returns the cells visible to a viewer.
+             * The result is cached and only computed again if the viewer moved, the radius is different or
+             * a cell in range changed its blocking type.
+             * @param viewer The instance that sees, its location is converted to the layer of the CellCache.
+             * @param radius The view range in cells.
+             * @return The visibility, valid until the viewer is queried again or removed.
+             */
+            VisibilityMap const & getVisibility(Instance* viewer, uint16_t radius);
+
+            /** Updates the cached visibility of many viewers, viewers on the same cell share the computation.
+             * @param viewers The instances that see.
+             * @param radius The view range in cells.
+             */
+            void updateVisibility(std::vector<Instance*> const & viewers, uint16_t radius);
+
+            /** Returns the cells visible to any of the viewers, the cached visibilities are updated.
+             * @param viewers The instances that see.
+             * @param radius The view range in cells.
+             * @return A vector that contain the visible cells, each once.
+             */
+            std::vector<ModelCoordinate> getVisibleCells(std::vector<Instance*> const & viewers, uint16_t radius);
+
+            /** Checks whether no cell between two cells blocks the sight.
+             * The cells of the line are the ones of CellCache::getCellsInLine().
+             * @return True if both cells exist and the cells between them do not block the sight.
+             */
+            bool isInLineOfSight(ModelCoordinate const & from, ModelCoordinate const & to);
+
+            /** Forgets the cached visibility of a viewer. Deleted instances are removed automatically.
+             */
+            void removeViewer(Instance* viewer);
+
+            /** Forgets all cached visibilities.
+             */
+            void clear();
+
+            /** Returns the number of viewers with a cached visibility.
+             */
+            std::size_t getViewerCount() const;
+
+            void onInstanceEnteredCell(Cell* cell, Instance* instance) override;
+            void onInstanceExitedCell(Cell* cell, Instance* instance) override;
+            void onBlockingChangedCell(Cell* cell, CellTypeInfo type, bool blocks) override;
+
+            void onInstanceDeleted(Instance* instance) override;
+
+            /** Called by the CellCache after a cell was created.
+             */
+            void onCellCreated(Cell* cell);
+
+            /** Called by the CellCache before a cell is destroyed.
+             */
+            void onCellDestroyed(Cell* cell);
+
+            /** Called by the CellCache before all cells are destroyed.
+             */
+            void onCellsReset();
+
+        private:
+            struct Viewer
+            {
+                    VisibilityMap visibility;
+                    // the square of the visibility is in m_watched
+                    bool watching = false;
+                    bool dirty    = true;
+            };
+
+            /** A coordinate in the square of at least one viewer.
+             */
+            struct WatchedCell
+            {
+                    // nullptr if the cell does not exist, otherwise this is a listener of it
+                    Cell* cell = nullptr;
+                    std::vector<Viewer*> viewers;
+            };
+
+            /** Returns true if the cell blocks the sight, missing cells do.
+             */
+            bool isOpaque(Cell const * cell) const;
+
+            /** Scans an octant of a square grid, rows from row on between the slopes start and end.
+             */
+            void castOctant(
+                VisibilityMap& visibility,
+                int32_t row,
+                double start,
+                double end,
+                int32_t xx,
+                int32_t xy,
+                int32_t yx,
+                int32_t yy) const;
+
+            void castHexRays(VisibilityMap& visibility, bool axial) const;
+
+            /** Returns the cached visibility of an instance, adds it as viewer if needed.
+             */
+            Viewer& getViewer(Instance* instance);
+
+            /** Computes the visibility of a viewer and observes the cells in its range.
+             */
+            void updateViewer(Viewer& viewer, ModelCoordinate const & origin, uint16_t radius);
+
+            void watch(Viewer& viewer);
+            void unwatch(Viewer& viewer);
+
+            /** Marks the viewers whose square contains the coordinate as dirty.
+             * @return The entry of the coordinate, nullptr if no viewer watches it.
+             */
+            WatchedCell* invalidate(ModelCoordinate const & mc);
+
+            ModelCoordinate getViewerCoordinate(Instance* viewer) const;
+
+            CellCache* m_cache;
+            bool m_dynamicOpaque;
+            // node based, the Viewer pointers in m_watched stay valid
+            std::unordered_map<Instance*, Viewer> m_viewers;
+            // the viewers whose square contains a coordinate, by watchKey()
+            std::unordered_map<uint64_t, WatchedCell> m_watched;
+    };
+
+} // namespace FIFE
+
+#endif
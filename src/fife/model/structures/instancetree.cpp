@@ -6,6 +6,9 @@
 
 // Standard C++ library includes
 #include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
 
 // 3rd party library includes
 
@@ -13,6 +16,7 @@
 #include "model/structures/instance.h"
 #include "util/base/exception.h"
 #include "util/log/logger.h"
+#include "util/math/angles.h"
 #include "util/structures/rect.h"
 
 namespace FIFE
@@ -24,6 +28,41 @@ namespace FIFE
             static Logger log(LM_STRUCTURES);
             return log;
         }
+
+        /** Returns the squared distance limit of a circle, see InstanceTree::findInstancesInCircle.
+         */
+        int64_t circleLimit(uint16_t radius)
+        {
+            return static_cast<int64_t>(radius) * (static_cast<int64_t>(radius) + 1);
+        }
+
+        int64_t distanceSquared(ModelCoordinate const & a, ModelCoordinate const & b)
+        {
+            int64_t const dx = static_cast<int64_t>(a.x) - b.x;
+            int64_t const dy = static_cast<int64_t>(a.y) - b.y;
+            return (dx * dx) + (dy * dy);
+        }
+
+        /** Returns the squared distance between a cell and the nearest cell of a node.
+         */
+        int64_t nearestDistanceSquared(InstanceTree::InstanceTreeNode const * node, ModelCoordinate const & cell)
+        {
+            int32_t const last = node->size() - 1;
+            ModelCoordinate const nearest(
+                std::clamp(cell.x, node->x(), node->x() + last), std::clamp(cell.y, node->y(), node->y() + last));
+            return distanceSquared(cell, nearest);
+        }
+
+        /** Returns the squared distance between a cell and the farthest cell of a node.
+         */
+        int64_t farthestDistanceSquared(InstanceTree::InstanceTreeNode const * node, ModelCoordinate const & cell)
+        {
+            int32_t const last = node->size() - 1;
+            ModelCoordinate const farthest(
+                cell.x - node->x() > node->x() + last - cell.x ? node->x() : node->x() + last,
+                cell.y - node->y() > node->y() + last - cell.y ? node->y() : node->y() + last);
+            return distanceSquared(cell, farthest);
+        }
     } // namespace
 
     InstanceTree::InstanceTree() = default;
@@ -110,4 +149,240 @@ namespace FIFE
         }
     }
 
+    /** Collects the instances within a circle, a ring or a circle sector.
+     */
+    class RadialCollector
+    {
+        public:
+            std::vector<Instance*>* instances;
+            ModelCoordinate center;
+            // cells with a squared distance in (innerLimit, outerLimit] are collected
+            int64_t outerLimit;
+            int64_t innerLimit;
+            bool sector;
+            int32_t startAngle;
+            int32_t endAngle;
+            RadialCollector(
+                std::vector<Instance*>* a_instances,
+                ModelCoordinate const & a_center,
+                int64_t a_outerLimit,
+                int64_t a_innerLimit) :
+                instances(a_instances),
+                center(a_center),
+                outerLimit(a_outerLimit),
+                innerLimit(a_innerLimit),
+                sector(false),
+                startAngle(0),
+                endAngle(0)
+            {
+            }
+            bool visit(InstanceTree::InstanceTreeNode* node, int32_t d) const;
+    };
+
+    bool RadialCollector::visit(InstanceTree::InstanceTreeNode* node, [[maybe_unused]] int32_t d) const
+    {
+        if (nearestDistanceSquared(node, center) > outerLimit || farthestDistanceSquared(node, center) <= innerLimit) {
+            return false;
+        }
+        ExactModelCoordinate const exactCenter(center.x, center.y);
+        for (auto* instance : node->data()) {
+            ModelCoordinate const coords = instance->getLocationRef().getLayerCoordinates();
+            int64_t const distance       = distanceSquared(center, coords);
+            if (distance > outerLimit || distance <= innerLimit) {
+                continue;
+            }
+            if (sector) {
+                int32_t const angle = getAngleBetween(exactCenter, intPt2doublePt(coords));
+                if (startAngle > endAngle ? (angle < startAngle && angle > endAngle) :
+                                            (angle < startAngle || angle > endAngle)) {
+                    continue;
+                }
+            }
+            instances->push_back(instance);
+        }
+        return true;
+    }
+
+    /** Collects the instances within a set of cells.
+     */
+    class CellsCollector
+    {
+        public:
+            struct CellIndex
+            {
+                    int32_t x;
+                    int32_t y;
+                    size_t index;
+            };
+            // the cells sorted by x and y
+            std::vector<CellIndex> cells;
+            // the found instances with the index of their cell
+            std::vector<std::pair<size_t, Instance*>> hits;
+            explicit CellsCollector(std::vector<ModelCoordinate> const & a_cells);
+            bool visit(InstanceTree::InstanceTreeNode* node, int32_t d);
+    };
+
+    CellsCollector::CellsCollector(std::vector<ModelCoordinate> const & a_cells)
+    {
+        cells.reserve(a_cells.size());
+        for (size_t i = 0; i < a_cells.size(); ++i) {
+            cells.push_back({.x = a_cells[i].x, .y = a_cells[i].y, .index = i});
+        }
+        // stable, so the first index of a duplicated cell comes first
+        std::ranges::stable_sort(cells, [](CellIndex const & a, CellIndex const & b) {
+            return a.x != b.x ? a.x < b.x : a.y < b.y;
+        });
+    }
+
+    bool CellsCollector::visit(InstanceTree::InstanceTreeNode* node, [[maybe_unused]] int32_t d)
+    {
+        auto const byX = [](CellIndex const & cell, int32_t x) {
+            return cell.x < x;
+        };
+        int32_t const right  = node->x() + node->size();
+        int32_t const bottom = node->y() + node->size();
+        bool nodeHasCell     = false;
+        auto it              = std::lower_bound(cells.begin(), cells.end(), node->x(), byX);
+        for (; it != cells.end() && it->x < right; ++it) {
+            if (it->y >= node->y() && it->y < bottom) {
+                nodeHasCell = true;
+                break;
+            }
+        }
+        if (!nodeHasCell) {
+            return false;
+        }
+        for (auto* instance : node->data()) {
+            ModelCoordinate const coords = instance->getLocationRef().getLayerCoordinates();
+            auto cell                    = std::lower_bound(cells.begin(), cells.end(), coords.x, byX);
+            for (; cell != cells.end() && cell->x == coords.x; ++cell) {
+                if (cell->y == coords.y) {
+                    hits.emplace_back(cell->index, instance);
+                    break;
+                }
+            }
+        }
+        return true;
+    }
+
+    /** Collects the instances within many circles of the same radius.
+     */
+    class CirclesCollector
+    {
+        public:
+            std::vector<ModelCoordinate> const * centers;
+            std::vector<std::vector<Instance*>>* instances;
+            int64_t limit;
+            // indices of the centers whose circle overlaps the node visited last at each depth
+            std::vector<std::vector<uint32_t>> active;
+            CirclesCollector(
+                std::vector<ModelCoordinate> const * a_centers,
+                std::vector<std::vector<Instance*>>* a_instances,
+                int64_t a_limit) :
+                centers(a_centers), instances(a_instances), limit(a_limit)
+            {
+            }
+            bool visit(InstanceTree::InstanceTreeNode* node, int32_t d);
+    };
+
+    bool CirclesCollector::visit(InstanceTree::InstanceTreeNode* node, int32_t d)
+    {
+        // the visit is depth first, so the last node visited one level up is the parent
+        size_t const depth = static_cast<size_t>(d);
+        if (active.size() <= depth) {
+            active.resize(depth + 1);
+        }
+        std::vector<uint32_t>& current = active[depth];
+        current.clear();
+        if (depth == 0) {
+            for (uint32_t i = 0; i < centers->size(); ++i) {
+                if (nearestDistanceSquared(node, (*centers)[i]) <= limit) {
+                    current.push_back(i);
+                }
+            }
+        } else {
+            for (uint32_t const i : active[depth - 1]) {
+                if (nearestDistanceSquared(node, (*centers)[i]) <= limit) {
+                    current.push_back(i);
+                }
+            }
+        }
+        if (current.empty()) {
+            return false;
+        }
+        for (auto* instance : node->data()) {
+            ModelCoordinate const coords = instance->getLocationRef().getLayerCoordinates();
+            for (uint32_t const i : current) {
+                if (distanceSquared((*centers)[i], coords) <= limit) {
+                    (*instances)[i].push_back(instance);
+                }
+            }
+        }
+        return true;
+    }
+
+    void InstanceTree::findInstancesInCircle(
+        ModelCoordinate const & center, uint16_t radius, std::vector<Instance*>& instances)
+    {
+        findInstancesInAnnulus(center, 0, radius, instances);
+    }
+
+    void InstanceTree::findInstancesInAnnulus(
+        ModelCoordinate const & center, uint16_t innerRadius, uint16_t outerRadius, std::vector<Instance*>& instances)
+    {
+        instances.clear();
+        int64_t const innerLimit = innerRadius == 0 ? -1 : circleLimit(innerRadius - 1);
+        RadialCollector collector(&instances, center, circleLimit(outerRadius), innerLimit);
+        m_tree.apply_visitor(collector);
+    }
+
+    void InstanceTree::findInstancesInSector(
+        ModelCoordinate const & center,
+        uint16_t radius,
+        int32_t sangle,
+        int32_t eangle,
+        std::vector<Instance*>& instances)
+    {
+        instances.clear();
+        RadialCollector collector(&instances, center, circleLimit(radius), -1);
+        collector.sector     = true;
+        collector.startAngle = ((sangle % 360) + 360) % 360;
+        collector.endAngle   = ((eangle % 360) + 360) % 360;
+        m_tree.apply_visitor(collector);
+    }
+
+    void InstanceTree::findInstancesInCells(
+        std::vector<ModelCoordinate> const & cells, std::vector<Instance*>& instances)
+    {
+        instances.clear();
+        if (cells.empty()) {
+            return;
+        }
+        CellsCollector collector(cells);
+        m_tree.apply_visitor(collector);
+        std::ranges::stable_sort(collector.hits, [](auto const & a, auto const & b) {
+            return a.first < b.first;
+        });
+        instances.reserve(collector.hits.size());
+        for (auto const & hit : collector.hits) {
+            instances.push_back(hit.second);
+        }
+    }
+
+    void InstanceTree::findInstancesInCircles(
+        std::vector<ModelCoordinate> const & centers,
+        uint16_t radius,
+        std::vector<std::vector<Instance*>>& instances)
+    {
+        instances.resize(centers.size());
+        for (auto& list : instances) {
+            list.clear();
+        }
+        if (centers.empty()) {
+            return;
+        }
+        CirclesCollector collector(&centers, &instances, circleLimit(radius));
+        m_tree.apply_visitor(collector);
+    }
+
 } // namespace FIFE
@@ -10,6 +10,7 @@
 // Standard C++ library includes
 #include <list>
 #include <map>
+#include <vector>
 
 // 3rd party library includes
 
@@ -72,6 +73,66 @@ namespace FIFE
              */
             void findInstances(ModelCoordinate const & point, int32_t w, int32_t h, InstanceList& list);
 
+            /** Find all instances in a circle.
+             *
+             * A cell is part of the circle if dx * dx + dy * dy <= radius * (radius + 1).
+             * The tree is traversed once, nodes outside the circle are skipped.
+             *
+             * @param center The center cell of the circle.
+             * @param radius The radius of the circle in cells.
+             * @param instances vector reference that will be filled with all instances within the circle.
+             */
+            void findInstancesInCircle(
+                ModelCoordinate const & center, uint16_t radius, std::vector<Instance*>& instances);
+
+            /** Find all instances in a ring, that is a circle without the circle of innerRadius - 1.
+             *
+             * @param center The center cell of the ring.
+             * @param innerRadius Cells nearer to the center are not part of the ring, 0 includes the center.
+             * @param outerRadius The radius of the outer circle in cells.
+             * @param instances vector reference that will be filled with all instances within the ring.
+             */
+            void findInstancesInAnnulus(
+                ModelCoordinate const & center,
+                uint16_t innerRadius,
+                uint16_t outerRadius,
+                std::vector<Instance*>& instances);
+
+            /** Find all instances in a circle sector.
+             *
+             * @param center The center cell of the circle.
+             * @param radius The radius of the circle in cells.
+             * @param sangle The start angle of the sector in degrees.
+             * @param eangle The end angle of the sector in degrees, the sector wraps around 360.
+             * @param instances vector reference that will be filled with all instances within the sector.
+             */
+            void findInstancesInSector(
+                ModelCoordinate const & center,
+                uint16_t radius,
+                int32_t sangle,
+                int32_t eangle,
+                std::vector<Instance*>& instances);
+
+            /** Find all instances in the given cells, e.g. the cells of a line.
+             *
+             * The tree is traversed once, nodes without any of the cells are skipped.
+             *
+             * @param cells The cells to search.
+             * @param instances vector reference that will be filled with the instances, in the order of the cells.
+             */
+            void findInstancesInCells(std::vector<ModelCoordinate> const & cells, std::vector<Instance*>& instances);
+
+            /** Find the instances in many circles of the same radius with one traversal.
+             *
+             * @param centers The center cells of the circles.
+             * @param radius The radius of the circles in cells.
+             * @param instances Filled with one vector per center, holding the instances within its circle.
+             */
+            void findInstancesInCircles(
+                std::vector<ModelCoordinate> const & centers,
+                uint16_t radius,
+                std::vector<std::vector<Instance*>>& instances);
+
             /** See QuadNode::apply_visitor
              */
             template <typename Visitor>
@@ -6,11 +6,14 @@
 
 // Standard C++ library includes
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstddef>
 #include <limits>
 #include <list>
 #include <memory>
 #include <set>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -24,9 +27,12 @@
 #include "instancetree.h"
 #include "map.h"
 #include "model/metamodel/grids/cellgrid.h"
+#include "tilegrid.h"
 #include "trigger.h"
+#include "util/base/exception.h"
 #include "util/log/logger.h"
 #include "util/structures/purge.h"
+#include "util/time/profiler.h"
 
 namespace FIFE
 {
@@ -40,6 +46,14 @@ namespace FIFE
             static Logger log(LM_STRUCTURES);
             return log;
         }
+
+        void checkBufferSize(std::size_t size, std::size_t expected)
+        {
+            if (size != expected) {
+                throw IndexOverflow(
+                    "buffer holds " + std::to_string(size) + " values, expected " + std::to_string(expected));
+            }
+        }
     } // namespace
 
     Layer::Layer(std::string identifier, Map* map, CellGrid* grid) :
@@ -242,6 +256,56 @@ namespace FIFE
         return m_instances;
     }
 
+    void Layer::getInstanceIds(std::span<uint64_t> ids) const
+    {
+        checkBufferSize(ids.size(), m_instances.size());
+        for (std::size_t i = 0; i < m_instances.size(); ++i) {
+            ids[i] = m_instances[i]->getId();
+        }
+    }
+
+    void Layer::getInstancePositions(std::span<double> positions) const
+    {
+        checkBufferSize(positions.size(), m_instances.size() * 3);
+        for (std::size_t i = 0; i < m_instances.size(); ++i) {
+            ExactModelCoordinate const pos = m_instances[i]->getLocation().getExactLayerCoordinates();
+            positions[(i * 3)]             = pos.x;
+            positions[(i * 3) + 1]         = pos.y;
+            positions[(i * 3) + 2]         = pos.z;
+        }
+    }
+
+    void Layer::getInstanceRotations(std::span<int32_t> rotations) const
+    {
+        checkBufferSize(rotations.size(), m_instances.size());
+        for (std::size_t i = 0; i < m_instances.size(); ++i) {
+            rotations[i] = m_instances[i]->getRotation();
+        }
+    }
+
+    void Layer::setInstancePositions(std::span<double const> positions)
+    {
+        checkBufferSize(positions.size(), m_instances.size() * 3);
+        Location location(this);
+        for (std::size_t i = 0; i < m_instances.size(); ++i) {
+            ExactModelCoordinate const pos(positions[(i * 3)], positions[(i * 3) + 1], positions[(i * 3) + 2]);
+            Location const & current = m_instances[i]->getLocation();
+            if (current.getLayer() == this && current.getExactLayerCoordinates() == pos) {
+                continue;
+            }
+            location.setExactLayerCoordinates(pos);
+            m_instances[i]->setLocation(location);
+        }
+    }
+
+    void Layer::setInstanceRotations(std::span<int32_t const> rotations)
+    {
+        checkBufferSize(rotations.size(), m_instances.size());
+        for (std::size_t i = 0; i < m_instances.size(); ++i) {
+            m_instances[i]->setRotation(rotations[i]);
+        }
+    }
+
     void Layer::setInstanceActivityStatus(Instance* instance, bool active)
     {
         if (active) {
@@ -307,77 +371,22 @@ namespace FIFE
     std::vector<Instance*> Layer::getInstancesInLine(ModelCoordinate const & pt1, ModelCoordinate const & pt2)
     {
         std::vector<Instance*> instances;
-        std::list<Instance*> matchingInstances;
-        std::vector<ModelCoordinate> const coords = m_grid->getCoordinatesInLine(pt1, pt2);
-        for (auto const & coord : coords) {
-            m_instanceTree->findInstances(coord, 0, 0, matchingInstances);
-            if (!matchingInstances.empty()) {
-                instances.insert(instances.end(), matchingInstances.begin(), matchingInstances.end());
-            }
-        }
+        m_instanceTree->findInstancesInCells(m_grid->getCoordinatesInLine(pt1, pt2), instances);
         return instances;
     }
 
     std::vector<Instance*> Layer::getInstancesInCircle(ModelCoordinate const & center, uint16_t radius)
     {
         std::vector<Instance*> instances;
-        std::list<Instance*> matchingInstances;
-        // radius power 2
-        int32_t const radiusp2 = static_cast<int32_t>(radius + 1) * static_cast<int32_t>(radius);
-
-        ModelCoordinate current(center.x - radius, center.y - radius);
-        ModelCoordinate const target(center.x + radius, center.y + radius);
-        for (; current.y < center.y; current.y++) {
-            current.x = center.x - radius;
-            for (; current.x < center.x; current.x++) {
-                int32_t const dx       = center.x - current.x;
-                int32_t const dy       = center.y - current.y;
-                int32_t const distance = (dx * dx) + (dy * dy);
-                if (distance <= radiusp2) {
-                    m_instanceTree->findInstances(current, 0, 0, matchingInstances);
-                    if (!matchingInstances.empty()) {
-                        instances.insert(instances.end(), matchingInstances.begin(), matchingInstances.end());
-                    }
-
-                    current.x = center.x + dx;
-                    m_instanceTree->findInstances(current, 0, 0, matchingInstances);
-                    if (!matchingInstances.empty()) {
-                        instances.insert(instances.end(), matchingInstances.begin(), matchingInstances.end());
-                    }
-
-                    current.y = center.y + dy;
-                    m_instanceTree->findInstances(current, 0, 0, matchingInstances);
-                    if (!matchingInstances.empty()) {
-                        instances.insert(instances.end(), matchingInstances.begin(), matchingInstances.end());
-                    }
-
-                    current.x = center.x - dx;
-                    m_instanceTree->findInstances(current, 0, 0, matchingInstances);
-                    if (!matchingInstances.empty()) {
-                        instances.insert(instances.end(), matchingInstances.begin(), matchingInstances.end());
-                    }
-
-                    current.y = center.y - dy;
-                }
-            }
-        }
-        current.x = center.x;
-        current.y = center.y - radius;
-        for (; current.y <= target.y; current.y++) {
-            m_instanceTree->findInstances(current, 0, 0, matchingInstances);
-            if (!matchingInstances.empty()) {
-                instances.insert(instances.end(), matchingInstances.begin(), matchingInstances.end());
-            }
-        }
+        m_instanceTree->findInstancesInCircle(center, radius, instances);
+        return instances;
+    }
 
-        current.y = center.y;
-        current.x = center.x - radius;
-        for (; current.x <= target.x; current.x++) {
-            m_instanceTree->findInstances(current, 0, 0, matchingInstances);
-            if (!matchingInstances.empty()) {
-                instances.insert(instances.end(), matchingInstances.begin(), matchingInstances.end());
-            }
-        }
+    std::vector<Instance*> Layer::getInstancesInAnnulus(
+        ModelCoordinate const & center, uint16_t innerRadius, uint16_t outerRadius)
+    {
+        std::vector<Instance*> instances;
+        m_instanceTree->findInstancesInAnnulus(center, innerRadius, outerRadius, instances);
         return instances;
     }
 
@@ -385,24 +394,15 @@ namespace FIFE
         ModelCoordinate const & center, uint16_t radius, int32_t sangle, int32_t eangle)
     {
         std::vector<Instance*> instances;
-        ExactModelCoordinate const exactCenter(center.x, center.y);
-        std::vector<Instance*> tmpInstances = getInstancesInCircle(center, radius);
-        int32_t const s                     = (sangle + 360) % 360;
-        int32_t const e                     = (eangle + 360) % 360;
-        bool const greater                  = s > e;
-        for (auto& tmpInstance : tmpInstances) {
-            int32_t const angle =
-                getAngleBetween(exactCenter, intPt2doublePt(tmpInstance->getLocationRef().getLayerCoordinates()));
-            if (greater) {
-                if (angle >= s || angle <= e) {
-                    instances.push_back(tmpInstance);
-                }
-            } else {
-                if (angle >= s && angle <= e) {
-                    instances.push_back(tmpInstance);
-                }
-            }
-        }
+        m_instanceTree->findInstancesInSector(center, radius, sangle, eangle, instances);
+        return instances;
+    }
+
+    std::vector<std::vector<Instance*>> Layer::getInstancesInCircles(
+        std::vector<ModelCoordinate> const & centers, uint16_t radius)
+    {
+        std::vector<std::vector<Instance*>> instances;
+        m_instanceTree->findInstancesInCircles(centers, radius, instances);
         return instances;
     }
 
@@ -415,6 +415,29 @@ namespace FIFE
         if (m_instances.empty()) {
             min = ModelCoordinate();
             max = min;
+        } else if (layer == this) {
+            // the cells of all instances in one batch
+            std::size_t const count = m_instances.size();
+            std::vector<double> x(count);
+            std::vector<double> y(count);
+            std::vector<double> z(count);
+            for (std::size_t i = 0; i < count; ++i) {
+                ExactModelCoordinate const & exact = m_instances[i]->getLocationRef().getExactLayerCoordinates();
+                x[i]                               = exact.x;
+                y[i]                               = exact.y;
+                z[i]                               = exact.z;
+            }
+            std::vector<ModelCoordinate> cells(count);
+            m_grid->toLayerCoordinatesFromExactLayerCoordinates(x, y, z, cells);
+
+            min = cells.front();
+            max = min;
+            for (ModelCoordinate const & coord : cells) {
+                min.x = std::min(min.x, coord.x);
+                max.x = std::max(max.x, coord.x);
+                min.y = std::min(min.y, coord.y);
+                max.y = std::max(max.y, coord.y);
+            }
         } else {
             min = m_instances.front()->getLocationRef().getLayerCoordinates(layer);
             max = min;
@@ -427,6 +450,30 @@ namespace FIFE
                 max.y                       = std::max(max.y, coord.y);
             }
         }
+
+        ModelCoordinate tileMin;
+        ModelCoordinate tileMax;
+        if (m_tileGrid == nullptr || !m_tileGrid->getBounds(tileMin, tileMax)) {
+            return;
+        }
+        // the corners of the tile bounds, cast to the other layer
+        std::array<ModelCoordinate, 4> corners = {
+            tileMin, ModelCoordinate(tileMax.x, tileMin.y), ModelCoordinate(tileMin.x, tileMax.y), tileMax};
+        if (layer != this) {
+            for (ModelCoordinate& corner : corners) {
+                corner = layer->getCellGrid()->toLayerCoordinates(m_grid->toMapCoordinates(intPt2doublePt(corner)));
+            }
+        }
+        if (m_instances.empty()) {
+            min = corners[0];
+            max = min;
+        }
+        for (ModelCoordinate const & corner : corners) {
+            min.x = std::min(min.x, corner.x);
+            max.x = std::max(max.x, corner.x);
+            min.y = std::min(min.y, corner.y);
+            max.y = std::max(max.y, corner.y);
+        }
     }
 
     float Layer::getZOffset() const
@@ -510,6 +557,8 @@ namespace FIFE
                     return inst->isBlocking() && inst->getLocationRef().getLayerCoordinates() == cellCoordinate;
                 })) {
                 blockingInstance = true;
+            } else if (m_tileGrid != nullptr) {
+                blockingInstance = m_tileGrid->isBlocking(cellCoordinate);
             }
         }
         return blockingInstance;
@@ -521,10 +570,10 @@ namespace FIFE
         if (m_cellCache != nullptr) {
             Cell* cell = m_cellCache->getCell(cellCoordinate);
             if (cell != nullptr) {
-                std::set<Instance*> const & blocker = cell->getInstances();
-                std::ranges::copy_if(blocker, std::back_inserter(blockingInstances), [](Instance const * inst) {
-                    return inst->isBlocking();
-                });
+                std::ranges::copy_if(
+                    cell->getInstances(), std::back_inserter(blockingInstances), [](Instance const * inst) {
+                        return inst->isBlocking();
+                    });
             }
         } else {
             std::list<Instance*> adjacentInstances;
@@ -640,6 +689,7 @@ namespace FIFE
 
     bool Layer::update()
     {
+        FIFE_PROFILE_ZONE("Layer::update");
         m_changedInstances.clear();
         std::vector<Instance*> inactiveInstances;
         auto it = m_activeInstances.begin();
@@ -710,4 +760,45 @@ namespace FIFE
         return m_static;
     }
 
+    void Layer::setTile(ModelCoordinate const & cell, Object* object)
+    {
+        if (m_tileGrid == nullptr) {
+            if (object == nullptr) {
+                return;
+            }
+            m_tileGrid = std::make_unique<TileGrid>();
+        }
+        if (!m_tileGrid->setTile(cell, object)) {
+            return;
+        }
+        for (auto* listener : m_changeListeners) {
+            listener->onTileChanged(this, cell);
+        }
+    }
+
+    Object* Layer::getTile(ModelCoordinate const & cell) const
+    {
+        return m_tileGrid != nullptr ? m_tileGrid->getTile(cell) : nullptr;
+    }
+
+    bool Layer::hasTiles() const
+    {
+        return m_tileGrid != nullptr && m_tileGrid->getTileCount() != 0;
+    }
+
+    TileGrid const * Layer::getTileGrid() const
+    {
+        return m_tileGrid.get();
+    }
+
+    Instance* Layer::createTileInstance(ModelCoordinate const & cell, std::string const & id)
+    {
+        Object* object = getTile(cell);
+        if (object == nullptr) {
+            return nullptr;
+        }
+        setTile(cell, nullptr);
+        return createInstance(object, ModelCoordinate(cell.x, cell.y), id);
+    }
+
 } // namespace FIFE
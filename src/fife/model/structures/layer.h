@@ -12,6 +12,7 @@
 #include <list>
 #include <memory>
 #include <set>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -32,6 +33,7 @@ namespace FIFE
     class Object;
     class InstanceTree;
     class CellCache;
+    class TileGrid;
     class Trigger;
 
     /** Defines how pathing can be performed on this layer
@@ -79,6 +81,16 @@ namespace FIFE
              * @note right after this call, instance actually gets deleted!
              */
             virtual void onInstanceDelete(Layer* layer, Instance* instance) = 0;
+
+            /** Called when a tile of the layer was set or removed, see Layer::setTile()
+             * @param layer where change occurred
+             * @param cell layer coordinates of the changed tile
+             */
+            virtual void onTileChanged(Layer* layer, ModelCoordinate const & cell)
+            {
+                static_cast<void>(layer);
+                static_cast<void>(cell);
+            }
     };
 
     /** A basic layer on a map
@@ -182,6 +194,15 @@ namespace FIFE
              */
             std::vector<Instance*> getInstancesInCircle(ModelCoordinate const & center, uint16_t radius);
 
+            /** Returns instances in the ring between two circles around center.
+             * @param center A const reference to the ModelCoordinate where the center of the ring is.
+             * @param innerRadius A unsigned integer, instances nearer to the center are not returned.
+             * @param outerRadius A unsigned integer, radius of the outer circle.
+             * @return A vector that contain the instances.
+             */
+            std::vector<Instance*> getInstancesInAnnulus(
+                ModelCoordinate const & center, uint16_t innerRadius, uint16_t outerRadius);
+
             /** Returns all instances in the circle segment.
              * @param center A const reference to the ModelCoordinate where the center of the circle is.
              * @param radius A unsigned integer, radius of the circle.
@@ -192,6 +213,44 @@ namespace FIFE
             std::vector<Instance*> getInstancesInCircleSegment(
                 ModelCoordinate const & center, uint16_t radius, int32_t sangle, int32_t eangle);
 
+            /** Returns the instances in many circles of the same radius, faster than a query per circle.
+             * @param centers A const reference to the ModelCoordinates where the centers of the circles are.
+             * @param radius A unsigned integer, radius of the circles.
+             * @return A vector per center that contain the instances.
+             */
+            std::vector<std::vector<Instance*>> getInstancesInCircles(
+                std::vector<ModelCoordinate> const & centers, uint16_t radius);
+
+            /** Writes the ids of the instances, see FifeClass::getId(), in the order of getInstances().
+             * @param ids A buffer with one value per instance.
+             * @throws IndexOverflow if the buffer has a different size.
+             */
+            void getInstanceIds(std::span<uint64_t> ids) const;
+
+            /** Writes the exact layer coordinates of the instances, in the order of getInstances().
+             * @param positions A buffer with x, y and z per instance.
+             * @throws IndexOverflow if the buffer has a different size.
+             */
+            void getInstancePositions(std::span<double> positions) const;
+
+            /** Writes the rotations of the instances, in the order of getInstances().
+             * @param rotations A buffer with one value per instance.
+             * @throws IndexOverflow if the buffer has a different size.
+             */
+            void getInstanceRotations(std::span<int32_t> rotations) const;
+
+            /** Moves the instances, in the order of getInstances(), instances at their position are skipped.
+             * @param positions A buffer with the exact layer coordinates x, y and z per instance.
+             * @throws IndexOverflow if the buffer has a different size.
+             */
+            void setInstancePositions(std::span<double const> positions);
+
+            /** Rotates the instances, in the order of getInstances().
+             * @param rotations A buffer with one value per instance.
+             * @throws IndexOverflow if the buffer has a different size.
+             */
+            void setInstanceRotations(std::span<int32_t const> rotations);
+
             /** Get the first instance on this layer with the given identifier.
              */
             Instance* getInstance(std::string const & identifier);
@@ -367,6 +426,34 @@ namespace FIFE
              */
             bool isStatic() const;
 
+            /** Sets the static tile of a cell. A tile is drawn, picked and blocks like a static instance
+             *  of its object, but it is stored in a TileGrid, so large tile layers do not need an Instance per cell.
+             * @param cell The layer coordinates of the cell, z is ignored.
+             * @param object The object of the tile or nullptr to remove the tile.
+             * @throws IndexOverflow if the layer would have tiles of more than 65535 different objects.
+             */
+            void setTile(ModelCoordinate const & cell, Object* object);
+
+            /** Returns the object of the tile on a cell or nullptr if the cell has no tile.
+             */
+            Object* getTile(ModelCoordinate const & cell) const;
+
+            /** Check existance of tiles on this layer
+             * @return True, if tiles exist.
+             */
+            bool hasTiles() const;
+
+            /** Returns the tiles of the layer or nullptr if no tile was ever set.
+             */
+            TileGrid const * getTileGrid() const;
+
+            /** Replaces the tile of a cell by an instance of its object, so scripts can change it.
+             * @param cell The layer coordinates of the cell.
+             * @param id The id of the new instance.
+             * @return The new instance or nullptr if the cell has no tile.
+             */
+            Instance* createTileInstance(ModelCoordinate const & cell, std::string const & id = "");
+
         protected:
             //! string identifier
             std::string m_name;
@@ -390,6 +477,8 @@ namespace FIFE
             CellGrid* m_grid;
             //! pointer to cellcache
             std::unique_ptr<CellCache> m_cellCache;
+            //! static tiles, created by the first setTile()
+            std::unique_ptr<TileGrid> m_tileGrid;
             //! pathing strategy for the layer
             PathingStrategy m_pathingStrategy;
             //! sorting strategy for rendering
@@ -37,6 +37,7 @@ namespace FIFE {
 		virtual void onLayerChanged(Layer* layer, std::vector<Instance*>& changedInstances) = 0;
 		virtual void onInstanceCreate(Layer* layer, Instance* instance) = 0;
 		virtual void onInstanceDelete(Layer* layer, Instance* instance) = 0;
+		virtual void onTileChanged(Layer* layer, const ModelCoordinate& cell);
 	};
 	
 
@@ -65,7 +66,9 @@ namespace FIFE {
 			std::list<Instance*> getInstancesIn(Rect& rec);
 			std::vector<Instance*> getInstancesInLine(const ModelCoordinate& pt1, const ModelCoordinate& pt2);
 			std::vector<Instance*> getInstancesInCircle(const ModelCoordinate& center, uint16_t radius);
+			std::vector<Instance*> getInstancesInAnnulus(const ModelCoordinate& center, uint16_t innerRadius, uint16_t outerRadius);
 			std::vector<Instance*> getInstancesInCircleSegment(const ModelCoordinate& center, uint16_t radius, int32_t sangle, int32_t eangle);
+			std::vector<std::vector<Instance*> > getInstancesInCircles(const std::vector<ModelCoordinate>& centers, uint16_t radius);
 			Instance* getInstance(const std::string& id);
 
 			void setInstancesVisible(bool vis);
@@ -105,5 +108,52 @@ namespace FIFE {
 
 			void setStatic(bool stati);
 			bool isStatic();
+
+			void setTile(const ModelCoordinate& cell, Object* object);
+			Object* getTile(const ModelCoordinate& cell) const;
+			bool hasTiles() const;
+			Instance* createTileInstance(const ModelCoordinate& cell, const std::string& id="");
 	};
-}
\ No newline at end of file
+
+	%extend Layer {
+		PyObject* getInstanceIds() {
+			std::size_t const count = $self->getInstances().size();
+			uint64_t* data = NULL;
+			PyObject* bytes = fifeNewBuffer(count, &data);
+			if (!bytes) {
+				return NULL;
+			}
+			$self->getInstanceIds(std::span<uint64_t>(data, count));
+			return fifeBufferView(bytes, "Q", static_cast<Py_ssize_t>(count), 1);
+		}
+		PyObject* getInstancePositions() {
+			std::size_t const count = $self->getInstances().size();
+			double* data = NULL;
+			PyObject* bytes = fifeNewBuffer(count * 3, &data);
+			if (!bytes) {
+				return NULL;
+			}
+			$self->getInstancePositions(std::span<double>(data, count * 3));
+			return fifeBufferView(bytes, "d", static_cast<Py_ssize_t>(count), 3);
+		}
+		PyObject* getInstanceRotations() {
+			std::size_t const count = $self->getInstances().size();
+			int32_t* data = NULL;
+			PyObject* bytes = fifeNewBuffer(count, &data);
+			if (!bytes) {
+				return NULL;
+			}
+			$self->getInstanceRotations(std::span<int32_t>(data, count));
+			return fifeBufferView(bytes, "i", static_cast<Py_ssize_t>(count), 1);
+		}
+		void setInstancePositions(PyObject* positions) {
+			FifeBufferReader<double> const reader(positions, "d");
+			$self->setInstancePositions(reader.values());
+		}
+		void setInstanceRotations(PyObject* rotations) {
+			FifeBufferReader<int32_t> const reader(rotations, sizeof(long) == 4 ? "il" : "i");
+			$self->setInstanceRotations(reader.values());
+		}
+	}
+}
+%template(InstanceVectorVector) std::vector<std::vector<FIFE::Instance*> >;
@@ -119,7 +119,10 @@ namespace FIFE
             ExactModelCoordinate getExactLayerCoordinates(Layer const * layer) const;
 
             /** Gets cell precision layer coordinates set to this location
+             *  Computed on every call, loops over many locations should use the batch transforms of the
+             *  CellGrid instead.
              * @see getExactLayerCoordinates()
+             * @see CellGrid::toLayerCoordinatesFromExactLayerCoordinates()
              */
             ModelCoordinate getLayerCoordinates() const;
 
@@ -7,6 +7,7 @@
 // Standard C++ library includes
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <limits>
 #include <list>
 #include <map>
@@ -23,10 +24,13 @@
 #include "layer.h"
 #include "triggercontroller.h"
 #include "util/base/exception.h"
+#include "util/base/jobpool.h"
 #include "util/structures/purge.h"
 #include "util/structures/rect.h"
+#include "util/time/profiler.h"
 #include "video/renderbackend.h"
 #include "view/camera.h"
+#include "view/layercache.h"
 #include "view/rendererbase.h"
 
 namespace FIFE
@@ -41,6 +45,8 @@ namespace FIFE
 
         m_timeProvider(tp_master),
 
+        m_renderListTime(0.0),
+        m_renderTime(0.0),
         m_renderBackend(renderBackend),
         m_renderers(renderers),
         m_changed(false),
@@ -158,6 +164,7 @@ namespace FIFE
 
     bool Map::update()
     {
+        FIFE_PROFILE_ZONE("Map::update");
         m_changedLayers.clear();
         // transfer instances from one layer to another
         if (!m_transferInstances.empty()) {
@@ -199,13 +206,31 @@ namespace FIFE
         }
 
         // loop over cameras and update if enabled
+        using Clock                = std::chrono::steady_clock;
+        Clock::time_point const t0 = Clock::now();
+        m_updateCameras.clear();
+        m_updateCaches.clear();
         auto camIter = m_cameras.begin();
         for (; camIter != m_cameras.end(); ++camIter) {
             if ((*camIter)->isEnabled()) {
                 (*camIter)->update();
-                (*camIter)->render();
+                (*camIter)->prepareRenderLists(m_updateCaches);
+                m_updateCameras.push_back(camIter->get());
             }
         }
+        // the layer caches of all cameras are independent until rendering
+        if (!m_updateCaches.empty()) {
+            JobPool::instance()->parallelFor(m_updateCaches.size(), [this](size_t index) {
+                m_updateCaches[index]->finishUpdate();
+            });
+        }
+        Clock::time_point const t1 = Clock::now();
+        for (auto* camera : m_updateCameras) {
+            camera->renderFrame();
+        }
+        Clock::time_point const t2 = Clock::now();
+        m_renderListTime           = std::chrono::duration<double, std::milli>(t1 - t0).count();
+        m_renderTime               = std::chrono::duration<double, std::milli>(t2 - t1).count();
 
         bool const retval = m_changed;
         m_changed         = false;
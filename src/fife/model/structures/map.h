@@ -32,6 +32,7 @@ namespace FIFE
     class CellGrid;
     class Map;
     class Camera;
+    class LayerCache;
     class Instance;
     class TriggerController;
 
@@ -135,6 +136,22 @@ namespace FIFE
              */
             bool update();
 
+            /** Time the last update spent building the render lists of the cameras.
+             * @return Duration in milliseconds.
+             */
+            double getRenderListTime() const
+            {
+                return m_renderListTime;
+            }
+
+            /** Time the last update spent rendering the cameras.
+             * @return Duration in milliseconds.
+             */
+            double getRenderTime() const
+            {
+                return m_renderTime;
+            }
+
             /** Sets speed for the map. See Model::setTimeMultiplier.
              */
             void setTimeMultiplier(float multip)
@@ -255,6 +272,14 @@ namespace FIFE
             //! holds the cameras attached to this map
             std::vector<std::unique_ptr<Camera>> m_cameras;
 
+            //! enabled cameras and their layer caches left to finish during update
+            std::vector<Camera*> m_updateCameras;
+            std::vector<LayerCache*> m_updateCaches;
+
+            //! durations of the last update in milliseconds
+            double m_renderListTime;
+            double m_renderTime;
+
             //! pointer to renderbackend
             RenderBackend* m_renderBackend;
 
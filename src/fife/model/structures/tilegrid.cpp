@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Corresponding header include
+#include "tilegrid.h"
+
+// Standard C++ library includes
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+// 3rd party library includes
+
+// FIFE includes
+#include "model/metamodel/object.h"
+#include "util/base/exception.h"
+
+namespace FIFE
+{
+
+    TileGrid::TileGrid() :
+        m_records(1, Record{.object = nullptr, .blocking = false}), m_tileCount(0), m_boundsValid(true)
+    {
+    }
+
+    bool TileGrid::setTile(ModelCoordinate const & cell, Object* object)
+    {
+        uint16_t index = NO_TILE;
+        if (object != nullptr) {
+            auto it = m_recordIndices.find(object);
+            if (it != m_recordIndices.end()) {
+                index = it->second;
+            } else {
+                if (m_records.size() > std::numeric_limits<uint16_t>::max()) {
+                    throw IndexOverflow("a tile grid can not hold more than 65535 objects");
+                }
+                index = static_cast<uint16_t>(m_records.size());
+                m_records.push_back(Record{.object = object, .blocking = object->isBlocking()});
+                m_recordIndices.emplace(object, index);
+            }
+            if (!contains(cell)) {
+                grow(expandedArea(cell));
+            }
+        } else if (!contains(cell)) {
+            return false;
+        }
+
+        uint16_t& tile = m_tiles[toIndex(cell)];
+        if (tile == index) {
+            return false;
+        }
+        if (tile == NO_TILE) {
+            // the first tile sets the bounds, the others extend them
+            if (m_tileCount == 0) {
+                m_min         = ModelCoordinate(cell.x, cell.y);
+                m_max         = m_min;
+                m_boundsValid = true;
+            } else if (m_boundsValid) {
+                m_min.x = std::min(m_min.x, cell.x);
+                m_min.y = std::min(m_min.y, cell.y);
+                m_max.x = std::max(m_max.x, cell.x);
+                m_max.y = std::max(m_max.y, cell.y);
+            }
+            ++m_tileCount;
+        } else if (index == NO_TILE) {
+            --m_tileCount;
+            // only a tile on the border can shrink the bounds
+            if (cell.x == m_min.x || cell.x == m_max.x || cell.y == m_min.y || cell.y == m_max.y) {
+                m_boundsValid = false;
+            }
+        }
+        tile = index;
+        return true;
+    }
+
+    Object* TileGrid::getTile(ModelCoordinate const & cell) const
+    {
+        return m_records[getTileIndex(cell)].object;
+    }
+
+    uint16_t TileGrid::getTileIndex(ModelCoordinate const & cell) const
+    {
+        if (!contains(cell)) {
+            return NO_TILE;
+        }
+        return m_tiles[toIndex(cell)];
+    }
+
+    bool TileGrid::isBlocking(ModelCoordinate const & cell) const
+    {
+        return m_records[getTileIndex(cell)].blocking;
+    }
+
+    TileGrid::Record const & TileGrid::getRecord(uint16_t index) const
+    {
+        assert(index != NO_TILE && index < m_records.size());
+        return m_records[index];
+    }
+
+    bool TileGrid::hasTilesOf(Object const * object) const
+    {
+        auto it = std::ranges::find(m_records, object, &Record::object);
+        if (it == m_records.end() || object == nullptr) {
+            return false;
+        }
+        auto const index = static_cast<uint16_t>(std::distance(m_records.begin(), it));
+        return std::ranges::find(m_tiles, index) != m_tiles.end();
+    }
+
+    std::size_t TileGrid::getRecordCount() const
+    {
+        return m_records.size() - 1;
+    }
+
+    std::size_t TileGrid::getTileCount() const
+    {
+        return m_tileCount;
+    }
+
+    Rect const & TileGrid::getArea() const
+    {
+        return m_area;
+    }
+
+    void TileGrid::reserve(Rect const & area)
+    {
+        if (area.w <= 0 || area.h <= 0) {
+            return;
+        }
+        if (m_area.w == 0 || m_area.h == 0) {
+            grow(area);
+            return;
+        }
+        int32_t const x = std::min(m_area.x, area.x);
+        int32_t const y = std::min(m_area.y, area.y);
+        Rect const merged(
+            x, y, std::max(m_area.right(), area.right()) - x, std::max(m_area.bottom(), area.bottom()) - y);
+        if (!(merged == m_area)) {
+            grow(merged);
+        }
+    }
+
+    bool TileGrid::getBounds(ModelCoordinate& min, ModelCoordinate& max) const
+    {
+        if (m_tileCount == 0) {
+            return false;
+        }
+        if (!m_boundsValid) {
+            bool first = true;
+            for (int32_t y = 0; y < m_area.h; ++y) {
+                for (int32_t x = 0; x < m_area.w; ++x) {
+                    if (m_tiles[(static_cast<std::size_t>(y) * static_cast<std::size_t>(m_area.w)) +
+                                static_cast<std::size_t>(x)] == NO_TILE) {
+                        continue;
+                    }
+                    ModelCoordinate const cell(m_area.x + x, m_area.y + y);
+                    if (first) {
+                        m_min = cell;
+                        m_max = cell;
+                        first = false;
+                    } else {
+                        m_min.x = std::min(m_min.x, cell.x);
+                        m_min.y = std::min(m_min.y, cell.y);
+                        m_max.x = std::max(m_max.x, cell.x);
+                        m_max.y = std::max(m_max.y, cell.y);
+                    }
+                }
+            }
+            m_boundsValid = true;
+        }
+        min = m_min;
+        max = m_max;
+        return true;
+    }
+
+    void TileGrid::clear()
+    {
+        m_tiles.clear();
+        m_tiles.shrink_to_fit();
+        m_records.resize(1);
+        m_recordIndices.clear();
+        m_area        = Rect();
+        m_tileCount   = 0;
+        m_boundsValid = true;
+    }
+
+    bool TileGrid::contains(ModelCoordinate const & cell) const
+    {
+        return cell.x >= m_area.x && cell.x < m_area.right() && cell.y >= m_area.y && cell.y < m_area.bottom();
+    }
+
+    std::size_t TileGrid::toIndex(ModelCoordinate const & cell) const
+    {
+        return (static_cast<std::size_t>(cell.y - m_area.y) * static_cast<std::size_t>(m_area.w)) +
+               static_cast<std::size_t>(cell.x - m_area.x);
+    }
+
+    Rect TileGrid::expandedArea(ModelCoordinate const & cell) const
+    {
+        if (m_area.w == 0 || m_area.h == 0) {
+            return Rect(cell.x, cell.y, 1, 1);
+        }
+        // grow by half of the size in every direction that is too small, filling a map cell by cell
+        // reallocates only a few times
+        int32_t left   = std::min(cell.x, m_area.x);
+        int32_t top    = std::min(cell.y, m_area.y);
+        int32_t right  = std::max(cell.x + 1, m_area.right());
+        int32_t bottom = std::max(cell.y + 1, m_area.bottom());
+        if (left < m_area.x) {
+            left = std::min(left, m_area.x - (m_area.w / 2));
+        }
+        if (top < m_area.y) {
+            top = std::min(top, m_area.y - (m_area.h / 2));
+        }
+        if (right > m_area.right()) {
+            right = std::max(right, m_area.right() + (m_area.w / 2));
+        }
+        if (bottom > m_area.bottom()) {
+            bottom = std::max(bottom, m_area.bottom() + (m_area.h / 2));
+        }
+        return Rect(left, top, right - left, bottom - top);
+    }
+
+    void TileGrid::grow(Rect const & area)
+    {
+        std::vector<uint16_t> tiles(static_cast<std::size_t>(area.w) * static_cast<std::size_t>(area.h), NO_TILE);
+        for (int32_t y = 0; y < m_area.h; ++y) {
+            auto const source = m_tiles.begin() + (static_cast<std::ptrdiff_t>(y) * m_area.w);
+            auto const target =
+                tiles.begin() + (static_cast<std::ptrdiff_t>(m_area.y + y - area.y) * area.w) + (m_area.x - area.x);
+            std::copy_n(source, m_area.w, target);
+        }
+        m_tiles.swap(tiles);
+        m_area = area;
+    }
+
+} // namespace FIFE
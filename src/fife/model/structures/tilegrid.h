@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+#ifndef FIFE_TILEGRID_H
+#define FIFE_TILEGRID_H
+
+// Platform specific includes
+#include "platform.h"
+
+// Standard C++ library includes
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// 3rd party library includes
+
+// FIFE includes
+#include "model/metamodel/modelcoords.h"
+#include "util/structures/rect.h"
+
+namespace FIFE
+{
+
+    class Object;
+
+    /** Dense storage of the static tiles of a layer.
+     *
+     * A tile is an object on a cell that is drawn, picked and blocks like a static instance, but is not one. Every
+     * cell of the area stores a 16 bit index into a list of records, one record per object, so a tile costs two bytes
+     * instead of an Instance with its location, visual and cache entries. The z coordinate of the cells is ignored.
+     *
+     * Tiles that scripts want to change are turned into instances with Layer::createTileInstance().
+     */
+    class FIFE_API TileGrid
+    {
+        public:
+            /** The data shared by all tiles of one object.
+             *
+             * A record does not change once it is created, so it keeps the blocking of the object at that time.
+             */
+            struct Record
+            {
+                    /** the object of the tiles, owned by the Model. It must outlive the tiles that use it,
+                     *  Model::deleteObject() refuses objects that are still used by tiles.
+                     */
+                    Object* object;
+                    //! true if the tiles block like a static blocking instance
+                    bool blocking;
+            };
+
+            //! index of cells without a tile
+            static constexpr uint16_t NO_TILE = 0;
+
+            TileGrid();
+
+            /** Sets the tile of a cell, the area grows to contain the cell.
+             * @param cell The layer coordinates of the cell.
+             * @param object The object of the tile or nullptr to remove the tile.
+             * @return True if the tile changed.
+             * @throws IndexOverflow if the grid would hold more than 65535 different objects.
+             */
+            bool setTile(ModelCoordinate const & cell, Object* object);
+
+            /** Returns the object of the tile on a cell or nullptr if the cell has no tile.
+             */
+            Object* getTile(ModelCoordinate const & cell) const;
+
+            /** Returns the record index of the tile on a cell or NO_TILE.
+             */
+            uint16_t getTileIndex(ModelCoordinate const & cell) const;
+
+            /** Returns true if the cell has a tile that blocks.
+             */
+            bool isBlocking(ModelCoordinate const & cell) const;
+
+            /** Returns the record of a tile index.
+             * @param index A tile index other than NO_TILE.
+             */
+            Record const & getRecord(uint16_t index) const;
+
+            /** Returns true if at least one cell has a tile of the object.
+             */
+            bool hasTilesOf(Object const * object) const;
+
+            /** Returns the number of records, the tile indices are in the range [1, count].
+             */
+            std::size_t getRecordCount() const;
+
+            /** Returns the number of cells with a tile.
+             */
+            std::size_t getTileCount() const;
+
+            /** Returns the area the grid has storage for, it can hold cells without tiles.
+             */
+            Rect const & getArea() const;
+
+            /** Grows the area, so a map of known size is stored without reallocations.
+             */
+            void reserve(Rect const & area);
+
+            /** Retrieves the minimum and maximum cell coordinates of the tiles.
+             * @return False if the grid has no tiles, then min and max are not changed.
+             */
+            bool getBounds(ModelCoordinate& min, ModelCoordinate& max) const;
+
+            /** Removes all tiles and records.
+             */
+            void clear();
+
+        private:
+            bool contains(ModelCoordinate const & cell) const;
+            std::size_t toIndex(ModelCoordinate const & cell) const;
+            Rect expandedArea(ModelCoordinate const & cell) const;
+            void grow(Rect const & area);
+
+            //! record index per cell of the area, row by row
+            std::vector<uint16_t> m_tiles;
+            //! the records, index 0 belongs to NO_TILE
+            std::vector<Record> m_records;
+            //! record index per object
+            std::unordered_map<Object*, uint16_t> m_recordIndices;
+            //! area of m_tiles
+            Rect m_area;
+            //! number of cells with a tile
+            std::size_t m_tileCount;
+            //! bounds of the tiles, recalculated after tiles were removed
+            mutable ModelCoordinate m_min;
+            mutable ModelCoordinate m_max;
+            mutable bool m_boundsValid;
+    };
+
+} // namespace FIFE
+
+#endif
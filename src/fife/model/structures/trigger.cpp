@@ -18,6 +18,7 @@
 #include "instance.h"
 #include "layer.h"
 #include "location.h"
+#include "triggercellindex.h"
 
 namespace FIFE
 {
@@ -40,8 +41,7 @@ namespace FIFE
             // InstanceDeleteListener callback
             void onInstanceDeleted([[maybe_unused]] Instance* instance) override
             {
-                std::vector<TriggerCondition> const & types = m_trigger->getTriggerConditions();
-                if (std::ranges::find(types, INSTANCE_TRIGGER_DELETE) != types.end()) {
+                if (m_trigger->hasTriggerCondition(INSTANCE_TRIGGER_DELETE)) {
                     m_trigger->setTriggered();
                 }
                 m_trigger->detach();
@@ -50,26 +50,16 @@ namespace FIFE
             // CellChangeListener callback
             void onInstanceEnteredCell([[maybe_unused]] Cell* cell, Instance* instance) override
             {
-                std::vector<TriggerCondition> const & types = m_trigger->getTriggerConditions();
-                if (std::ranges::find(types, CELL_TRIGGER_ENTER) != types.end()) {
-                    std::vector<Instance*> const & restrict = m_trigger->getEnabledInstances();
-                    if (m_trigger->isEnabledForAllInstances() ||
-                        std::ranges::find(restrict, instance) != restrict.end()) {
-                        m_trigger->setTriggered();
-                    }
+                if (m_trigger->hasTriggerCondition(CELL_TRIGGER_ENTER) && m_trigger->isEnabledForInstance(instance)) {
+                    m_trigger->setTriggered();
                 }
             }
 
             // CellChangeListener callback
             void onInstanceExitedCell([[maybe_unused]] Cell* cell, Instance* instance) override
             {
-                std::vector<TriggerCondition> const & types = m_trigger->getTriggerConditions();
-                if (std::ranges::find(types, CELL_TRIGGER_EXIT) != types.end()) {
-                    std::vector<Instance*> const & restrict = m_trigger->getEnabledInstances();
-                    if (m_trigger->isEnabledForAllInstances() ||
-                        std::ranges::find(restrict, instance) != restrict.end()) {
-                        m_trigger->setTriggered();
-                    }
+                if (m_trigger->hasTriggerCondition(CELL_TRIGGER_EXIT) && m_trigger->isEnabledForInstance(instance)) {
+                    m_trigger->setTriggered();
                 }
             }
 
@@ -77,8 +67,7 @@ namespace FIFE
             void onBlockingChangedCell(
                 [[maybe_unused]] Cell* cell, [[maybe_unused]] CellTypeInfo type, [[maybe_unused]] bool blocks) override
             {
-                std::vector<TriggerCondition> const & types = m_trigger->getTriggerConditions();
-                if (std::ranges::find(types, CELL_TRIGGER_BLOCKING_CHANGE) != types.end()) {
+                if (m_trigger->hasTriggerCondition(CELL_TRIGGER_BLOCKING_CHANGE)) {
                     m_trigger->setTriggered();
                 }
             }
@@ -86,17 +75,16 @@ namespace FIFE
             // InstanceChangeListener callback
             void onInstanceChanged(Instance* instance, InstanceChangeInfo info) override
             {
-                std::vector<TriggerCondition> const & types = m_trigger->getTriggerConditions();
                 if (m_trigger->getAttached() == instance && (info & ICHANGE_CELL) == ICHANGE_CELL) {
                     m_trigger->move();
                 }
 
-                if (types.empty()) {
+                if (m_trigger->getTriggerConditions().empty()) {
                     return;
                 }
 
                 auto const hasTrigger = [&](InstanceChangeInfo change, TriggerCondition condition) {
-                    return (info & change) == change && std::ranges::find(types, condition) != types.end();
+                    return (info & change) == change && m_trigger->hasTriggerCondition(condition);
                 };
 
                 if (hasTrigger(ICHANGE_LOC, INSTANCE_TRIGGER_LOCATION) ||
@@ -120,7 +108,12 @@ namespace FIFE
     };
 
     Trigger::Trigger() :
-        m_triggered(false), m_enabledAll(false), m_changeListener(new TriggerChangeListener(this)), m_attached(nullptr)
+        m_triggered(false),
+        m_enabledAll(false),
+        m_changeListener(new TriggerChangeListener(this)),
+        m_conditionMask(0),
+        m_cellIndex(nullptr),
+        m_attached(nullptr)
     {
     }
 
@@ -129,6 +122,8 @@ namespace FIFE
         m_triggered(false),
         m_enabledAll(false),
         m_changeListener(new TriggerChangeListener(this)),
+        m_conditionMask(0),
+        m_cellIndex(nullptr),
         m_attached(nullptr)
     {
     }
@@ -136,9 +131,12 @@ namespace FIFE
     Trigger::~Trigger()
     {
         detach();
-        auto it = m_assigned.begin();
-        for (; it != m_assigned.end(); ++it) {
-            (*it)->removeChangeListener(m_changeListener);
+        if (m_cellIndex != nullptr) {
+            m_cellIndex->removeTrigger(this);
+        } else {
+            for (Cell* cell : m_assigned) {
+                cell->removeChangeListener(m_changeListener);
+            }
         }
         delete m_changeListener;
     }
@@ -188,9 +186,9 @@ namespace FIFE
 
     void Trigger::addTriggerCondition(TriggerCondition type)
     {
-        auto it = std::ranges::find(m_triggerConditions, type);
-        if (it == m_triggerConditions.end()) {
+        if (!hasTriggerCondition(type)) {
             m_triggerConditions.push_back(type);
+            m_conditionMask |= 1U << type;
         }
     }
 
@@ -204,13 +202,13 @@ namespace FIFE
         auto it = std::ranges::find(m_triggerConditions, type);
         if (it != m_triggerConditions.end()) {
             m_triggerConditions.erase(it);
+            m_conditionMask &= ~(1U << type);
         }
     }
 
     void Trigger::enableForInstance(Instance* instance)
     {
-        auto it = std::ranges::find(m_enabledInstances, instance);
-        if (it == m_enabledInstances.end()) {
+        if (m_enabledSet.insert(instance).second) {
             m_enabledInstances.push_back(instance);
         }
     }
@@ -222,12 +220,16 @@ namespace FIFE
 
     void Trigger::disableForInstance(Instance* instance)
     {
-        auto it = std::ranges::find(m_enabledInstances, instance);
-        if (it != m_enabledInstances.end()) {
-            m_enabledInstances.erase(it);
+        if (m_enabledSet.erase(instance) != 0) {
+            m_enabledInstances.erase(std::ranges::find(m_enabledInstances, instance));
         }
     }
 
+    bool Trigger::isEnabledForInstance(Instance const * instance) const
+    {
+        return m_enabledAll || m_enabledSet.contains(instance);
+    }
+
     void Trigger::enableForAllInstances()
     {
         m_enabledAll = true;
@@ -252,7 +254,7 @@ namespace FIFE
         auto it = std::ranges::find(m_assigned, cell);
         if (it == m_assigned.end()) {
             m_assigned.push_back(cell);
-            cell->addChangeListener(m_changeListener);
+            observe(cell);
         }
     }
 
@@ -265,7 +267,7 @@ namespace FIFE
         auto it = std::ranges::find(m_assigned, cell);
         if (it != m_assigned.end()) {
             m_assigned.erase(it);
-            cell->removeChangeListener(m_changeListener);
+            unobserve(cell);
         }
     }
 
@@ -274,7 +276,7 @@ namespace FIFE
         auto it = std::ranges::find(m_assigned, cell);
         if (it == m_assigned.end()) {
             m_assigned.push_back(cell);
-            cell->addChangeListener(m_changeListener);
+            observe(cell);
         }
     }
 
@@ -283,7 +285,7 @@ namespace FIFE
         auto it = std::ranges::find(m_assigned, cell);
         if (it != m_assigned.end()) {
             m_assigned.erase(it);
-            cell->removeChangeListener(m_changeListener);
+            unobserve(cell);
         }
     }
 
@@ -347,13 +349,51 @@ namespace FIFE
                 m_assigned.erase(found);
             } else {
                 // add new
-                (*it)->addChangeListener(m_changeListener);
+                observe(*it);
             }
         }
         // remove old
         for (it = m_assigned.begin(); it != m_assigned.end(); ++it) {
-            (*it)->removeChangeListener(m_changeListener);
+            unobserve(*it);
         }
         m_assigned = newCells;
     }
+
+    void Trigger::setCellIndex(TriggerCellIndex* index)
+    {
+        if (index == m_cellIndex) {
+            return;
+        }
+        for (Cell* cell : m_assigned) {
+            unobserve(cell);
+        }
+        if (m_cellIndex != nullptr) {
+            m_cellIndex->removeTrigger(this);
+        }
+        m_cellIndex = index;
+        if (m_cellIndex != nullptr) {
+            m_cellIndex->addTrigger(this);
+        }
+        for (Cell* cell : m_assigned) {
+            observe(cell);
+        }
+    }
+
+    void Trigger::observe(Cell* cell)
+    {
+        if (m_cellIndex != nullptr) {
+            m_cellIndex->assign(cell, this);
+        } else {
+            cell->addChangeListener(m_changeListener);
+        }
+    }
+
+    void Trigger::unobserve(Cell* cell)
+    {
+        if (m_cellIndex != nullptr) {
+            m_cellIndex->remove(cell, this);
+        } else {
+            cell->removeChangeListener(m_changeListener);
+        }
+    }
 } // namespace FIFE
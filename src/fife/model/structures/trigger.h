@@ -10,6 +10,7 @@
 // Standard C++ library includes
 #include <cstdint>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 // 3rd party library includes
@@ -23,6 +24,7 @@ namespace FIFE
     class Cell;
     class Layer;
     class Instance;
+    class TriggerCellIndex;
     class TriggerChangeListener;
 
     class FIFE_API ITriggerListener
@@ -163,6 +165,15 @@ namespace FIFE
              */
             void removeTriggerCondition(TriggerCondition type);
 
+            /** Returns true if the trigger has the condition.
+             *
+             * @param type The trigger condition.
+             */
+            bool hasTriggerCondition(TriggerCondition type) const
+            {
+                return (m_conditionMask & (1U << type)) != 0;
+            }
+
             /** Enables trigger for given instance.
              *
              * @param instance The instance which is enabled for the trigger.
@@ -179,6 +190,12 @@ namespace FIFE
              */
             void disableForInstance(Instance* instance);
 
+            /** Returns true if the trigger is enabled for all instances or the given one.
+             *
+             * @param instance The instance to check.
+             */
+            bool isEnabledForInstance(Instance const * instance) const;
+
             /** Enables trigger for all instances.
              */
             void enableForAllInstances();
@@ -243,6 +260,13 @@ namespace FIFE
              */
             void move();
 
+            /** Sets the index that observes the assigned cells instead of the trigger itself.
+             * The TriggerController sets its index on the triggers it creates.
+             *
+             * @param index The index or nullptr, it has to outlive the trigger.
+             */
+            void setCellIndex(TriggerCellIndex* index);
+
             /** Moves the trigger from the old position to the new position.
              *
              * @param newPos The old position as ModelCoordinate.
@@ -251,6 +275,12 @@ namespace FIFE
             void moveTo(ModelCoordinate const & newPos, ModelCoordinate const & oldPos);
 
         private:
+            //! observes a cell, through the cell index if there is one
+            void observe(Cell* cell);
+
+            //! stops to observe a cell
+            void unobserve(Cell* cell);
+
             //! name of the trigger.  This should be unique per Map.
             std::string m_name;
 
@@ -272,9 +302,18 @@ namespace FIFE
             //! all trigger conditions
             std::vector<TriggerCondition> m_triggerConditions;
 
+            //! bit per trigger condition
+            uint32_t m_conditionMask;
+
             //! all enabled instances
             std::vector<Instance*> m_enabledInstances;
 
+            //! the enabled instances for lookups
+            std::unordered_set<Instance const *> m_enabledSet;
+
+            //! index that observes the assigned cells, nullptr if the trigger observes them itself
+            TriggerCellIndex* m_cellIndex;
+
             //! instance where the trigger is attached to
             Instance* m_attached;
     };
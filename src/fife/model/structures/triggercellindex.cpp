@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Corresponding header include
+#include "triggercellindex.h"
+
+// Standard C++ library includes
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <utility>
+#include <vector>
+
+// 3rd party library includes
+
+// FIFE includes
+#include "instance.h"
+
+namespace FIFE
+{
+
+    TriggerCellIndex::TriggerCellIndex() = default;
+
+    TriggerCellIndex::~TriggerCellIndex()
+    {
+        for (auto const & entry : m_cells) {
+            entry.first->removeChangeListener(this);
+            entry.first->removeDeleteListener(this);
+        }
+    }
+
+    void TriggerCellIndex::addTrigger(Trigger* trigger)
+    {
+        if (m_slots.contains(trigger)) {
+            return;
+        }
+        uint32_t slot = 0;
+        if (!m_freeSlots.empty()) {
+            slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+            m_triggers[slot] = trigger;
+        } else {
+            slot = static_cast<uint32_t>(m_triggers.size());
+            m_triggers.push_back(trigger);
+        }
+        m_slots.emplace(trigger, slot);
+    }
+
+    void TriggerCellIndex::removeTrigger(Trigger* trigger)
+    {
+        auto it = m_slots.find(trigger);
+        if (it == m_slots.end()) {
+            return;
+        }
+        for (Cell* cell : trigger->getAssignedCells()) {
+            remove(cell, trigger);
+        }
+        m_triggers[it->second] = nullptr;
+        m_freeSlots.push_back(it->second);
+        m_slots.erase(it);
+    }
+
+    void TriggerCellIndex::assign(Cell* cell, Trigger const * trigger)
+    {
+        uint32_t const slot = getSlot(trigger);
+        auto [it, inserted] = m_cells.try_emplace(cell);
+        if (inserted) {
+            cell->addChangeListener(this);
+            cell->addDeleteListener(this);
+        }
+        std::vector<uint64_t>& bits = it->second;
+        if (bits.size() <= slot / 64) {
+            bits.resize((slot / 64) + 1, 0);
+        }
+        bits[slot / 64] |= uint64_t{1} << (slot % 64);
+    }
+
+    void TriggerCellIndex::remove(Cell* cell, Trigger const * trigger)
+    {
+        auto it = m_cells.find(cell);
+        auto st = m_slots.find(trigger);
+        if (it == m_cells.end() || st == m_slots.end()) {
+            return;
+        }
+        uint32_t const slot         = st->second;
+        std::vector<uint64_t>& bits = it->second;
+        if (slot / 64 < bits.size()) {
+            bits[slot / 64] &= ~(uint64_t{1} << (slot % 64));
+        }
+        if (std::ranges::all_of(bits, [](uint64_t word) {
+                return word == 0;
+            })) {
+            cell->removeChangeListener(this);
+            cell->removeDeleteListener(this);
+            m_cells.erase(it);
+        }
+    }
+
+    std::vector<Trigger*> TriggerCellIndex::getTriggers(Cell* cell) const
+    {
+        std::vector<Trigger*> triggers;
+        auto it = m_cells.find(cell);
+        if (it == m_cells.end()) {
+            return triggers;
+        }
+        std::vector<uint64_t> const & bits = it->second;
+        for (std::size_t word = 0; word < bits.size(); ++word) {
+            for (uint64_t rest = bits[word]; rest != 0; rest &= rest - 1) {
+                triggers.push_back(m_triggers[(word * 64) + static_cast<std::size_t>(std::countr_zero(rest))]);
+            }
+        }
+        return triggers;
+    }
+
+    std::size_t TriggerCellIndex::getCellCount() const
+    {
+        return m_cells.size();
+    }
+
+    std::size_t TriggerCellIndex::getTriggerCount() const
+    {
+        return m_slots.size();
+    }
+
+    void TriggerCellIndex::onInstanceEnteredCell(Cell* cell, Instance* instance)
+    {
+        dispatch(cell, instance, CELL_TRIGGER_ENTER);
+    }
+
+    void TriggerCellIndex::onInstanceExitedCell(Cell* cell, Instance* instance)
+    {
+        dispatch(cell, instance, CELL_TRIGGER_EXIT);
+    }
+
+    void TriggerCellIndex::onBlockingChangedCell(
+        Cell* cell, [[maybe_unused]] CellTypeInfo type, [[maybe_unused]] bool blocks)
+    {
+        dispatch(cell, nullptr, CELL_TRIGGER_BLOCKING_CHANGE);
+    }
+
+    void TriggerCellIndex::onCellDeleted(Cell* cell)
+    {
+        // the cell removes its listeners itself
+        m_cells.erase(cell);
+    }
+
+    void TriggerCellIndex::dispatch(Cell* cell, Instance* instance, TriggerCondition condition)
+    {
+        auto it = m_cells.find(cell);
+        if (it == m_cells.end()) {
+            return;
+        }
+
+        // the listeners of a trigger can change the index, so the triggers are collected first
+        std::vector<std::pair<uint32_t, Trigger*>> triggered;
+        std::vector<uint64_t> const & bits = it->second;
+        for (std::size_t word = 0; word < bits.size(); ++word) {
+            for (uint64_t rest = bits[word]; rest != 0; rest &= rest - 1) {
+                std::size_t const slot = (word * 64) + static_cast<std::size_t>(std::countr_zero(rest));
+                Trigger* trigger       = m_triggers[slot];
+                if (!trigger->isTriggered() && trigger->hasTriggerCondition(condition) &&
+                    (instance == nullptr || trigger->isEnabledForInstance(instance))) {
+                    triggered.emplace_back(static_cast<uint32_t>(slot), trigger);
+                }
+            }
+        }
+        for (auto const & [slot, trigger] : triggered) {
+            // skips triggers that were removed meanwhile
+            if (m_triggers[slot] == trigger) {
+                trigger->setTriggered();
+            }
+        }
+    }
+
+    uint32_t TriggerCellIndex::getSlot(Trigger const * trigger) const
+    {
+        auto it = m_slots.find(trigger);
+        assert(it != m_slots.end());
+        return it->second;
+    }
+
+} // namespace FIFE
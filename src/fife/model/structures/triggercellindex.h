@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+#ifndef FIFE_TRIGGERCELLINDEX_H
+#define FIFE_TRIGGERCELLINDEX_H
+
+// Platform specific includes
+#include "platform.h"
+
+// Standard C++ library includes
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// 3rd party library includes
+
+// FIFE includes
+#include "cell.h"
+#include "trigger.h"
+
+namespace FIFE
+{
+
+    class Instance;
+
+    /** Index of the cells the triggers of a TriggerController are assigned to.
+     *
+     * Every trigger gets a slot and every cell a bitset of the slots that are assigned to it. The index is the only
+     * listener on the cells, so a cell event is resolved with one lookup, no matter how many triggers cover the map.
+     * The conditions and enabled instances are checked with Trigger::hasTriggerCondition() and
+     * Trigger::isEnabledForInstance().
+     */
+    class FIFE_API TriggerCellIndex : public CellChangeListener, public CellDeleteListener
+    {
+        public:
+            TriggerCellIndex();
+            ~TriggerCellIndex() override;
+
+            TriggerCellIndex(TriggerCellIndex const &)            = delete;
+            TriggerCellIndex& operator=(TriggerCellIndex const &) = delete;
+            TriggerCellIndex(TriggerCellIndex&&)                  = delete;
+            TriggerCellIndex& operator=(TriggerCellIndex&&)       = delete;
+
+            /** Gives the trigger a slot, slots of removed triggers are reused.
+             */
+            void addTrigger(Trigger* trigger);
+
+            /** Frees the slot of the trigger and removes it from its assigned cells.
+             */
+            void removeTrigger(Trigger* trigger);
+
+            /** Assigns a trigger to a cell, the trigger has to be added before.
+             */
+            void assign(Cell* cell, Trigger const * trigger);
+
+            /** Removes a trigger from a cell.
+             */
+            void remove(Cell* cell, Trigger const * trigger);
+
+            /** Returns the triggers that are assigned to a cell, in slot order.
+             */
+            std::vector<Trigger*> getTriggers(Cell* cell) const;
+
+            /** Returns the number of cells with at least one trigger.
+             */
+            std::size_t getCellCount() const;
+
+            /** Returns the number of triggers with a slot.
+             */
+            std::size_t getTriggerCount() const;
+
+            void onInstanceEnteredCell(Cell* cell, Instance* instance) override;
+            void onInstanceExitedCell(Cell* cell, Instance* instance) override;
+            void onBlockingChangedCell(Cell* cell, CellTypeInfo type, bool blocks) override;
+            void onCellDeleted(Cell* cell) override;
+
+        private:
+            /** Sets the triggers of the cell that have the condition and are enabled for the instance.
+             * @param instance The instance that caused the event or nullptr, if the event has none.
+             */
+            void dispatch(Cell* cell, Instance* instance, TriggerCondition condition);
+
+            uint32_t getSlot(Trigger const * trigger) const;
+
+            // triggers by slot, nullptr for free slots
+            std::vector<Trigger*> m_triggers;
+            std::vector<uint32_t> m_freeSlots;
+            std::unordered_map<Trigger const *, uint32_t> m_slots;
+            // bitset of the assigned slots per cell, 64 slots per word
+            std::unordered_map<Cell*, std::vector<uint64_t>> m_cells;
+    };
+
+} // namespace FIFE
+
+#endif
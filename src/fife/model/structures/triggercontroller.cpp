@@ -19,6 +19,7 @@
 #include "map.h"
 #include "model/metamodel/modelcoords.h"
 #include "trigger.h"
+#include "triggercellindex.h"
 #include "util/log/logger.h"
 
 namespace FIFE
@@ -37,7 +38,7 @@ namespace FIFE
         }
     } // namespace
 
-    TriggerController::TriggerController(Map* map) : m_map(map)
+    TriggerController::TriggerController(Map* map) : m_map(map), m_cellIndex(std::make_unique<TriggerCellIndex>())
     {
     }
 
@@ -52,7 +53,9 @@ namespace FIFE
             // _log(),
             // std::format(
             // "TriggerController::createTrigger() - Trigger {} already exists.... ignoring.", triggerName));
+            return it->second.get();
         }
+        it->second->setCellIndex(m_cellIndex.get());
         return it->second.get();
     }
 
@@ -242,6 +245,11 @@ namespace FIFE
         return triggers;
     }
 
+    TriggerCellIndex* TriggerController::getCellIndex() const
+    {
+        return m_cellIndex.get();
+    }
+
     std::vector<std::string> TriggerController::getAllTriggerNames()
     {
         std::vector<std::string> names;
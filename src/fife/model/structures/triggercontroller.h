@@ -24,6 +24,7 @@
 namespace FIFE
 {
     class Trigger;
+    class TriggerCellIndex;
     class Map;
     class Layer;
     class Location;
@@ -34,6 +35,9 @@ namespace FIFE
      *
      *  You should never instantiate this class directly as Map does it
      *  when you create a new map.
+     *
+     *  The cells of the triggers are observed by one TriggerCellIndex, so cells are not
+     *  slowed down by the number of triggers that cover them.
      */
     class FIFE_API TriggerController : public FifeClass
     {
@@ -203,10 +207,17 @@ namespace FIFE
              */
             std::vector<std::string> getAllTriggerNames();
 
+            /** Returns the index of the cells the triggers are assigned to.
+             */
+            TriggerCellIndex* getCellIndex() const;
+
         private:
             //! Pointer to the map this controller is associated with.
             Map* m_map [[maybe_unused]]; // TODO: implement map-level trigger operations
 
+            //! Observes the cells of all triggers, declared before the triggers as they use it until they are deleted
+            std::unique_ptr<TriggerCellIndex> m_cellIndex;
+
             using TriggerNameMap              = std::map<std::string, std::unique_ptr<Trigger, void (*)(Trigger*)>>;
             using TriggerNameMapIterator      = TriggerNameMap::iterator;
             using TriggerNameMapConstIterator = TriggerNameMap::const_iterator;
@@ -36,6 +36,7 @@ namespace FIFE
         m_status(ROUTE_CREATED),
         m_startNode(start),
         m_endNode(end),
+        m_current(0),
         m_walked(0),
         m_sessionId(-1),
         m_rotation(0),
@@ -63,9 +64,7 @@ namespace FIFE
         m_startNode = node;
         if (m_status != ROUTE_CREATED) {
             m_status = ROUTE_CREATED;
-            if (!m_path.empty()) {
-                m_path.clear();
-            }
+            clearPath();
             m_walked = 1;
         }
     }
@@ -79,9 +78,9 @@ namespace FIFE
     {
         if (m_status != ROUTE_CREATED) {
             m_status = ROUTE_CREATED;
-            if (!m_path.empty()) {
-                m_startNode = *m_current;
-                m_path.clear();
+            if (!m_steps.empty()) {
+                m_startNode = getPathNode(getCursor());
+                clearPath();
             }
             m_walked = 1;
         }
@@ -93,116 +92,173 @@ namespace FIFE
         return m_endNode;
     }
 
-    Location const & Route::getCurrentNode()
+    Location Route::getCurrentNode() const
     {
-        if (m_path.empty()) {
+        if (m_steps.empty()) {
             return m_startNode;
         }
-        if (m_current == m_path.end()) {
-            return m_path.back();
-        }
-        return *m_current;
+        return getPathNode(getCursor());
     }
 
-    Location const & Route::getPreviousNode()
+    Location Route::getPreviousNode() const
     {
-        if (m_path.empty()) {
+        if (m_steps.empty()) {
             return m_startNode;
         }
-        if (m_current != m_path.begin()) {
-            --m_current;
-            Location const & loc = *m_current;
-            ++m_current;
-            return loc;
-        }
-        return *m_current;
+        uint32_t const cursor = getCursor();
+        return getPathNode(cursor != 0 ? cursor - 1 : cursor);
     }
 
-    Location const & Route::getNextNode()
+    Location Route::getNextNode() const
     {
-        if (m_path.empty()) {
+        if (m_steps.empty()) {
             return m_startNode;
         }
-        if (m_current != m_path.end()) {
-            ++m_current;
-            if (m_current != m_path.end()) {
-                Location const & loc = *m_current;
-                --m_current;
-                return loc;
-            }
-            --m_current;
-        }
-        return *m_current;
+        uint32_t const cursor = getCursor();
+        return getPathNode(std::cmp_less(cursor + 1, m_steps.size()) ? cursor + 1 : cursor);
     }
 
     bool Route::walkToNextNode(int32_t step)
     {
-        if (m_path.empty() || step == 0) {
+        if (m_steps.empty() || step == 0) {
             return false;
         }
 
         int64_t const pos = static_cast<int64_t>(m_walked) + static_cast<int64_t>(step);
-        if (pos < 0 || std::cmp_greater_equal(pos, m_path.size())) {
+        if (pos < 0 || std::cmp_greater_equal(pos, m_steps.size())) {
             return false;
         }
 
-        std::advance(m_current, step);
-        m_walked = static_cast<uint32_t>(pos);
+        m_current = static_cast<uint32_t>(static_cast<int64_t>(m_current) + step);
+        m_walked  = static_cast<uint32_t>(pos);
 
         return true;
     }
 
     bool Route::reachedEnd()
     {
-        if (m_path.empty()) {
+        if (m_steps.empty()) {
             return true;
         }
-        return m_current == m_path.end();
+        return std::cmp_greater_equal(m_current, m_steps.size());
     }
 
     void Route::setPath(Path const & path)
     {
-        m_path = path;
-        if (!m_path.empty()) {
+        clearPath();
+        if (!path.empty()) {
+            m_steps.reserve(path.size());
+            for (auto const & loc : path) {
+                if (m_stepLayers.empty() || m_stepLayers.back().second != loc.getLayer()) {
+                    m_stepLayers.emplace_back(static_cast<uint32_t>(m_steps.size()), loc.getLayer());
+                }
+                m_steps.push_back(loc.getLayerCoordinates());
+            }
+            m_firstStep = path.front().getExactLayerCoordinates();
+            m_status    = ROUTE_SOLVED;
+            m_startNode = path.front();
+            m_endNode   = path.back();
+        }
+        m_replanned = false;
+        m_walked    = 1;
+    }
+
+    void Route::setPath(Layer* layer, std::vector<ModelCoordinate> coordinates, ExactModelCoordinate const & start)
+    {
+        clearPath();
+        m_steps = std::move(coordinates);
+        if (!m_steps.empty()) {
+            m_steps.front() = doublePt2intPt(start);
+            m_stepLayers.emplace_back(0, layer);
+            m_firstStep = start;
             m_status    = ROUTE_SOLVED;
-            m_current   = m_path.begin();
-            m_startNode = m_path.front();
-            m_endNode   = m_path.back();
+            m_startNode = getPathNode(0);
+            m_endNode   = getPathNode(static_cast<uint32_t>(m_steps.size() - 1));
         }
         m_replanned = false;
         m_walked    = 1;
     }
 
-    Path const & Route::getPath()
+    Path Route::getPath() const
+    {
+        Path path;
+        for (uint32_t i = 0; std::cmp_less(i, m_steps.size()); ++i) {
+            path.push_back(getPathNode(i));
+        }
+        return path;
+    }
+
+    std::span<ModelCoordinate const> Route::getPathCoordinates() const
+    {
+        return m_steps;
+    }
+
+    Layer* Route::getPathLayer(uint32_t index) const
+    {
+        assert(std::cmp_less(index, m_steps.size()));
+        // most paths stay on one layer
+        if (m_stepLayers.size() == 1) {
+            return m_stepLayers.front().second;
+        }
+        auto it = std::ranges::upper_bound(m_stepLayers, index, {}, &std::pair<uint32_t, Layer*>::first);
+        return std::prev(it)->second;
+    }
+
+    Location Route::getPathNode(uint32_t index) const
+    {
+        Location loc(getPathLayer(index));
+        if (loc.getLayer() != nullptr) {
+            if (index == 0) {
+                loc.setExactLayerCoordinates(m_firstStep);
+            } else {
+                loc.setLayerCoordinates(m_steps[index]);
+            }
+        }
+        return loc;
+    }
+
+    void Route::clearPath()
+    {
+        m_steps.clear();
+        m_stepLayers.clear();
+        m_current = 0;
+    }
+
+    uint32_t Route::getCursor() const
     {
-        return m_path;
+        if (std::cmp_greater_equal(m_current, m_steps.size())) {
+            return static_cast<uint32_t>(m_steps.size() - 1);
+        }
+        return m_current;
     }
 
     void Route::cutPath(uint32_t length)
     {
         if (length == 0) {
-            if (!m_path.empty()) {
-                m_startNode = *m_current;
-                m_endNode   = *m_current;
-                m_path.clear();
-                m_current = m_path.end();
+            if (!m_steps.empty()) {
+                m_startNode = getPathNode(getCursor());
+                m_endNode   = m_startNode;
+                clearPath();
             }
             m_status    = ROUTE_CREATED;
             m_walked    = 1;
             m_replanned = true;
             return;
         }
-        if (!std::cmp_less(length, m_path.size())) {
+        if (!std::cmp_less(length, m_steps.size())) {
             return;
         }
 
         uint32_t const newend = m_walked + length - 1;
-        if (std::cmp_greater(newend, m_path.size())) {
+        if (std::cmp_greater(newend, m_steps.size())) {
             return;
         }
 
-        m_path.resize(newend);
-        m_endNode   = m_path.back();
+        m_steps.resize(newend);
+        std::erase_if(m_stepLayers, [newend](auto const & entry) {
+            return entry.first >= newend;
+        });
+        m_endNode   = getPathNode(newend - 1);
         m_replanned = true;
     }
 
@@ -216,10 +272,10 @@ namespace FIFE
         return m_replanned;
     }
 
-    uint32_t Route::getPathLength()
+    uint32_t Route::getPathLength() const
     {
-        assert(std::cmp_less_equal(m_path.size(), std::numeric_limits<uint32_t>::max()));
-        return static_cast<uint32_t>(m_path.size());
+        assert(std::cmp_less_equal(m_steps.size(), std::numeric_limits<uint32_t>::max()));
+        return static_cast<uint32_t>(m_steps.size());
     }
 
     uint32_t Route::getWalkedLength() const
@@ -324,37 +380,37 @@ namespace FIFE
     Path Route::getBlockingPathLocations()
     {
         Path p;
-        if (!m_path.empty()) {
-            // Check each path cell for blocking instances
-            for (auto& it : m_path) {
-                Layer* layer = it.getLayer();
-                if (layer != nullptr && layer->cellContainsBlockingInstance(it.getLayerCoordinates())) {
-                    p.push_back(it);
-                }
+        uint32_t const length = getPathLength();
+        // Check each path cell for blocking instances
+        for (uint32_t i = 0; i < length; ++i) {
+            Layer* layer = getPathLayer(i);
+            if (layer != nullptr && layer->cellContainsBlockingInstance(m_steps[i])) {
+                p.push_back(getPathNode(i));
             }
-            // For multi-cell, also check if any footprint cells at each path position are blocked
-            if (m_object != nullptr && m_object->isMultiObject()) {
-                for (auto const & it : m_path) {
-                    Layer* layer = it.getLayer();
-                    if (layer == nullptr) {
-                        continue;
-                    }
-                    CellGrid* grid = layer->getCellGrid();
-                    if (grid == nullptr) {
-                        continue;
-                    }
-                    std::vector<ModelCoordinate> const footprint =
-                        grid->toMultiCoordinates(it.getLayerCoordinates(), getOccupiedCells(m_rotation));
-                    for (auto const & fc : footprint) {
-                        if (layer->cellContainsBlockingInstance(fc)) {
-                            // Check if this blocker is part of the multi-cell's own path cells
-                            bool const isSelf = std::ranges::any_of(m_path, [&](auto const & pathCell) {
-                                return pathCell.getLayerCoordinates() == fc && pathCell.getLayer() == layer;
-                            });
-                            if (!isSelf) {
-                                p.push_back(it);
-                                break;
-                            }
+        }
+        // For multi-cell, also check if any footprint cells at each path position are blocked
+        if (m_object != nullptr && m_object->isMultiObject()) {
+            for (uint32_t i = 0; i < length; ++i) {
+                Layer* layer = getPathLayer(i);
+                if (layer == nullptr) {
+                    continue;
+                }
+                CellGrid* grid = layer->getCellGrid();
+                if (grid == nullptr) {
+                    continue;
+                }
+                std::vector<ModelCoordinate> const footprint =
+                    grid->toMultiCoordinates(m_steps[i], getOccupiedCells(m_rotation));
+                for (auto const & fc : footprint) {
+                    if (layer->cellContainsBlockingInstance(fc)) {
+                        // Check if this blocker is part of the multi-cell's own path cells
+                        bool isSelf = false;
+                        for (uint32_t j = 0; j < length && !isSelf; ++j) {
+                            isSelf = m_steps[j] == fc && getPathLayer(j) == layer;
+                        }
+                        if (!isSelf) {
+                            p.push_back(getPathNode(i));
+                            break;
                         }
                     }
                 }
@@ -375,13 +431,11 @@ namespace FIFE
 
     double Route::getTotalCost() const
     {
-        if (m_path.empty()) {
-            return 0.0;
-        }
         double cost           = 0.0;
-        Location const * prev = nullptr;
-        for (auto const & loc : m_path) {
-            Layer* layer = loc.getLayer();
+        Layer const * prev    = nullptr;
+        uint32_t const length = getPathLength();
+        for (uint32_t i = 0; i < length; ++i) {
+            Layer* layer = getPathLayer(i);
             if (layer == nullptr) {
                 continue;
             }
@@ -390,31 +444,29 @@ namespace FIFE
             if (cache == nullptr || grid == nullptr) {
                 continue;
             }
-            if (prev != nullptr && prev->getLayer() == layer) {
-                cost += grid->getAdjacentCost(loc.getLayerCoordinates(), prev->getLayerCoordinates());
+            if (prev == layer) {
+                cost += grid->getAdjacentCost(m_steps[i], m_steps[i - 1]);
             }
-            prev = &loc;
+            prev = layer;
         }
         return cost;
     }
 
     double Route::getRemainingCostFrom(Location const & pos) const
     {
-        if (m_path.empty()) {
-            return 0.0;
-        }
         double cost           = 0.0;
         bool found            = false;
-        Location const * prev = nullptr;
-        for (auto const & loc : m_path) {
-            if (!found && loc.getLayerCoordinates() == pos.getLayerCoordinates() && loc.getLayer() == pos.getLayer()) {
+        Layer const * prev    = nullptr;
+        uint32_t const length = getPathLength();
+        for (uint32_t i = 0; i < length; ++i) {
+            Layer* layer = getPathLayer(i);
+            if (!found && m_steps[i] == pos.getLayerCoordinates() && layer == pos.getLayer()) {
                 found = true;
             }
             if (!found) {
-                prev = &loc;
+                prev = layer;
                 continue;
             }
-            Layer const * layer = loc.getLayer();
             if (layer == nullptr) {
                 continue;
             }
@@ -422,10 +474,10 @@ namespace FIFE
             if (grid == nullptr) {
                 continue;
             }
-            if (prev != nullptr && prev->getLayer() == layer) {
-                cost += grid->getAdjacentCost(loc.getLayerCoordinates(), prev->getLayerCoordinates());
+            if (prev == layer) {
+                cost += grid->getAdjacentCost(m_steps[i], m_steps[i - 1]);
             }
-            prev = &loc;
+            prev = layer;
         }
         return cost;
     }
@@ -436,9 +488,10 @@ namespace FIFE
             return false;
         }
         // Find the cell in the new path closest to currentPos
-        auto bestIt     = newPath.begin();
-        double bestDist = std::numeric_limits<double>::max();
-        for (auto it = newPath.begin(); it != newPath.end(); ++it) {
+        uint32_t bestIndex = 0;
+        uint32_t index     = 0;
+        double bestDist    = std::numeric_limits<double>::max();
+        for (auto it = newPath.begin(); it != newPath.end(); ++it, ++index) {
             if (it->getLayer() != currentPos.getLayer()) {
                 continue;
             }
@@ -448,25 +501,18 @@ namespace FIFE
             double const dy          = static_cast<double>(mc.y - pc.y);
             double const dist        = (dx * dx) + (dy * dy);
             if (dist < bestDist) {
-                bestDist = dist;
-                bestIt   = it;
+                bestDist  = dist;
+                bestIndex = index;
             }
         }
         // Accept only if within 3 cells of current position
         if (bestDist > 9.0) {
             return false;
         }
-        // Walk the path iterator to the new current position
-        m_path    = newPath;
-        m_current = m_path.begin();
-        m_walked  = 1;
-        // Advance to the best position
-        for (auto it = m_path.begin(); it != bestIt; ++it, ++m_walked) {
-            ++m_current;
-        }
-        m_startNode = m_path.front();
-        m_endNode   = m_path.back();
-        m_status    = ROUTE_SOLVED;
+        // Continue the new path at the best position
+        setPath(newPath);
+        m_current   = bestIndex;
+        m_walked    = bestIndex + 1;
         m_replanned = true;
         return true;
     }
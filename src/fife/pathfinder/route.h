@@ -10,7 +10,9 @@
 // Standard C++ library includes
 #include <cstdint>
 #include <list>
+#include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 // 3rd party library includes
@@ -23,6 +25,7 @@
 namespace FIFE
 {
 
+    class Layer;
     class Location;
     class Object;
 
@@ -49,7 +52,8 @@ namespace FIFE
     /**
      * A basic route.
      *
-     * Holds the path and all related infos.
+     * Holds the path and all related infos. The path is stored as an array of cell coordinates and the layers
+     * they belong to, Locations are only created when they are asked for. Following the route does not allocate.
      */
     class FIFE_API Route : public FifeClass
     {
@@ -98,19 +102,19 @@ namespace FIFE
             Location const & getEndNode();
 
             /** Returns current location.
-             * @return A const reference to the currently used location.
+             * @return The currently used location.
              */
-            Location const & getCurrentNode();
+            Location getCurrentNode() const;
 
             /** Returns previous location.
-             * @return A const reference to the previous location.
+             * @return The previous location.
              */
-            Location const & getPreviousNode();
+            Location getPreviousNode() const;
 
             /** Returns next location.
-             * @return A const reference to the next location.
+             * @return The next location.
              */
-            Location const & getNextNode();
+            Location getNextNode() const;
 
             /** Changes the position on the path.
              * Changes the results of getCurrentNode(), getPreviousNode() and getPreviousNode().
@@ -125,14 +129,39 @@ namespace FIFE
             bool reachedEnd();
 
             /** Sets the path for the route.
+             * Only the first location keeps its exact coordinates, the others are stored as cell coordinates.
              * @param path A const reference to the path.
              */
             void setPath(Path const & path);
 
-            /** Returns the path.
+            /** Sets the path for the route from cells of one layer.
+             * @param layer The layer of the cells.
+             * @param coordinates The cell coordinates from start to end.
+             * @param start The exact coordinates of the first step.
+             */
+            void setPath(Layer* layer, std::vector<ModelCoordinate> coordinates, ExactModelCoordinate const & start);
+
+            /** Returns a copy of the path.
              * @return The path which contains all steps.
              */
-            Path const & getPath();
+            Path getPath() const;
+
+            /** Returns the cell coordinates of the path.
+             * @return A view of the coordinates, valid until the path changes.
+             */
+            std::span<ModelCoordinate const> getPathCoordinates() const;
+
+            /** Returns the layer of a step.
+             * @param index The index of the step, has to be smaller than the path length.
+             * @return A pointer to the layer.
+             */
+            Layer* getPathLayer(uint32_t index) const;
+
+            /** Returns the location of a step.
+             * @param index The index of the step, has to be smaller than the path length.
+             * @return The location.
+             */
+            Location getPathNode(uint32_t index) const;
 
             /** Cuts path after the given length.
              * @param length The new length of the path.
@@ -152,7 +181,7 @@ namespace FIFE
             /** Returns the length of the path.
              * @return The path length.
              */
-            uint32_t getPathLength();
+            uint32_t getPathLength() const;
 
             /** Returns the walked steps.
              * @return The number of walked steps.
@@ -265,8 +294,14 @@ namespace FIFE
             bool replacePathKeepingProgress(Path const & newPath, Location const & currentPos);
 
         private:
-            //! path iterator
-            using PathIterator = Path::iterator;
+            /** Removes the path and keeps the storage.
+             */
+            void clearPath();
+
+            /** Clamps the cursor to the last step.
+             */
+            uint32_t getCursor() const;
+
             //! search status
             RouteStatusInfo m_status;
 
@@ -276,11 +311,17 @@ namespace FIFE
             //! end location
             Location m_endNode;
 
-            //! path
-            Path m_path;
+            //! cell coordinates of the path
+            std::vector<ModelCoordinate> m_steps;
+
+            //! index of the first step on a layer and the layer, one entry per layer change
+            std::vector<std::pair<uint32_t, Layer*>> m_stepLayers;
+
+            //! exact coordinates of the first step
+            ExactModelCoordinate m_firstStep;
 
             //! current position on the path
-            PathIterator m_current;
+            uint32_t m_current;
 
             //! walked steps on the path
             uint32_t m_walked;
@@ -68,8 +68,8 @@ namespace FIFE
 
         // if end zone is invalid (static blocker) then change it
         if (m_endZone == nullptr) {
-            Cell* endcell                        = m_endCache->getCell(m_to.getLayerCoordinates());
-            std::vector<Cell*> const & neighbors = endcell->getNeighbors();
+            Cell* endcell                 = m_endCache->getCell(m_to.getLayerCoordinates());
+            CellNeighbors const neighbors = endcell->getNeighbors();
             for (auto* neighbor : neighbors) {
                 Zone* tmpzone = neighbor->getZone();
                 if (tmpzone != nullptr) {
@@ -91,7 +91,7 @@ namespace FIFE
         }
         // if it is a protected cell it can have a second startzone
         if (m_betweenTargets.empty() && startCell->isZoneProtected()) {
-            std::vector<Cell*> const & neighbors = startCell->getNeighbors();
+            CellNeighbors const neighbors = startCell->getNeighbors();
             for (auto* neighbor : neighbors) {
                 Zone* tmpzone = neighbor->getZone();
                 if (tmpzone != nullptr) {
@@ -192,12 +192,12 @@ namespace FIFE
         if (nextCell == nullptr) {
             return;
         }
-        int32_t const cellZ                  = nextCell->getLayerCoordinates().z;
-        int32_t const maxZ                   = m_route->getZStepRange();
-        bool const zLimited                  = maxZ != -1;
-        uint8_t const blockerThreshold       = m_ignoreDynamicBlockers ? 2 : 1;
-        bool const limitedArea               = m_route->isAreaLimited();
-        std::vector<Cell*> const & adjacents = nextCell->getNeighbors();
+        int32_t const cellZ            = nextCell->getLayerCoordinates().z;
+        int32_t const maxZ             = m_route->getZStepRange();
+        bool const zLimited            = maxZ != -1;
+        uint8_t const blockerThreshold = m_ignoreDynamicBlockers ? 2 : 1;
+        bool const limitedArea         = m_route->isAreaLimited();
+        CellNeighbors const adjacents  = nextCell->getNeighbors();
         if (adjacents.empty()) {
             return;
         }
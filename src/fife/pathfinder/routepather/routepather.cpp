@@ -28,6 +28,7 @@
 #include "routepathersearch.h"
 #include "singlelayersearch.h"
 #include "util/math/angles.h"
+#include "util/time/profiler.h"
 
 namespace FIFE
 {
@@ -51,6 +52,7 @@ namespace FIFE
 
     void RoutePather::update()
     {
+        FIFE_PROFILE_ZONE("RoutePather::update");
         int32_t ticksleft = m_maxTicks;
         while (ticksleft > 0) {
             if (m_sessions.empty()) {
@@ -168,8 +170,8 @@ namespace FIFE
             if (startZone != endZone) {
                 // look for special cases (start is zone border or end is static blocker)
                 if ((endZone == nullptr) || startCell->isZoneProtected()) {
-                    bool found                           = false;
-                    std::vector<Cell*> const & neighbors = endCell->getNeighbors();
+                    bool found                    = false;
+                    CellNeighbors const neighbors = endCell->getNeighbors();
                     for (auto* neighbor : neighbors) {
                         Zone const * tmpZone = neighbor->getZone();
                         if (tmpZone != nullptr) {
@@ -181,7 +183,7 @@ namespace FIFE
                         }
                     }
                     if (!found && startCell->isZoneProtected()) {
-                        std::vector<Cell*> const & startNeighbors = startCell->getNeighbors();
+                        CellNeighbors const startNeighbors = startCell->getNeighbors();
                         for (auto* neighbor : startNeighbors) {
                             Zone const * tmpZone = neighbor->getZone();
                             if (tmpZone != nullptr) {
@@ -216,7 +218,7 @@ namespace FIFE
                 }
             }
             if (!sameAreas) {
-                std::vector<Cell*> const & neighbors = endCell->getNeighbors();
+                CellNeighbors const neighbors = endCell->getNeighbors();
                 if (neighbors.empty()) {
                     return false;
                 }
@@ -289,8 +291,7 @@ namespace FIFE
 
     bool RoutePather::followRoute(Location const & current, Route* route, double speed, Location& nextLocation)
     {
-        Path const path = route->getPath();
-        if (path.empty()) {
+        if (route->getPathLength() == 0) {
             return false;
         }
         if (Mathd::Equal(speed, 0.0)) {
@@ -385,7 +386,7 @@ namespace FIFE
         if (!Mathd::Equal(distance, 0.0) && !pop) {
             Location const prevNode      = route->getPreviousNode();
             CellCache* prevCache         = prevNode.getLayer()->getCellCache();
-            ExactModelCoordinate prevPos = route->getPreviousNode().getMapCoordinates();
+            ExactModelCoordinate prevPos = prevNode.getMapCoordinates();
             tmpCell                      = prevCache->getCell(prevNode.getLayerCoordinates());
             if (tmpCell != nullptr) {
                 CellGrid const * prevGrid = prevNode.getLayer()->getCellGrid();
@@ -13,6 +13,7 @@
 #include <limits>
 #include <list>
 #include <string>
+#include <utility>
 #include <vector>
 
 // 3rd party library includes
@@ -121,12 +122,12 @@ namespace FIFE
         if (nextCell == nullptr) {
             return;
         }
-        int32_t const cellZ                  = nextCell->getLayerCoordinates().z;
-        int32_t const maxZ                   = m_route->getZStepRange();
-        bool const zLimited                  = maxZ != -1;
-        uint8_t const blockerThreshold       = m_ignoreDynamicBlockers ? 2 : 1;
-        bool const limitedArea               = m_route->isAreaLimited();
-        std::vector<Cell*> const & adjacents = nextCell->getNeighbors();
+        int32_t const cellZ            = nextCell->getLayerCoordinates().z;
+        int32_t const maxZ             = m_route->getZStepRange();
+        bool const zLimited            = maxZ != -1;
+        uint8_t const blockerThreshold = m_ignoreDynamicBlockers ? 2 : 1;
+        bool const limitedArea         = m_route->isAreaLimited();
+        CellNeighbors const adjacents  = nextCell->getNeighbors();
         for (auto* adjacent : adjacents) {
             if (adjacent == nullptr) {
                 continue;
@@ -157,7 +158,7 @@ namespace FIFE
                 // Spatial early-out: if adjacent cell and all its neighbors are unblocked,
                 // skip the expensive footprint expansion (W5-T2)
                 bool const spatialEarlyOut = !blocker && [&]() {
-                    auto const & adjNbrs = adjacent->getNeighbors();
+                    auto const adjNbrs = adjacent->getNeighbors();
                     return std::ranges::all_of(adjNbrs, [&](auto* nbr) {
                         return nbr == nullptr || nbr->getCellType() <= blockerThreshold;
                     });
@@ -282,11 +283,10 @@ namespace FIFE
     {
         int32_t current   = m_destCoordInt;
         int32_t const end = m_startCoordInt;
-        Path path;
-        Location newnode(m_cellCache->getLayer());
+        // the path is collected from the end to the start
+        std::vector<ModelCoordinate> path;
         // This assures that the agent always steps into the center of the cell.
-        newnode.setExactLayerCoordinates(FIFE::intPt2doublePt(m_to.getLayerCoordinates()));
-        path.push_back(newnode);
+        path.push_back(m_to.getLayerCoordinates());
         while (current != end) {
             std::size_t const currentIndex = toIndex(current);
             if (m_spt.at(currentIndex) < 0) {
@@ -295,12 +295,10 @@ namespace FIFE
                 m_route->setRouteStatus(ROUTE_FAILED);
                 break;
             }
-            current                            = m_spt.at(currentIndex);
-            ModelCoordinate const currentCoord = m_cellCache->convertIntToCoord(current);
-            newnode.setLayerCoordinates(currentCoord);
-            path.push_front(newnode);
+            current = m_spt.at(currentIndex);
+            path.push_back(m_cellCache->convertIntToCoord(current));
         }
-        path.front().setExactLayerCoordinates(m_from.getExactLayerCoordinatesRef());
-        m_route->setPath(path);
+        std::ranges::reverse(path);
+        m_route->setPath(m_cellCache->getLayer(), std::move(path), m_from.getExactLayerCoordinatesRef());
     }
 } // namespace FIFE
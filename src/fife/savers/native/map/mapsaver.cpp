@@ -9,6 +9,7 @@
 #include <list>
 #include <memory>
 #include <set>
+#include <span>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -23,6 +24,7 @@
 #include "model/structures/instance.h"
 #include "model/structures/layer.h"
 #include "model/structures/map.h"
+#include "model/structures/tilegrid.h"
 #include "model/structures/trigger.h"
 #include "model/structures/triggercontroller.h"
 #include "savers/native/map/animationsaver.h"
@@ -197,6 +199,7 @@ namespace FIFE
                 instancesElement->InsertEndChild(instanceElement);
             }
 
+            writeLayerTiles(*layer, doc, layerElement);
             writeLayerLights(map, *layer, doc, layerElement);
         }
         // add cellcaches tag to document
@@ -233,7 +236,7 @@ namespace FIFE
                     std::vector<std::string> cellAreaIds;
                     bool areasEmpty = areaIds.empty();
                     if (!areasEmpty) {
-                        std::set<Instance*> const & cellInstances = cell->getInstances();
+                        std::span<Instance* const> const cellInstances = cell->getInstances();
                         if (!cellInstances.empty()) {
                             auto area_it = areaIds.begin();
                             for (; area_it != areaIds.end(); ++area_it) {
@@ -433,6 +436,50 @@ namespace FIFE
         doc.SaveFile(filename.c_str());
     }
 
+    void MapSaver::writeLayerTiles(Layer const & layer, XML::Document& doc, XML::Element* layerElement)
+    {
+        TileGrid const * tiles = layer.getTileGrid();
+        if (tiles == nullptr || tiles->getTileCount() == 0) {
+            return;
+        }
+
+        XML::Element* tilesElement = doc.NewElement("tiles");
+        layerElement->InsertEndChild(tilesElement);
+
+        // like the instances, x and y are left out when the tile follows the previous one in its row
+        std::string currentNamespace;
+        bool first        = true;
+        int32_t lastX     = 0;
+        int32_t lastY     = 0;
+        Rect const & area = tiles->getArea();
+        for (int32_t y = area.y; y < area.bottom(); ++y) {
+            for (int32_t x = area.x; x < area.right(); ++x) {
+                Object const * obj = tiles->getTile(ModelCoordinate(x, y));
+                if (obj == nullptr) {
+                    continue;
+                }
+
+                XML::Element* tileElement = doc.NewElement("t");
+                if (currentNamespace != obj->getNamespace()) {
+                    tileElement->SetAttribute("ns", obj->getNamespace().c_str());
+                    currentNamespace = obj->getNamespace();
+                }
+                tileElement->SetAttribute("o", obj->getName().c_str());
+                if (first || y != lastY || x != lastX + 1) {
+                    tileElement->SetAttribute("x", x);
+                }
+                if (first || y != lastY) {
+                    tileElement->SetAttribute("y", y);
+                }
+                tilesElement->InsertEndChild(tileElement);
+
+                first = false;
+                lastX = x;
+                lastY = y;
+            }
+        }
+    }
+
     void MapSaver::writeLayerLights(
         Map const & map, Layer const & layer, XML::Document& doc, XML::Element* layerElement)
     {
@@ -51,6 +51,7 @@ namespace FIFE
                 Map const & map, std::string const & filename, std::vector<std::string> const & importFiles) override;
 
         private:
+            void writeLayerTiles(Layer const & layer, XML::Document& doc, XML::Element* layerElement);
             void writeLayerLights(Map const & map, Layer const & layer, XML::Document& doc, XML::Element* layerElement);
 
             ObjectSaverPtr m_objectSaver;
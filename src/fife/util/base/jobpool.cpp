@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Corresponding header include
+#include "jobpool.h"
+
+// Standard C++ library includes
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Platform specific includes
+
+// 3rd party library includes
+
+// FIFE includes
+
+namespace FIFE
+{
+
+    JobPool::JobPool(uint32_t workers) :
+        m_job(nullptr), m_count(0), m_next(0), m_batch(0), m_busy(0), m_quit(false)
+    {
+        m_workers.reserve(workers);
+        for (uint32_t i = 0; i < workers; ++i) {
+            m_workers.emplace_back(&JobPool::run, this);
+        }
+    }
+
+    JobPool::~JobPool()
+    {
+        {
+            std::scoped_lock const lock(m_mutex);
+            m_quit = true;
+        }
+        m_wake.notify_all();
+        for (auto& worker : m_workers) {
+            worker.join();
+        }
+    }
+
+    uint32_t JobPool::getWorkerCount() const
+    {
+        return static_cast<uint32_t>(m_workers.size());
+    }
+
+    void JobPool::parallelFor(size_t count, std::function<void(size_t)> const & job)
+    {
+        if (count == 0) {
+            return;
+        }
+        if (m_workers.empty() || count == 1) {
+            for (size_t i = 0; i < count; ++i) {
+                job(i);
+            }
+            return;
+        }
+
+        {
+            std::scoped_lock const lock(m_mutex);
+            m_job   = &job;
+            m_count = count;
+            m_next.store(0, std::memory_order_relaxed);
+            m_busy  = static_cast<uint32_t>(m_workers.size());
+            m_error = nullptr;
+            ++m_batch;
+        }
+        m_wake.notify_all();
+
+        work();
+
+        std::exception_ptr error;
+        {
+            std::unique_lock lock(m_mutex);
+            m_done.wait(lock, [this] {
+                return m_busy == 0;
+            });
+            m_job = nullptr;
+            error = std::exchange(m_error, nullptr);
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    void JobPool::run()
+    {
+        uint64_t batch = 0;
+        while (true) {
+            {
+                std::unique_lock lock(m_mutex);
+                m_wake.wait(lock, [this, batch] {
+                    return m_quit || m_batch != batch;
+                });
+                if (m_quit) {
+                    return;
+                }
+                batch = m_batch;
+            }
+
+            work();
+
+            std::scoped_lock const lock(m_mutex);
+            if (--m_busy == 0) {
+                m_done.notify_one();
+            }
+        }
+    }
+
+    void JobPool::work()
+    {
+        try {
+            size_t i = m_next.fetch_add(1, std::memory_order_relaxed);
+            while (i < m_count) {
+                (*m_job)(i);
+                i = m_next.fetch_add(1, std::memory_order_relaxed);
+            }
+        } catch (...) {
+            std::scoped_lock const lock(m_mutex);
+            if (!m_error) {
+                m_error = std::current_exception();
+            }
+            // let the others run out of indices
+            m_next.store(m_count, std::memory_order_relaxed);
+        }
+    }
+} // namespace FIFE
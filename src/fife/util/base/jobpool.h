@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+#ifndef FIFE_UTIL_BASE_JOBPOOL_H
+#define FIFE_UTIL_BASE_JOBPOOL_H
+
+// Platform specific includes
+#include "platform.h"
+
+// Standard C++ library includes
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// 3rd party library includes
+
+// FIFE includes
+#include "util/base/singleton.h"
+
+namespace FIFE
+{
+
+    /** Fixed set of worker threads for data parallel work inside a frame.
+     *
+     * parallelFor() hands out the indices of a batch to the workers and to the
+     * calling thread and returns once all of them are done. Only one batch runs
+     * at a time and the jobs must not start another batch. With no workers every
+     * batch simply runs on the calling thread.
+     *
+     * The Engine creates the pool with EngineSettings::getJobThreads() workers.
+     */
+    class FIFE_API JobPool : public DynamicSingleton<JobPool>
+    {
+        public:
+            /** Constructor.
+             *
+             * @param workers Number of worker threads, the calling thread always works along.
+             */
+            explicit JobPool(uint32_t workers);
+
+            JobPool(JobPool const &)            = delete;
+            JobPool& operator=(JobPool const &) = delete;
+
+            /** Destructor, joins the workers.
+             */
+            ~JobPool();
+
+            /** Returns the number of worker threads.
+             */
+            uint32_t getWorkerCount() const;
+
+            /** Calls job for every index in [0, count) and waits until all calls returned.
+             *
+             * The indices are handed out in ascending order, but the calls may run in any
+             * order and concurrently. If a job throws, the first exception is rethrown here
+             * after the batch finished.
+             */
+            void parallelFor(size_t count, std::function<void(size_t)> const & job);
+
+        private:
+            /** Worker thread loop.
+             */
+            void run();
+
+            /** Calls the job for indices until the batch is exhausted.
+             */
+            void work();
+
+            std::vector<std::thread> m_workers;
+            std::mutex m_mutex;
+            // signals workers a new batch or the shutdown
+            std::condition_variable m_wake;
+            // signals the caller that the last worker left the batch
+            std::condition_variable m_done;
+
+            // current batch, only changed while no worker is inside a batch
+            std::function<void(size_t)> const * m_job;
+            size_t m_count;
+            std::atomic<size_t> m_next;
+            // number of the current batch, workers wait for it to change
+            uint64_t m_batch;
+            // workers that did not yet leave the current batch
+            uint32_t m_busy;
+            std::exception_ptr m_error;
+            bool m_quit;
+    };
+} // namespace FIFE
+
+#endif
@@ -5,6 +5,7 @@
 #define FIFE_LOG_CONFIG_HPP
 
 #include <cstddef>
+#include <cstdint>
 #include <string>
 
 #ifdef LOG_ENABLED
@@ -14,6 +15,15 @@
 namespace FIFE
 {
 
+    /**
+     * What an asynchronous log does with a message while its queue is full.
+     */
+    enum class LogOverflowPolicy : uint8_t
+    {
+        Drop  = 0, /**< Discard the message and count it. */
+        Block = 1  /**< Wait until the flush thread made room. */
+    };
+
     /**
      * Logging configuration for the LogManager.
      *
@@ -28,6 +38,11 @@ namespace FIFE
             std::size_t file_max_size = static_cast<std::size_t>(5) * 1024 * 1024; // 5 MB
             int file_max_files        = 3;
 
+            // Hands messages to a background flush thread instead of writing them in the calling thread.
+            bool async_enabled               = false;
+            std::size_t async_queue_size     = 4096;
+            LogOverflowPolicy async_overflow = LogOverflowPolicy::Drop;
+
 #ifdef LOG_ENABLED
             spdlog::level::level_enum default_level = spdlog::level::info;
 #else
@@ -11,6 +11,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -99,10 +100,16 @@ namespace FIFE
 #endif
     }
 
-    void Logger::log(LogManager::LogLevel level, std::string const & msg)
+    void Logger::log(LogManager::LogLevel level, std::string_view msg)
     {
 #ifdef LOG_ENABLED
         if (m_logger != nullptr) {
+            if (level == LogManager::LEVEL_PANIC) {
+                // the queued messages lead up to the panic
+                LogManager::instance().flush();
+            } else if (LogManager::instance().logAsync(m_module, level, msg)) {
+                return;
+            }
             auto spd_level = static_cast<spdlog::level::level_enum>(level);
             m_logger->log(spd_level, msg);
             if (level == LogManager::LEVEL_PANIC) {
@@ -130,6 +137,7 @@ namespace FIFE
         m_config = cfg;
 #ifdef LOG_ENABLED
         rebuildSinks();
+        updateQueue();
 #endif
     }
 
@@ -196,6 +204,58 @@ namespace FIFE
         return m_config.file_enabled;
     }
 
+    void LogManager::setAsync(bool async)
+    {
+        LogConfig cfg     = m_config;
+        cfg.async_enabled = async;
+        configure(cfg);
+    }
+
+    bool LogManager::isAsync() const
+    {
+        return m_config.async_enabled;
+    }
+
+    void LogManager::setOverflowPolicy(LogOverflowPolicy policy)
+    {
+        LogConfig cfg      = m_config;
+        cfg.async_overflow = policy;
+        configure(cfg);
+    }
+
+    LogOverflowPolicy LogManager::getOverflowPolicy() const
+    {
+        return m_config.async_overflow;
+    }
+
+    uint64_t LogManager::getDroppedMessageCount()
+    {
+        std::scoped_lock const lock(m_config_mutex);
+        return m_queue ? m_queue->getDroppedCount() : 0;
+    }
+
+    void LogManager::flush()
+    {
+        std::scoped_lock const lock(m_config_mutex);
+        if (m_queue) {
+            m_queue->flush();
+        }
+#ifdef LOG_ENABLED
+        if (m_root_logger) {
+            m_root_logger->flush();
+        }
+#endif
+    }
+
+    bool LogManager::logAsync(logmodule_t module, LogLevel level, std::string_view msg)
+    {
+        if (!m_async.load(std::memory_order_acquire)) {
+            return false;
+        }
+        m_queue->push(module, level, msg);
+        return true;
+    }
+
     bool LogManager::isVisible(logmodule_t module)
     {
         if (!isValidModule(module)) {
@@ -211,6 +271,11 @@ namespace FIFE
         return true;
     }
 
+    bool LogManager::isLogged(logmodule_t module, LogLevel level)
+    {
+        return level >= m_level && isVisible(module);
+    }
+
     char const * LogManager::getModuleName(logmodule_t module)
     {
         if (!isValidModule(module)) {
@@ -261,6 +326,9 @@ namespace FIFE
         m_root_logger(nullptr),
         m_dist_sink(nullptr)
 #endif
+        ,
+        m_queue(nullptr),
+        m_async(false)
     {
         validateModuleDescription(LM_CORE);
         clearVisibleModules();
@@ -326,6 +394,36 @@ namespace FIFE
             m_loggers[i] = module_logger.get();
         }
     }
+
+    void LogManager::updateQueue()
+    {
+        if (m_config.async_enabled && !m_queue) {
+            m_queue = std::make_unique<LogQueue>(m_config.async_queue_size, [this](LogQueue::Entry const & entry) {
+                writeEntry(entry);
+            });
+        }
+        if (!m_queue) {
+            return;
+        }
+        m_queue->setOverflowPolicy(m_config.async_overflow);
+        m_async.store(m_config.async_enabled, std::memory_order_release);
+        if (!m_config.async_enabled) {
+            // later messages are written synchronously, so write the queued ones first
+            m_queue->flush();
+        }
+    }
+
+    void LogManager::writeEntry(LogQueue::Entry const & entry)
+    {
+        spdlog::logger* logger = m_loggers[static_cast<size_t>(entry.module)];
+        if (logger != nullptr) {
+            logger->log(
+                entry.time,
+                spdlog::source_loc{},
+                static_cast<spdlog::level::level_enum>(entry.level),
+                spdlog::string_view_t(entry.text, entry.length));
+        }
+    }
 #endif
 
 } // namespace FIFE
@@ -8,10 +8,14 @@
 #include "platform.h"
 
 // Standard C++ library includes
+#include <array>
+#include <atomic>
 #include <cstdint>
+#include <format>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -25,6 +29,7 @@
 
 // FIFE includes
 #include "config.hpp"
+#include "logqueue.h"
 #include "modules.h"
 #include "util/base/fife_stdint.h"
 
@@ -52,6 +57,7 @@ namespace FIFE
      *   - Filter messages by module visibility (modules.h).
      *   - Route visible messages to spdlog sinks (color console, rotating file).
      *   - Lazily create a file sink, if enabled
+     *   - Optionally hand messages to a flush thread (LogConfig::async_enabled)
      *
      * Use the FL_DBG / FL_LOG / FL_WARN / FL_ERR / FL_PANIC macros instead
      * of calling LogManager or Logger methods directly.
@@ -153,6 +159,14 @@ namespace FIFE
              */
             bool isVisible(logmodule_t module);
 
+            /**
+             *  Checks whether a message passes the module and level filters.
+             * @param module  Module of the message.
+             * @param level   Severity of the message.
+             * @return true if the module is visible and @p level is at least the level filter.
+             */
+            bool isLogged(logmodule_t module, LogLevel level);
+
             /**
              *  Enables or disables console output.
              * @param logtoprompt  true to enable the color console sink.
@@ -186,6 +200,51 @@ namespace FIFE
              */
             bool isLogToFile() const;
 
+            /**
+             *  Enables or disables asynchronous output.
+             * @param async  true to write messages in a background flush thread.
+             *
+             * The logging threads then only copy their messages into a bounded
+             * queue, messages longer than LogQueue::MESSAGE_CAPACITY are
+             * truncated. Panic messages are always written synchronously after
+             * the queue was flushed.
+             *
+             * This is a shorthand for configure() that toggles only the
+             * async_enabled flag.
+             */
+            void setAsync(bool async);
+
+            /**
+             *  Returns whether asynchronous output is enabled.
+             * @return true if messages are written by the flush thread.
+             */
+            bool isAsync() const;
+
+            /**
+             *  Sets what happens to a message while the queue is full.
+             * @param policy  Drop the message or wait for the flush thread.
+             */
+            void setOverflowPolicy(LogOverflowPolicy policy);
+
+            /**
+             *  Returns the policy for a full queue.
+             * @return The active LogOverflowPolicy.
+             */
+            LogOverflowPolicy getOverflowPolicy() const;
+
+            /**
+             *  Returns the number of messages dropped because the queue was full.
+             * @return Dropped message count since the queue was created.
+             */
+            uint64_t getDroppedMessageCount();
+
+            /**
+             *  Writes all queued messages and flushes the sinks.
+             *
+             * Returns after the messages logged before the call were written.
+             */
+            void flush();
+
             /**
              *  Returns the human-readable display name of a module.
              * @param module  Module identifier.
@@ -206,6 +265,14 @@ namespace FIFE
             spdlog::logger* getSpdlogLogger(logmodule_t module);
 #endif
 
+            /**
+             *  Queues a message for the flush thread.
+             * @return false if asynchronous output is disabled.
+             *
+             * @internal Used internally by the Logger class.
+             */
+            bool logAsync(logmodule_t module, LogLevel level, std::string_view msg);
+
         private:
             // Only instance() may construct a LogManager.
             LogManager();
@@ -216,6 +283,12 @@ namespace FIFE
 #ifdef LOG_ENABLED
             /** Rebuild all sinks and propagate them to every registered logger. */
             void rebuildSinks();
+
+            /** Create the queue on first use and apply the async settings. */
+            void updateQueue();
+
+            /** Write a queued message, called by the flush thread. */
+            void writeEntry(LogQueue::Entry const & entry);
 #endif
 
             std::mutex m_config_mutex;
@@ -229,6 +302,10 @@ namespace FIFE
             std::shared_ptr<spdlog::logger> m_root_logger;
             std::shared_ptr<spdlog::sinks::dist_sink_mt> m_dist_sink;
 #endif
+
+            // Created when async output is first enabled, then kept so racing loggers never see it vanish.
+            std::unique_ptr<LogQueue> m_queue;
+            std::atomic<bool> m_async;
     };
 
     /**
@@ -275,7 +352,33 @@ namespace FIFE
              * If @p level is LEVEL_PANIC the process calls std::abort()
              * after flushing the log.
              */
-            void log(LogManager::LogLevel level, std::string const & msg);
+            void log(LogManager::LogLevel level, std::string_view msg);
+
+            /**
+             *  Formats and logs a message at the given severity.
+             * @param level  Severity level.
+             * @param fmt    std::format format string.
+             * @param args   Arguments of the format string.
+             *
+             * Messages up to LogQueue::MESSAGE_CAPACITY characters are formatted
+             * into a stack buffer, so they are logged without allocating.
+             */
+            template <typename... Args>
+            void logFormat(
+                [[maybe_unused]] LogManager::LogLevel level,
+                [[maybe_unused]] std::format_string<Args const &...> fmt,
+                [[maybe_unused]] Args const &... args)
+            {
+                if constexpr (kLogEnabled) {
+                    std::array<char, LogQueue::MESSAGE_CAPACITY> buffer;
+                    auto const result = std::format_to_n(buffer.data(), buffer.size(), fmt, args...);
+                    if (std::cmp_less_equal(result.size, buffer.size())) {
+                        log(level, std::string_view(buffer.data(), static_cast<std::size_t>(result.size)));
+                    } else {
+                        log(level, std::format(fmt, args...));
+                    }
+                }
+            }
 
             /**
              *  Returns the module associated with this logger.
@@ -300,60 +403,130 @@ namespace FIFE
      * @param msg    Message to log (string literal, std::string, or std::format result).
      *
      * These are inline template functions (not macros) that first check whether
-     * the logger's module is visible via LogManager::isVisible() before logging.
+     * the message passes the module and level filters via LogManager::isLogged()
+     * before logging.
      * When @c LOG_ENABLED is not defined the function body is eliminated by
      * @c if constexpr and the compiler may elide the call entirely.
+     *
+     * Given a format string and its arguments, as in
+     * @code FL_DBG(_log(), "Path of {} has {} nodes", id, count); @endcode
+     * the message is only formatted if it passes the filters.
      */
     template <typename Msg>
     inline void FL_DBG([[maybe_unused]] Logger& logger, [[maybe_unused]] Msg&& msg)
     {
         if constexpr (kLogEnabled) {
-            if (LogManager::instance().isVisible(logger.getModule())) {
+            if (LogManager::instance().isLogged(logger.getModule(), LogManager::LEVEL_DEBUG)) {
                 logger.log(LogManager::LEVEL_DEBUG, std::forward<Msg>(msg));
             }
         }
     }
 
+    template <typename... Args>
+    inline void FL_DBG(
+        [[maybe_unused]] Logger& logger,
+        [[maybe_unused]] std::format_string<Args const &...> fmt,
+        [[maybe_unused]] Args const &... args)
+    {
+        if constexpr (kLogEnabled) {
+            if (LogManager::instance().isLogged(logger.getModule(), LogManager::LEVEL_DEBUG)) {
+                logger.logFormat(LogManager::LEVEL_DEBUG, fmt, args...);
+            }
+        }
+    }
+
     template <typename Msg>
     inline void FL_LOG([[maybe_unused]] Logger& logger, [[maybe_unused]] Msg&& msg)
     {
         if constexpr (kLogEnabled) {
-            if (LogManager::instance().isVisible(logger.getModule())) {
+            if (LogManager::instance().isLogged(logger.getModule(), LogManager::LEVEL_LOG)) {
                 logger.log(LogManager::LEVEL_LOG, std::forward<Msg>(msg));
             }
         }
     }
 
+    template <typename... Args>
+    inline void FL_LOG(
+        [[maybe_unused]] Logger& logger,
+        [[maybe_unused]] std::format_string<Args const &...> fmt,
+        [[maybe_unused]] Args const &... args)
+    {
+        if constexpr (kLogEnabled) {
+            if (LogManager::instance().isLogged(logger.getModule(), LogManager::LEVEL_LOG)) {
+                logger.logFormat(LogManager::LEVEL_LOG, fmt, args...);
+            }
+        }
+    }
+
     template <typename Msg>
     inline void FL_WARN([[maybe_unused]] Logger& logger, [[maybe_unused]] Msg&& msg)
     {
         if constexpr (kLogEnabled) {
-            if (LogManager::instance().isVisible(logger.getModule())) {
+            if (LogManager::instance().isLogged(logger.getModule(), LogManager::LEVEL_WARN)) {
                 logger.log(LogManager::LEVEL_WARN, std::forward<Msg>(msg));
             }
         }
     }
 
+    template <typename... Args>
+    inline void FL_WARN(
+        [[maybe_unused]] Logger& logger,
+        [[maybe_unused]] std::format_string<Args const &...> fmt,
+        [[maybe_unused]] Args const &... args)
+    {
+        if constexpr (kLogEnabled) {
+            if (LogManager::instance().isLogged(logger.getModule(), LogManager::LEVEL_WARN)) {
+                logger.logFormat(LogManager::LEVEL_WARN, fmt, args...);
+            }
+        }
+    }
+
     template <typename Msg>
     inline void FL_ERR([[maybe_unused]] Logger& logger, [[maybe_unused]] Msg&& msg)
     {
         if constexpr (kLogEnabled) {
-            if (LogManager::instance().isVisible(logger.getModule())) {
+            if (LogManager::instance().isLogged(logger.getModule(), LogManager::LEVEL_ERROR)) {
                 logger.log(LogManager::LEVEL_ERROR, std::forward<Msg>(msg));
             }
         }
     }
 
+    template <typename... Args>
+    inline void FL_ERR(
+        [[maybe_unused]] Logger& logger,
+        [[maybe_unused]] std::format_string<Args const &...> fmt,
+        [[maybe_unused]] Args const &... args)
+    {
+        if constexpr (kLogEnabled) {
+            if (LogManager::instance().isLogged(logger.getModule(), LogManager::LEVEL_ERROR)) {
+                logger.logFormat(LogManager::LEVEL_ERROR, fmt, args...);
+            }
+        }
+    }
+
     template <typename Msg>
     inline void FL_PANIC([[maybe_unused]] Logger& logger, [[maybe_unused]] Msg&& msg)
     {
         if constexpr (kLogEnabled) {
-            if (LogManager::instance().isVisible(logger.getModule())) {
+            if (LogManager::instance().isLogged(logger.getModule(), LogManager::LEVEL_PANIC)) {
                 logger.log(LogManager::LEVEL_PANIC, std::forward<Msg>(msg));
             }
         }
     }
 
+    template <typename... Args>
+    inline void FL_PANIC(
+        [[maybe_unused]] Logger& logger,
+        [[maybe_unused]] std::format_string<Args const &...> fmt,
+        [[maybe_unused]] Args const &... args)
+    {
+        if constexpr (kLogEnabled) {
+            if (LogManager::instance().isLogged(logger.getModule(), LogManager::LEVEL_PANIC)) {
+                logger.logFormat(LogManager::LEVEL_PANIC, fmt, args...);
+            }
+        }
+    }
+
 } // namespace FIFE
 
 #endif
@@ -10,7 +10,10 @@
 %template(moduleVector) std::vector<logmodule_t>;
 
 namespace FIFE {
-
+	enum class LogOverflowPolicy {
+		Drop  = 0,
+		Block = 1
+	};
 
 	class LogManager {
 	public:
@@ -29,12 +32,21 @@ namespace FIFE {
 		void removeVisibleModule(logmodule_t module);
 		void clearVisibleModules();
 		bool isVisible(logmodule_t module);
+		bool isLogged(logmodule_t module, LogLevel level);
 
 		void setLogToPrompt(bool logtoprompt);
 		bool isLogToPrompt();
 
 		void setLogToFile(bool logtofile);
 		bool isLogToFile();
+
+		void setAsync(bool async);
+		bool isAsync();
+		void setOverflowPolicy(LogOverflowPolicy policy);
+		LogOverflowPolicy getOverflowPolicy();
+		uint64_t getDroppedMessageCount();
+		void flush();
+
 		const char* getModuleName(logmodule_t module);
 
 	private:
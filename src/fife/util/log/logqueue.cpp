@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Corresponding header include
+#include "logqueue.h"
+
+// Standard C++ library includes
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+// 3rd party library includes
+
+// FIFE includes
+
+namespace FIFE
+{
+
+    LogQueue::LogQueue(std::size_t capacity, Consumer consumer) :
+        m_slots(std::make_unique<Slot[]>(std::bit_ceil(std::max<std::size_t>(capacity, 2)))),
+        m_mask(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1),
+        m_consumer(std::move(consumer)),
+        m_policy(LogOverflowPolicy::Drop),
+        m_dropped(0),
+        m_stop(false),
+        m_enqueue(0),
+        m_signal(0),
+        m_dequeue(0)
+    {
+        for (std::size_t i = 0; i <= m_mask; ++i) {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        m_thread = std::thread(&LogQueue::run, this);
+    }
+
+    LogQueue::~LogQueue()
+    {
+        m_stop.store(true, std::memory_order_release);
+        m_signal.fetch_add(1, std::memory_order_release);
+        m_signal.notify_one();
+        m_thread.join();
+    }
+
+    bool LogQueue::push(logmodule_t module, uint8_t level, std::string_view text)
+    {
+        uint64_t pos = m_enqueue.load(std::memory_order_relaxed);
+        Slot* slot   = nullptr;
+        while (true) {
+            slot               = &m_slots[pos & m_mask];
+            uint64_t const seq = slot->sequence.load(std::memory_order_acquire);
+            if (seq == pos) {
+                if (m_enqueue.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (seq < pos) {
+                // the slot still holds the message of the previous lap
+                if (m_policy.load(std::memory_order_relaxed) == LogOverflowPolicy::Drop) {
+                    m_dropped.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+                uint64_t const dequeued = m_dequeue.load(std::memory_order_acquire);
+                if (slot->sequence.load(std::memory_order_acquire) < pos) {
+                    m_dequeue.wait(dequeued, std::memory_order_acquire);
+                }
+                pos = m_enqueue.load(std::memory_order_relaxed);
+            } else {
+                pos = m_enqueue.load(std::memory_order_relaxed);
+            }
+        }
+
+        Entry& entry = slot->entry;
+        entry.time   = std::chrono::system_clock::now();
+        entry.module = module;
+        entry.level  = level;
+        entry.length = static_cast<uint16_t>(std::min(text.size(), MESSAGE_CAPACITY));
+        std::memcpy(entry.text, text.data(), entry.length);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+
+        m_signal.fetch_add(1, std::memory_order_release);
+        m_signal.notify_one();
+        return true;
+    }
+
+    void LogQueue::flush()
+    {
+        uint64_t const target = m_enqueue.load(std::memory_order_acquire);
+        uint64_t dequeued     = m_dequeue.load(std::memory_order_acquire);
+        while (dequeued < target) {
+            m_dequeue.wait(dequeued, std::memory_order_acquire);
+            dequeued = m_dequeue.load(std::memory_order_acquire);
+        }
+    }
+
+    void LogQueue::run()
+    {
+        while (true) {
+            uint32_t const signal = m_signal.load(std::memory_order_acquire);
+            drain();
+            if (m_stop.load(std::memory_order_acquire)) {
+                // messages pushed while stopping
+                drain();
+                return;
+            }
+            m_signal.wait(signal, std::memory_order_acquire);
+        }
+    }
+
+    void LogQueue::drain()
+    {
+        uint64_t pos        = m_dequeue.load(std::memory_order_relaxed);
+        uint64_t const from = pos;
+        while (true) {
+            Slot& slot = m_slots[pos & m_mask];
+            if (slot.sequence.load(std::memory_order_acquire) != pos + 1) {
+                break;
+            }
+            m_consumer(slot.entry);
+            slot.sequence.store(pos + m_mask + 1, std::memory_order_release);
+            ++pos;
+            m_dequeue.store(pos, std::memory_order_release);
+        }
+        if (pos != from) {
+            m_dequeue.notify_all();
+        }
+    }
+
+    void LogQueue::setOverflowPolicy(LogOverflowPolicy policy)
+    {
+        m_policy.store(policy, std::memory_order_relaxed);
+    }
+
+    LogOverflowPolicy LogQueue::getOverflowPolicy() const
+    {
+        return m_policy.load(std::memory_order_relaxed);
+    }
+
+    uint64_t LogQueue::getDroppedCount() const
+    {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
+    std::size_t LogQueue::getCapacity() const
+    {
+        return m_mask + 1;
+    }
+
+} // namespace FIFE
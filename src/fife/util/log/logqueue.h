@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+#ifndef FIFE_LOG_LOGQUEUE_H
+#define FIFE_LOG_LOGQUEUE_H
+
+// Platform specific includes
+#include "platform.h"
+
+// Standard C++ library includes
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <thread>
+
+// 3rd party library includes
+
+// FIFE includes
+#include "config.hpp"
+#include "modules.h"
+
+namespace FIFE
+{
+
+    /**
+     *  Bounded queue between the logging threads and a flush thread.
+     *
+     * Any thread may push a message; pushing claims a slot with a single
+     * compare-and-swap and copies the text into it, so it neither locks nor
+     * allocates. The flush thread owned by the queue hands every message in
+     * order to the consumer given at construction and then frees its slot.
+     *
+     * Texts longer than MESSAGE_CAPACITY are truncated. While the queue is full
+     * a push either drops the message or waits, see LogOverflowPolicy.
+     */
+    class FIFE_API LogQueue
+    {
+        public:
+            /** Number of characters kept per message. */
+            static constexpr std::size_t MESSAGE_CAPACITY = 480;
+
+            /**
+             *  A queued message.
+             */
+            struct Entry
+            {
+                    std::chrono::system_clock::time_point time;
+                    logmodule_t module;
+                    uint8_t level;
+                    uint16_t length;
+                    char text[MESSAGE_CAPACITY];
+            };
+
+            using Consumer = std::function<void(Entry const &)>;
+
+            /**
+             *  Creates the queue and starts its flush thread.
+             * @param capacity  Number of messages the queue holds, rounded up to a power of two.
+             * @param consumer  Called by the flush thread for every message.
+             */
+            LogQueue(std::size_t capacity, Consumer consumer);
+
+            /**
+             *  Hands the remaining messages to the consumer and joins the flush thread.
+             */
+            ~LogQueue();
+
+            LogQueue(LogQueue const &)            = delete;
+            LogQueue& operator=(LogQueue const &) = delete;
+
+            /**
+             *  Queues a message.
+             * @return false if the message was dropped because the queue was full.
+             */
+            bool push(logmodule_t module, uint8_t level, std::string_view text);
+
+            /**
+             *  Waits until the messages queued so far were handed to the consumer.
+             * Must not be called by the consumer.
+             */
+            void flush();
+
+            void setOverflowPolicy(LogOverflowPolicy policy);
+            LogOverflowPolicy getOverflowPolicy() const;
+
+            /** Returns the number of messages dropped so far. */
+            uint64_t getDroppedCount() const;
+
+            /** Returns the number of messages the queue holds. */
+            std::size_t getCapacity() const;
+
+        private:
+            struct Slot
+            {
+                    // Equals the position of a free slot and the position + 1 of a queued message.
+                    std::atomic<uint64_t> sequence;
+                    Entry entry;
+            };
+
+            void run();
+            void drain();
+
+            std::unique_ptr<Slot[]> m_slots;
+            std::size_t m_mask;
+            Consumer m_consumer;
+
+            std::atomic<LogOverflowPolicy> m_policy;
+            std::atomic<uint64_t> m_dropped;
+            std::atomic<bool> m_stop;
+
+            // Written by the logging threads.
+            alignas(64) std::atomic<uint64_t> m_enqueue;
+            // Bumped after every push, the flush thread sleeps on it.
+            alignas(64) std::atomic<uint32_t> m_signal;
+            // Messages handed to the consumer, flush() sleeps on it.
+            alignas(64) std::atomic<uint64_t> m_dequeue;
+
+            std::thread m_thread;
+    };
+
+} // namespace FIFE
+
+#endif
@@ -14,7 +14,9 @@
 
 // Standard C++ library includes
 #include <cassert>
+#include <cstddef>
 #include <iostream>
+#include <span>
 // 3rd party library includes
 
 // FIFE includes
@@ -217,6 +219,23 @@ namespace FIFE
                     (vec.x * m2) + (vec.y * m6) + (vec.z * m10) + m14);
             }
 
+            /** Transforms points in place, the same as operator* for each of them.
+             * The points are given as separate arrays of x, y and z values of the same size,
+             * so the loop runs over plain arrays and the compiler can vectorize it.
+             */
+            void transform(std::span<T> xs, std::span<T> ys, std::span<T> zs) const
+            {
+                assert(xs.size() == ys.size() && xs.size() == zs.size());
+                for (std::size_t i = 0; i < xs.size(); ++i) {
+                    T const x = xs[i];
+                    T const y = ys[i];
+                    T const z = zs[i];
+                    xs[i]     = (x * m0) + (y * m4) + (z * m8) + m12;
+                    ys[i]     = (x * m1) + (y * m5) + (z * m9) + m13;
+                    zs[i]     = (x * m2) + (y * m6) + (z * m10) + m14;
+                }
+            }
+
             /** Direct access to the matrix elements, just remember they are in column major format!!
              */
             T& operator[](int32_t ind)
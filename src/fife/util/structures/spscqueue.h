@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+#ifndef FIFE_UTIL_STRUCTURES_SPSCQUEUE_H
+#define FIFE_UTIL_STRUCTURES_SPSCQUEUE_H
+
+// Platform specific includes
+#include "platform.h"
+
+// Standard C++ library includes
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+// 3rd party library includes
+
+// FIFE includes
+
+namespace FIFE
+{
+
+    /** Bounded lock-free queue for exactly one producer and one consumer thread.
+     *
+     * push() may only be called from the producer thread, pop() only from the
+     * consumer thread. Neither call blocks or allocates; push() fails if the
+     * queue is full and pop() fails if it is empty.
+     *
+     * @tparam T Element type, copied in and out of the queue.
+     * @tparam Capacity Number of slots, has to be a power of two.
+     */
+    template <typename T, size_t Capacity>
+    class SpscQueue
+    {
+            static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity has to be a power of two");
+            static_assert(std::is_trivially_copyable_v<T>, "SpscQueue elements have to be trivially copyable");
+
+        public:
+            SpscQueue() = default;
+
+            SpscQueue(SpscQueue const &)            = delete;
+            SpscQueue& operator=(SpscQueue const &) = delete;
+
+            /** Appends a copy of value.
+             * @return False if the queue is full, the value is not queued then.
+             */
+            bool push(T const & value)
+            {
+                size_t const tail = m_tail.load(std::memory_order_relaxed);
+                if (tail - m_head.load(std::memory_order_acquire) == Capacity) {
+                    return false;
+                }
+                m_slots[tail & (Capacity - 1)] = value;
+                m_tail.store(tail + 1, std::memory_order_release);
+                return true;
+            }
+
+            /** Removes the oldest value and stores it in value.
+             * @return False if the queue is empty, value is untouched then.
+             */
+            bool pop(T& value)
+            {
+                size_t const head = m_head.load(std::memory_order_relaxed);
+                if (head == m_tail.load(std::memory_order_acquire)) {
+                    return false;
+                }
+                value = m_slots[head & (Capacity - 1)];
+                m_head.store(head + 1, std::memory_order_release);
+                return true;
+            }
+
+            /** Returns the number of queued values.
+             * Only a snapshot if called while the other side is working on the queue,
+             * but always in [0, Capacity] whichever thread asks.
+             */
+            size_t size() const
+            {
+                // head first: the tail read afterwards is never older, so the difference cannot wrap
+                size_t const head = m_head.load(std::memory_order_acquire);
+                size_t const tail = m_tail.load(std::memory_order_acquire);
+                return std::min(tail - head, Capacity);
+            }
+
+            bool empty() const
+            {
+                return size() == 0;
+            }
+
+            static constexpr size_t capacity()
+            {
+                return Capacity;
+            }
+
+        private:
+            // producer and consumer indices live on separate cache lines
+            alignas(64) std::atomic<size_t> m_head{0};
+            alignas(64) std::atomic<size_t> m_tail{0};
+            std::array<T, Capacity> m_slots{};
+    };
+} // namespace FIFE
+
+#endif
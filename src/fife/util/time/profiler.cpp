@@ -0,0 +1,281 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Corresponding header include
+#include "profiler.h"
+
+// Standard C++ library includes
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// 3rd party library includes
+
+// FIFE includes
+#include "util/log/logger.h"
+
+namespace FIFE
+{
+    namespace
+    {
+        Logger& _log()
+        {
+            static Logger log(LM_UTIL);
+            return log;
+        }
+
+        // Each profiler gets a new id, so threads notice a buffer of a destroyed profiler.
+        std::atomic<uint64_t> g_nextProfilerId{1};
+
+        struct ThreadCache
+        {
+                uint64_t profiler{0};
+                void* buffer{nullptr};
+        };
+
+        thread_local ThreadCache t_cache;
+
+        void appendEscaped(std::string& out, char const * text)
+        {
+            for (char const * c = text; *c != '\0'; ++c) {
+                if (*c == '"' || *c == '\\') {
+                    out.push_back('\\');
+                }
+                out.push_back(*c);
+            }
+        }
+    } // namespace
+
+    std::atomic<bool> Profiler::s_enabled{false};
+
+    Profiler::ThreadBuffer::ThreadBuffer(uint32_t capacity, uint32_t index) :
+        zones(std::make_unique<Zone[]>(capacity)), capacity(capacity), thread(index), head(0)
+    {
+    }
+
+    Profiler::Profiler(uint32_t capacity) :
+        m_id(g_nextProfilerId.fetch_add(1)),
+        m_capacity(std::max<uint32_t>(capacity, 1)),
+        m_frameStarts(FRAME_CAPACITY, 0),
+        m_frameCount(0)
+    {
+    }
+
+    Profiler::~Profiler()
+    {
+        s_enabled.store(false);
+    }
+
+    void Profiler::setEnabled(bool enabled)
+    {
+        s_enabled.store(enabled);
+    }
+
+    void Profiler::beginFrame()
+    {
+        m_frameStarts[m_frameCount % FRAME_CAPACITY] = now();
+        ++m_frameCount;
+    }
+
+    uint64_t Profiler::getFrameCount() const
+    {
+        return m_frameCount;
+    }
+
+    uint64_t Profiler::now()
+    {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+    }
+
+    char const * Profiler::internName(std::string const & name)
+    {
+        static std::mutex mutex;
+        static std::unordered_set<std::string> names;
+        std::scoped_lock const lock(mutex);
+        // the nodes of the set keep their address
+        return names.insert(name).first->c_str();
+    }
+
+    void Profiler::record(char const * name, uint64_t start, uint64_t end)
+    {
+        // disabled while the zone was open
+        if (!isEnabled()) {
+            return;
+        }
+        Profiler* profiler = instance();
+        if (t_cache.profiler != profiler->m_id) {
+            t_cache.buffer   = profiler->registerThread();
+            t_cache.profiler = profiler->m_id;
+        }
+        auto* buffer        = static_cast<ThreadBuffer*>(t_cache.buffer);
+        uint64_t const head = buffer->head.load(std::memory_order_relaxed);
+        Zone& zone          = buffer->zones[head % buffer->capacity];
+        zone.name.store(name, std::memory_order_relaxed);
+        zone.start.store(start, std::memory_order_relaxed);
+        zone.end.store(end, std::memory_order_relaxed);
+        buffer->head.store(head + 1, std::memory_order_release);
+    }
+
+    Profiler::ThreadBuffer* Profiler::registerThread()
+    {
+        std::scoped_lock const lock(m_mutex);
+        // one spare slot for the zone the owner is writing while collect() copies the others
+        m_buffers.push_back(
+            std::make_unique<ThreadBuffer>(m_capacity + 1, static_cast<uint32_t>(m_buffers.size())));
+        return m_buffers.back().get();
+    }
+
+    std::vector<Profiler::ZoneRecord> Profiler::collect(uint64_t since) const
+    {
+        std::vector<ZoneRecord> records;
+        std::scoped_lock const lock(m_mutex);
+        for (auto const & buffer : m_buffers) {
+            uint64_t const head  = buffer->head.load(std::memory_order_acquire);
+            // the slot of zone head - capacity is the next one the owner writes
+            uint64_t const first = head + 1 > buffer->capacity ? head + 1 - buffer->capacity : 0;
+            size_t const offset  = records.size();
+            for (uint64_t i = first; i < head; ++i) {
+                Zone const & zone = buffer->zones[i % buffer->capacity];
+                records.push_back(
+                    {.name   = zone.name.load(std::memory_order_relaxed),
+                     .start  = zone.start.load(std::memory_order_relaxed),
+                     .end    = zone.end.load(std::memory_order_relaxed),
+                     .thread = buffer->thread});
+            }
+            // the owner may have overwritten the oldest zones while they were copied, and may already be
+            // writing zone newHead, which shares its slot with zone newHead - capacity
+            std::atomic_thread_fence(std::memory_order_acquire);
+            uint64_t const newHead = buffer->head.load(std::memory_order_relaxed);
+            uint64_t const valid   = newHead + 1 > buffer->capacity ? newHead + 1 - buffer->capacity : 0;
+            if (valid > first) {
+                auto const overwritten = static_cast<std::ptrdiff_t>(std::min(valid, head) - first);
+                records.erase(
+                    records.begin() + static_cast<std::ptrdiff_t>(offset),
+                    records.begin() + static_cast<std::ptrdiff_t>(offset) + overwritten);
+            }
+        }
+        std::erase_if(records, [since](ZoneRecord const & record) {
+            return record.start < since || record.name == nullptr;
+        });
+        std::ranges::sort(records, [](ZoneRecord const & a, ZoneRecord const & b) {
+            return a.start < b.start;
+        });
+        return records;
+    }
+
+    uint64_t Profiler::windowStart(uint32_t frames, uint32_t& count) const
+    {
+        uint64_t const kept = std::min<uint64_t>(m_frameCount, FRAME_CAPACITY);
+        count               = static_cast<uint32_t>(std::min<uint64_t>(frames, kept));
+        if (count == 0) {
+            return 0;
+        }
+        return m_frameStarts[(m_frameCount - count) % FRAME_CAPACITY];
+    }
+
+    std::vector<std::string> Profiler::getZoneNames() const
+    {
+        uint32_t count = 0;
+        std::vector<std::string> names;
+        for (ZoneRecord const & record : collect(windowStart(FRAME_CAPACITY, count))) {
+            names.emplace_back(record.name);
+        }
+        std::ranges::sort(names);
+        auto const [first, last] = std::ranges::unique(names);
+        names.erase(first, last);
+        return names;
+    }
+
+    double Profiler::getZoneAverage(std::string const & zone, uint32_t frames) const
+    {
+        uint32_t count       = 0;
+        uint64_t const since = windowStart(frames, count);
+        if (count == 0) {
+            return 0.0;
+        }
+        uint64_t total = 0;
+        for (ZoneRecord const & record : collect(since)) {
+            if (zone == record.name) {
+                total += record.end - record.start;
+            }
+        }
+        return static_cast<double>(total) / 1000000.0 / static_cast<double>(count);
+    }
+
+    std::string Profiler::getChromeTrace(uint32_t frames) const
+    {
+        uint32_t count                      = 0;
+        uint64_t const since                = windowStart(frames, count);
+        std::vector<ZoneRecord> const zones = collect(since);
+        uint32_t threads                    = 0;
+        {
+            std::scoped_lock const lock(m_mutex);
+            threads = static_cast<uint32_t>(m_buffers.size());
+        }
+
+        // timestamps are in microseconds
+        std::string out = R"({"displayTimeUnit":"ms","traceEvents":[)";
+        bool first      = true;
+        auto separate   = [&out, &first]() {
+            if (!first) {
+                out += ",\n";
+            }
+            first = false;
+        };
+        for (uint32_t thread = 0; thread < threads; ++thread) {
+            separate();
+            out += std::format(
+                R"({{"name":"thread_name","ph":"M","pid":1,"tid":{},"args":{{"name":"thread {}"}}}})", thread, thread);
+        }
+        for (uint64_t frame = m_frameCount - count; frame < m_frameCount; ++frame) {
+            separate();
+            out += std::format(
+                R"({{"name":"frame {}","ph":"i","s":"g","pid":1,"tid":0,"ts":{:.3f}}})",
+                frame,
+                static_cast<double>(m_frameStarts[frame % FRAME_CAPACITY]) / 1000.0);
+        }
+        for (ZoneRecord const & zone : zones) {
+            separate();
+            out += R"({"name":")";
+            appendEscaped(out, zone.name);
+            out += std::format(
+                R"(","ph":"X","pid":1,"tid":{},"ts":{:.3f},"dur":{:.3f}}})",
+                zone.thread,
+                static_cast<double>(zone.start) / 1000.0,
+                static_cast<double>(zone.end - zone.start) / 1000.0);
+        }
+        out += "]}\n";
+        return out;
+    }
+
+    bool Profiler::saveChromeTrace(std::string const & filename, uint32_t frames) const
+    {
+        std::string const trace = getChromeTrace(frames);
+        std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+        file.write(trace.data(), static_cast<std::streamsize>(trace.size()));
+        if (!file) {
+            FL_WARN(_log(), std::format("Could not write profiler trace {}", filename));
+            return false;
+        }
+        return true;
+    }
+
+    void Profiler::clear()
+    {
+        std::scoped_lock const lock(m_mutex);
+        for (auto const & buffer : m_buffers) {
+            buffer->head.store(0);
+        }
+        m_frameCount = 0;
+    }
+
+} // namespace FIFE
@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+#ifndef FIFE_UTIL_TIME_PROFILER_H
+#define FIFE_UTIL_TIME_PROFILER_H
+
+// Platform specific includes
+#include "platform.h"
+
+// Standard C++ library includes
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// 3rd party library includes
+
+// FIFE includes
+#include "util/base/singleton.h"
+
+namespace FIFE
+{
+
+    /** Collects the durations of named zones of code.
+     *
+     * A zone is the lifetime of a ProfileZone, usually placed with FIFE_PROFILE_ZONE
+     * at the top of a function. Every thread writes its finished zones into an own
+     * ring buffer without locking, so the buffers keep the zones of the last frames
+     * of every thread. The Engine marks the frames, the buffers can then be queried
+     * for the average time of a zone per frame or be written as a Chrome trace,
+     * which chrome://tracing and Perfetto display.
+     *
+     * While the profiler is disabled a zone costs a single branch.
+     *
+     * The Engine creates the profiler disabled.
+     */
+    class FIFE_API Profiler : public DynamicSingleton<Profiler>
+    {
+        public:
+            /** Number of zones kept per thread by default.
+             */
+            static constexpr uint32_t DEFAULT_CAPACITY = 65536;
+
+            /** Number of frame starts kept.
+             */
+            static constexpr uint32_t FRAME_CAPACITY = 1024;
+
+            /** Constructor.
+             *
+             * @param capacity Number of zones kept per thread.
+             */
+            explicit Profiler(uint32_t capacity = DEFAULT_CAPACITY);
+
+            Profiler(Profiler const &)            = delete;
+            Profiler& operator=(Profiler const &) = delete;
+
+            /** Destructor.
+             */
+            ~Profiler();
+
+            /** Returns true if zones are recorded.
+             */
+            static bool isEnabled()
+            {
+                return s_enabled.load(std::memory_order_relaxed);
+            }
+
+            /** Enables or disables recording. Recorded zones are kept.
+             */
+            void setEnabled(bool enabled);
+
+            /** Marks the start of a frame.
+             * Called by the Engine at the start of every pump while the profiler is enabled.
+             */
+            void beginFrame();
+
+            /** Returns the number of frames marked so far.
+             */
+            uint64_t getFrameCount() const;
+
+            /** Returns the sorted names of the zones in the kept frames.
+             */
+            std::vector<std::string> getZoneNames() const;
+
+            /** Returns the average time per frame spent in a zone, summed over all threads.
+             *
+             * @param zone Name of the zone.
+             * @param frames Number of the last frames to average over.
+             * @return Time in milliseconds.
+             */
+            double getZoneAverage(std::string const & zone, uint32_t frames) const;
+
+            /** Returns the zones of the last frames in the Chrome trace event format.
+             *
+             * @param frames Number of the last frames to include.
+             */
+            std::string getChromeTrace(uint32_t frames) const;
+
+            /** Writes the zones of the last frames as Chrome trace to a file.
+             *
+             * @return False if the file could not be written.
+             */
+            bool saveChromeTrace(std::string const & filename, uint32_t frames) const;
+
+            /** Drops the recorded zones and frames.
+             * Must not be called while other threads record zones.
+             */
+            void clear();
+
+            /** Returns a timestamp in nanoseconds.
+             */
+            static uint64_t now();
+
+            /** Returns a name with the lifetime of the program, for zones with a dynamic name.
+             */
+            static char const * internName(std::string const & name);
+
+            /** Adds a finished zone to the buffer of the calling thread.
+             */
+            static void record(char const * name, uint64_t start, uint64_t end);
+
+        private:
+            struct Zone
+            {
+                    std::atomic<char const *> name{nullptr};
+                    std::atomic<uint64_t> start{0};
+                    std::atomic<uint64_t> end{0};
+            };
+
+            struct ZoneRecord
+            {
+                    char const * name;
+                    uint64_t start;
+                    uint64_t end;
+                    uint32_t thread;
+            };
+
+            /** Ring buffer of a thread, only the owning thread writes to it.
+             */
+            struct ThreadBuffer
+            {
+                    ThreadBuffer(uint32_t capacity, uint32_t index);
+
+                    std::unique_ptr<Zone[]> zones;
+                    uint32_t capacity;
+                    uint32_t thread;
+                    // Number of zones written so far.
+                    std::atomic<uint64_t> head;
+            };
+
+            ThreadBuffer* registerThread();
+
+            /** Returns the kept zones that started at or after since.
+             */
+            std::vector<ZoneRecord> collect(uint64_t since) const;
+
+            /** Returns the start of the last frames and their number.
+             */
+            uint64_t windowStart(uint32_t frames, uint32_t& count) const;
+
+            static std::atomic<bool> s_enabled;
+
+            // Identifies the profiler in the thread local buffer lookup.
+            uint64_t m_id;
+            uint32_t m_capacity;
+
+            mutable std::mutex m_mutex;
+            std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+
+            // Ring of frame starts, written by the thread that pumps the engine.
+            std::vector<uint64_t> m_frameStarts;
+            uint64_t m_frameCount;
+    };
+
+    /** Records the lifetime of the object as a zone of the Profiler.
+     */
+    class FIFE_API ProfileZone
+    {
+        public:
+            /** Starts a zone, the name has to outlive the profiler.
+             * Zones without a name are not kept.
+             */
+            explicit ProfileZone(char const * name) : m_name(name), m_start(0)
+            {
+                if (Profiler::isEnabled()) [[unlikely]] {
+                    m_start = Profiler::now();
+                }
+            }
+
+            ~ProfileZone()
+            {
+                if (m_start != 0) [[unlikely]] {
+                    Profiler::record(m_name, m_start, Profiler::now());
+                }
+            }
+
+            ProfileZone(ProfileZone const &)            = delete;
+            ProfileZone& operator=(ProfileZone const &) = delete;
+            ProfileZone(ProfileZone&&)                  = delete;
+            ProfileZone& operator=(ProfileZone&&)       = delete;
+
+        private:
+            char const * m_name;
+            uint64_t m_start;
+    };
+
+} // namespace FIFE
+
+#define FIFE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define FIFE_PROFILE_CONCAT(a, b)      FIFE_PROFILE_CONCAT_IMPL(a, b)
+
+/** Records the rest of the enclosing scope as a zone with the given name.
+ */
+#define FIFE_PROFILE_ZONE(name) ::FIFE::ProfileZone const FIFE_PROFILE_CONCAT(fife_profile_zone_, __LINE__)(name)
+
+/** Like FIFE_PROFILE_ZONE, but the std::string name is only evaluated while the profiler is enabled.
+ */
+#define FIFE_PROFILE_ZONE_DYNAMIC(name)                                          \
+    ::FIFE::ProfileZone const FIFE_PROFILE_CONCAT(fife_profile_zone_, __LINE__)( \
+        ::FIFE::Profiler::isEnabled() ? ::FIFE::Profiler::internName(name) : nullptr)
+
+#endif
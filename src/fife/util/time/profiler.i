@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+%module fife
+%{
+#include "util/time/profiler.h"
+%}
+
+namespace FIFE {
+	class Profiler {
+	public:
+		~Profiler();
+		static bool isEnabled();
+		void setEnabled(bool enabled);
+		void beginFrame();
+		uint64_t getFrameCount() const;
+		std::vector<std::string> getZoneNames() const;
+		double getZoneAverage(const std::string& zone, uint32_t frames) const;
+		std::string getChromeTrace(uint32_t frames) const;
+		bool saveChromeTrace(const std::string& filename, uint32_t frames) const;
+		void clear();
+	private:
+		Profiler();
+	};
+}
@@ -18,11 +18,17 @@
 namespace FIFE
 {
 
-    TimeEvent::TimeEvent(int32_t period) : m_period(period), m_last_updated(TimeManager::instance()->now64())
+    TimeEvent::TimeEvent(int32_t period) :
+        m_period(period), m_last_updated(TimeManager::instance()->now64()), m_manager(nullptr), m_slot(0)
     {
     }
 
-    TimeEvent::~TimeEvent() = default;
+    TimeEvent::~TimeEvent()
+    {
+        if (m_manager != nullptr) {
+            m_manager->unregisterEvent(this);
+        }
+    }
 
     void TimeEvent::managerUpdateEvent(uint32_t time)
     {
@@ -45,6 +51,9 @@ namespace FIFE
     void TimeEvent::setPeriod(int32_t period)
     {
         m_period = period;
+        if (m_manager != nullptr) {
+            m_manager->rescheduleEvent(this);
+        }
     }
 
     int32_t TimeEvent::getPeriod() const
@@ -65,11 +74,17 @@ namespace FIFE
     void TimeEvent::setLastUpdateTime(uint32_t ms)
     {
         m_last_updated = SDLTimeCompat::fromLegacy32Ticks(ms);
+        if (m_manager != nullptr) {
+            m_manager->rescheduleEvent(this);
+        }
     }
 
     void TimeEvent::setLastUpdateTime64(uint64_t ms)
     {
         m_last_updated = ms;
+        if (m_manager != nullptr) {
+            m_manager->rescheduleEvent(this);
+        }
     }
 
 } // namespace FIFE
@@ -8,6 +8,8 @@
 #include "platform.h"
 
 // Standard C++ library includes
+#include <cstdint>
+
 // 3rd party library includes
 
 // FIFE includes
@@ -27,6 +29,8 @@ namespace FIFE
      *
      * @see TimeManager
      */
+    class TimeManager;
+
     class FIFE_API TimeEvent
     {
         public:
@@ -38,6 +42,7 @@ namespace FIFE
 
             /** Destructor.
              *
+             * Unregisters the event if it is still registered.
              */
             virtual ~TimeEvent();
 
@@ -96,11 +101,19 @@ namespace FIFE
             void setLastUpdateTime64(uint64_t ms);
 
         private:
+            friend class TimeManager;
+
             // The period of the event. See the class description.
             int32_t m_period;
 
             // The last time the class was updated.
             uint64_t m_last_updated;
+
+            // The manager the event is registered with, or nullptr.
+            TimeManager* m_manager;
+
+            // The slot of the event in its manager.
+            uint32_t m_slot;
     };
 
 } // namespace FIFE
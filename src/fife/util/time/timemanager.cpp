@@ -24,21 +24,51 @@ namespace FIFE
     namespace
     {
         uint64_t const UNDEFINED_TIME_DELTA = 999999;
+        // Outdated queue entries tolerated before the queue is compacted.
+        size_t const QUEUE_SLACK = 64;
         Logger& _log()
         {
             static Logger log(LM_UTIL);
             return log;
         }
+
+        // Heap order for the event queue, the earliest entry ends up in front.
+        template <typename Entry>
+        [[nodiscard]] bool isLater(Entry const & a, Entry const & b)
+        {
+            if (a.due != b.due) {
+                return a.due > b.due;
+            }
+            return a.sequence > b.sequence;
+        }
     } // namespace
 
-    TimeManager::TimeManager() : m_current_time(0), m_time_delta(UNDEFINED_TIME_DELTA), m_average_frame_time(0)
+    TimeManager::TimeManager() :
+        m_current_time(0),
+        m_time_delta(UNDEFINED_TIME_DELTA),
+        m_average_frame_time(0),
+        m_fixed_time_delta(0),
+        m_virtual_time(0),
+        m_tick_offset(0),
+        m_event_count(0),
+        m_sequence(0),
+        m_fired_count(0),
+        m_max_fired_count(0)
     {
     }
 
-    TimeManager::~TimeManager() = default;
+    TimeManager::~TimeManager()
+    {
+        for (Slot const & slot : m_slots) {
+            if (slot.event != nullptr) {
+                slot.event->m_manager = nullptr;
+            }
+        }
+    }
 
     void TimeManager::update()
     {
+        m_virtual_time += m_fixed_time_delta;
         // if first update...
         double avg_multiplier = 0.985;
         if (m_current_time == 0) {
@@ -53,38 +83,118 @@ namespace FIFE
         m_average_frame_time =
             (m_average_frame_time * avg_multiplier) + (static_cast<double>(m_time_delta) * (1.0 - avg_multiplier));
 
-        // Update live events.
-        //
-        // It is very important to NOT use iterators (over a vector)
-        // here, as an event might add enough events to resize the vector.
-        // -> Ugly segfault
-        for (auto* event : m_events_list) {
-            if (event != nullptr) {
-                event->managerUpdateEvent64(m_current_time);
+        auto const later = isLater<QueueEntry>;
+
+        // Queue the events scheduled since the last update.
+        for (QueueEntry const & entry : m_pending) {
+            if (m_slots[entry.slot].generation == entry.generation) {
+                m_queue.push_back(entry);
+                std::ranges::push_heap(m_queue, later);
             }
         }
+        m_pending.clear();
+        compactQueue();
 
-        // Remove dead events
-        auto it = std::ranges::remove(m_events_list, static_cast<TimeEvent*>(nullptr)).begin();
-        m_events_list.erase(it, m_events_list.end());
+        // Collect the due events first, events that are scheduled while
+        // updating are not considered before the next frame.
+        m_due.clear();
+        while (!m_queue.empty() && m_queue.front().due <= m_current_time) {
+            std::ranges::pop_heap(m_queue, later);
+            QueueEntry const entry = m_queue.back();
+            m_queue.pop_back();
+            if (m_slots[entry.slot].generation == entry.generation) {
+                m_due.push_back(entry);
+            }
+        }
+
+        // Update due events.
+        //
+        // An event might register or unregister events, so the slot
+        // is looked up again after every update.
+        m_fired_count = 0;
+        for (QueueEntry const & entry : m_due) {
+            if (m_slots[entry.slot].generation != entry.generation) {
+                // unregistered or rescheduled by an earlier event
+                continue;
+            }
+            TimeEvent* event = m_slots[entry.slot].event;
+            event->managerUpdateEvent64(m_current_time);
+            ++m_fired_count;
+            if (m_slots[entry.slot].event == event) {
+                schedule(entry.slot);
+            }
+        }
+        m_max_fired_count = std::max(m_max_fired_count, m_fired_count);
     }
 
     void TimeManager::registerEvent(TimeEvent* event)
     {
-        // Register.
-        m_events_list.push_back(event);
+        if (event == nullptr || event->m_manager == this) {
+            return;
+        }
+        if (event->m_manager != nullptr) {
+            event->m_manager->unregisterEvent(event);
+        }
+
+        uint32_t slot = 0;
+        if (m_free_slots.empty()) {
+            slot = static_cast<uint32_t>(m_slots.size());
+            m_slots.emplace_back();
+        } else {
+            slot = m_free_slots.back();
+            m_free_slots.pop_back();
+        }
+        m_slots[slot].event = event;
+        event->m_manager    = this;
+        event->m_slot       = slot;
+        ++m_event_count;
+        schedule(slot);
     }
 
     void TimeManager::unregisterEvent(TimeEvent* event)
     {
-        // Unregister.
-        auto it = std::ranges::find_if(m_events_list, [event](TimeEvent const * e) {
-            return e == event;
-        });
-        if (it != m_events_list.end()) {
-            *it = nullptr;
+        if (event == nullptr || event->m_manager != this) {
             return;
         }
+        // Queued entries of the slot become outdated and are skipped.
+        Slot& slot = m_slots[event->m_slot];
+        slot.event = nullptr;
+        ++slot.generation;
+        m_free_slots.push_back(event->m_slot);
+        event->m_manager = nullptr;
+        --m_event_count;
+    }
+
+    void TimeManager::rescheduleEvent(TimeEvent* event)
+    {
+        if (event->m_manager == this && m_slots[event->m_slot].event == event) {
+            schedule(event->m_slot);
+        }
+    }
+
+    void TimeManager::schedule(uint32_t slot)
+    {
+        Slot& entry = m_slots[slot];
+        ++entry.generation;
+
+        TimeEvent const * event = entry.event;
+        if (event->m_period < 0) {
+            // never updated, stays registered until the period changes
+            return;
+        }
+        uint64_t const due = event->m_last_updated + SDLTimeCompat::fromLegacy32Ticks(event->m_period);
+        m_pending.push_back(QueueEntry{due, m_sequence++, slot, entry.generation});
+    }
+
+    void TimeManager::compactQueue()
+    {
+        if (m_queue.size() <= (2 * m_event_count) + QUEUE_SLACK) {
+            return;
+        }
+        std::erase_if(m_queue, [this](QueueEntry const & entry) {
+            return m_slots[entry.slot].generation != entry.generation;
+        });
+        std::ranges::make_heap(m_queue, isLater<QueueEntry>);
     }
 
     uint32_t TimeManager::getTime() const
@@ -109,7 +219,26 @@ namespace FIFE
 
     uint64_t TimeManager::getTicks64() const
     {
-        return SDL_GetTicks();
+        if (m_fixed_time_delta > 0) {
+            return m_virtual_time;
+        }
+        // unsigned overflow undoes an offset that moves the time back
+        return SDL_GetTicks() + m_tick_offset;
+    }
+
+    void TimeManager::setFixedTimeDelta(uint64_t delta)
+    {
+        if (delta > 0 && m_fixed_time_delta == 0) {
+            m_virtual_time = m_current_time;
+        } else if (delta == 0 && m_fixed_time_delta > 0) {
+            m_tick_offset = m_virtual_time - SDL_GetTicks();
+        }
+        m_fixed_time_delta = delta;
+    }
+
+    uint64_t TimeManager::getFixedTimeDelta() const
+    {
+        return m_fixed_time_delta;
     }
 
     void TimeManager::sleep64(uint64_t ms) const
@@ -127,9 +256,31 @@ namespace FIFE
         return m_average_frame_time;
     }
 
+    size_t TimeManager::getEventCount() const
+    {
+        return m_event_count;
+    }
+
+    size_t TimeManager::getQueueDepth() const
+    {
+        return m_queue.size() + m_pending.size();
+    }
+
+    uint32_t TimeManager::getFiredEventCount() const
+    {
+        return m_fired_count;
+    }
+
     void TimeManager::printStatistics() const
     {
-        // FL_LOG(_log(), std::format("Timers: {}", m_events_list.size()));
+        FL_LOG(
+            _log(),
+            std::format(
+                "Timers: {} registered, queue depth {}, {} updated last frame, {} at most",
+                m_event_count,
+                getQueueDepth(),
+                m_fired_count,
+                m_max_fired_count));
     }
 
 } // namespace FIFE
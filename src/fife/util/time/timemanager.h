@@ -8,6 +8,7 @@
 #include "platform.h"
 
 // Standard C++ library includes
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -29,6 +30,10 @@ namespace FIFE
      * Users of this class will have to manually register and
      * unregister events.
      *
+     * Events are kept in a min-heap ordered by their next update time,
+     * so a frame only touches the events that are due. Events that are due
+     * at the same time are updated in the order they were scheduled.
+     *
      * @see TimeEvent
      */
     class FIFE_API TimeManager : public DynamicSingleton<TimeManager>
@@ -56,6 +61,8 @@ namespace FIFE
              * Adds a TimeEvent.
              *
              * The event will be updated regularly, depending on its settings.
+             * It is first considered by the next call to update(). Adding an
+             * event that is already registered does nothing.
              * @param event The TimeEvent object to be added.
              */
             void registerEvent(TimeEvent* event);
@@ -99,10 +106,31 @@ namespace FIFE
             /**
              * Get current SDL tick count.
              *
+             * While a fixed time delta is set this is the virtual time instead.
+             *
              * @return Current SDL ticks in milliseconds.
              */
             uint64_t getTicks64() const;
 
+            /**
+             * Lets the time advance by a fixed delta on every update(),
+             * independent of how long a frame really took.
+             *
+             * The virtual clock starts at the time of the last update. Setting
+             * the delta back to 0 follows the SDL ticks again from the
+             * virtual time on, so the time never jumps.
+             *
+             * @param delta Time per update in milliseconds, 0 to use the SDL ticks.
+             */
+            void setFixedTimeDelta(uint64_t delta);
+
+            /**
+             * Gets the fixed time delta.
+             *
+             * @return Time per update in milliseconds, 0 if the SDL ticks are used.
+             */
+            uint64_t getFixedTimeDelta() const;
+
             /**
              * Sleep for a 64-bit millisecond duration.
              */
@@ -115,21 +143,90 @@ namespace FIFE
              */
             double getAverageFrameTime() const;
 
+            /**
+             * Gets the number of registered events.
+             */
+            size_t getEventCount() const;
+
+            /**
+             * Gets the number of entries in the event queue, including
+             * the outdated ones that are not yet cleaned up.
+             */
+            size_t getQueueDepth() const;
+
+            /**
+             * Gets the number of events updated by the last call to update().
+             */
+            uint32_t getFiredEventCount() const;
+
             /**
              * Prints Timer statistics
              */
             void printStatistics() const;
 
         private:
+            friend class TimeEvent;
+
+            struct Slot
+            {
+                    TimeEvent* event{nullptr};
+                    // Increased whenever the queued entries of the slot become outdated.
+                    uint32_t generation{0};
+            };
+
+            struct QueueEntry
+            {
+                    uint64_t due;
+                    uint64_t sequence;
+                    uint32_t slot;
+                    uint32_t generation;
+            };
+
+            /** Queues the event again after its period or last update time changed.
+             * Called by TimeEvent.
+             */
+            void rescheduleEvent(TimeEvent* event);
+
+            /** Outdates the queued entries of the slot and queues a new one.
+             */
+            void schedule(uint32_t slot);
+
+            /** Drops the outdated entries once they outnumber the registered events.
+             */
+            void compactQueue();
+
+
             // Current time in milliseconds.
             uint64_t m_current_time;
             // Time since last frame in milliseconds.
             uint64_t m_time_delta;
             // Average frame time in milliseconds.
             double m_average_frame_time;
-
-            // List of active TimeEvents.
-            std::vector<TimeEvent*> m_events_list;
+            // Time per update of the virtual clock, 0 if the SDL ticks are used.
+            uint64_t m_fixed_time_delta;
+            // Current time of the virtual clock.
+            uint64_t m_virtual_time;
+            // Added to the SDL ticks, keeps the time going on after the virtual clock.
+            uint64_t m_tick_offset;
+
+            // Registered events, indexed by TimeEvent::m_slot.
+            std::vector<Slot> m_slots;
+            // Unused indices into m_slots.
+            std::vector<uint32_t> m_free_slots;
+            // Number of registered events.
+            size_t m_event_count;
+            // Min-heap of scheduled updates, outdated entries are skipped.
+            std::vector<QueueEntry> m_queue;
+            // Entries scheduled since the last update, moved into m_queue by update().
+            std::vector<QueueEntry> m_pending;
+            // Entries due in the current update.
+            std::vector<QueueEntry> m_due;
+            // Tie breaker for entries with the same due time.
+            uint64_t m_sequence;
+            // Number of events updated by the last update.
+            uint32_t m_fired_count;
+            // Highest number of events updated by a single update.
+            uint32_t m_max_fired_count;
     };
 
 } // namespace FIFE
@@ -21,8 +21,13 @@ namespace FIFE {
 		uint32_t getTimeDelta() const;
 		uint64_t getTimeDelta64() const;
 		uint64_t getTicks64() const;
+		void setFixedTimeDelta(uint64_t delta);
+		uint64_t getFixedTimeDelta() const;
 		void sleep64(uint64_t ms) const;
 		double getAverageFrameTime() const;
+		size_t getEventCount() const;
+		size_t getQueueDepth() const;
+		uint32_t getFiredEventCount() const;
 		void printStatistics() const;
 		void registerEvent(TimeEvent* event);
 		void unregisterEvent(TimeEvent* event);
@@ -3,7 +3,6 @@
 
 // Standard C++ library includes
 #include <algorithm>
-#include <array>
 #include <cstdint>
 #include <span>
 #include <vector>
@@ -18,18 +17,45 @@
 namespace FIFE
 {
 
-    LZSSDecoder::LZSSDecoder() : m_outlen(0), m_outindex(0)
+    namespace
+    {
+        constexpr uint32_t kRingBufferSize        = 4096;
+        constexpr uint32_t kMatchLengthUpperLimit = 18;
+        constexpr uint32_t kThreshold             = 2;
+        // dictionary position of the first byte of a block
+        constexpr uint32_t kRingStart = kRingBufferSize - kMatchLengthUpperLimit;
+
+        /** Returns the byte of the initial dictionary that lies the given distance before the start of the block.
+         * The dictionary is filled with spaces, except for the positions the block writes first.
+         */
+        uint8_t initialByte(uint32_t distance)
+        {
+            return distance <= kRingStart ? ' ' : 0;
+        }
+    } // namespace
+
+    LZSSDecoder::LZSSDecoder() : m_output(nullptr), m_outlen(0), m_outindex(0), m_finished(true)
     {
     }
 
     void LZSSDecoder::decode(RawData* input, uint8_t* output, uint32_t const outputsize)
     {
+        begin(output, outputsize);
+        decodeUntil(input, outputsize);
+    }
 
-        m_outindex = 0;
+    void LZSSDecoder::begin(uint8_t* output, uint32_t outputsize)
+    {
+        m_output   = output;
         m_outlen   = outputsize;
+        m_outindex = 0;
+        m_finished = false;
+    }
 
-        auto const outSpan = std::span(output, outputsize);
-        while (m_outindex < outputsize) {
+    uint32_t LZSSDecoder::decodeUntil(RawData* input, uint32_t size)
+    {
+        size = std::min(size, m_outlen);
+        while (!m_finished && m_outindex < size) {
             // Block header: signed 16-bit big-endian integer N.
             //   N == 0: end of stream
             //   N < 0:  raw block, copy -N bytes as-is
@@ -37,79 +63,74 @@ namespace FIFE
             int16_t const n = static_cast<int16_t>(input->read16Big());
 
             if (n == 0) {
-                break;
-            }
-
-            if (n < 0) {
-                uint16_t const rawSize = static_cast<uint16_t>(-n);
-                auto dest              = outSpan.subspan(static_cast<size_t>(m_outindex), static_cast<size_t>(rawSize));
-                input->readInto(dest.data(), rawSize);
+                m_finished = true;
+            } else if (n < 0) {
+                auto const rawSize = static_cast<uint32_t>(-static_cast<int32_t>(n));
+                if (rawSize > m_outlen - m_outindex) {
+                    throw InvalidFormat("LZSS raw block exceeds the output size");
+                }
+                input->readInto(std::span(m_output, m_outlen).subspan(m_outindex).data(), rawSize);
                 m_outindex += rawSize;
             } else {
-                // Allocate +2 bytes so that on corrupt data the LZSS
-                // decoder won't crash the input buffer.
-                std::vector<uint8_t> indata(static_cast<size_t>(n) + 2U);
-                input->readInto(indata.data(), static_cast<uint32_t>(n));
-                LZSSDecode(indata.data(), n, outSpan.data());
-                // Note outindex is advanced inside LZSSDecode.
+                // Two more bytes, so that on corrupt data the decoder reads zeros after the block.
+                auto const len = static_cast<uint32_t>(n);
+                m_block.resize(static_cast<size_t>(len) + 2U);
+                input->readInto(m_block.data(), len);
+                m_block[len]      = 0;
+                m_block[len + 1U] = 0;
+                LZSSDecode(m_block.data(), len);
             }
         }
+        return m_outindex;
     }
 
-    void LZSSDecoder::LZSSDecode(uint8_t const * in, int64_t len, uint8_t* out)
+    void LZSSDecoder::LZSSDecode(uint8_t const * in, uint32_t len)
     {
-        constexpr int64_t kRingBufferSize        = 4096;
-        constexpr int64_t kMatchLengthUpperLimit = 18;
-        constexpr int64_t kThreshold             = 2;
-
-        auto const inSpan = std::span(in, static_cast<size_t>(len));
-        auto outSpan      = std::span(out, m_outlen);
-
-        std::array<char, kRingBufferSize + kMatchLengthUpperLimit - 1> buffer{};
-        int32_t ibuf = 0;
-        int32_t c{};
+        auto const inSpan = std::span(in, static_cast<size_t>(len) + 2U);
+        auto const out    = std::span(m_output, m_outlen);
 
-        int32_t i = 0;
-        int32_t j{};
-        int32_t k{};
-        int32_t r = kRingBufferSize - kMatchLengthUpperLimit;
-
-        uint32_t flags = 0;
-
-        for (i = 0; i < kRingBufferSize - kMatchLengthUpperLimit; i++) {
-            buffer.at(static_cast<size_t>(i)) = ' ';
-        }
-
-        flags = 0;
+        uint32_t const blockStart = m_outindex;
+        uint32_t ibuf             = 0;
+        uint32_t flags            = 0;
         while (ibuf < len) {
             flags >>= 1;
             if ((flags & 256) == 0) {
-                c     = *(inSpan.data() + static_cast<size_t>(ibuf++));
-                flags = static_cast<uint32_t>(c | 0xff00); /* uses higher byte cleverly to count eight */
+                flags = inSpan[ibuf++] | 0xff00U; /* uses higher byte cleverly to count eight */
             }
 
             if ((flags & 1) != 0U) {
-                c                                                     = *(inSpan.data() + static_cast<size_t>(ibuf++));
-                *(outSpan.data() + static_cast<size_t>(m_outindex++)) = static_cast<uint8_t>(c);
-
-                buffer.at(static_cast<size_t>(r++)) = static_cast<char>(c);
-                r &= (kRingBufferSize - 1);
-            } else {
-                i = *(inSpan.data() + static_cast<size_t>(ibuf++));
-                j = *(inSpan.data() + static_cast<size_t>(ibuf++));
-
-                i |= ((j & 0xf0) << 4);
-                j = (j & 0x0f) + kThreshold;
-
-                for (k = 0; k <= j; k++) {
-                    c = static_cast<unsigned char>(buffer.at((i + k) & (kRingBufferSize - 1)));
+                if (m_outindex == m_outlen) {
+                    throw InvalidFormat("LZSS block exceeds the output size");
+                }
+                out[m_outindex++] = inSpan[ibuf++];
+                continue;
+            }
 
-                    *(outSpan.data() + static_cast<size_t>(m_outindex++)) = static_cast<uint8_t>(c);
+            uint32_t const offset = inSpan[ibuf] | ((inSpan[ibuf + 1] & 0xf0U) << 4);
+            uint32_t const length = (inSpan[ibuf + 1] & 0x0fU) + kThreshold + 1;
+            ibuf += 2;
+            if (length > m_outlen - m_outindex) {
+                throw InvalidFormat("LZSS block exceeds the output size");
+            }
 
-                    buffer.at(static_cast<size_t>(r++)) = static_cast<char>(c);
-                    r &= (kRingBufferSize - 1);
+            // The dictionary position was last written distance bytes ago, 1 to 4096.
+            uint32_t const written  = m_outindex - blockStart;
+            uint32_t const distance = ((kRingStart + written - offset - 1) & (kRingBufferSize - 1)) + 1;
+            if (distance >= length && distance <= written) {
+                std::copy_n(out.subspan(m_outindex - distance).begin(), length, out.subspan(m_outindex).begin());
+            } else if (distance <= written) {
+                // the match overlaps its own output and repeats the last distance bytes
+                for (uint32_t k = 0; k < length; ++k) {
+                    out[m_outindex + k] = out[m_outindex + k - distance];
+                }
+            } else {
+                // the match starts in the initial dictionary
+                for (uint32_t k = 0; k < length; ++k) {
+                    out[m_outindex + k] = written + k >= distance ? out[m_outindex + k - distance]
+                                                                  : initialByte(distance - written - k);
                 }
             }
+            m_outindex += length;
         }
     }
 
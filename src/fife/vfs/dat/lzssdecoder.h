@@ -8,6 +8,8 @@
 #include "platform.h"
 
 // Standard C++ library includes
+#include <vector>
+
 // 3rd party library includes
 
 // FIFE includes
@@ -24,6 +26,13 @@ namespace FIFE
      *   N == 0: end of stream
      *   N < 0:  raw block, copy -N bytes as-is
      *   N > 0:  LZSS compressed block, next N bytes are compressed
+     *
+     * Every compressed block starts with a fresh 4096 byte dictionary. The decoder copies matches
+     * straight from the output it already wrote instead of keeping a ring buffer, and reads the
+     * compressed blocks into one buffer that is reused for the whole stream.
+     *
+     * A stream can be decoded in steps with begin() and decodeUntil(), so only the requested prefix
+     * of an entry has to be decoded.
      */
     class FIFE_API LZSSDecoder
     {
@@ -44,13 +53,37 @@ namespace FIFE
              * @param input The VFS file to read from
              * @param output The memory location to write to
              * @param outputsize The size of the memory location in byte
+             * @throws InvalidFormat if the stream decodes to more than outputsize bytes.
              */
             void decode(RawData* input, uint8_t* output, uint32_t outputsize);
 
+            /**
+             * Starts decoding a stream, it is read from the current index of the input on.
+             *
+             * @param output The memory location to write to
+             * @param outputsize The size of the memory location in byte
+             */
+            void begin(uint8_t* output, uint32_t outputsize);
+
+            /**
+             * Decodes whole blocks until at least size bytes of the output are written.
+             *
+             * @param input The VFS file to read from, at the index where the last call stopped
+             * @param size The number of bytes that are needed
+             * @return The number of bytes written, less than size only if the stream ended before.
+             * @throws InvalidFormat if the stream decodes to more than the output size.
+             */
+            uint32_t decodeUntil(RawData* input, uint32_t size);
+
         private:
+            void LZSSDecode(uint8_t const * in, uint32_t len);
+
+            uint8_t* m_output;
             uint32_t m_outlen;
             uint32_t m_outindex;
-            void LZSSDecode(uint8_t const * in, int64_t len, uint8_t* out);
+            bool m_finished;
+            // compressed block, reused for all blocks
+            std::vector<uint8_t> m_block;
     };
 
 } // namespace FIFE
@@ -5,7 +5,10 @@
 #include "rawdatadat1.h"
 
 // Standard C++ library includes
+#include <algorithm>
+#include <cassert>
 #include <memory>
+#include <span>
 #include <string>
 
 // 3rd party library includes
@@ -18,18 +21,60 @@
 namespace FIFE
 {
 
+    namespace
+    {
+        // stored entries are read in chunks of at least this size
+        constexpr uint32_t kReadChunk = 64 * 1024;
+    } // namespace
+
     RawDataDAT1::RawDataDAT1(VFS* vfs, std::string const & datfile, s_info const & info) :
-        RawDataMemSource(info.unpackedLength)
+        m_vfs(vfs),
+        m_datfile(datfile),
+        m_inputIndex(info.offset),
+        m_data(std::make_unique_for_overwrite<uint8_t[]>(info.unpackedLength)), // NOLINT(modernize-avoid-c-arrays)
+        m_size(info.unpackedLength),
+        m_decoded(0),
+        m_compressed(info.type == 0x40)
+    {
+        if (m_compressed) {
+            m_decoder.begin(m_data.get(), m_size);
+        }
+    }
+
+    RawDataDAT1::~RawDataDAT1() = default;
+
+    uint32_t RawDataDAT1::getSize() const
     {
+        return m_size;
+    }
 
-        auto input = vfs->open(datfile);
-        input->setIndex(info.offset);
+    void RawDataDAT1::readInto(uint8_t* buffer, uint32_t start, uint32_t length)
+    {
+        assert(start + length <= m_size);
+        if (start + length > m_decoded) {
+            decodeUntil(start + length);
+        }
+        auto const src = std::span(m_data.get(), m_size).subspan(start, length);
+        std::ranges::copy(src, buffer);
+    }
 
-        if (info.type == 0x40) { // compressed
-            LZSSDecoder decoder;
-            decoder.decode(input.get(), getRawData(), getSize());
+    void RawDataDAT1::decodeUntil(uint32_t size)
+    {
+        auto const data                = std::span(m_data.get(), m_size);
+        std::unique_ptr<RawData> input = m_vfs->open(m_datfile);
+        input->setIndex(m_inputIndex);
+        if (m_compressed) {
+            m_decoded = m_decoder.decodeUntil(input.get(), size);
+            if (m_decoded < size) {
+                // the stream ended early, the rest of the entry stays empty
+                std::ranges::fill(data.subspan(m_decoded), 0);
+                m_decoded = m_size;
+            }
         } else {
-            input->readInto(getRawData(), getSize());
+            uint32_t const end = std::max(size, std::min(m_size, m_decoded + kReadChunk));
+            input->readInto(data.subspan(m_decoded).data(), end - m_decoded);
+            m_decoded = end;
         }
+        m_inputIndex = input->getCurrentIndex();
     }
 } // namespace FIFE
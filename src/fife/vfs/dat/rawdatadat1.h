@@ -8,21 +8,27 @@
 #include "platform.h"
 
 // Standard C++ library includes
+#include <memory>
 #include <string>
 
 // 3rd party library includes
 
 // FIFE includes
-#include "vfs/raw/rawdatamemsource.h"
+#include "lzssdecoder.h"
+#include "vfs/raw/rawdatasource.h"
 #include "vfs/vfs.h"
 
 namespace FIFE
 {
 
-    /** A subclass of RawDataMemSource, that fills itself with a FALLOUT1 .DAT file entry
+    /** A RawDataSource for a FALLOUT1 .DAT file entry, that is read and decompressed on demand
+     *
+     * Only the prefix of the entry that was read so far is decoded, e.g. the header of an image.
+     * The archive is only opened while a read decodes more of the entry, so entries that are
+     * kept around do not hold a file handle each.
      * @see MFFalloutDAT1
      */
-    class FIFE_API RawDataDAT1 : public RawDataMemSource
+    class FIFE_API RawDataDAT1 : public RawDataSource
     {
         public:
             /** The needed information for the extraction.
@@ -42,9 +48,28 @@ namespace FIFE
              * @param info The .DAT file entry, as retrieved by MFFalloutDAT1
              */
             RawDataDAT1(VFS* vfs, std::string const & datfile, s_info const & info);
+            ~RawDataDAT1() override;
 
             RawDataDAT1(RawDataDAT1 const &)            = delete;
             RawDataDAT1& operator=(RawDataDAT1 const &) = delete;
+
+            uint32_t getSize() const override;
+            void readInto(uint8_t* buffer, uint32_t start, uint32_t length) override;
+
+        private:
+            /** Reads or decodes the entry until at least size bytes are available.
+             */
+            void decodeUntil(uint32_t size);
+
+            VFS* m_vfs;
+            std::string m_datfile;
+            // index in the archive where the next read continues
+            uint32_t m_inputIndex;
+            LZSSDecoder m_decoder;
+            std::unique_ptr<uint8_t[]> m_data; // NOLINT(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+            uint32_t m_size;
+            uint32_t m_decoded;
+            bool m_compressed;
     };
 
 } // namespace FIFE
@@ -6,7 +6,9 @@
 
 // Standard C++ library includes
 #include <algorithm>
+#include <cassert>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -21,25 +23,98 @@
 namespace FIFE
 {
 
+    namespace
+    {
+        // bytes read from the archive or inflated at least per step
+        constexpr uint32_t kReadChunk = 64 * 1024;
+    } // namespace
+
     RawDataDAT2::RawDataDAT2(VFS* vfs, std::string const & datfile, s_info const & info) :
-        RawDataMemSource(info.unpackedLength)
+        m_name(info.name + " (inside: " + datfile + ")"),
+        m_vfs(vfs),
+        m_datfile(datfile),
+        m_inputIndex(info.offset),
+        m_data(std::make_unique_for_overwrite<uint8_t[]>(info.unpackedLength)), // NOLINT(modernize-avoid-c-arrays)
+        m_size(info.unpackedLength),
+        m_decoded(0),
+        m_packedLeft(info.type == 1 ? info.packedLength : 0),
+        m_stream(),
+        m_inflating(false)
     {
+        if (info.type == 1) { // compressed
+            if (inflateInit(&m_stream) != Z_OK) {
+                throw InvalidFormat("failed to decompress " + m_name);
+            }
+            m_inflating = true;
+        }
+        if (m_size == 0) {
+            finish();
+        }
+    }
 
-        auto input = vfs->open(datfile);
-        input->setIndex(info.offset);
+    RawDataDAT2::~RawDataDAT2()
+    {
+        finish();
+    }
 
-        if (info.type == 1) { // compressed
-            std::vector<uint8_t> compressed(info.packedLength);
-            input->readInto(compressed.data(), info.packedLength);
+    uint32_t RawDataDAT2::getSize() const
+    {
+        return m_size;
+    }
 
-            uLongf dstlen = info.unpackedLength;
-            if (uncompress(getRawData(), &dstlen, compressed.data(), info.packedLength) != Z_OK ||
-                dstlen != info.unpackedLength) {
-                throw InvalidFormat("failed to decompress " + info.name + " (inside: " + datfile + ")");
-            }
+    void RawDataDAT2::readInto(uint8_t* buffer, uint32_t start, uint32_t length)
+    {
+        assert(start + length <= m_size);
+        if (start + length > m_decoded) {
+            decodeUntil(start + length);
+        }
+        auto const src = std::span(m_data.get(), m_size).subspan(start, length);
+        std::ranges::copy(src, buffer);
+    }
+
+    void RawDataDAT2::decodeUntil(uint32_t size)
+    {
+        auto const data                = std::span(m_data.get(), m_size);
+        std::unique_ptr<RawData> input = m_vfs->open(m_datfile);
+        input->setIndex(m_inputIndex);
+        if (!m_inflating) {
+            uint32_t const end = std::max(size, std::min(m_size, m_decoded + kReadChunk));
+            input->readInto(data.subspan(m_decoded).data(), end - m_decoded);
+            m_decoded = end;
         } else {
-            input->readInto(getRawData(), info.unpackedLength);
+            while (m_decoded < size) {
+                if (m_stream.avail_in == 0 && m_packedLeft > 0) {
+                    uint32_t const chunk = std::min(m_packedLeft, kReadChunk);
+                    m_packed.resize(chunk);
+                    input->readInto(m_packed.data(), chunk);
+                    m_packedLeft -= chunk;
+                    m_stream.next_in  = m_packed.data();
+                    m_stream.avail_in = chunk;
+                }
+                uint32_t const wanted = std::min(m_size - m_decoded, std::max(size - m_decoded, kReadChunk));
+                m_stream.next_out     = data.subspan(m_decoded).data();
+                m_stream.avail_out    = wanted;
+
+                int32_t const err = inflate(&m_stream, Z_NO_FLUSH);
+                m_decoded += wanted - m_stream.avail_out;
+                if ((err != Z_OK && err != Z_STREAM_END) || (err == Z_STREAM_END && m_decoded != m_size)) {
+                    throw InvalidFormat("failed to decompress " + m_name);
+                }
+            }
+        }
+        m_inputIndex = input->getCurrentIndex();
+        if (m_decoded == m_size) {
+            finish();
+        }
+    }
+
+    void RawDataDAT2::finish()
+    {
+        if (m_inflating) {
+            inflateEnd(&m_stream);
+            m_inflating = false;
         }
+        std::vector<uint8_t>().swap(m_packed);
     }
 
 } // namespace FIFE
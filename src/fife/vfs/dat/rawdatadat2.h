@@ -8,23 +8,31 @@
 #include "platform.h"
 
 // Standard C++ library includes
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "util/base/fife_stdint.h"
 
 // 3rd party library includes
+#include <zlib.h>
 
 // FIFE includes
-#include "vfs/raw/rawdatamemsource.h"
+#include "vfs/raw/rawdatasource.h"
 
 namespace FIFE
 {
+    class RawData;
     class VFS;
 
-    /** A subclass of RawDataMemSource, that fills itself with a FALLOUT1 .DAT file entry
+    /** A RawDataSource for a FALLOUT2 .DAT file entry, that is read and inflated on demand
+     *
+     * Only the prefix of the entry that was read so far is inflated, e.g. the header of an image.
+     * The archive is only opened while a read inflates more of the entry, so entries that are
+     * kept around do not hold a file handle each.
      * @see MFFalloutDAT2
      */
-    class FIFE_API RawDataDAT2 : public RawDataMemSource
+    class FIFE_API RawDataDAT2 : public RawDataSource
     {
         public:
             /** The needed information for the extraction.
@@ -44,9 +52,38 @@ namespace FIFE
              * @param info The .DAT file entry, as retrieved by MFFalloutDAT2
              */
             RawDataDAT2(VFS* vfs, std::string const & datfile, s_info const & info);
+            ~RawDataDAT2() override;
 
             RawDataDAT2(RawDataDAT2 const &)            = delete;
             RawDataDAT2& operator=(RawDataDAT2 const &) = delete;
+
+            uint32_t getSize() const override;
+
+            /** @throws InvalidFormat if the entry fails to inflate. */
+            void readInto(uint8_t* buffer, uint32_t start, uint32_t length) override;
+
+        private:
+            /** Reads or inflates the entry until at least size bytes are available.
+             */
+            void decodeUntil(uint32_t size);
+
+            /** Closes the inflate stream.
+             */
+            void finish();
+
+            std::string m_name;
+            VFS* m_vfs;
+            std::string m_datfile;
+            // index in the archive where the next read continues
+            uint32_t m_inputIndex;
+            std::unique_ptr<uint8_t[]> m_data; // NOLINT(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+            uint32_t m_size;
+            uint32_t m_decoded;
+            // compressed bytes that were not yet read from the archive
+            uint32_t m_packedLeft;
+            std::vector<uint8_t> m_packed;
+            z_stream m_stream;
+            bool m_inflating;
     };
 } // namespace FIFE
 #endif
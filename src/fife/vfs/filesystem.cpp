@@ -5,6 +5,7 @@
 #include <filesystem>
 #include <iterator>
 #include <string>
+#include <system_error>
 
 // FIFE includes
 #include "vfs/filesystem.h"
@@ -86,4 +87,15 @@ namespace FIFE
         return GetStem(fs::path(path));
     }
 
+    bool ReplaceFile(std::string const & source, std::string const & target, std::error_code& error)
+    {
+        fs::rename(fs::path(source), fs::path(target), error);
+        if (!error) {
+            return true;
+        }
+        std::error_code ignored;
+        fs::remove(fs::path(source), ignored);
+        return false;
+    }
+
 } // namespace FIFE
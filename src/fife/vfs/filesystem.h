@@ -10,6 +10,7 @@
 // Standard C++ library includes
 #include <filesystem>
 #include <string>
+#include <system_error>
 
 // Namespace alias for convenience
 namespace fs = std::filesystem;
@@ -100,6 +101,15 @@ namespace FIFE
      *  @return the filename minus any extension
      */
     std::string GetStem(fs::path const & path);
+
+    /** Helper function to replace a file by another one
+     *  @note the source file is removed if it cannot replace the target
+     *  @param source the path of the new file
+     *  @param target the path of the file to replace
+     *  @param error set to the reason of a failure
+     *  @return true if the target was replaced
+     */
+    bool ReplaceFile(std::string const & source, std::string const & target, std::error_code& error);
 } // namespace FIFE
 
 #endif
@@ -6,7 +6,9 @@
 
 // Standard C++ library includes
 #include <algorithm>
+#include <cstddef>
 #include <format>
+#include <iterator>
 #include <memory>
 #include <regex>
 #include <set>
@@ -23,6 +25,7 @@
 #include "vfs/raw/rawdata.h"
 #include "vfssource.h"
 #include "vfssourceprovider.h"
+#include "zip/zipentrycache.h"
 
 namespace FIFE
 {
@@ -38,7 +41,9 @@ namespace FIFE
         }
     } // namespace
 
-    VFS::VFS() = default;
+    VFS::VFS() : m_zipCache(std::make_unique<ZipEntryCache>())
+    {
+    }
 
     VFS::~VFS()
     {
@@ -271,6 +276,41 @@ namespace FIFE
         return results;
     }
 
+    std::vector<std::unique_ptr<RawData>> VFS::openBatch(std::vector<std::string> const & paths)
+    {
+        // indices of the paths per source, in the order the sources are first used
+        std::vector<std::pair<VFSSource const *, std::vector<std::size_t>>> groups;
+        for (std::size_t i = 0; i < paths.size(); ++i) {
+            VFSSource const * source = getSourceForFile(paths[i]);
+            if (source == nullptr) {
+                FL_DBG(_log(), std::format("openBatch: {} not found", paths[i]));
+                continue;
+            }
+            auto it = std::ranges::find_if(groups, [source](auto const & group) {
+                return group.first == source;
+            });
+            if (it == groups.end()) {
+                groups.emplace_back(source, std::vector<std::size_t>());
+                it = std::prev(groups.end());
+            }
+            it->second.push_back(i);
+        }
+
+        std::vector<std::unique_ptr<RawData>> files(paths.size());
+        for (auto const & [source, indices] : groups) {
+            std::vector<std::string> sourcePaths;
+            sourcePaths.reserve(indices.size());
+            for (std::size_t const index : indices) {
+                sourcePaths.push_back(paths[index]);
+            }
+            std::vector<std::unique_ptr<RawData>> opened = source->openBatch(sourcePaths);
+            for (std::size_t i = 0; i < indices.size() && i < opened.size(); ++i) {
+                files[indices[i]] = std::move(opened[i]);
+            }
+        }
+        return files;
+    }
+
     std::unique_ptr<RawData> VFS::readFile(std::string const & path)
     {
         VFSSource const * source = getSourceForFile(path);
@@ -281,6 +321,18 @@ namespace FIFE
         return source->open(path);
     }
 
+    std::optional<FileStamp> VFS::getStamp(std::string const & path) const
+    {
+        for (auto const & source : m_sources) {
+            // a stamp implies the file exists, sources without stamps are asked the usual way
+            std::optional<FileStamp> stamp = source->getStamp(path);
+            if (stamp || source->fileExists(path)) {
+                return stamp;
+            }
+        }
+        return std::nullopt;
+    }
+
     bool VFS::hasSource(std::string const & path) const
     {
         auto checkPath = [this](std::string const & candidate) -> bool {
@@ -326,4 +378,9 @@ namespace FIFE
 
         return false;
     }
+
+    ZipEntryCache& VFS::getZipCache() const
+    {
+        return *m_zipCache;
+    }
 } // namespace FIFE
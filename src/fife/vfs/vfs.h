@@ -8,7 +8,9 @@
 #include "platform.h"
 
 // Standard C++ library includes
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <vector>
@@ -25,6 +27,19 @@ namespace FIFE
 
     class VFSSourceProvider;
     class VFSSource;
+    class ZipEntryCache;
+
+    /** Cheap identity of a file, see VFS::getStamp().
+     *
+     * A different stamp means the file may have changed, an equal stamp means it did not.
+     */
+    struct FIFE_API FileStamp
+    {
+            uint64_t size;
+            // modification time of a plain file, CRC-32 of an archive entry
+            uint64_t version;
+            bool operator==(FileStamp const &) const = default;
+    };
 
     /** the main VFS (virtual file system) class
      *
@@ -114,6 +129,16 @@ namespace FIFE
              */
             std::unique_ptr<RawData> open(std::string const & path);
 
+            /** Open several files at once
+             *
+             * The files of one source are opened together, so archives can read them in order and decompress
+             * them in parallel on the JobPool, see ZipSource::openBatch(). Other sources open them one by one.
+             *
+             * @param paths the files to open
+             * @return the opened files in the order of the paths, nullptr for files that cannot be found or opened
+             */
+            std::vector<std::unique_ptr<RawData>> openBatch(std::vector<std::string> const & paths);
+
             /** Read a file, returning nullptr instead of throwing on failure.
              *
              * Searches all VFS sources for the given file and returns its
@@ -125,6 +150,13 @@ namespace FIFE
              */
             std::unique_ptr<RawData> readFile(std::string const & path);
 
+            /** Returns the stamp of a file without opening or reading it.
+             *
+             * @param path the file
+             * @return the stamp, nullopt if the file does not exist or its source has no cheap stamp
+             */
+            std::optional<FileStamp> getStamp(std::string const & path) const;
+
             /** Get a filelist of the given directory
              *
              * @param path the directory
@@ -173,6 +205,10 @@ namespace FIFE
              */
             VFSSource* findSourceForFile(std::string const & file) const;
 
+            /** Returns the cache of decompressed zip entries, shared by all zip archives of the VFS
+             */
+            ZipEntryCache& getZipCache() const;
+
         private:
             using type_providers = std::vector<std::unique_ptr<VFSSourceProvider>>;
             type_providers m_providers;
@@ -180,6 +216,8 @@ namespace FIFE
             using type_sources = std::vector<std::unique_ptr<VFSSource>>;
             type_sources m_sources;
 
+            std::unique_ptr<ZipEntryCache> m_zipCache;
+
             std::set<std::string> filterList(std::set<std::string> const & list, std::string const & fregex) const;
             VFSSource* getSourceForFile(std::string const & file) const;
     };
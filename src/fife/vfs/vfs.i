@@ -5,6 +5,7 @@
 %{
 #include "util/base/exception.h"
 #include "vfs/vfs.h"
+#include "vfs/zip/zipentrycache.h"
 %}
 
 %include "vfs/raw/rawdata.i"
@@ -14,6 +15,24 @@
 
 
 namespace FIFE {
+	struct ZipCacheStats {
+		uint64_t hits;
+		uint64_t misses;
+		uint64_t bytesInflated;
+	};
+
+	class ZipEntryCache {
+	public:
+		void setLimit(size_t bytes);
+		size_t getLimit() const;
+		size_t getSize() const;
+		void clear();
+		const ZipCacheStats& getStats() const;
+		void resetStats();
+	private:
+		ZipEntryCache();
+	};
+
 	class VFS {
 	public:
 
@@ -30,5 +49,7 @@ namespace FIFE {
 
 		std::set<std::string> listFiles(const std::string& path) const;
 		std::set<std::string> listDirectories(const std::string& path) const;
+
+		ZipEntryCache& getZipCache() const;
 	};
 }
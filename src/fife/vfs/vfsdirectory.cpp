@@ -5,10 +5,13 @@
 #include "vfsdirectory.h"
 
 // Standard C++ library includes
+#include <cstdint>
 #include <format>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
+#include <system_error>
 #include <utility>
 
 // 3rd party library includes
@@ -59,6 +62,23 @@ namespace FIFE
         return std::make_unique<RawData>(new RawDataFile(m_root + file)); // NOLINT(cppcoreguidelines-owning-memory)
     }
 
+    std::optional<FileStamp> VFSDirectory::getStamp(std::string const & filename) const
+    {
+        std::error_code error;
+        fs::path const path(m_root + filename);
+        fs::file_status const status = fs::status(path, error);
+        if (error || !fs::is_regular_file(status)) {
+            return std::nullopt;
+        }
+        uintmax_t const size              = fs::file_size(path, error);
+        fs::file_time_type const modified = fs::last_write_time(path, error);
+        if (error) {
+            return std::nullopt;
+        }
+        return FileStamp{
+            .size = static_cast<uint64_t>(size), .version = static_cast<uint64_t>(modified.time_since_epoch().count())};
+    }
+
     std::set<std::string> VFSDirectory::listFiles(std::string const & path) const
     {
         return list(path, false);
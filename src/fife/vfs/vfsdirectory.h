@@ -38,6 +38,10 @@ namespace FIFE
             bool fileExists(std::string const & filename) const override;
             std::unique_ptr<RawData> open(std::string const & filename) const override;
 
+            /** Size and modification time of the file, from a single stat.
+             */
+            std::optional<FileStamp> getStamp(std::string const & filename) const override;
+
             std::set<std::string> listFiles(std::string const & path) const override;
 
             std::set<std::string> listDirectories(std::string const & path) const override;
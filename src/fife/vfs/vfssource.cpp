@@ -6,12 +6,16 @@
 
 // Standard C++ library includes
 #include <algorithm>
+#include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 // 3rd party library includes
 
 // FIFE includes
 #include "vfs.h"
+#include "vfs/raw/rawdata.h"
 
 namespace FIFE
 {
@@ -27,6 +31,21 @@ namespace FIFE
         }
     }
 
+    std::vector<std::unique_ptr<RawData>> VFSSource::openBatch(std::vector<std::string> const & files) const
+    {
+        std::vector<std::unique_ptr<RawData>> opened;
+        opened.reserve(files.size());
+        for (std::string const & file : files) {
+            opened.push_back(fileExists(file) ? open(file) : nullptr);
+        }
+        return opened;
+    }
+
+    std::optional<FileStamp> VFSSource::getStamp(std::string const & /*file*/) const
+    {
+        return std::nullopt;
+    }
+
 } // namespace FIFE
 
 std::string FIFE::VFSSource::fixPath(std::string path) const
@@ -9,8 +9,10 @@
 
 // Standard C++ library includes
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
+#include <vector>
 
 // 3rd party library includes
 
@@ -56,6 +58,22 @@ namespace FIFE
              */
             virtual std::unique_ptr<RawData> open(std::string const & file) const = 0;
 
+            /** open several files inside this source
+             *
+             * The default opens them one by one, archives override it to read and decompress them together.
+             * @param files the files to open
+             * @return the opened files in the order of the names, nullptr for files that do not exist
+             */
+            virtual std::vector<std::unique_ptr<RawData>> openBatch(std::vector<std::string> const & files) const;
+
+            /** get the stamp of a file without opening it
+             *
+             * The default has no cheap stamp and returns nullopt.
+             * @param file the file
+             * @return the stamp, nullopt if the file does not exist or the source cannot tell
+             */
+            virtual std::optional<FileStamp> getStamp(std::string const & file) const;
+
             /** list all files in a directory of this source
              *
              * @param path path to list files in
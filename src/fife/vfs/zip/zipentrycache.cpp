@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Corresponding header include
+#include "zipentrycache.h"
+
+// Standard C++ library includes
+#include <cstddef>
+#include <iterator>
+
+// 3rd party library includes
+
+// FIFE includes
+
+namespace FIFE
+{
+
+    ZipEntryCache::ZipEntryCache() : m_size(0), m_limit(DEFAULT_LIMIT)
+    {
+    }
+
+    ZipEntryCache::Buffer ZipEntryCache::find(ZipNode const * node)
+    {
+        auto it = m_index.find(node);
+        if (it == m_index.end()) {
+            return nullptr;
+        }
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return it->second->data;
+    }
+
+    void ZipEntryCache::add(ZipSource const * source, ZipNode const * node, Buffer const & data)
+    {
+        if (m_limit == 0 || data->size() > m_limit || m_index.contains(node)) {
+            return;
+        }
+        shrink(m_limit - data->size());
+        m_entries.push_front({source, node, data});
+        m_index[node] = m_entries.begin();
+        m_size += data->size();
+    }
+
+    void ZipEntryCache::removeSource(ZipSource const * source)
+    {
+        for (auto it = m_entries.begin(); it != m_entries.end();) {
+            auto const next = std::next(it);
+            if (it->source == source) {
+                erase(it);
+            }
+            it = next;
+        }
+    }
+
+    void ZipEntryCache::setLimit(std::size_t bytes)
+    {
+        m_limit = bytes;
+        shrink(bytes);
+    }
+
+    std::size_t ZipEntryCache::getLimit() const
+    {
+        return m_limit;
+    }
+
+    std::size_t ZipEntryCache::getSize() const
+    {
+        return m_size;
+    }
+
+    void ZipEntryCache::clear()
+    {
+        shrink(0);
+    }
+
+    ZipCacheStats& ZipEntryCache::getStats()
+    {
+        return m_stats;
+    }
+
+    ZipCacheStats const & ZipEntryCache::getStats() const
+    {
+        return m_stats;
+    }
+
+    void ZipEntryCache::resetStats()
+    {
+        m_stats = ZipCacheStats();
+    }
+
+    void ZipEntryCache::shrink(std::size_t bytes)
+    {
+        while (m_size > bytes) {
+            erase(std::prev(m_entries.end()));
+        }
+    }
+
+    void ZipEntryCache::erase(EntryList::iterator it)
+    {
+        m_size -= it->data->size();
+        m_index.erase(it->node);
+        m_entries.erase(it);
+    }
+
+} // namespace FIFE
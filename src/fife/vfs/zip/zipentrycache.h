@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+#ifndef FIFE_ZIP_ENTRYCACHE_H
+#define FIFE_ZIP_ENTRYCACHE_H
+
+// Platform specific includes
+#include "platform.h"
+
+// Standard C++ library includes
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// 3rd party library includes
+
+// FIFE includes
+
+namespace FIFE
+{
+    class ZipNode;
+    class ZipSource;
+
+    /** Counters of the decompressed entry cache of the zip archives.
+     */
+    struct ZipCacheStats
+    {
+            //! opened entries that were found in the cache
+            uint64_t hits = 0;
+            //! opened entries that were read from the archive
+            uint64_t misses = 0;
+            //! uncompressed bytes produced by inflating entries
+            uint64_t bytesInflated = 0;
+    };
+
+    /** Decompressed zip entries, shared by all ZipSources of a VFS.
+     *
+     * The cache is bounded by bytes for all archives together, so the memory it holds does not grow with the number
+     * of archives. The least recently opened entries are dropped first.
+     */
+    class FIFE_API ZipEntryCache
+    {
+        public:
+            using Buffer = std::shared_ptr<std::vector<uint8_t> const>;
+
+            ZipEntryCache();
+
+            ZipEntryCache(ZipEntryCache const &)            = delete;
+            ZipEntryCache& operator=(ZipEntryCache const &) = delete;
+
+            /** Returns the cached data of an entry and marks it as recently used, nullptr on a miss.
+             */
+            Buffer find(ZipNode const * node);
+
+            /** Adds the data of an entry to the cache and drops old entries until it fits the limit.
+             * @param source The archive of the entry, see removeSource().
+             */
+            void add(ZipSource const * source, ZipNode const * node, Buffer const & data);
+
+            /** Drops the entries of an archive, called when it is destroyed.
+             */
+            void removeSource(ZipSource const * source);
+
+            /** Sets the maximum of decompressed bytes kept for all archives, 0 disables the cache.
+             * Entries larger than the limit are never cached.
+             */
+            void setLimit(std::size_t bytes);
+
+            /** Returns the maximum of decompressed bytes kept in the cache.
+             */
+            std::size_t getLimit() const;
+
+            /** Returns the decompressed bytes that are currently cached.
+             */
+            std::size_t getSize() const;
+
+            /** Drops all cached entries, files that are still open keep their data.
+             */
+            void clear();
+
+            ZipCacheStats& getStats();
+            ZipCacheStats const & getStats() const;
+            void resetStats();
+
+            //! default cache limit in bytes
+            static std::size_t const DEFAULT_LIMIT = 32 * 1024 * 1024;
+
+        private:
+            struct Entry
+            {
+                    ZipSource const * source;
+                    ZipNode const * node;
+                    Buffer data;
+            };
+
+            using EntryList = std::list<Entry>;
+
+            /** Drops the least recently used entries until the cache holds at most the given bytes.
+             */
+            void shrink(std::size_t bytes);
+
+            void erase(EntryList::iterator it);
+
+            // most recently opened entries first
+            EntryList m_entries;
+            std::unordered_map<ZipNode const *, EntryList::iterator> m_index;
+            std::size_t m_size;
+            std::size_t m_limit;
+            ZipCacheStats m_stats;
+    };
+
+} // namespace FIFE
+
+#endif
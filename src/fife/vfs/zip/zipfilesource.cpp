@@ -7,8 +7,8 @@
 // Standard C++ library includes
 #include <algorithm>
 #include <cassert>
-#include <cstring>
 #include <span>
+#include <utility>
 
 // 3rd party library includes
 
@@ -16,24 +16,21 @@
 namespace FIFE
 {
 
-    ZipFileSource::ZipFileSource(uint8_t* data, uint32_t datalen) : m_data(data), m_datalen(datalen)
+    ZipFileSource::ZipFileSource(std::shared_ptr<std::vector<uint8_t> const> data) : m_data(std::move(data))
     {
     }
 
-    ZipFileSource::~ZipFileSource()
-    {
-        delete[] m_data;
-    }
+    ZipFileSource::~ZipFileSource() = default;
 
     uint32_t ZipFileSource::getSize() const
     {
-        return m_datalen;
+        return static_cast<uint32_t>(m_data->size());
     }
 
     void ZipFileSource::readInto(uint8_t* target, uint32_t start, uint32_t len)
     {
-        assert(start + len <= m_datalen);
-        auto const src = std::span(m_data, m_datalen).subspan(start, len);
+        assert(start + len <= m_data->size());
+        auto const src = std::span(*m_data).subspan(start, len);
         std::ranges::copy(src, target);
     }
 } // namespace FIFE
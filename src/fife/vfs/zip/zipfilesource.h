@@ -9,6 +9,8 @@
 
 // Standard C++ library includes
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 // FIFE includes
 #include "vfs/raw/rawdatasource.h"
@@ -16,18 +18,19 @@
 namespace FIFE
 {
 
+    /** Decompressed zip entry, the data may be shared with the cache of the ZipSource.
+     */
     class FIFE_API ZipFileSource : public RawDataSource
     {
         public:
-            ZipFileSource(uint8_t* data, uint32_t datalen);
+            explicit ZipFileSource(std::shared_ptr<std::vector<uint8_t> const> data);
             ~ZipFileSource() override;
 
             uint32_t getSize() const override;
             void readInto(uint8_t* target, uint32_t start, uint32_t len) override;
 
         private:
-            uint8_t* m_data;
-            uint32_t m_datalen;
+            std::shared_ptr<std::vector<uint8_t> const> m_data;
     };
 
 } // namespace FIFE
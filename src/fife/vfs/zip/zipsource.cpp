@@ -3,21 +3,28 @@
 
 #include "zipsource.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <format>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "modules.h"
+#include "util/base/jobpool.h"
 #include "util/log/logger.h"
 #include "vfs/filesystem.h"
 #include "vfs/raw/rawdata.h"
 #include "vfs/vfs.h"
 #include "vfs/zip/ziptree.h"
+#include "zipentrycache.h"
 #include "zipfilesource.h"
 #include "zipnode.h"
 #include "zlib.h"
@@ -32,15 +39,94 @@ namespace FIFE
             static Logger log(LM_LOADERS);
             return log;
         }
+
+        /** Raw deflate stream of a thread, it is reset for every entry instead of being set up again.
+         */
+        class Inflater
+        {
+            public:
+                Inflater() : m_stream(), m_ready(inflateInit2(&m_stream, -15) == Z_OK)
+                {
+                }
+
+                ~Inflater()
+                {
+                    if (m_ready) {
+                        inflateEnd(&m_stream);
+                    }
+                }
+
+                Inflater(Inflater const &)            = delete;
+                Inflater& operator=(Inflater const &) = delete;
+                Inflater(Inflater&&)                  = delete;
+                Inflater& operator=(Inflater&&)       = delete;
+
+                /** Inflates a whole entry, the output has the uncompressed size of the entry.
+                 * @return An empty string on success, the error otherwise.
+                 */
+                std::string inflate(std::vector<uint8_t>& input, std::vector<uint8_t>& output)
+                {
+                    if (!m_ready || inflateReset(&m_stream) != Z_OK) {
+                        return "inflateInit2 failed";
+                    }
+                    m_stream.next_in   = input.data();
+                    m_stream.avail_in  = static_cast<uInt>(input.size());
+                    m_stream.next_out  = output.data();
+                    m_stream.avail_out = static_cast<uInt>(output.size());
+
+                    int32_t const err = ::inflate(&m_stream, Z_FINISH);
+                    if (err == Z_STREAM_END) {
+                        return {};
+                    }
+                    if (m_stream.msg != nullptr) {
+                        return std::format("inflate failed: {}", m_stream.msg);
+                    }
+                    return std::format("inflate failed without msg, err: {}", err);
+                }
+
+            private:
+                z_stream m_stream;
+                bool m_ready;
+        };
+
+        /** Turns the stored bytes of an entry into its data, the stored bytes may be taken over.
+         * @return The data or nullptr, then error is set.
+         */
+        std::shared_ptr<std::vector<uint8_t> const> decodeEntry(
+            ZipEntryData const & entryData, std::vector<uint8_t>& stored, std::string& error)
+        {
+            if (entryData.comp == 0) {
+                return std::make_shared<std::vector<uint8_t> const>(std::move(stored));
+            }
+            if (entryData.comp != 8) {
+                error = "unsupported compression";
+                return nullptr;
+            }
+            thread_local Inflater inflater;
+            auto data = std::make_shared<std::vector<uint8_t>>(entryData.size_real);
+            error     = inflater.inflate(stored, *data);
+            if (!error.empty()) {
+                return nullptr;
+            }
+            return data;
+        }
     } // namespace
 
     ZipSource::ZipSource(VFS* vfs, std::string const & zip_file) :
-        VFSSource(vfs), m_zipfile(vfs->open(zip_file)), m_centralDirOffset(0), m_centralDirCount(0)
+        VFSSource(vfs),
+        m_zipfile(vfs->open(zip_file)),
+        m_centralDirOffset(0),
+        m_centralDirCount(0),
+        m_cache(vfs->getZipCache())
     {
         readIndex();
     }
 
-    ZipSource::~ZipSource() = default;
+    ZipSource::~ZipSource()
+    {
+        // the cache is keyed by the nodes of the archive
+        m_cache.removeSource(this);
+    }
 
     bool ZipSource::fileExists(std::string const & file) const
     {
@@ -48,6 +134,16 @@ namespace FIFE
         return m_zipTree.getNode(path.string()) != nullptr;
     }
 
+    std::optional<FileStamp> ZipSource::getStamp(std::string const & path) const
+    {
+        ZipNode const * node = m_zipTree.getNode(fs::path(path).string());
+        if (node == nullptr || node->getContentType() != ZipContentType::File) {
+            return std::nullopt;
+        }
+        ZipEntryData const & entryData = node->getZipEntryData();
+        return FileStamp{.size = entryData.size_real, .version = entryData.crc32};
+    }
+
     std::unique_ptr<RawData> ZipSource::open(std::string const & path) const
     {
         fs::path const filePath(path);
@@ -55,58 +151,120 @@ namespace FIFE
 
         assert("File not found in zip archive" && node != nullptr);
 
-        if (node != nullptr) {
-            ZipEntryData const & entryData = node->getZipEntryData();
-            uint32_t const dataOffset      = getLocalFileDataOffset(entryData.offset);
+        if (node == nullptr) {
+            return nullptr;
+        }
 
-            m_zipfile->setIndex(dataOffset);
-            auto data = std::make_unique<uint8_t[]>(entryData.size_real); // NOLINT(cppcoreguidelines-avoid-c-arrays,
-                                                                          // modernize-avoid-c-arrays)
+        ZipCacheStats& stats       = m_cache.getStats();
+        ZipEntryCache::Buffer data = m_cache.find(node);
+        if (data) {
+            ++stats.hits;
+        } else {
+            ++stats.misses;
+            ZipEntryData const & entryData = node->getZipEntryData();
             if (entryData.comp == 8) {
                 FL_DBG(
                     _log(),
                     std::format("trying to uncompress file {} (compressed with method {})", path, entryData.comp));
-                std::vector<uint8_t> compdata(entryData.size_comp);
-                m_zipfile->readInto(compdata.data(), entryData.size_comp);
-
-                z_stream zstream;
-                zstream.next_in   = compdata.data();
-                zstream.avail_in  = entryData.size_comp;
-                zstream.zalloc    = Z_NULL;
-                zstream.zfree     = Z_NULL;
-                zstream.opaque    = Z_NULL;
-                zstream.next_out  = data.get();
-                zstream.avail_out = entryData.size_real;
-
-                if (inflateInit2(&zstream, -15) != Z_OK) {
-                    FL_ERR(_log(), "inflateInit2 failed");
-                    return nullptr;
-                }
+            }
+            std::vector<uint8_t> stored = readEntry(entryData);
+            std::string error;
+            data = decodeEntry(entryData, stored, error);
+            if (!data) {
+                FL_ERR(_log(), error);
+                return nullptr;
+            }
+            if (entryData.comp == 8) {
+                stats.bytesInflated += entryData.size_real;
+            }
+            m_cache.add(this, node, data);
+        }
 
-                int32_t const err = inflate(&zstream, Z_FINISH);
-                if (err != Z_STREAM_END) {
-                    if (zstream.msg != nullptr) {
-                        FL_ERR(_log(), std::format("inflate failed: {}", zstream.msg));
-                    } else {
-                        FL_ERR(_log(), std::format("inflate failed without msg, err: {}", err));
-                    }
-                    inflateEnd(&zstream);
-                    return nullptr;
-                }
+        return std::make_unique<RawData>(new ZipFileSource(std::move(data))); // NOLINT(cppcoreguidelines-owning-memory)
+    }
 
-                inflateEnd(&zstream);
-            } else if (entryData.comp == 0) {
-                m_zipfile->readInto(data.get(), entryData.size_real);
-            } else {
-                FL_ERR(_log(), "unsupported compression");
-                return nullptr;
+    std::vector<std::unique_ptr<RawData>> ZipSource::openBatch(std::vector<std::string> const & paths) const
+    {
+        struct Pending
+        {
+                ZipNode const * node;
+                std::vector<std::size_t> indices;
+                std::vector<uint8_t> stored;
+                ZipEntryCache::Buffer data;
+                std::string error;
+        };
+
+        ZipCacheStats& stats = m_cache.getStats();
+        std::vector<ZipEntryCache::Buffer> buffers(paths.size());
+        std::vector<Pending> pending;
+        std::unordered_map<ZipNode const *, std::size_t> pendingIndex;
+        for (std::size_t i = 0; i < paths.size(); ++i) {
+            ZipNode const * node = m_zipTree.getNode(fs::path(paths[i]).string());
+            if (node == nullptr) {
+                FL_ERR(_log(), std::format("file {} not found in zip archive", paths[i]));
+                continue;
+            }
+            buffers[i] = m_cache.find(node);
+            if (buffers[i]) {
+                ++stats.hits;
+                continue;
             }
+            // an entry that is requested twice is only decompressed once
+            auto [it, inserted] = pendingIndex.try_emplace(node, pending.size());
+            if (inserted) {
+                pending.push_back({node, {}, {}, nullptr, {}});
+            }
+            pending[it->second].indices.push_back(i);
+        }
+
+        // the archive is read sequentially, only the decompression runs in parallel
+        std::ranges::sort(pending, [](Pending const & a, Pending const & b) {
+            return a.node->getZipEntryData().offset < b.node->getZipEntryData().offset;
+        });
+        for (Pending& entry : pending) {
+            entry.stored = readEntry(entry.node->getZipEntryData());
+        }
+        if (!pending.empty()) {
+            JobPool::instance()->parallelFor(pending.size(), [&pending](std::size_t index) {
+                Pending& entry = pending[index];
+                entry.data     = decodeEntry(entry.node->getZipEntryData(), entry.stored, entry.error);
+                std::vector<uint8_t>().swap(entry.stored);
+            });
+        }
+
+        for (Pending const & entry : pending) {
+            ++stats.misses;
+            if (!entry.data) {
+                FL_ERR(_log(), std::format("{}: {}", paths[entry.indices.front()], entry.error));
+                continue;
+            }
+            ZipEntryData const & entryData = entry.node->getZipEntryData();
+            if (entryData.comp == 8) {
+                stats.bytesInflated += entryData.size_real;
+            }
+            m_cache.add(this, entry.node, entry.data);
+            for (std::size_t const index : entry.indices) {
+                buffers[index] = entry.data;
+            }
+        }
 
-            return std::make_unique<RawData>(
-                new ZipFileSource(data.release(), entryData.size_real)); // NOLINT(cppcoreguidelines-owning-memory)
+        std::vector<std::unique_ptr<RawData>> files(paths.size());
+        for (std::size_t i = 0; i < paths.size(); ++i) {
+            if (buffers[i]) {
+                files[i] = std::make_unique<RawData>(
+                    new ZipFileSource(std::move(buffers[i]))); // NOLINT(cppcoreguidelines-owning-memory)
+            }
         }
+        return files;
+    }
 
-        return nullptr;
+    std::vector<uint8_t> ZipSource::readEntry(ZipEntryData const & entryData) const
+    {
+        uint32_t const dataOffset = getLocalFileDataOffset(entryData.offset);
+        m_zipfile->setIndex(dataOffset);
+        std::vector<uint8_t> stored(entryData.comp == 0 ? entryData.size_real : entryData.size_comp);
+        m_zipfile->readInto(stored.data(), static_cast<uint32_t>(stored.size()));
+        return stored;
     }
 
     void ZipSource::readIndex()
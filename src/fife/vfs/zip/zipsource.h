@@ -8,9 +8,12 @@
 #include "platform.h"
 
 // Standard C++ library includes
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
+#include <vector>
 
 // 3rd party library includes
 
@@ -23,11 +26,17 @@ namespace FIFE
 {
     class RawData;
     class VFS;
+    class ZipEntryCache;
+    class ZipNode;
+    struct ZipEntryData;
 } // namespace FIFE
 
 namespace FIFE
 {
     /**  Implements a Zip archive file source.
+     *
+     * Opened entries are kept decompressed in the ZipEntryCache of the VFS, so files that are opened again, e.g.
+     * shared imports or images reloaded after ImageManager::freeUnreferenced(), are neither read nor inflated again.
      *
      * @see FIFE::VFSSource
      */
@@ -51,7 +60,22 @@ namespace FIFE
 
             std::unique_ptr<RawData> open(std::string const & path) const override;
 
+            /** Opens several files of the archive at once.
+             *
+             * The entries are read in archive order and the deflated ones are inflated in parallel on the
+             * JobPool, which has to exist.
+             * @return The files in the order of the paths, nullptr for entries that failed to decompress.
+             */
+            std::vector<std::unique_ptr<RawData>> openBatch(std::vector<std::string> const & paths) const override;
+
+            /** Uncompressed size and CRC-32 of the entry, both from the central directory.
+             */
+            std::optional<FileStamp> getStamp(std::string const & path) const override;
+
         private:
+            /** Reads the stored or compressed bytes of an entry from the archive.
+             */
+            std::vector<uint8_t> readEntry(ZipEntryData const & entryData) const;
             /**
              * Reads the zip archive index by parsing the central directory.
              *  Calls readEndOfCentralDirectory() to locate the EOCD record,
@@ -102,6 +126,9 @@ namespace FIFE
             std::unique_ptr<RawData> m_zipfile;
             uint32_t m_centralDirOffset;
             uint16_t m_centralDirCount;
+
+            // shared with the other archives of the VFS
+            ZipEntryCache& m_cache;
     };
 
 } // namespace FIFE
@@ -9,7 +9,6 @@
 #include <cassert>
 #include <iterator>
 #include <limits>
-#include <map>
 #include <string>
 #include <utility>
 #include <vector>
@@ -24,14 +23,42 @@
 
 namespace FIFE
 {
+    namespace
+    {
+        // never equal to Image::getFreeGeneration()
+        constexpr uint64_t FRAME_NOT_LOADED = std::numeric_limits<uint64_t>::max();
+
+        /** Returns the index of the last frame that starts at or before time.
+         * Branchless binary search, starts[0] has to be 0.
+         */
+        [[nodiscard]] size_t findFrame(std::vector<uint32_t> const & starts, uint32_t time)
+        {
+            uint32_t const * base = starts.data();
+            size_t count          = starts.size();
+            while (count > 1) {
+                size_t const half = count / 2;
+                base              = (base[half] <= time) ? base + half : base;
+                count -= half;
+            }
+            return static_cast<size_t>(base - starts.data());
+        }
+    } // namespace
 
     Animation::Animation(IResourceLoader* loader) :
-        IResource(createUniqueAnimationName(), loader), m_direction(0), m_action_frame(-1), m_animation_endtime(-1)
+        IResource(createUniqueAnimationName(), loader),
+        m_frameQuantum(0),
+        m_direction(0),
+        m_action_frame(-1),
+        m_animation_endtime(-1)
     {
     }
 
     Animation::Animation(std::string const & name, IResourceLoader* loader) :
-        IResource(name, loader), m_direction(0), m_action_frame(-1), m_animation_endtime(-1)
+        IResource(name, loader),
+        m_frameQuantum(0),
+        m_direction(0),
+        m_action_frame(-1),
+        m_animation_endtime(-1)
     {
     }
 
@@ -65,8 +92,9 @@ namespace FIFE
     void Animation::invalidate()
     {
         free();
-        m_framemap.clear();
         m_frames.clear();
+        m_frameStarts.clear();
+        m_frameQuantum      = 0;
         m_action_frame      = -1;
         m_animation_endtime = -1;
         m_direction         = 0;
@@ -91,24 +119,23 @@ namespace FIFE
     {
         FrameInfo info;
         assert(m_frames.size() <= std::numeric_limits<uint32_t>::max());
-        info.index    = static_cast<uint32_t>(m_frames.size());
-        info.duration = duration;
-        info.image    = image;
+        info.index            = static_cast<uint32_t>(m_frames.size());
+        info.duration         = duration;
+        info.image            = image;
+        info.loadedGeneration = FRAME_NOT_LOADED;
+
+        uint32_t const frametime = m_frames.empty() ? 0 : static_cast<uint32_t>(m_animation_endtime);
+        if (m_frames.empty()) {
+            m_frameQuantum = duration;
+        } else if (duration != m_frameQuantum) {
+            m_frameQuantum = 0;
+        }
         m_frames.push_back(info);
+        m_frameStarts.push_back(frametime);
 
-        std::map<uint32_t, FrameInfo>::const_iterator i(m_framemap.end());
-        if (i == m_framemap.begin()) {
-            m_framemap[0] = info;
-            assert(duration <= static_cast<uint32_t>(std::numeric_limits<int32_t>::max()));
-            m_animation_endtime = static_cast<int32_t>(duration);
-        } else {
-            --i;
-            uint32_t const frametime        = i->first + i->second.duration;
-            m_framemap[frametime]           = info;
-            uint32_t const animationEndTime = frametime + duration;
-            assert(animationEndTime <= static_cast<uint32_t>(std::numeric_limits<int32_t>::max()));
-            m_animation_endtime = static_cast<int32_t>(animationEndTime);
-        }
+        uint32_t const animationEndTime = frametime + duration;
+        assert(animationEndTime <= static_cast<uint32_t>(std::numeric_limits<int32_t>::max()));
+        m_animation_endtime = static_cast<int32_t>(animationEndTime);
     }
 
     int32_t Animation::getFrameIndex(uint32_t timestamp)
@@ -118,15 +145,20 @@ namespace FIFE
 
     int32_t Animation::getFrameIndex64(uint64_t timestamp)
     {
-        int32_t val = -1;
-        if ((std::cmp_less_equal(timestamp, m_animation_endtime)) && (m_animation_endtime > 0)) {
-            assert(timestamp <= std::numeric_limits<uint32_t>::max());
-            std::map<uint32_t, FrameInfo>::const_iterator i(m_framemap.upper_bound(static_cast<uint32_t>(timestamp)));
-            --i;
-            assert(i->second.index <= static_cast<uint32_t>(std::numeric_limits<int32_t>::max()));
-            val = static_cast<int32_t>(i->second.index);
+        if (m_animation_endtime <= 0 || std::cmp_greater(timestamp, m_animation_endtime)) {
+            return -1;
+        }
+        auto const time = static_cast<uint32_t>(timestamp);
+        size_t index    = 0;
+        if (m_frameQuantum != 0) {
+            // the end time itself belongs to the last frame
+            index = std::min(static_cast<size_t>(time / m_frameQuantum), m_frames.size() - 1);
+        } else {
+            // frames without duration are hidden by the next frame starting at the same time
+            index = findFrame(m_frameStarts, time);
         }
-        return val;
+        assert(index <= static_cast<size_t>(std::numeric_limits<int32_t>::max()));
+        return static_cast<int32_t>(index);
     }
 
     bool Animation::isValidIndex(int32_t index) const
@@ -140,10 +172,7 @@ namespace FIFE
     {
         ImagePtr image;
         if (isValidIndex(index)) {
-            image = m_frames.at(static_cast<size_t>(index)).image;
-            if (image->getState() == IResource::RES_NOT_LOADED) {
-                image->load();
-            }
+            image = loadFrame(m_frames[static_cast<size_t>(index)]);
         }
         return image;
     }
@@ -155,17 +184,24 @@ namespace FIFE
 
     ImagePtr Animation::getFrameByTimestamp64(uint64_t timestamp)
     {
-        ImagePtr val;
-        if ((std::cmp_less_equal(timestamp, m_animation_endtime)) && (m_animation_endtime > 0)) {
-            assert(timestamp <= std::numeric_limits<uint32_t>::max());
-            std::map<uint32_t, FrameInfo>::const_iterator i(m_framemap.upper_bound(static_cast<uint32_t>(timestamp)));
-            --i;
-            val = i->second.image;
+        int32_t const index = getFrameIndex64(timestamp);
+        if (index < 0) {
+            return ImagePtr();
+        }
+        return loadFrame(m_frames[static_cast<size_t>(index)]);
+    }
+
+    ImagePtr const & Animation::loadFrame(FrameInfo& frame)
+    {
+        uint64_t const generation = Image::getFreeGeneration();
+        if (frame.loadedGeneration == generation) {
+            return frame.image;
         }
-        if (val && val->getState() == IResource::RES_NOT_LOADED) {
-            val->load();
+        if (frame.image && frame.image->getState() == IResource::RES_NOT_LOADED) {
+            frame.image->load();
         }
-        return val;
+        frame.loadedGeneration = generation;
+        return frame.image;
     }
 
     std::vector<ImagePtr> Animation::getFrames()
@@ -9,7 +9,6 @@
 
 // Standard C++ library includes
 #include <cassert>
-#include <map>
 #include <string>
 #include <vector>
 
@@ -72,6 +71,7 @@ namespace FIFE
             int32_t getFrameIndex64(uint64_t timestamp);
 
             /** Gets the frame iamge that matches the given index. If no matches found, returns an invalid ImagePtr
+             * Not loaded frames of the animation are loaded.
              */
             ImagePtr getFrame(int32_t index);
 
@@ -148,6 +148,8 @@ namespace FIFE
                     uint32_t index;
                     uint32_t duration;
                     ImagePtr image;
+                    // Image::getFreeGeneration() when the image was loaded the last time
+                    uint64_t loadedGeneration;
             };
 
             std::string createUniqueAnimationName();
@@ -156,10 +158,17 @@ namespace FIFE
              */
             bool isValidIndex(int32_t index) const;
 
-            // Map of timestamp + associated frame
-            std::map<uint32_t, FrameInfo> m_framemap;
+            /** Loads the image of a frame if it is not loaded.
+             * Only checks the image if an image was freed since the frame was loaded, see Image::getFreeGeneration().
+             */
+            ImagePtr const & loadFrame(FrameInfo& frame);
+
             // vector of frames for fast indexed access
             std::vector<FrameInfo> m_frames;
+            // start time of each frame, ascending (zero based)
+            std::vector<uint32_t> m_frameStarts;
+            // duration of every frame if all frames have the same, otherwise 0
+            uint32_t m_frameQuantum;
             // Direction for this animation
             uint32_t m_direction;
             // Action frame of the Animation.
@@ -3,8 +3,11 @@
 
 #include "fontface.h"
 
+#include <memory>
 #include <stdexcept>
 
+#include "glyphatlas.h"
+
 namespace FIFE
 {
 
@@ -15,9 +18,42 @@ namespace FIFE
         }
     }
 
+    FontFace::~FontFace() = default;
+
     bool FontFace::supports(uint32_t /*codepoint*/) const
     {
         return false;
     }
 
+    SDL_Surface* FontFace::renderGlyph(
+        uint32_t /*codepoint*/, SDL_Color const & /*color*/, bool /*antialias*/) const
+    {
+        return nullptr;
+    }
+
+    int FontFace::getGlyphAdvance(uint32_t /*codepoint*/) const
+    {
+        return 0;
+    }
+
+    int FontFace::getKerning(uint32_t /*previous*/, uint32_t /*codepoint*/) const
+    {
+        return 0;
+    }
+
+    GlyphAtlas& FontFace::getGlyphAtlas() const
+    {
+        if (!m_glyphAtlas) {
+            m_glyphAtlas = std::make_unique<GlyphAtlas>(*this);
+        }
+        return *m_glyphAtlas;
+    }
+
+    void FontFace::resetGlyphAtlas()
+    {
+        if (m_glyphAtlas) {
+            m_glyphAtlas->clear();
+        }
+    }
+
 } // namespace FIFE
@@ -4,6 +4,9 @@
 #ifndef FIFE_VIDEO_FONTS_FONTFACE_H
 #define FIFE_VIDEO_FONTS_FONTFACE_H
 
+#include <SDL3/SDL_surface.h>
+
+#include <cstdint>
 #include <memory>
 
 #include "fonttypes.h"
@@ -11,12 +14,14 @@
 
 namespace FIFE
 {
+    class GlyphAtlas;
 
     class FIFE_API FontFace
     {
         public:
             explicit FontFace(AssetHandle handle);
-            virtual ~FontFace() = default;
+            virtual ~FontFace();
+
             AssetHandle getAssetHandle() const
             {
                 return m_assetHandle;
@@ -38,8 +43,39 @@ namespace FIFE
                 return 1.0F;
             }
 
+            /** Rasterizes a single glyph.
+             * @return A new surface owned by the caller, or nullptr if the face can't render glyphs.
+             */
+            virtual SDL_Surface* renderGlyph(uint32_t codepoint, SDL_Color const & color, bool antialias) const;
+
+            /** Whether renderGlyph() uses the color and antialias arguments.
+             * The glyph atlas rasterizes the glyphs of such faces in white and tints them when drawn.
+             * Faces with pre-colored glyphs return false, their glyphs are drawn as they are.
+             */
+            virtual bool isGlyphColored() const
+            {
+                return true;
+            }
+
+            /** Horizontal pen advance of a glyph in pixels.
+             */
+            virtual int getGlyphAdvance(uint32_t codepoint) const;
+
+            /** Kerning adjustment in pixels between two consecutive glyphs.
+             */
+            virtual int getKerning(uint32_t previous, uint32_t codepoint) const;
+
+            /** Glyph cache of this face, created on first use.
+             */
+            GlyphAtlas& getGlyphAtlas() const;
+
         protected:
+            /** Drops all cached glyphs, must be called whenever the rasterized size changes.
+             */
+            void resetGlyphAtlas();
+
             AssetHandle m_assetHandle;
+            mutable std::unique_ptr<GlyphAtlas> m_glyphAtlas;
     };
 
 } // namespace FIFE
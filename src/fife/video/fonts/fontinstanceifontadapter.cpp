@@ -9,15 +9,14 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <list>
 #include <memory>
 #include <span>
 #include <string>
 #include <utility>
-#include <vector>
 
-#include "imagefontface.h"
-#include "truetypefontface.h"
+#include "glyphatlas.h"
 #include "util/base/exception.h"
 #include "util/log/logger.h"
 #include "util/structures/rect.h"
@@ -35,9 +34,36 @@ namespace FIFE
             return log;
         }
 
-        bool shouldLogGuiText(std::string const & text)
+        /** Draws a glyph into a RGBA32 surface, keeping the more opaque pixel where glyphs overlap.
+         */
+        void blendGlyph(SDL_Surface* glyph, SDL_Surface* target, int32_t x, int32_t y)
         {
-            return text == "Text 2" || text == "Text 3" || text == "Credits";
+            SDL_Surface* converted = SDL_ConvertSurface(glyph, SDL_PIXELFORMAT_RGBA32);
+            if (converted == nullptr) {
+                return;
+            }
+            // both surfaces are created by SDL without RLE, so they need no locking
+            int32_t const left   = std::max(0, -x);
+            int32_t const top    = std::max(0, -y);
+            int32_t const right  = std::min(converted->w, target->w - x);
+            int32_t const bottom = std::min(converted->h, target->h - y);
+            for (int32_t row = top; row < bottom; ++row) {
+                auto const src = std::span(
+                    static_cast<uint8_t const *>(converted->pixels) + (static_cast<size_t>(row) * converted->pitch),
+                    static_cast<size_t>(converted->w) * 4U);
+                auto const dst = std::span(
+                    static_cast<uint8_t*>(target->pixels) + (static_cast<size_t>(row + y) * target->pitch),
+                    static_cast<size_t>(target->w) * 4U);
+                for (int32_t col = left; col < right; ++col) {
+                    auto const from = static_cast<size_t>(col) * 4U;
+                    auto const to   = static_cast<size_t>(col + x) * 4U;
+                    // RGBA32 is R,G,B,A in byte order on every platform
+                    if (src[from + 3] > dst[to + 3]) {
+                        std::copy_n(src.subspan(from, 4).begin(), 4, dst.subspan(to, 4).begin());
+                    }
+                }
+            }
+            SDL_DestroySurface(converted);
         }
     } // namespace
 
@@ -142,7 +168,7 @@ namespace FIFE
 
     int32_t FontInstanceIFontAdapter::getWidth(std::string const & text) const
     {
-        return m_instance->getWidth(text);
+        return layoutText(text).width;
     }
 
     int FontInstanceIFontAdapter::getHeight() const
@@ -152,194 +178,142 @@ namespace FIFE
 
     void FontInstanceIFontAdapter::invalidate()
     {
-        m_pool.invalidateCachedText();
+        m_instance->getFace()->getGlyphAtlas().invalidate();
     }
 
-    SDL_Surface* FontInstanceIFontAdapter::renderTrueType(std::string const & text) const
+    SDL_Surface* FontInstanceIFontAdapter::renderLayout(TextLayout const & layout) const
     {
-        auto ttfFace = std::dynamic_pointer_cast<TrueTypeFontFace>(m_instance->getFace());
-        if (!ttfFace) {
-            return nullptr;
-        }
-
-        if (text.empty()) {
-            SDL_Surface* surface = SDL_CreateSurface(1, getHeight(), SDL_PIXELFORMAT_RGBA8888);
-            SDL_FillSurfaceRect(surface, nullptr, 0x00000000);
-            return surface;
-        }
-
-        TTF_Font* font = ttfFace->getFont();
-
-        SDL_Surface* renderedText = nullptr;
-        if (m_antiAlias) {
-            renderedText = TTF_RenderText_Blended(font, text.c_str(), text.length(), m_color);
-        } else {
-            renderedText = TTF_RenderText_Solid(font, text.c_str(), text.length(), m_color);
-        }
-        if (renderedText == nullptr && !m_antiAlias) {
-            renderedText = TTF_RenderText_Blended(font, text.c_str(), text.length(), m_color);
-        }
-        if (renderedText == nullptr) {
-            throw SDLException(std::string("TTF_RenderText_ failed: ") + SDL_GetError());
+        int32_t const width  = std::max(layout.width, 1);
+        int32_t const height = std::max(layout.height, getHeight());
+        SDL_Surface* surface = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_RGBA32);
+        if (surface == nullptr) {
+            throw SDLException(std::string("SDL_CreateSurface failed: ") + SDL_GetError());
         }
+        SDL_FillSurfaceRect(surface, nullptr, 0x00000000);
 
-        /*FL_WARN(
-            _log(),
-            std::format(
-                "renderTrueType result: text='{}' fmt={:#x} w={} h={} pitch={}",
-                text,
-                static_cast<unsigned>(renderedText->format),
-                renderedText->w,
-                renderedText->h,
-                renderedText->pitch));*/
-
-        // NOLINTNEXTLINE(readability-simplify-boolean-expr)
-        if (SDL_ISPIXELFORMAT_ALPHA(SDL_GetPixelFormatDetails(renderedText->format)->format)) {
-            if (SDL_LockSurface(renderedText)) {
-                // int fixedCount                     = 0;
-                SDL_PixelFormatDetails const * fmt = SDL_GetPixelFormatDetails(renderedText->format);
-                int32_t const pitch_px             = renderedText->pitch / 4;
-                auto pixels                        = std::span(
-                    static_cast<uint32_t*>(renderedText->pixels),
-                    static_cast<size_t>(pitch_px) * static_cast<size_t>(renderedText->h));
-                for (int32_t y = 0; y < renderedText->h; ++y) {
-                    auto row = pixels.subspan(
-                        static_cast<size_t>(y) * static_cast<size_t>(pitch_px), static_cast<size_t>(renderedText->w));
-                    for (int32_t x = 0; x < renderedText->w; ++x) {
-                        uint8_t r = 0;
-                        uint8_t g = 0;
-                        uint8_t b = 0;
-                        uint8_t a = 0;
-                        SDL_GetRGBA(*(row.data() + static_cast<size_t>(x)), fmt, nullptr, &r, &g, &b, &a);
-                        if (a == 0 && (r != 0 || g != 0 || b != 0)) {
-                            *(row.data() + static_cast<size_t>(x)) = 0;
-                            //++fixedCount;
-                        }
-                    }
+        std::shared_ptr<FontFace> const face = m_instance->getFace();
+        for (auto const & run : layout.runs) {
+            for (size_t i = 0; i < run.glyphIndices.size(); ++i) {
+                SDL_Surface* glyph = face->renderGlyph(run.glyphIndices[i], m_color, m_antiAlias);
+                if (glyph == nullptr) {
+                    continue;
                 }
-                SDL_UnlockSurface(renderedText);
-                /*if (fixedCount > 0) {
-                    FL_WARN(
-                        _log(),
-                        std::format("  alpha-fix: zeroed {} pixels with non-zero RGB but zero alpha", fixedCount));
-                }*/
+                Point const & pos = run.positions[i];
+                blendGlyph(glyph, surface, run.startX + pos.x, run.startY + pos.y);
+                SDL_DestroySurface(glyph);
             }
         }
+        return surface;
+    }
 
-        return renderedText;
+    ImagePtr FontInstanceIFontAdapter::getAsImage(std::string const & text) const
+    {
+        return ImagePtr(RenderBackend::instance()->createImage(renderLayout(layoutText(text))).release());
     }
 
-    SDL_Surface* FontInstanceIFontAdapter::renderImage(std::string const & text) const
+    ImagePtr FontInstanceIFontAdapter::getAsImageMultiline(std::string const & text) const
     {
-        auto imgFace = std::dynamic_pointer_cast<ImageFontFace>(m_instance->getFace());
-        if (!imgFace) {
-            return nullptr;
-        }
+        return getAsImage(text);
+    }
 
-        SDL_Surface* surface = SDL_CreateSurface(getWidth(text), getHeight(), SDL_PIXELFORMAT_RGBA8888);
-        SDL_FillSurfaceRect(surface, nullptr, 0x00000000);
+    TextLayout FontInstanceIFontAdapter::layoutText(std::string const & text) const
+    {
+        constexpr uint32_t newline_codepoint = '\n';
+
+        TextLayout layout;
+        std::shared_ptr<FontFace> const face = m_instance->getFace();
+        int32_t const row_height             = m_rowSpacing + getHeight();
+        int32_t render_width                 = 0;
+        int32_t lines                        = 0;
 
-        int32_t x                      = 0;
         std::string::const_iterator it = text.begin();
         while (it != text.end()) {
-            uint32_t const codepoint = utf8::next(it, text.end());
-            SDL_Surface* glyph       = imgFace->getGlyphSurface(codepoint);
-            if (glyph == nullptr) {
-                continue;
+            GlyphRun run;
+            run.face   = face;
+            run.startY = lines * row_height;
+
+            int32_t penX      = 0;
+            uint32_t previous = 0;
+            while (it != text.end()) {
+                uint32_t const codepoint = utf8::next(it, text.end());
+                if (codepoint == newline_codepoint) {
+                    break;
+                }
+                if (previous != 0) {
+                    penX += face->getKerning(previous, codepoint);
+                }
+                run.glyphIndices.push_back(codepoint);
+                run.positions.emplace_back(penX, 0);
+                penX += face->getGlyphAdvance(codepoint) + m_glyphSpacing;
+                previous = codepoint;
+            }
+            if (!run.glyphIndices.empty()) {
+                render_width = std::max(render_width, penX - m_glyphSpacing);
+                layout.addRun(std::move(run));
             }
-            SDL_Rect const dst{.x = x, .y = 0, .w = glyph->w, .h = glyph->h};
-            SDL_BlitSurface(glyph, nullptr, surface, &dst);
-            x += glyph->w + m_glyphSpacing;
+            ++lines;
         }
 
-        return surface;
-    }
-
-    SDL_Surface* FontInstanceIFontAdapter::renderString(std::string const & text) const
-    {
-        auto face = m_instance->getFace();
-        if (std::dynamic_pointer_cast<TrueTypeFontFace>(face)) {
-            return renderTrueType(text);
-        }
-        if (std::dynamic_pointer_cast<ImageFontFace>(face)) {
-            return renderImage(text);
-        }
-        return nullptr;
+        layout.width  = render_width;
+        layout.height = row_height * lines;
+        return layout;
     }
 
-    Image* FontInstanceIFontAdapter::getAsImage(std::string const & text) const
+    Point FontInstanceIFontAdapter::getTextSize(std::string const & text) const
     {
-        Image* image = m_pool.getRenderedText(this, text);
-        if (image == nullptr) {
-            SDL_Surface* textSurface = renderString(text);
-            auto newImage            = RenderBackend::instance()->createImage(textSurface);
-            image                    = newImage.get();
-            m_pool.addRenderedText(this, text, newImage.release());
-        }
-        return image;
+        TextLayout const layout = layoutText(text);
+        return Point(layout.width, layout.height);
     }
 
-    Image* FontInstanceIFontAdapter::getAsImageMultiline(std::string const & text) const
+    uint32_t FontInstanceIFontAdapter::renderText(std::string const & text, Rect const & rect, uint8_t alpha) const
     {
-        Image* image = m_pool.getRenderedText(this, text);
-        if (image != nullptr) {
-            return image;
+        if (alpha == 0) {
+            return 0;
         }
-
-        constexpr uint32_t newline_codepoint = '\n';
-
-        std::vector<SDL_Surface*> lines;
-        lines.reserve(16);
-        int32_t render_width = 0;
-
-        using Utf8Iter = utf8::iterator<std::string::const_iterator>;
-        Utf8Iter it(text.begin(), text.begin(), text.end());
-        Utf8Iter const end(text.end(), text.begin(), text.end());
-
-        while (it != end) {
-            std::string line;
-            line.reserve(64);
-            while (it != end && *it != newline_codepoint) {
-                utf8::append(*it, std::back_inserter(line));
-                ++it;
-            }
-            if (it != end && *it == newline_codepoint) {
-                ++it;
-            }
-            SDL_Surface* text_surface = renderString(line);
-            if (text_surface == nullptr) {
-                continue;
-            }
-            render_width = std::max(render_width, text_surface->w);
-            lines.emplace_back(text_surface);
+        TextLayout const layout = layoutText(text);
+        if (layout.isEmpty() || layout.width <= 0 || layout.height <= 0) {
+            return 0;
         }
 
-        int32_t const row_height    = m_rowSpacing + getHeight();
-        int32_t const render_height = row_height * static_cast<int32_t>(lines.size());
-
-        SDL_Surface* final_surface = SDL_CreateSurface(render_width, render_height, SDL_PIXELFORMAT_RGBA8888);
-        if (final_surface == nullptr) {
-            for (auto* surf : lines) {
-                SDL_DestroySurface(surf);
+        GlyphAtlas& atlas          = m_instance->getFace()->getGlyphAtlas();
+        SDL_Surface const * target = RenderBackend::instance()->getRenderTargetSurface();
+        SDL_Color const tint{
+            .r = m_color.r,
+            .g = m_color.g,
+            .b = m_color.b,
+            .a = static_cast<uint8_t>((static_cast<uint32_t>(m_color.a) * alpha + 127U) / 255U)};
+        double const scaleX        = static_cast<double>(rect.w) / static_cast<double>(layout.width);
+        double const scaleY        = static_cast<double>(rect.h) / static_cast<double>(layout.height);
+        auto const scaled          = [](int32_t value, double scale) {
+            return static_cast<int32_t>(std::lround(static_cast<double>(value) * scale));
+        };
+
+        uint32_t quads = 0;
+        for (auto const & run : layout.runs) {
+            for (size_t i = 0; i < run.glyphIndices.size(); ++i) {
+                GlyphInfo const * glyph = atlas.getGlyph(run.glyphIndices[i], m_antiAlias);
+                if (glyph == nullptr) {
+                    continue;
+                }
+                Point const & pos = run.positions[i];
+                Rect const dst(
+                    rect.x + scaled(run.startX + pos.x, scaleX),
+                    rect.y + scaled(run.startY + pos.y, scaleY),
+                    scaled(glyph->width, scaleX),
+                    scaled(glyph->height, scaleY));
+                // same screen test the images do, so the returned count matches the added render objects
+                if (dst.right() < 0 || dst.x > target->w || dst.bottom() < 0 || dst.y > target->h) {
+                    continue;
+                }
+                if (glyph->tinted) {
+                    glyph->image->renderTinted(dst, tint);
+                } else {
+                    glyph->image->render(dst, alpha);
+                }
+                ++quads;
             }
-            throw SDLException(std::string("CreateRGBSurface failed: ") + SDL_GetError());
-        }
-
-        SDL_FillSurfaceRect(final_surface, nullptr, 0x00000000);
-
-        int32_t ypos = 0;
-        for (auto* line_surf : lines) {
-            SDL_Rect const dst_rect{.x = 0, .y = ypos, .w = line_surf->w, .h = line_surf->h};
-            SDL_SetSurfaceBlendMode(line_surf, SDL_BLENDMODE_NONE);
-            SDL_BlitSurface(line_surf, nullptr, final_surface, &dst_rect);
-            ypos += row_height;
-            SDL_DestroySurface(line_surf);
         }
-
-        auto newImage = RenderBackend::instance()->createImage(final_surface);
-        image         = newImage.get();
-        m_pool.addRenderedText(this, text, newImage.release());
-        return image;
+        return quads;
     }
 
     int32_t FontInstanceIFontAdapter::getStringIndexAt(std::string const & text, int32_t x) const
@@ -381,40 +355,8 @@ namespace FIFE
         if (text.empty()) {
             return nullptr;
         }
-        Image* image = getAsImage(std::string(text));
-        if (image == nullptr) {
-            FL_WARN(_log(), std::format("renderToSurface: getAsImage returned nullptr for '{}'", text));
-            return nullptr;
-        }
-        if (image->getSurface() == nullptr) {
-            FL_WARN(_log(), std::format("renderToSurface: image surface is nullptr for '{}'", text));
-            return nullptr;
-        }
-
-        /*FL_WARN(
-            _log(),
-            std::format(
-                "renderToSurface: text='{}' img=({}x{}) surf_fmt={:#x} surf_w={} surf_h={}",
-                text,
-                image->getWidth(),
-                image->getHeight(),
-                static_cast<unsigned>(image->getSurface()->format),
-                image->getSurface()->w,
-                image->getSurface()->h));*/
-
-        SDL_Surface* src  = image->getSurface();
-        SDL_Surface* copy = SDL_DuplicateSurface(src);
-        if (copy == nullptr) {
-            FL_WARN(_log(), std::format("renderToSurface: SDL_DuplicateSurface returned nullptr for '{}'", text));
-            return nullptr;
-        }
-
-        /*FL_WARN(
-            _log(),
-            std::format(
-                "renderToSurface: copy w={} h={} fmt={:#x}", copy->w, copy->h, static_cast<unsigned>(copy->format)));*/
-
-        return std::unique_ptr<SDL_Surface, fcn::Font::SDL_SurfaceDeleter>(copy);
+        // same layout as getWidth() measures and renderText() draws
+        return std::unique_ptr<SDL_Surface, fcn::Font::SDL_SurfaceDeleter>(renderLayout(layoutText(std::string(text))));
     }
 
     void FontInstanceIFontAdapter::drawMultiLineString(
@@ -428,52 +370,26 @@ namespace FIFE
 
         fcn::ClipRectangle const & clip = graphics->getCurrentClipArea();
 
-        Image* image = nullptr;
-        if (isDynamicColoring()) {
-            SDL_Color const color = getColor();
-            setColor(graphics->getColor().r, graphics->getColor().g, graphics->getColor().b, graphics->getColor().a);
-            image = getAsImageMultiline(text);
-            setColor(color.r, color.g, color.b, color.a);
-        } else {
-            image = getAsImageMultiline(text);
-        }
+        Point const size = getTextSize(text);
 
         FIFE::Rect rect;
         rect.x = x + clip.xOffset;
         rect.y = y + clip.yOffset + yoffset;
-        rect.w = static_cast<int32_t>(image->getWidth());
-        rect.h = static_cast<int32_t>(image->getHeight());
-
-        if (shouldLogGuiText(text)) {
-            /*FL_LOG(
-                _log(),
-                std::format(
-                    "drawMultiLineString: text='{}' input=({}, {}) yoffset={} clip=(x={}, y={}, w={}, h={}, offX={}, "
-                    "offY={}) rect=({},{} {}x{}) image={}x{} surface={} fmt={:#x}",
-                    text,
-                    x,
-                    y,
-                    yoffset,
-                    clip.x,
-                    clip.y,
-                    clip.width,
-                    clip.height,
-                    clip.xOffset,
-                    clip.yOffset,
-                    rect.x,
-                    rect.y,
-                    rect.w,
-                    rect.h,
-                    image->getWidth(),
-                    image->getHeight(),
-                    surface != nullptr ? std::format("{}x{}", surface->w, surface->h) : std::string("null"),
-                    surface != nullptr ? static_cast<unsigned>(surface->format) : 0U));*/
-        }
+        rect.w = size.x;
+        rect.h = size.y;
 
         if (!rect.intersects(Rect(clip.x, clip.y, clip.width, clip.height))) {
             return;
         }
-        image->render(rect);
+
+        if (isDynamicColoring()) {
+            SDL_Color const color = getColor();
+            setColor(graphics->getColor().r, graphics->getColor().g, graphics->getColor().b, graphics->getColor().a);
+            renderText(text, rect);
+            setColor(color.r, color.g, color.b, color.a);
+        } else {
+            renderText(text, rect);
+        }
     }
 
     std::string FontInstanceIFontAdapter::splitTextToWidth(std::string const & text, int32_t render_width)
@@ -13,7 +13,8 @@
 #include "fontinstance.h"
 #include "ifont.h"
 #include "platform.h"
-#include "textrenderpool.h"
+#include "textlayout.h"
+#include "video/image.h"
 
 namespace fcn
 {
@@ -48,9 +49,11 @@ namespace FIFE
             bool isDynamicColoring() const override;
 
             int32_t getStringIndexAt(std::string const & text, int32_t x) const override;
-            Image* getAsImage(std::string const & text) const override;
-            Image* getAsImageMultiline(std::string const & text) const override;
+            ImagePtr getAsImage(std::string const & text) const override;
+            ImagePtr getAsImageMultiline(std::string const & text) const override;
             std::string splitTextToWidth(std::string const & text, int32_t render_width) override;
+            Point getTextSize(std::string const & text) const override;
+            uint32_t renderText(std::string const & text, Rect const & rect, uint8_t alpha = 255) const override;
             void setColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255) override;
             SDL_Color getColor() const override;
             int32_t getWidth(std::string const & text) const override;
@@ -65,13 +68,17 @@ namespace FIFE
 
             void drawMultiLineString(fcn::Graphics* graphics, std::string const & text, int32_t x, int32_t y);
 
+            /** Lays out given text as one glyph run per line, glyph indices are codepoints.
+             *  Text is splitted on multiple lines based "\n" marks, like getAsImageMultiline.
+             */
+            TextLayout layoutText(std::string const & text) const;
+
         private:
-            SDL_Surface* renderString(std::string const & text) const;
-            SDL_Surface* renderTrueType(std::string const & text) const;
-            SDL_Surface* renderImage(std::string const & text) const;
+            /** Renders a layout into a new RGBA32 surface owned by the caller, at least one row high.
+             */
+            SDL_Surface* renderLayout(TextLayout const & layout) const;
 
             std::shared_ptr<FontInstance> m_instance;
-            mutable TextRenderPool m_pool;
             SDL_Color m_color{255, 255, 255, 255};
             int32_t m_rowSpacing   = 0;
             int32_t m_glyphSpacing = 0;
@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Corresponding header include
+#include "glyphatlas.h"
+
+// Standard C++ library includes
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+// 3rd party library includes
+
+// FIFE includes
+#include "fontface.h"
+#include "util/structures/rect.h"
+#include "video/atlasbook.h"
+#include "video/renderbackend.h"
+
+namespace FIFE
+{
+    namespace
+    {
+        /** Clears the color of fully transparent pixels, otherwise texture filtering
+         *  bleeds the (invisible) glyph color into neighbouring atlas cells.
+         */
+        void clearTransparentPixels(SDL_Surface* surface)
+        {
+            if (!SDL_LockSurface(surface)) {
+                return;
+            }
+            for (int32_t y = 0; y < surface->h; ++y) {
+                auto row = std::span(
+                    static_cast<uint8_t*>(surface->pixels) + (static_cast<size_t>(y) * surface->pitch),
+                    static_cast<size_t>(surface->w) * 4U);
+                for (size_t x = 0; x < row.size(); x += 4) {
+                    // RGBA32 is R,G,B,A in byte order on every platform
+                    if (row[x + 3] == 0) {
+                        row[x]     = 0;
+                        row[x + 1] = 0;
+                        row[x + 2] = 0;
+                    }
+                }
+            }
+            SDL_UnlockSurface(surface);
+        }
+    } // namespace
+
+    GlyphAtlas::GlyphAtlas(FontFace const & face, uint32_t pageSize) :
+        m_face(face), m_pageSize(pageSize), m_book(std::make_unique<AtlasBook>(pageSize, pageSize))
+    {
+    }
+
+    GlyphAtlas::~GlyphAtlas() = default;
+
+    GlyphInfo const * GlyphAtlas::getGlyph(uint32_t codepoint, bool antialias)
+    {
+        // pre-colored glyphs ignore the antialias flag as well
+        bool const colored = m_face.isGlyphColored();
+        GlyphKey const key{.codepoint = codepoint, .antialias = colored && antialias};
+        auto it = m_glyphs.find(key);
+        if (it != m_glyphs.end()) {
+            return it->second.image ? &it->second : nullptr;
+        }
+
+        // Remember failures too, so unsupported glyphs are not rasterized again every frame.
+        GlyphInfo& info = m_glyphs[key];
+        info.advance    = m_face.getGlyphAdvance(codepoint);
+        info.tinted     = colored;
+
+        SDL_Color const white{.r = 255, .g = 255, .b = 255, .a = 255};
+        SDL_Surface* glyph = m_face.renderGlyph(codepoint, white, antialias);
+        if (glyph == nullptr) {
+            return nullptr;
+        }
+        if (glyph->w <= 0 || glyph->h <= 0 || std::cmp_greater_equal(glyph->w, m_pageSize) ||
+            std::cmp_greater_equal(glyph->h, m_pageSize)) {
+            SDL_DestroySurface(glyph);
+            return nullptr;
+        }
+
+        info.width  = glyph->w;
+        info.height = glyph->h;
+        info.image  = pack(glyph);
+        return info.image ? &info : nullptr;
+    }
+
+    ImagePtr GlyphAtlas::pack(SDL_Surface* surface)
+    {
+        // the GL backend uploads sub images straight from the source pixels
+        SDL_Surface* converted = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_RGBA32);
+        SDL_DestroySurface(surface);
+        if (converted == nullptr) {
+            return {};
+        }
+        clearTransparentPixels(converted);
+
+        RenderBackend* rb = RenderBackend::instance();
+        AtlasBlock const * block =
+            m_book->getBlock(static_cast<uint32_t>(converted->w), static_cast<uint32_t>(converted->h));
+
+        // if it can't fit, we need to add new 'page'
+        if (block->page >= m_pages.size()) {
+            std::vector<uint8_t> const blank(static_cast<size_t>(m_pageSize) * m_pageSize * 4U, 0);
+            m_pages.emplace_back(rb->createImage(blank.data(), m_pageSize, m_pageSize).release());
+
+            // because we gonna update texture on-the fly (via TexSubImage)
+            // we cant really use compressed texture
+            bool const prev = rb->isImageCompressingEnabled();
+            rb->setImageCompressingEnabled(false);
+            m_pages.at(block->page)->forceLoadInternal();
+            rb->setImageCompressingEnabled(prev);
+        }
+
+        // update atlas page with the glyph, this is the only upload a glyph ever causes
+        ImagePtr const glyphImage(rb->createImage(converted).release());
+        m_pages.at(block->page)->copySubimage(block->left, block->top, glyphImage);
+
+        ImagePtr img(rb->createImage().release());
+        Rect const region(
+            static_cast<int32_t>(block->left),
+            static_cast<int32_t>(block->top),
+            static_cast<int32_t>(block->getWidth()),
+            static_cast<int32_t>(block->getHeight()));
+        img->useSharedImage(m_pages.at(block->page), region);
+        return img;
+    }
+
+    void GlyphAtlas::clear()
+    {
+        m_glyphs.clear();
+        m_pages.clear();
+        m_book = std::make_unique<AtlasBook>(m_pageSize, m_pageSize);
+    }
+
+    void GlyphAtlas::invalidate()
+    {
+        for (auto& page : m_pages) {
+            page->invalidate();
+        }
+    }
+} // namespace FIFE
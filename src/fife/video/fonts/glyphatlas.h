@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+#ifndef FIFE_VIDEO_FONTS_GLYPHATLAS_H
+#define FIFE_VIDEO_FONTS_GLYPHATLAS_H
+
+// Platform specific includes
+#include "platform.h"
+
+// Standard C++ library includes
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// 3rd party library includes
+#include <SDL3/SDL.h>
+
+// FIFE includes
+#include "video/image.h"
+
+namespace FIFE
+{
+    class AtlasBook;
+    class FontFace;
+
+    /** A single glyph packed into a GlyphAtlas page.
+     */
+    struct GlyphInfo
+    {
+            // Sub image of an atlas page, rendered like any other shared image.
+            ImagePtr image;
+            // Horizontal pen advance in pixels, without glyph spacing.
+            int32_t advance = 0;
+            int32_t width   = 0;
+            int32_t height  = 0;
+            // The glyph is white coverage and gets the text color at draw time (Image::renderTinted()).
+            bool tinted = false;
+    };
+
+    /** Glyph cache of one FontFace (and therefore one point size).
+     *
+     *  Glyphs are rasterized once on first use and packed into shared atlas pages.
+     *  Text is then drawn as one textured quad per glyph, which ends up in the
+     *  regular vertex arrays of the render backend. Changing a string therefore
+     *  neither rasterizes nor uploads anything once its glyphs are resident.
+     *
+     *  Glyphs are keyed by codepoint and antialiasing. They are rasterized in
+     *  white and the text color is multiplied in through the vertex color, so
+     *  text in any number of colors shares the same pages. Faces with
+     *  pre-colored glyphs are keyed by codepoint only and drawn untinted.
+     */
+    class FIFE_API GlyphAtlas
+    {
+        public:
+            /** Constructor
+             * @param face The face glyphs are rasterized from. Must outlive the atlas.
+             * @param pageSize Width and height of a single atlas page in pixels.
+             */
+            explicit GlyphAtlas(FontFace const & face, uint32_t pageSize = 512);
+
+            GlyphAtlas(GlyphAtlas const &)            = delete;
+            GlyphAtlas& operator=(GlyphAtlas const &) = delete;
+
+            ~GlyphAtlas();
+
+            /** Returns the glyph for codepoint, rasterizing and packing it if necessary.
+             * @return nullptr if the face cannot render the glyph or it does not fit a page.
+             */
+            GlyphInfo const * getGlyph(uint32_t codepoint, bool antialias);
+
+            /** Drops all glyphs and pages, e.g. after the face was resized.
+             */
+            void clear();
+
+            /** Invalidates the page textures, they are re-uploaded from their surfaces on next use.
+             */
+            void invalidate();
+
+            size_t getGlyphCount() const
+            {
+                return m_glyphs.size();
+            }
+
+            size_t getPageCount() const
+            {
+                return m_pages.size();
+            }
+
+        private:
+            struct GlyphKey
+            {
+                    uint32_t codepoint;
+                    bool antialias;
+                    bool operator==(GlyphKey const &) const = default;
+            };
+
+            struct GlyphKeyHash
+            {
+                    size_t operator()(GlyphKey const & key) const noexcept
+                    {
+                        uint64_t const packed =
+                            (static_cast<uint64_t>(key.codepoint) << 1) | static_cast<uint64_t>(key.antialias);
+                        return std::hash<uint64_t>{}(packed);
+                    }
+            };
+
+            /** Packs the surface into a page and returns the shared sub image.
+             *  Takes ownership of the surface.
+             */
+            ImagePtr pack(SDL_Surface* surface);
+
+            FontFace const & m_face;
+            uint32_t m_pageSize;
+            std::unique_ptr<AtlasBook> m_book;
+            std::vector<ImagePtr> m_pages;
+            std::unordered_map<GlyphKey, GlyphInfo, GlyphKeyHash> m_glyphs;
+    };
+} // namespace FIFE
+
+#endif
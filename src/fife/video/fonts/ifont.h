@@ -13,11 +13,12 @@
 #include <SDL3/SDL.h>
 
 // FIFE includes
+#include "util/structures/point.h"
+#include "util/structures/rect.h"
+#include "video/image.h"
 
 namespace FIFE
 {
-    class Image;
-
     /** Pure abstract Font interface
      */
     class FIFE_API IFont
@@ -131,18 +132,31 @@ namespace FIFE
 
             virtual int32_t getStringIndexAt(std::string const & text, int32_t x) const = 0;
 
-            /** Gets given text as Image
-             *  The rsulting image is pooled, so it's not that time critical
+            /** Renders given text into a new image, laid out like renderText.
+             *  The image is not cached, text that is drawn every frame should use renderText.
              */
-            virtual Image* getAsImage(std::string const & text) const = 0;
+            virtual ImagePtr getAsImage(std::string const & text) const = 0;
 
-            /** Gets given text as Image. Text is splitted on multiple lines based "\n" marks
-             *  The rsulting image is pooled, so it's not that time critical
+            /** Renders given text into a new image. Text is splitted on multiple lines based "\n" marks
+             *  The image is not cached, text that is drawn every frame should use renderText.
              */
-            virtual Image* getAsImageMultiline(std::string const & text) const = 0;
+            virtual ImagePtr getAsImageMultiline(std::string const & text) const = 0;
 
             virtual std::string splitTextToWidth(std::string const & text, int32_t render_width) = 0;
 
+            /** Gets the size of given text in pixels. Text is splitted on multiple lines based "\n" marks
+             *  getWidth, getStringIndexAt, splitTextToWidth and the images use the same layout, so the size
+             *  matches what renderText and getAsImageMultiline draw.
+             */
+            virtual Point getTextSize(std::string const & text) const = 0;
+
+            /** Renders given text into rect. Text is splitted on multiple lines based "\n" marks
+             *  The text is scaled to the size of rect, see getTextSize for the unscaled size.
+             *  Fonts with a glyph atlas emit one quad per glyph instead of rendering the whole string.
+             *  @return The number of render objects added to the render backend.
+             */
+            virtual uint32_t renderText(std::string const & text, Rect const & rect, uint8_t alpha = 255) const = 0;
+
             /** Set the color the text should be rendered in
              */
             virtual void setColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255) = 0;
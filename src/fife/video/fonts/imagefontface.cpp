@@ -58,9 +58,27 @@ namespace FIFE
     }
 
     int ImageFontFace::getGlyphWidth(uint32_t codepoint) const
+    {
+        assert("Glyph must have been extracted" && m_glyphs.contains(codepoint));
+        return getGlyphAdvance(codepoint);
+    }
+
+    SDL_Surface* ImageFontFace::renderGlyph(
+        uint32_t codepoint, SDL_Color const & /*color*/, bool /*antialias*/) const
+    {
+        // image fonts are pre-colored
+        SDL_Surface* glyph = getGlyphSurface(codepoint);
+        return glyph != nullptr ? SDL_DuplicateSurface(glyph) : nullptr;
+    }
+
+    bool ImageFontFace::isGlyphColored() const
+    {
+        return false;
+    }
+
+    int ImageFontFace::getGlyphAdvance(uint32_t codepoint) const
     {
         auto it = m_glyphs.find(codepoint);
-        assert("Glyph must have been extracted" && it != m_glyphs.end());
         return it != m_glyphs.end() ? it->second.width : 0;
     }
 
@@ -70,6 +88,7 @@ namespace FIFE
             return;
         }
         m_dpiScale = factor;
+        resetGlyphAtlas();
 
         for (auto& [codepoint, info] : m_glyphs) {
             if (info.surface != nullptr) {
@@ -29,6 +29,9 @@ namespace FIFE
             }
             SDL_Surface* getGlyphSurface(uint32_t codepoint) const;
             int getGlyphWidth(uint32_t codepoint) const;
+            SDL_Surface* renderGlyph(uint32_t codepoint, SDL_Color const & color, bool antialias) const override;
+            bool isGlyphColored() const override;
+            int getGlyphAdvance(uint32_t codepoint) const override;
             int getHeight() const
             {
                 return m_height;
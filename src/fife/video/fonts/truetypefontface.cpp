@@ -75,6 +75,44 @@ namespace FIFE
         return false;
     }
 
+    SDL_Surface* TrueTypeFontFace::renderGlyph(uint32_t codepoint, SDL_Color const & color, bool antialias) const
+    {
+        if (m_font == nullptr) {
+            return nullptr;
+        }
+        SDL_Surface* glyph = nullptr;
+        if (antialias) {
+            glyph = TTF_RenderGlyph_Blended(m_font, codepoint, color);
+        } else {
+            glyph = TTF_RenderGlyph_Solid(m_font, codepoint, color);
+        }
+        if (glyph == nullptr && !antialias) {
+            glyph = TTF_RenderGlyph_Blended(m_font, codepoint, color);
+        }
+        return glyph;
+    }
+
+    int TrueTypeFontFace::getGlyphAdvance(uint32_t codepoint) const
+    {
+        int advance = 0;
+        if (m_font == nullptr) {
+            return 0;
+        }
+        if (!TTF_GetGlyphMetrics(m_font, codepoint, nullptr, nullptr, nullptr, nullptr, &advance)) {
+            return 0;
+        }
+        return advance;
+    }
+
+    int TrueTypeFontFace::getKerning(uint32_t previous, uint32_t codepoint) const
+    {
+        int kerning = 0;
+        if (m_font == nullptr || !TTF_GetGlyphKerning(m_font, previous, codepoint, &kerning)) {
+            return 0;
+        }
+        return kerning;
+    }
+
     void TrueTypeFontFace::setDPIScale(float factor)
     {
         if (factor <= 0.0F) {
@@ -108,6 +146,7 @@ namespace FIFE
 
         m_coverage.clear();
         initCoverage();
+        resetGlyphAtlas();
     }
 
     void TrueTypeFontFace::initCoverage()
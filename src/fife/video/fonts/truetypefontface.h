@@ -26,6 +26,9 @@ namespace FIFE
             ~TrueTypeFontFace() override;
 
             bool supports(uint32_t codepoint) const override;
+            SDL_Surface* renderGlyph(uint32_t codepoint, SDL_Color const & color, bool antialias) const override;
+            int getGlyphAdvance(uint32_t codepoint) const override;
+            int getKerning(uint32_t previous, uint32_t codepoint) const override;
             TTF_Font* getFont() const
             {
                 return m_font;
@@ -6,6 +6,7 @@
 
 // Standard C++ library includes
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstdio>
 #include <cstring>
@@ -25,6 +26,8 @@
 
 namespace FIFE
 {
+    std::atomic<uint64_t> Image::m_freeGeneration{0};
+
     Image::Image(IResourceLoader* loader) :
         IResource(createUniqueImageName(), loader), m_surface(nullptr), m_xshift(0), m_yshift(0), m_shared(false)
     {
@@ -175,6 +178,7 @@ namespace FIFE
         m_xshift = xshift;
         m_yshift = yshift;
         m_state  = IResource::RES_NOT_LOADED;
+        increaseFreeGeneration();
     }
 
     SDL_Surface* Image::detachSurface()
@@ -8,6 +8,7 @@
 #include "platform.h"
 
 // Standard C++ library includes
+#include <atomic>
 #include <stack>
 #include <string>
 
@@ -66,6 +67,12 @@ namespace FIFE
              * @param rgb The color value of overlay if any.
              */
             virtual void render(Rect const & rect, uint8_t alpha = 255, uint8_t const * rgb = nullptr) = 0;
+
+            /** Renders itself multiplied by a color, e.g. a white glyph in the text color.
+             * @param rect The position and clipping where to draw this image to.
+             * @param color Multiplied into every pixel, the alpha included.
+             */
+            virtual void renderTinted(Rect const & rect, SDL_Color const & color) = 0;
             virtual void render(
                 Rect const & rect, ImagePtr const & overlay, uint8_t alpha = 255, uint8_t const * rgb = nullptr)
             {
@@ -169,6 +176,14 @@ namespace FIFE
             void load() override;
             void free() override;
 
+            /** Returns a counter that is increased whenever an image is freed.
+             * Holders of many images, e.g. Animation, compare it instead of checking the state of every image.
+             */
+            static uint64_t getFreeGeneration()
+            {
+                return m_freeGeneration.load(std::memory_order_relaxed);
+            }
+
             /** After this call all image data will be taken from the given image and its subregion
              */
             virtual void useSharedImage(ImagePtr const & shared, Rect const & region) = 0;
@@ -213,11 +228,21 @@ namespace FIFE
              */
             void reset(SDL_Surface* surface);
 
+            /** Has to be called by every free() implementation.
+             */
+            static void increaseFreeGeneration()
+            {
+                m_freeGeneration.fetch_add(1, std::memory_order_relaxed);
+            }
+
             // Does this image share data with another
             bool m_shared;
 
         private:
             std::string createUniqueImageName();
+
+            // only compared for changes, so relaxed ordering is enough
+            static std::atomic<uint64_t> m_freeGeneration;
     };
 } // namespace FIFE
 
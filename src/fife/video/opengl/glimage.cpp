@@ -333,6 +333,27 @@ namespace FIFE
         rb->addImageToArray(m_texId, rect, &m_tex_coords[0], alpha, rgb);
     }
 
+    void GLImage::renderTinted(Rect const & rect, SDL_Color const & color)
+    {
+        if (color.a == 0) {
+            return;
+        }
+        auto* rb                   = dynamic_cast<RenderBackendOpenGL*>(RenderBackend::instance());
+        SDL_Surface const * target = rb->getRenderTargetSurface();
+        assert(target != m_surface); // can't draw on the source surface
+
+        if (rect.right() < 0 || rect.x > static_cast<int32_t>(target->w) || rect.bottom() < 0 ||
+            rect.y > static_cast<int32_t>(target->h)) {
+            return;
+        }
+        if (m_texId == 0U) {
+            generateGLTexture();
+        } else if (m_shared) {
+            validateShared();
+        }
+        rb->addTintedImageToArray(m_texId, rect, &m_tex_coords[0], color);
+    }
+
     void GLImage::render(Rect const & rect, ImagePtr const & overlay, uint8_t alpha, uint8_t const * rgb)
     {
         // completely transparent so dont bother rendering
@@ -510,8 +531,10 @@ namespace FIFE
 
         // get texture id from opengl
         glGenTextures(1, &m_texId);
-        // set focus on that texture
-        dynamic_cast<RenderBackendOpenGL*>(RenderBackend::instance())->bindTexture(m_texId);
+        // set focus on that texture, ids are reused so it counts as changed
+        auto* renderbackend = dynamic_cast<RenderBackendOpenGL*>(RenderBackend::instance());
+        renderbackend->touchTexture(m_texId);
+        renderbackend->bindTexture(m_texId);
         // set filters for texture
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
@@ -847,7 +870,9 @@ namespace FIFE
         Image::copySubimage(xoffset, yoffset, img);
 
         if (m_texId != 0U) {
-            dynamic_cast<RenderBackendOpenGL*>(RenderBackend::instance())->bindTexture(m_texId);
+            auto* renderbackend = dynamic_cast<RenderBackendOpenGL*>(RenderBackend::instance());
+            renderbackend->touchTexture(m_texId);
+            renderbackend->bindTexture(m_texId);
             glTexSubImage2D(
                 GL_TEXTURE_2D,
                 0,
@@ -897,6 +922,7 @@ namespace FIFE
         m_xshift = xshift;
         m_yshift = yshift;
         m_state  = IResource::RES_NOT_LOADED;
+        increaseFreeGeneration();
     }
 
     GLuint GLImage::getTexId() const
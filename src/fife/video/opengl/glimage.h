@@ -48,6 +48,7 @@ namespace FIFE
             void invalidate() override;
             void setSurface(SDL_Surface* surface) override;
             void render(Rect const & rect, uint8_t alpha = 255, uint8_t const * rgb = nullptr) override;
+            void renderTinted(Rect const & rect, SDL_Color const & color) override;
             void render(Rect const & rect, ImagePtr const & overlay, uint8_t alpha = 255, uint8_t const * rgb = nullptr)
                 override;
 
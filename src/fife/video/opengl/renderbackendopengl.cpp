@@ -8,6 +8,9 @@
 #include <array>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <format>
 #include <limits>
 #include <string>
@@ -96,6 +99,12 @@ namespace FIFE
             return static_cast<uint16_t>(value);
         }
 
+        std::ptrdiff_t toDifference(std::size_t value)
+        {
+            assert(value <= static_cast<std::size_t>(std::numeric_limits<std::ptrdiff_t>::max()));
+            return static_cast<std::ptrdiff_t>(value);
+        }
+
         int32_t toDisplayWindowPos(uint8_t displayIndex, bool centered)
         {
             return centered ? static_cast<int32_t>(SDL_WINDOWPOS_CENTERED_DISPLAY(displayIndex)) :
@@ -148,6 +157,8 @@ namespace FIFE
     RenderBackendOpenGL::RenderBackendOpenGL(SDL_Color const & colorkey) :
         RenderBackend(colorkey),
         m_maskOverlay(0),
+        m_textureStamp(0),
+        m_batchFlushes(0),
         m_state{},
         m_fbo_id(0),
         m_indicebufferId(0),
@@ -958,6 +969,7 @@ namespace FIFE
         bool stencil  = false;
         bool color    = false;
         bool mt       = false;
+        bool clip     = false;
         bool render   = false;
 
         // render mode
@@ -1053,6 +1065,17 @@ namespace FIFE
         uint32_t const strideTC  = sizeof(renderDataTC);
         uint32_t const stride2TC = sizeof(renderData2TC);
 
+        // clip changes, the objects from an index on render with another scissor box
+        std::size_t const noClipIndex = m_renderObjects.size();
+        std::size_t objectIndex       = 0;
+        std::size_t nextClip          = 0;
+        std::size_t nextClipIndex     = noClipIndex;
+        if (!m_clipChanges.empty()) {
+            setScissor(m_clipChanges.front().second);
+            nextClip      = 1;
+            nextClipIndex = nextClip < m_clipChanges.size() ? m_clipChanges.at(nextClip).first : noClipIndex;
+        }
+
         // disable alpha and depth tests
         disableAlphaTest();
         disableDepthTest();
@@ -1121,11 +1144,16 @@ namespace FIFE
                 mt     = true;
                 render = true;
             }
+            if (ro.src != src || ro.dst != dst) {
+                blending = true;
+                render   = true;
+            }
+            if (objectIndex == nextClipIndex) {
+                clip   = true;
+                render = true;
+            }
+            ++objectIndex;
             if (m_state.lightmodel != 0U) {
-                if (ro.src != src || ro.dst != dst) {
-                    blending = true;
-                    render   = true;
-                }
                 if (ro.light != m_state.light_enabled) {
                     light  = true;
                     render = true;
@@ -1154,6 +1182,13 @@ namespace FIFE
                         indexBuffer + *currentIndex); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
                     *currentIndex += *currentElements;
                 }
+                // switch clip area
+                if (clip) {
+                    setScissor(m_clipChanges.at(nextClip).second);
+                    ++nextClip;
+                    nextClipIndex = nextClip < m_clipChanges.size() ? m_clipChanges.at(nextClip).first : noClipIndex;
+                    clip          = false;
+                }
                 // switch mode
                 if (type) {
                     mode = ro.mode;
@@ -1321,15 +1356,16 @@ namespace FIFE
                 // set element to current size
                 *currentElements = ro.size;
 
+                // change blending
+                if (blending) {
+                    src = ro.src;
+                    dst = ro.dst;
+                    changeBlending(ro.src, ro.dst);
+                    blending = false;
+                }
+
                 // if lighting is enabled we have to consider a few more values
                 if (m_state.lightmodel != 0U) {
-                    // change blending
-                    if (blending) {
-                        src = ro.src;
-                        dst = ro.dst;
-                        changeBlending(ro.src, ro.dst);
-                        blending = false;
-                    }
                     // change light
                     if (light) {
                         if (ro.light && !m_state.light_enabled) {
@@ -1374,14 +1410,23 @@ namespace FIFE
         }
         disableTextures(0);
         enableColorArray();
+        // without a lighting model only the objects with own blending, e.g. cached gui windows, change it
+        if (m_state.lightmodel != 0 || src != 4 || dst != 5) {
+            changeBlending(4, 5);
+        }
 
         if (m_state.lightmodel != 0) {
-            changeBlending(4, 5);
             disableLighting();
             disableStencilTest();
             disableAlphaTest();
         }
 
+        // the clip area for the objects that are batched next
+        if (!m_clipChanges.empty()) {
+            setScissor(m_clipChanges.back().second);
+            m_clipChanges.clear();
+        }
+
         m_renderPrimitiveDatas.clear();
         m_renderTextureDatas.clear();
         m_renderTextureColorDatas.clear();
@@ -1710,6 +1755,11 @@ namespace FIFE
 
     void RenderBackendOpenGL::renderVertexArrays()
     {
+        // objects with z ignore the clip changes, they use the last clip area
+        if (!m_clipChanges.empty()) {
+            setScissor(m_clipChanges.back().second);
+        }
+
         // z stuff
         if (!m_renderZ_objects.empty()) {
             renderWithZTest();
@@ -1727,7 +1777,145 @@ namespace FIFE
         // objects without z
         if (!m_renderObjects.empty()) {
             renderWithoutZ();
+            ++m_batchFlushes;
+        }
+    }
+
+    RenderBackendOpenGL::BatchMark RenderBackendOpenGL::markBatch() const
+    {
+        return BatchMark{
+            .objects       = m_renderObjects.size(),
+            .primitives    = m_renderPrimitiveDatas.size(),
+            .textures      = m_renderTextureDatas.size(),
+            .textureColors = m_renderTextureColorDatas.size(),
+            .multitextures = m_renderMultitextureDatas.size(),
+            .pIndices      = m_pIndices.size(),
+            .tIndices      = m_tIndices.size(),
+            .tcIndices     = m_tcIndices.size(),
+            .tc2Indices    = m_tc2Indices.size(),
+            .clipChanges   = m_clipChanges.size(),
+            .flushes       = m_batchFlushes,
+            .clip          = getClipArea()};
+    }
+
+    bool RenderBackendOpenGL::isBatchIntact(BatchMark const & mark) const
+    {
+        return mark.flushes == m_batchFlushes;
+    }
+
+    std::vector<GLuint> RenderBackendOpenGL::getBatchTextures(BatchMark const & mark) const
+    {
+        std::vector<GLuint> textures;
+        for (std::size_t i = mark.objects; i < m_renderObjects.size(); ++i) {
+            RenderObject const & ro = m_renderObjects[i];
+            for (GLuint const texId : {ro.texture_id, ro.overlay_id}) {
+                if (texId != 0 && std::ranges::find(textures, texId) == textures.end()) {
+                    textures.push_back(texId);
+                }
+            }
         }
+        return textures;
+    }
+
+    void RenderBackendOpenGL::discardBatch(BatchMark const & mark)
+    {
+        m_renderObjects.erase(m_renderObjects.begin() + toDifference(mark.objects), m_renderObjects.end());
+        m_renderPrimitiveDatas.resize(mark.primitives);
+        m_renderTextureDatas.resize(mark.textures);
+        m_renderTextureColorDatas.resize(mark.textureColors);
+        m_renderMultitextureDatas.resize(mark.multitextures);
+        m_pIndices.resize(mark.pIndices);
+        m_tIndices.resize(mark.tIndices);
+        m_tcIndices.resize(mark.tcIndices);
+        m_tc2Indices.resize(mark.tc2Indices);
+        m_clipChanges.resize(std::min(mark.clipChanges, m_clipChanges.size()));
+        // the clip area of the objects that are batched next
+        setClipArea(getClipArea(), false);
+    }
+
+    bool RenderBackendOpenGL::renderBatchTo(BatchMark const & mark, ImagePtr& target, Point const & origin)
+    {
+        if (!GLEW_EXT_framebuffer_object || !m_useframebuffer) {
+            // without framebuffer objects the target content would be copied from the screen
+            return false;
+        }
+
+        // move the segment aside, the rest of the batch is flushed to the screen by the attach
+        std::vector<RenderObject> const objects(
+            m_renderObjects.begin() + toDifference(mark.objects), m_renderObjects.end());
+        std::vector<renderDataP> const primitives(
+            m_renderPrimitiveDatas.begin() + toDifference(mark.primitives), m_renderPrimitiveDatas.end());
+        std::vector<renderDataT> const textures(
+            m_renderTextureDatas.begin() + toDifference(mark.textures), m_renderTextureDatas.end());
+        std::vector<renderDataTC> const textureColors(
+            m_renderTextureColorDatas.begin() + toDifference(mark.textureColors), m_renderTextureColorDatas.end());
+        std::vector<renderData2TC> const multitextures(
+            m_renderMultitextureDatas.begin() + toDifference(mark.multitextures), m_renderMultitextureDatas.end());
+        std::vector<uint32_t> const pIndices(m_pIndices.begin() + toDifference(mark.pIndices), m_pIndices.end());
+        std::vector<uint32_t> const tIndices(m_tIndices.begin() + toDifference(mark.tIndices), m_tIndices.end());
+        std::vector<uint32_t> const tcIndices(m_tcIndices.begin() + toDifference(mark.tcIndices), m_tcIndices.end());
+        std::vector<uint32_t> const tc2Indices(
+            m_tc2Indices.begin() + toDifference(mark.tc2Indices), m_tc2Indices.end());
+        std::vector<std::pair<std::size_t, Rect>> clipChanges;
+        for (std::size_t i = mark.clipChanges; i < m_clipChanges.size(); ++i) {
+            auto const & [index, area] = m_clipChanges[i];
+            clipChanges.emplace_back(index > mark.objects ? index - mark.objects : 0, area);
+        }
+        discardBatch(mark);
+
+        attachRenderTargetAt(target, false, origin);
+
+        // clear to transparent, the background color of the screen stays
+        std::array<GLfloat, 4> clearColor = {0.0F, 0.0F, 0.0F, 0.0F};
+        glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor.data());
+        setScissor(toTargetClipArea(
+            Rect(origin.x, origin.y, toInt32Dimension(target->getWidth()), toInt32Dimension(target->getHeight()))));
+        glClearColor(0.0F, 0.0F, 0.0F, 0.0F);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glClearColor(clearColor.at(0), clearColor.at(1), clearColor.at(2), clearColor.at(3));
+
+        m_renderObjects.insert(m_renderObjects.end(), objects.begin(), objects.end());
+        m_renderPrimitiveDatas.insert(m_renderPrimitiveDatas.end(), primitives.begin(), primitives.end());
+        m_renderTextureDatas.insert(m_renderTextureDatas.end(), textures.begin(), textures.end());
+        m_renderTextureColorDatas.insert(m_renderTextureColorDatas.end(), textureColors.begin(), textureColors.end());
+        m_renderMultitextureDatas.insert(m_renderMultitextureDatas.end(), multitextures.begin(), multitextures.end());
+        for (uint32_t const index : pIndices) {
+            m_pIndices.push_back(index - static_cast<uint32_t>(mark.primitives));
+        }
+        for (uint32_t const index : tIndices) {
+            m_tIndices.push_back(index - static_cast<uint32_t>(mark.textures));
+        }
+        for (uint32_t const index : tcIndices) {
+            m_tcIndices.push_back(index - static_cast<uint32_t>(mark.textureColors));
+        }
+        for (uint32_t const index : tc2Indices) {
+            m_tc2Indices.push_back(index - static_cast<uint32_t>(mark.multitextures));
+        }
+        // the clip areas of the segment are on the screen
+        addClipChange(0, toTargetClipArea(mark.clip));
+        for (auto const & [index, area] : clipChanges) {
+            addClipChange(index, toTargetClipArea(area));
+        }
+
+        // the alpha of the target adds up, the colors are premultiplied once
+        glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+        renderVertexArrays();
+        glBlendFunc(m_state.blend_src, m_state.blend_dst);
+
+        detachRenderTarget();
+        setClipArea(getClipArea(), false);
+        return true;
+    }
+
+    void RenderBackendOpenGL::touchTexture(GLuint texId)
+    {
+        m_textureStamps[texId] = ++m_textureStamp;
+    }
+
+    uint64_t RenderBackendOpenGL::getTextureStamp(GLuint texId) const
+    {
+        auto const it = m_textureStamps.find(texId);
+        return it != m_textureStamps.end() ? it->second : 0;
     }
 
     bool RenderBackendOpenGL::putPixel(int32_t x, int32_t y, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
@@ -2198,32 +2386,33 @@ namespace FIFE
         uint8_t green,
         uint8_t blue)
     {
-        float const step =
-            Mathf::twoPi() / static_cast<float>(subdivisions); // NOLINT(cppcoreguidelines-init-variables)
-        uint32_t elements    = 0;
-        uint32_t const index = m_pIndices.empty() ? 0 : m_pIndices.back() + 1;
-        uint32_t lastIndex   = index;
+        std::vector<std::array<float, 2>> const & circle = getLightCircle(subdivisions);
+        float const xradius                              = radius * xstretch;
+        float const yradius                              = radius * ystretch;
+        auto const x                                     = static_cast<float>(p.x);
+        auto const y                                     = static_cast<float>(p.y);
+        uint32_t elements                                = 0;
+        uint32_t const index                             = m_pIndices.empty() ? 0 : m_pIndices.back() + 1;
+        uint32_t lastIndex                               = index;
+        m_renderPrimitiveDatas.reserve(m_renderPrimitiveDatas.size() + (2 * circle.size()) - 1);
+        m_pIndices.reserve(m_pIndices.size() + (3 * (circle.size() - 1)));
         // center vertex
         renderDataP rd{};
-        rd.vertex.at(0) = static_cast<float>(p.x);
-        rd.vertex.at(1) = static_cast<float>(p.y);
+        rd.vertex.at(0) = x;
+        rd.vertex.at(1) = y;
         rd.color.at(0)  = red;
         rd.color.at(1)  = green;
         rd.color.at(2)  = blue;
         rd.color.at(3)  = intensity;
         m_renderPrimitiveDatas.push_back(rd);
-        for (int32_t i = 0; i <= subdivisions; ++i) {
-            float const angle = static_cast<float>(i) * step;
-            rd.vertex.at(0)   = (radius * Mathf::Cos(angle + step) * xstretch) + static_cast<float>(p.x);
-            rd.vertex.at(1)   = (radius * Mathf::Sin(angle + step) * ystretch) + static_cast<float>(p.y);
-            rd.color.at(0)    = 0;
-            rd.color.at(1)    = 0;
-            rd.color.at(2)    = 0;
-            rd.color.at(3)    = 255;
+        rd.color = {0, 0, 0, 255};
+        for (std::size_t i = 0; i + 1 < circle.size(); ++i) {
+            rd.vertex.at(0) = (xradius * circle[i + 1][0]) + x;
+            rd.vertex.at(1) = (yradius * circle[i + 1][1]) + y;
             m_renderPrimitiveDatas.push_back(rd);
 
-            rd.vertex.at(0) = (radius * Mathf::Cos(angle) * xstretch) + static_cast<float>(p.x);
-            rd.vertex.at(1) = (radius * Mathf::Sin(angle) * ystretch) + static_cast<float>(p.y);
+            rd.vertex.at(0) = (xradius * circle[i][0]) + x;
+            rd.vertex.at(1) = (yradius * circle[i][1]) + y;
             m_renderPrimitiveDatas.push_back(rd);
             // forms triangle with start index and two new ones
             std::array<uint32_t, 3> indices{index, ++lastIndex, ++lastIndex};
@@ -2234,6 +2423,25 @@ namespace FIFE
         m_renderObjects.push_back(ro);
     }
 
+    std::vector<std::array<float, 2>> const & RenderBackendOpenGL::getLightCircle(int32_t subdivisions)
+    {
+        auto it = m_lightCircles.find(subdivisions);
+        if (it != m_lightCircles.end()) {
+            return it->second;
+        }
+        // the fan closes with one triangle past the full circle, like it always did
+        int32_t const count = std::max(subdivisions + 2, 1);
+        float const step =
+            Mathf::twoPi() / static_cast<float>(subdivisions); // NOLINT(cppcoreguidelines-init-variables)
+        std::vector<std::array<float, 2>> circle;
+        circle.reserve(static_cast<std::size_t>(count));
+        for (int32_t i = 0; i < count; ++i) {
+            float const angle = static_cast<float>(i) * step;
+            circle.push_back({Mathf::Cos(angle), Mathf::Sin(angle)});
+        }
+        return m_lightCircles.emplace(subdivisions, std::move(circle)).first->second;
+    }
+
     void RenderBackendOpenGL::addImageToArray(
         uint32_t id, Rect const & rect, float const * st, uint8_t alpha, uint8_t const * rgba)
     {
@@ -2336,43 +2544,59 @@ namespace FIFE
                 m_tc2Indices.insert(m_tc2Indices.end(), indices.begin(), indices.end());
                 // texture quad with alpha
             } else {
-                renderDataTC rd{};
-                rd.vertex.at(0) = static_cast<float>(rect.x);
-                rd.vertex.at(1) = static_cast<float>(rect.y);
-                rd.texel.at(0)  = st[0];
-                rd.texel.at(1)  = st[1];
-                rd.color.at(0)  = 255;
-                rd.color.at(1)  = 255;
-                rd.color.at(2)  = 255;
-                rd.color.at(3)  = alpha;
-                m_renderTextureColorDatas.push_back(rd);
-
-                rd.vertex.at(0) = static_cast<float>(rect.x);
-                rd.vertex.at(1) = static_cast<float>(rect.y + rect.h);
-                rd.texel.at(1)  = st[3];
-                m_renderTextureColorDatas.push_back(rd);
-
-                rd.vertex.at(0) = static_cast<float>(rect.x + rect.w);
-                rd.vertex.at(1) = static_cast<float>(rect.y + rect.h);
-                rd.texel.at(0)  = st[2];
-                m_renderTextureColorDatas.push_back(rd);
-
-                rd.vertex.at(0) = static_cast<float>(rect.x + rect.w);
-                rd.vertex.at(1) = static_cast<float>(rect.y);
-                rd.texel.at(1)  = st[1];
-                m_renderTextureColorDatas.push_back(rd);
-
+                addColoredTextureQuad(rect, st, SDL_Color{.r = 255, .g = 255, .b = 255, .a = alpha});
                 ro.color = true;
-
-                uint32_t const index = m_tcIndices.empty() ? 0 : m_tcIndices.back() + 1;
-                std::array<uint32_t, 6> indices{index, index + 1, index + 2, index, index + 2, index + 3};
-                m_tcIndices.insert(m_tcIndices.end(), indices.begin(), indices.end());
             }
         }
         m_renderObjects.push_back(ro);
         // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     }
 
+    void RenderBackendOpenGL::addTintedImageToArray(
+        uint32_t id, Rect const & rect, float const * st, SDL_Color const & color)
+    {
+        RenderObject ro(GL_TRIANGLES, 6, id);
+        addColoredTextureQuad(rect, st, color);
+        ro.color = true;
+        m_renderObjects.push_back(ro);
+    }
+
+    void RenderBackendOpenGL::addColoredTextureQuad(Rect const & rect, float const * st, SDL_Color const & color)
+    {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        // the vertex color is multiplied into the texels
+        renderDataTC rd{};
+        rd.vertex.at(0) = static_cast<float>(rect.x);
+        rd.vertex.at(1) = static_cast<float>(rect.y);
+        rd.texel.at(0)  = st[0];
+        rd.texel.at(1)  = st[1];
+        rd.color.at(0)  = color.r;
+        rd.color.at(1)  = color.g;
+        rd.color.at(2)  = color.b;
+        rd.color.at(3)  = color.a;
+        m_renderTextureColorDatas.push_back(rd);
+
+        rd.vertex.at(0) = static_cast<float>(rect.x);
+        rd.vertex.at(1) = static_cast<float>(rect.y + rect.h);
+        rd.texel.at(1)  = st[3];
+        m_renderTextureColorDatas.push_back(rd);
+
+        rd.vertex.at(0) = static_cast<float>(rect.x + rect.w);
+        rd.vertex.at(1) = static_cast<float>(rect.y + rect.h);
+        rd.texel.at(0)  = st[2];
+        m_renderTextureColorDatas.push_back(rd);
+
+        rd.vertex.at(0) = static_cast<float>(rect.x + rect.w);
+        rd.vertex.at(1) = static_cast<float>(rect.y);
+        rd.texel.at(1)  = st[1];
+        m_renderTextureColorDatas.push_back(rd);
+
+        uint32_t const index = m_tcIndices.empty() ? 0 : m_tcIndices.back() + 1;
+        std::array<uint32_t, 6> indices{index, index + 1, index + 2, index, index + 2, index + 3};
+        m_tcIndices.insert(m_tcIndices.end(), indices.begin(), indices.end());
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
     void RenderBackendOpenGL::addImageToArray(
         Rect const & rect,
         uint32_t id1,
@@ -2924,6 +3148,31 @@ namespace FIFE
 
     void RenderBackendOpenGL::setClipArea(Rect const & cliparea, bool clear)
     {
+        // batched objects keep the clip area they were added with, so a clip change does not need a flush
+        if (!m_renderObjects.empty()) {
+            addClipChange(m_renderObjects.size(), cliparea);
+            if (!clear) {
+                return;
+            }
+        }
+
+        setScissor(cliparea);
+        if (clear) {
+            if (m_isbackgroundcolor) {
+                auto red   = static_cast<float>(m_backgroundcolor.r / 255.0);
+                auto green = static_cast<float>(m_backgroundcolor.g / 255.0);
+                auto blue  = static_cast<float>(m_backgroundcolor.b / 255.0);
+                glClearColor(red, green, blue, 0.0);
+                m_isbackgroundcolor = false;
+            }
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        }
+    }
+
+    void RenderBackendOpenGL::setScissor(Rect const & cliparea)
+    {
+        m_scissorArea = cliparea;
+
         GLint scissorX   = cliparea.x;
         GLint scissorY   = toGLint(getHeight()) - cliparea.y - cliparea.h;
         GLsizei scissorW = toGLsizei(static_cast<uint32_t>(cliparea.w));
@@ -2956,25 +3205,45 @@ namespace FIFE
         }
 
         glScissor(scissorX, scissorY, scissorW, scissorH);
-        if (clear) {
-            if (m_isbackgroundcolor) {
-                auto red   = static_cast<float>(m_backgroundcolor.r / 255.0);
-                auto green = static_cast<float>(m_backgroundcolor.g / 255.0);
-                auto blue  = static_cast<float>(m_backgroundcolor.b / 255.0);
-                glClearColor(red, green, blue, 0.0);
-                m_isbackgroundcolor = false;
-            }
-            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    }
+
+    Rect RenderBackendOpenGL::toTargetClipArea(Rect const & area) const
+    {
+        // the target shows the screen from its origin, not flipped, while clip areas are flipped for it
+        return Rect(
+            area.x - m_targetOrigin.x,
+            toInt32Dimension(getHeight()) - (area.y - m_targetOrigin.y) - area.h,
+            area.w,
+            area.h);
+    }
+
+    void RenderBackendOpenGL::addClipChange(std::size_t index, Rect const & cliparea)
+    {
+        if (m_clipChanges.empty()) {
+            // the objects before the first change keep the current scissor box
+            m_clipChanges.emplace_back(0, m_scissorArea);
+        }
+        if (m_clipChanges.back().first == index) {
+            // nothing was batched since the last change
+            m_clipChanges.back().second = cliparea;
+        } else {
+            m_clipChanges.emplace_back(index, cliparea);
         }
     }
 
     void RenderBackendOpenGL::attachRenderTarget(ImagePtr& img, bool discard)
+    {
+        attachRenderTargetAt(img, discard, Point(0, 0));
+    }
+
+    bool RenderBackendOpenGL::attachRenderTargetAt(ImagePtr& img, bool discard, Point const & origin)
     {
         // flush down what we batched for the old target
         renderVertexArrays();
 
         m_img_target     = img;
         m_target_discard = discard;
+        m_targetOrigin   = origin;
 
         // to render on something, we need to make sure its loaded already in gpu memory
         m_img_target->forceLoadInternal();
@@ -2985,6 +3254,7 @@ namespace FIFE
         GLuint const targetid = glimage->getTexId();
         uint32_t const w      = m_img_target->getWidth();
         uint32_t const h      = m_img_target->getHeight();
+        touchTexture(targetid);
 
         // quick & dirty hack for attaching compressed texture
         if (glimage->isCompressed()) {
@@ -3012,8 +3282,8 @@ namespace FIFE
         glViewport(0, 0, toGLsizei(w), toGLsizei(h));
         glMatrixMode(GL_PROJECTION);
         glLoadIdentity();
-        // invert top with bottom
-        glOrtho(0, w, 0, h, -100, 100);
+        // invert top with bottom, the origin shifts the visible screen area
+        glOrtho(origin.x, origin.x + w, origin.y, origin.y + h, -100, 100);
         glMatrixMode(GL_MODELVIEW);
         // because of inversion 2 lines above we need to also invert culling faces
         glCullFace(GL_FRONT);
@@ -3022,13 +3292,12 @@ namespace FIFE
             glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
         } else if (!GLEW_EXT_framebuffer_object || !m_useframebuffer) {
             // if we wanna just add something to render target, we need to first render previous contents
-            addImageToArray(
-                targetid,
-                m_img_target->getArea(),
-                dynamic_cast<GLImage*>(m_img_target.get())->getTexCoords(),
-                255,
-                nullptr);
+            Rect area = m_img_target->getArea();
+            area.x += origin.x;
+            area.y += origin.y;
+            addImageToArray(targetid, area, dynamic_cast<GLImage*>(m_img_target.get())->getTexCoords(), 255, nullptr);
         }
+        return true;
     }
 
     void RenderBackendOpenGL::detachRenderTarget()
@@ -3054,6 +3323,7 @@ namespace FIFE
         }
 
         m_target           = m_screen;
+        m_targetOrigin     = Point(0, 0);
         uint32_t viewportW = static_cast<uint32_t>(m_screen->w);
         uint32_t viewportH = static_cast<uint32_t>(m_screen->h);
         getDrawableSizeOrFallback(
@@ -3073,6 +3343,10 @@ namespace FIFE
         DoublePoint const & translation,
         ImagePtr texture) // NOLINT(performance-unnecessary-value-param)
     {
+        // the geometry is drawn right away, so the scissor box has to match the current clip area
+        if (!m_clipChanges.empty()) {
+            setScissor(m_clipChanges.back().second);
+        }
 
         glPushMatrix();
         glTranslatef(static_cast<GLfloat>(translation.x), static_cast<GLfloat>(translation.y), 0.0F);
@@ -9,8 +9,12 @@
 
 // Standard C++ library includes
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 // 3rd party library includes
@@ -67,6 +71,10 @@ namespace FIFE
                 uint8_t alpha,
                 uint8_t const * rgba);
 
+            /** Adds a texture quad whose texels are multiplied by color, see Image::renderTinted().
+             */
+            void addTintedImageToArray(uint32_t id, Rect const & rect, float const * st, SDL_Color const & color);
+
             virtual void addImageToArrayZ(
                 uint32_t id, Rect const & rect, float vertexZ, float const * st, uint8_t alpha, uint8_t const * rgba);
             virtual void addImageToArrayZ(
@@ -167,6 +175,7 @@ namespace FIFE
             void disableScissorTest() override;
 
             void attachRenderTarget(ImagePtr& img, bool discard) override;
+            bool attachRenderTargetAt(ImagePtr& img, bool discard, Point const & origin) override;
             void detachRenderTarget() override;
 
             void renderGuiGeometry(
@@ -180,9 +189,75 @@ namespace FIFE
             void bindTexture(uint32_t texUnit, GLuint texId);
             void bindTexture(GLuint texId);
 
+            /** Positions in the batched objects without depth, the objects batched after a mark form a segment.
+             */
+            struct FIFE_API BatchMark
+            {
+                    std::size_t objects;
+                    std::size_t primitives;
+                    std::size_t textures;
+                    std::size_t textureColors;
+                    std::size_t multitextures;
+                    std::size_t pIndices;
+                    std::size_t tIndices;
+                    std::size_t tcIndices;
+                    std::size_t tc2Indices;
+                    std::size_t clipChanges;
+                    // the number of flushes before the mark
+                    uint64_t flushes;
+                    // the clip area at the mark
+                    Rect clip;
+            };
+
+            /** Returns the end of the batched objects without depth.
+             */
+            BatchMark markBatch() const;
+
+            /** Returns true if the batch was not flushed since the mark, a flushed segment is already rendered.
+             */
+            bool isBatchIntact(BatchMark const & mark) const;
+
+            /** Returns the textures the segment after the mark renders from, each once.
+             */
+            std::vector<GLuint> getBatchTextures(BatchMark const & mark) const;
+
+            /** Removes the segment after the mark from the batch.
+             */
+            void discardBatch(BatchMark const & mark);
+
+            /** Renders the segment after the mark into an image instead of the screen, the image is cleared first.
+             * The colors in the image are premultiplied with their alpha.
+             * @param mark The start of the segment.
+             * @param target The image, it is placed at origin on the screen.
+             * @param origin The position of the image on the screen.
+             * @return False if framebuffer objects are not used, the segment stays in the batch then.
+             */
+            bool renderBatchTo(BatchMark const & mark, ImagePtr& target, Point const & origin);
+
+            /** Marks the content of a texture as changed.
+             */
+            void touchTexture(GLuint texId);
+
+            /** Returns the stamp of the last change of a texture, 0 if it was not changed yet.
+             * Stamps grow with every change of any texture.
+             */
+            uint64_t getTextureStamp(GLuint texId) const;
+
         protected:
             void setClipArea(Rect const & cliparea, bool clear) override;
 
+            /** Sets the scissor box, the clip area is flipped for render targets like in setClipArea().
+             */
+            void setScissor(Rect const & cliparea);
+
+            /** Returns the clip area for the attached render target that covers the screen area.
+             */
+            Rect toTargetClipArea(Rect const & area) const;
+
+            /** Changes the clip area for the batched objects from index on.
+             */
+            void addClipChange(std::size_t index, Rect const & cliparea);
+
             void enableLighting();
             void disableLighting();
             void enableStencilTest();
@@ -201,6 +276,10 @@ namespace FIFE
             void setColorPointer(GLsizei stride, GLvoid const * ptr);
             void setTexCoordPointer(uint32_t texUnit, GLsizei stride, GLvoid const * ptr);
 
+            /** Appends the vertices and indices of a texture quad with a vertex color.
+             */
+            void addColoredTextureQuad(Rect const & rect, float const * st, SDL_Color const & color);
+
             GLuint m_maskOverlay;
             void prepareForOverlays();
 
@@ -282,6 +361,10 @@ namespace FIFE
                     uint32_t max_size;
             };
             RenderZObjectTest* getRenderBufferObject(GLuint texture_id);
+
+            /** Returns the points of a light fan on the unit circle, subdivisions + 2 of them.
+             */
+            std::vector<std::array<float, 2>> const & getLightCircle(int32_t subdivisions);
             std::vector<renderDataZ> m_renderZ_datas;
             std::vector<RenderZObjectTest> m_renderZ_objects;
 
@@ -304,6 +387,22 @@ namespace FIFE
             std::vector<uint32_t> m_tcIndices;
             std::vector<uint32_t> m_tc2Indices;
 
+            // Clip areas that apply to m_renderObjects from an index on, the scissor box changes while they render
+            std::vector<std::pair<std::size_t, Rect>> m_clipChanges;
+            // The clip area of the scissor box
+            Rect m_scissorArea;
+            // Position of the render target on the screen
+            Point m_targetOrigin;
+
+            // Stamps of the last texture changes, see touchTexture()
+            std::unordered_map<GLuint, uint64_t> m_textureStamps;
+            uint64_t m_textureStamp;
+            // Number of flushes of the batched objects without depth
+            uint64_t m_batchFlushes;
+
+            // Unit circles of the light fans by subdivision count, filled when a count is first drawn
+            std::unordered_map<int32_t, std::vector<std::array<float, 2>>> m_lightCircles;
+
             // Now the vertex data that do use the depth buffer / z
             // vertex data source for textured quads that do use depth buffer but no color/alpha - described by
             // m_renderTextureObjectsZ
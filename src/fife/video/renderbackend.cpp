@@ -278,6 +278,11 @@ namespace FIFE
         return m_target;
     }
 
+    bool RenderBackend::attachRenderTargetAt(ImagePtr& /*img*/, bool /*discard*/, Point const & /*origin*/)
+    {
+        return false;
+    }
+
     Point RenderBackend::getBezierPoint(std::vector<Point> const & points, int32_t elements, float t)
     {
         if (t < 0.0) {
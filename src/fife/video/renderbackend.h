@@ -290,6 +290,7 @@ namespace FIFE
             /** Pushes clip area to clip stack
              *  Clip areas define which area is drawn on screen. Usable e.g. with viewports
              *  note that previous items in stack do not affect the latest area pushed
+             *  The OpenGL backend does not render the batched objects on a change, they keep their clip area.
              */
             void pushClipArea(Rect const & cliparea, bool clear = true);
 
@@ -610,6 +611,13 @@ namespace FIFE
              */
             virtual void attachRenderTarget(ImagePtr& img, bool discard) = 0;
 
+            /** Attaches given image as a new render surface that shows the screen area starting at origin.
+             * Allows rendering a part of the screen, e.g. a tile of a cached layer, with screen coordinates.
+             *
+             * @return False if the backend does not support an origin, nothing is attached then.
+             */
+            virtual bool attachRenderTargetAt(ImagePtr& img, bool discard, Point const & origin);
+
             /** Detaches current render surface
              */
             virtual void detachRenderTarget() = 0;
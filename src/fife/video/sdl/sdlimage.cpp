@@ -154,6 +154,13 @@ namespace FIFE
         }
     }
 
+    void SDLImage::renderTinted(Rect const & rect, SDL_Color const & color)
+    {
+        // the color and alpha mods of render() multiply the texture
+        std::array<uint8_t, 4> const rgba{color.r, color.g, color.b, color.a};
+        render(rect, 255, rgba.data());
+    }
+
     size_t SDLImage::getSize()
     {
         size_t size = 0;
@@ -239,6 +246,7 @@ namespace FIFE
         m_xshift = xshift;
         m_yshift = yshift;
         m_state  = IResource::RES_NOT_LOADED;
+        increaseFreeGeneration();
     }
 
     SDL_Texture* SDLImage::getTexture()
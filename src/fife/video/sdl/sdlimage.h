@@ -35,6 +35,7 @@ namespace FIFE
             void invalidate() override;
             void setSurface(SDL_Surface* surface) override;
             void render(Rect const & rect, uint8_t alpha = 255, uint8_t const * rgb = nullptr) override;
+            void renderTinted(Rect const & rect, SDL_Color const & color) override;
             size_t getSize() override;
             void useSharedImage(ImagePtr const & shared, Rect const & region) override;
             void forceLoadInternal() override;
@@ -13,6 +13,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -32,6 +33,7 @@
 #include "util/log/logger.h"
 #include "util/math/angles.h"
 #include "util/math/fife_math.h"
+#include "util/time/profiler.h"
 #include "util/time/sdltimecompat.h"
 #include "util/time/timemanager.h"
 #include "video/animation.h"
@@ -106,6 +108,7 @@ namespace FIFE
         m_attachedTo(nullptr),
 
         m_transform(NoneTransform),
+        m_updateTransform(NoneTransform),
 
         m_updated(false),
         m_map_observer(new MapObserver(this)),
@@ -478,6 +481,11 @@ namespace FIFE
         return pt;
     }
 
+    void Camera::toVirtualScreenCoordinates(std::span<double> x, std::span<double> y, std::span<double> z) const
+    {
+        m_vs_matrix.transform(x, y, z);
+    }
+
     ScreenPoint Camera::virtualScreenToScreen(DoublePoint3D const & p)
     {
         return doublePt2intPt(m_vscreen_2_screen * p);
@@ -706,6 +714,48 @@ found_non_transparent_pixel:;
         }
     }
 
+    void Camera::getMatchingTiles(
+        ScreenPoint const & screen_coords, Layer& layer, std::vector<ModelCoordinate>& cells, uint8_t alpha)
+    {
+        cells.clear();
+        auto cache_it = m_cache.find(&layer);
+        if (cache_it == m_cache.end() || cache_it->second == nullptr) {
+            return;
+        }
+        LayerCache* cache = cache_it->second.get();
+        bool const special_alpha = alpha != 0;
+        cache->collectTiles(Rect(screen_coords.x, screen_coords.y, 1, 1), m_tileItems);
+        auto tile_it = m_tileItems.end();
+        while (tile_it != m_tileItems.begin()) {
+            --tile_it;
+            TileRenderItem const & tile = *tile_it;
+            if (!tile.dimensions.contains(Point(screen_coords.x, screen_coords.y))) {
+                continue;
+            }
+            if (tile.image->isSharedImage()) {
+                tile.image->forceLoadInternal();
+            }
+            uint8_t r = 0;
+            uint8_t g = 0;
+            uint8_t b = 0;
+            uint8_t a = 0;
+            int32_t x = screen_coords.x - tile.dimensions.x;
+            int32_t y = screen_coords.y - tile.dimensions.y;
+            if (!Mathd::Equal(m_zoom, 1.0)) {
+                x = static_cast<int32_t>(round(static_cast<double>(x) / static_cast<double>(tile.dimensions.w) *
+                                               static_cast<double>(tile.image->getWidth())));
+                y = static_cast<int32_t>(round(static_cast<double>(y) / static_cast<double>(tile.dimensions.h) *
+                                               static_cast<double>(tile.image->getHeight())));
+            }
+            tile.image->getPixelRGBA(x, y, &r, &g, &b, &a);
+            // tile is hit with mouse if not totally transparent
+            if (a == 0 || (special_alpha && a < alpha)) {
+                continue;
+            }
+            cells.push_back(tile.cell);
+        }
+    }
+
     void Camera::getMatchingInstances(Location& loc, std::list<Instance*>& instances, bool use_exactcoordinates)
     {
         instances.clear();
@@ -767,8 +817,9 @@ found_non_transparent_pixel:;
 
     void Camera::resetUpdates()
     {
-        m_updated   = m_transform != NoneTransform;
-        m_transform = NoneTransform;
+        m_updated         = m_transform != NoneTransform;
+        m_updateTransform = m_transform;
+        m_transform       = NoneTransform;
     }
 
     namespace
@@ -1000,9 +1051,14 @@ found_non_transparent_pixel:;
     void Camera::renderStaticLayer(Layer* layer, bool update)
     {
         // ToDo: Remove this function from the camera class to something like engine pre-render.
-        // ToDo: Check if partial rendering of only updated RenderItems to existing FBO is possible/faster in our case.
         // ToDo: Add and fix support for SDL backend, for SDL it works only on the lowest layer(alpha/transparent bug).
-        LayerCache* cache   = m_cache[layer].get();
+        LayerCache* cache = m_cache[layer].get();
+        if (renderStaticTiles(layer, cache)) {
+            return;
+        }
+        // without tiles a changed instance needs the whole image
+        update = update || cache->hasDirtyAreas();
+        cache->clearDirtyAreas();
         ImagePtr cacheImage = cache->getCacheImage();
         if (cacheImage.get() == nullptr) {
             // the cacheImage name will be, camera id + _virtual_layer_image_ + layer id
@@ -1024,40 +1080,114 @@ found_non_transparent_pixel:;
             // here we use the new viewport size
             m_renderbackend->pushClipArea(rec, false);
             // render stuff to texture
-            RenderList& instancesToRender = m_layerToInstances[layer];
-            // split the RenderList into smaller parts
-            if (instancesToRender.size() > MAX_BATCH_SIZE) {
-                uint8_t const batches = static_cast<uint8_t>(
-                    ceilf(static_cast<float>(instancesToRender.size()) / static_cast<float>(MAX_BATCH_SIZE)));
-                uint32_t const residual = instancesToRender.size() % MAX_BATCH_SIZE;
-                for (uint8_t i = 0; i < batches; ++i) {
-                    uint32_t const start = i * MAX_BATCH_SIZE;
-                    uint32_t const end   = start + ((i + 1 == batches) ? residual : MAX_BATCH_SIZE);
-                    RenderList tempList(instancesToRender.begin() + start, instancesToRender.begin() + end);
-                    auto r_it = m_pipeline.begin();
-                    for (; r_it != m_pipeline.end(); ++r_it) {
-                        if ((*r_it)->isActivedLayer(layer)) {
-                            (*r_it)->render(this, layer, tempList);
-                            m_renderbackend->renderVertexArrays();
-                        }
-                    }
-                }
-            } else {
+            renderTiles(layer, m_viewport);
+            renderItems(layer, m_layerToInstances[layer]);
+            m_renderbackend->detachRenderTarget();
+            m_renderbackend->popClipArea();
+        }
+    }
+
+    bool Camera::renderStaticTiles(Layer* layer, LayerCache* cache)
+    {
+        FIFE_PROFILE_ZONE("Camera::renderStaticTiles");
+        StaticLayerTiles& tiles = cache->getStaticTiles();
+        // anything but a pan changes the look of the whole layer
+        if ((m_updateTransform & ~static_cast<Transform>(PositionTransform)) != NoneTransform) {
+            tiles.invalidate();
+        }
+        // the map origin moves with the map, so the tiles stay valid while panning
+        ScreenPoint const origin = toScreenCoordinates(ExactModelCoordinate(0.0, 0.0, 0.0));
+        Point const anchor(origin.x, origin.y);
+        Point const shift(anchor.x - tiles.getAnchor().x, anchor.y - tiles.getAnchor().y);
+        tiles.setAnchor(anchor);
+        cache->applyDirtyAreas(shift);
+
+        int32_t const size = tiles.getTileSize();
+        // the clip area is flipped for render targets, see renderStaticLayer
+        Rect const clip(0, static_cast<int32_t>(m_renderbackend->getHeight()) - size, size, size);
+        for (StaticLayerTiles::Tile* tile : tiles.update(m_viewport)) {
+            if (!tile->dirty) {
+                continue;
+            }
+            Rect const area = tiles.getScreenRect(*tile);
+            if (!tile->image) {
+                // bounded names, a tile image is only created if the tiles have less images than their capacity
+                tile->image = ImageManager::instance()->loadBlank(
+                    m_name + "_static_tile_" + layer->getName() + "_" + std::to_string(tiles.getImageCount()),
+                    static_cast<uint32_t>(size),
+                    static_cast<uint32_t>(size));
+            }
+            if (!m_renderbackend->attachRenderTargetAt(tile->image, true, Point(area.x, area.y))) {
+                tiles.invalidate();
+                return false;
+            }
+            m_renderbackend->pushClipArea(clip, false);
+            renderTiles(layer, area);
+            RenderList instancesToRender;
+            cache->collectRenderItems(area, instancesToRender);
+            renderItems(layer, instancesToRender);
+            m_renderbackend->detachRenderTarget();
+            m_renderbackend->popClipArea();
+            tile->dirty = false;
+        }
+        return true;
+    }
+
+    void Camera::renderItems(Layer* layer, RenderList& instancesToRender)
+    {
+        // split the RenderList into smaller parts
+        if (instancesToRender.size() > MAX_BATCH_SIZE) {
+            uint8_t const batches = static_cast<uint8_t>(
+                ceilf(static_cast<float>(instancesToRender.size()) / static_cast<float>(MAX_BATCH_SIZE)));
+            uint32_t const residual = instancesToRender.size() % MAX_BATCH_SIZE;
+            for (uint8_t i = 0; i < batches; ++i) {
+                uint32_t const start = i * MAX_BATCH_SIZE;
+                uint32_t const end   = start + ((i + 1 == batches) ? residual : MAX_BATCH_SIZE);
+                RenderList tempList(instancesToRender.begin() + start, instancesToRender.begin() + end);
                 auto r_it = m_pipeline.begin();
                 for (; r_it != m_pipeline.end(); ++r_it) {
                     if ((*r_it)->isActivedLayer(layer)) {
-                        (*r_it)->render(this, layer, instancesToRender);
+                        (*r_it)->render(this, layer, tempList);
                         m_renderbackend->renderVertexArrays();
                     }
                 }
             }
-            m_renderbackend->detachRenderTarget();
-            m_renderbackend->popClipArea();
+        } else {
+            auto r_it = m_pipeline.begin();
+            for (; r_it != m_pipeline.end(); ++r_it) {
+                if ((*r_it)->isActivedLayer(layer)) {
+                    (*r_it)->render(this, layer, instancesToRender);
+                    m_renderbackend->renderVertexArrays();
+                }
+            }
+        }
+    }
+
+    void Camera::renderTiles(Layer* layer, Rect const & area)
+    {
+        m_cache[layer]->collectTiles(area, m_tileItems);
+        if (m_tileItems.empty()) {
+            return;
+        }
+        FIFE_PROFILE_ZONE("Camera::renderTiles");
+        uint8_t const alpha = 255 - layer->getLayerTransparency();
+        // with a depth buffer the tiles get the lowest z of the layer, as they lie below its instances
+        if (m_renderbackend->getName() == "OpenGL" && m_renderbackend->isDepthBufferEnabled()) {
+            float const vertexZ = layer->getZOffset();
+            for (TileRenderItem const & tile : m_tileItems) {
+                tile.image->renderZ(tile.dimensions, vertexZ, alpha, static_cast<uint8_t*>(nullptr));
+            }
+        } else {
+            for (TileRenderItem const & tile : m_tileItems) {
+                tile.image->render(tile.dimensions, alpha);
+            }
         }
+        m_renderbackend->renderVertexArrays();
     }
 
-    void Camera::updateRenderLists()
+    void Camera::prepareRenderLists(std::vector<LayerCache*>& caches)
     {
+        FIFE_PROFILE_ZONE("Camera::prepareRenderLists");
         if (m_map == nullptr) {
             FL_ERR(_log(), "No map for camera found");
             return;
@@ -1073,18 +1203,26 @@ found_non_transparent_pixel:;
                 FL_ERR(_log(), std::format("Layer Cache miss! (This shouldn't happen!){}", (*layer_it)->getName()));
             }
             RenderList& instancesToRender = m_layerToInstances[*layer_it];
-            if ((*layer_it)->isStatic() && m_transform == NoneTransform) {
-                continue;
+            if (cache->prepareUpdate(m_transform, instancesToRender)) {
+                caches.push_back(cache);
             }
-            cache->update(m_transform, instancesToRender);
         }
         resetUpdates();
     }
 
     void Camera::render()
     {
-        updateRenderLists();
+        std::vector<LayerCache*> caches;
+        prepareRenderLists(caches);
+        for (auto* cache : caches) {
+            cache->finishUpdate();
+        }
+        renderFrame();
+    }
 
+    void Camera::renderFrame()
+    {
+        FIFE_PROFILE_ZONE("Camera::renderFrame");
         if (m_map == nullptr) {
             return;
         }
@@ -1105,6 +1243,11 @@ found_non_transparent_pixel:;
                 renderStaticLayer(*layer_it, m_updated);
                 continue;
             }
+            // tiles of a layer that is no longer static would be outdated once it becomes static again
+            StaticLayerTiles& tiles = m_cache[*layer_it]->getStaticTiles();
+            if (tiles.getTileCount() != 0) {
+                tiles.invalidate();
+            }
         }
 
         m_renderbackend->pushClipArea(getViewPort());
@@ -1113,10 +1256,19 @@ found_non_transparent_pixel:;
         for (; layer_it != layers.end(); ++layer_it) {
             // layer with static flag will rendered as one texture
             if ((*layer_it)->isStatic()) {
-                m_cache[*layer_it]->getCacheImage()->render(m_viewport);
+                LayerCache* cache       = m_cache[*layer_it].get();
+                StaticLayerTiles& tiles = cache->getStaticTiles();
+                if (tiles.getTileCount() != 0) {
+                    for (StaticLayerTiles::Tile const * tile : tiles.getVisibleTiles()) {
+                        tile->image->render(tiles.getScreenRect(*tile));
+                    }
+                } else if (cache->getCacheImage()) {
+                    cache->getCacheImage()->render(m_viewport);
+                }
                 m_renderbackend->renderVertexArrays();
                 continue;
             }
+            renderTiles(*layer_it, m_viewport);
             RenderList& instancesToRender = m_layerToInstances[*layer_it];
             // split the RenderList into smaller parts
             if (instancesToRender.size() > MAX_BATCH_SIZE) {
@@ -1130,6 +1282,7 @@ found_non_transparent_pixel:;
                     auto r_it = m_pipeline.begin();
                     for (; r_it != m_pipeline.end(); ++r_it) {
                         if ((*r_it)->isActivedLayer(*layer_it)) {
+                            FIFE_PROFILE_ZONE_DYNAMIC((*r_it)->getName());
                             (*r_it)->render(this, *layer_it, tempList);
                             m_renderbackend->renderVertexArrays();
                         }
@@ -1139,6 +1292,7 @@ found_non_transparent_pixel:;
                 auto r_it = m_pipeline.begin();
                 for (; r_it != m_pipeline.end(); ++r_it) {
                     if ((*r_it)->isActivedLayer(*layer_it)) {
+                        FIFE_PROFILE_ZONE_DYNAMIC((*r_it)->getName());
                         (*r_it)->render(this, *layer_it, instancesToRender);
                         m_renderbackend->renderVertexArrays();
                     }
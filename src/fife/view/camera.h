@@ -13,6 +13,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -35,6 +36,7 @@ namespace FIFE
     class RenderBackend;
     class LayerCache;
     class MapObserver;
+    struct TileRenderItem;
     using t_layer_to_instances = std::map<Layer*, RenderList>;
     /** Camera describes properties of a view port shown in the main screen
      *  Main screen can have multiple cameras active simultanously
@@ -268,6 +270,11 @@ namespace FIFE
              */
             DoublePoint3D toVirtualScreenCoordinates(ExactModelCoordinate const & elevation_coords);
 
+            /** Transforms points from map coordinates to virtual screen coordinates in place
+             *  The points are given as separate arrays of x, y and z values of the same size.
+             */
+            void toVirtualScreenCoordinates(std::span<double> x, std::span<double> y, std::span<double> z) const;
+
             /** Transforms given point from virtual screen coordinates to screen coordinates
              *  @return point in screen coordinates
              */
@@ -322,6 +329,21 @@ namespace FIFE
             void getMatchingInstances(
                 Location& loc, std::list<Instance*>& instances, bool use_exactcoordinates = false);
 
+            /** Returns the cells of the tiles that match given screen coordinate, see Layer::setTile().
+             * The topmost tile is first in returned vector.
+             * @param screen_coords screen coordinates to be used for hit search
+             * @param layer layer to use for search
+             * @param cells vector of layer coordinates that is filled based on hit test results
+             * @param alpha the alpha to use to filter the matching tiles.  Pixels
+             *        that have an alpha value higher than what is specified here are
+             *        considered a hit.
+             */
+            void getMatchingTiles(
+                ScreenPoint const & screen_coords,
+                Layer& layer,
+                std::vector<ModelCoordinate>& cells,
+                uint8_t alpha = 0);
+
             /** General update routine.
              * In this function, the camera's position gets updated when its attached
              * to another instance.
@@ -419,10 +441,23 @@ namespace FIFE
              */
             void resetOverlayAnimation();
 
-            /** Renders camera
+            /** Updates the render lists and renders camera
              */
             void render();
 
+            /** Runs the main thread part of the render list update.
+             *
+             * Appends the layer caches that still have to finish their update to caches.
+             * They can be finished in parallel, also together with the caches of other
+             * cameras, but all of them have to be finished before renderFrame() is called.
+             * @see LayerCache::finishUpdate()
+             */
+            void prepareRenderLists(std::vector<LayerCache*>& caches);
+
+            /** Renders camera with the render lists as they are
+             */
+            void renderFrame();
+
         private:
             friend class MapObserver;
             void addLayer(Layer* layer);
@@ -451,10 +486,6 @@ namespace FIFE
              */
             void updateReferenceScale();
 
-            /** Updates camera RenderLists
-             */
-            void updateRenderLists();
-
             /** Gets logical cell image dimensions for given layer
              */
             DoublePoint getLogicalCellDimensions(Layer* layer) const;
@@ -471,6 +502,20 @@ namespace FIFE
              */
             void renderStaticLayer(Layer* layer, bool update);
 
+            /** Renders the dirty tiles of a static layer, if the backend can render to a part of the screen.
+             *
+             * @return False if the backend can not render tiles.
+             */
+            bool renderStaticTiles(Layer* layer, LayerCache* cache);
+
+            /** Renders the items with the renderers active for the layer, in batches.
+             */
+            void renderItems(Layer* layer, RenderList& instancesToRender);
+
+            /** Renders the tiles of the layer that overlap a screen area, below its instances.
+             */
+            void renderTiles(Layer* layer, Rect const & area);
+
             DoubleMatrix m_matrix;
             DoubleMatrix m_inverse_matrix;
 
@@ -498,6 +543,8 @@ namespace FIFE
 
             // contains the geometry changes
             Transform m_transform;
+            // geometry changes of the last update, for the rendering of the frame
+            Transform m_updateTransform;
 
             // list of renderers managed by the view
             std::map<std::string, std::unique_ptr<RendererBase>> m_renderers;
@@ -510,6 +557,8 @@ namespace FIFE
 
             std::map<Layer*, std::unique_ptr<LayerCache>> m_cache;
             MapObserver* m_map_observer;
+            // tiles of the layer that is rendered or picked, reused between the calls
+            std::vector<TileRenderItem> m_tileItems;
 
             // is lighting enable
             bool m_lighting;
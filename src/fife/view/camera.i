@@ -55,6 +55,7 @@ namespace FIFE {
 		void getMatchingInstances(ScreenPoint screen_coords, Layer& layer, std::list<Instance*>& instances, uint8_t alpha = 0);
 		void getMatchingInstances(Rect screen_rect, Layer& layer, std::list<Instance*>& instances, uint8_t alpha = 0);
 		void getMatchingInstances(Location& loc, std::list<Instance*>& instances, bool use_exactcoordinates=false);
+		void getMatchingTiles(ScreenPoint screen_coords, Layer& layer, std::vector<ModelCoordinate>& cells, uint8_t alpha = 0);
 		RendererBase* getRenderer(const std::string& name);
 		void resetRenderers();
 
@@ -6,9 +6,11 @@
 
 // Standard C++ library includes
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cfloat>
 #include <format>
+#include <functional>
 #include <limits>
 #include <map>
 #include <memory>
@@ -25,10 +27,12 @@
 #include "model/structures/instance.h"
 #include "model/structures/layer.h"
 #include "model/structures/location.h"
+#include "model/structures/tilegrid.h"
 #include "util/base/exception.h"
 #include "util/log/logger.h"
 #include "util/math/angles.h"
 #include "util/math/fife_math.h"
+#include "util/time/profiler.h"
 #include "util/time/sdltimecompat.h"
 #include "video/animation.h"
 #include "video/image.h"
@@ -80,6 +84,11 @@ namespace FIFE
                 m_cache->removeInstance(instance);
             }
 
+            void onTileChanged([[maybe_unused]] Layer* layer, [[maybe_unused]] ModelCoordinate const & cell) override
+            {
+                m_cache->updateTile();
+            }
+
         private:
             LayerCache* m_cache;
     };
@@ -195,10 +204,15 @@ namespace FIFE
     LayerCache::LayerCache(Camera* camera) :
         m_camera(camera),
         m_layer(nullptr),
+        m_tilesChanged(false),
+        m_tileAngle(0),
         m_needSorting(
             !(RenderBackend::instance()->getName() == "OpenGL" && RenderBackend::instance()->isDepthBufferEnabled())),
         m_zMin(0.0),
         m_zMax(0.0),
+        m_pending(PendingNone),
+        m_pendingTransform(Camera::NoneTransform),
+        m_pendingRenderList(nullptr),
         m_zoom(camera->getZoom()),
         m_zoomed(!Mathd::Equal(m_zoom, 1.0)),
         m_straightZoom(Mathd::Equal(fmod(m_zoom, 1.0), 0.0))
@@ -232,6 +246,9 @@ namespace FIFE
         m_entriesToUpdate.clear();
         m_freeEntries.clear();
         m_cacheImage.reset();
+        m_staticTiles.invalidate();
+        clearDirtyAreas();
+        m_tileImages.clear();
 
         m_tree                                   = std::make_unique<CacheTree>();
         std::vector<Instance*> const & instances = m_layer->getInstances();
@@ -275,10 +292,12 @@ namespace FIFE
             entry->entryIndex    = index;
         }
 
-        entry->node        = nullptr;
-        entry->forceUpdate = true;
-        entry->visible     = true;
-        entry->updateInfo  = EntryFullUpdate;
+        entry->node           = nullptr;
+        entry->forceUpdate    = true;
+        entry->visible        = true;
+        entry->updateInfo     = EntryFullUpdate;
+        entry->positionUpdate = false;
+        entry->onScreen       = false;
 
         m_entriesToUpdate.insert(entry->entryIndex);
     }
@@ -291,6 +310,9 @@ namespace FIFE
         Entry* entry = m_entries.at(static_cast<size_t>(m_instance_map[instance])).get();
         assert(entry->instanceIndex == m_instance_map[instance]);
         RenderItem* item = m_renderItems.at(static_cast<size_t>(entry->instanceIndex)).get();
+        if (entry->visible) {
+            addDirtyArea(item, true);
+        }
         // removes entry from updates
         auto entriesToUpdateIt = m_entriesToUpdate.find(entry->entryIndex);
         if (entriesToUpdateIt != m_entriesToUpdate.end()) {
@@ -382,6 +404,18 @@ namespace FIFE
 
     void LayerCache::update(Camera::Transform transform, RenderList& renderlist)
     {
+        if (prepareUpdate(transform, renderlist)) {
+            finishUpdate();
+        }
+    }
+
+    bool LayerCache::prepareUpdate(Camera::Transform transform, RenderList& renderlist)
+    {
+        FIFE_PROFILE_ZONE("LayerCache::prepareUpdate");
+        m_pending           = PendingNone;
+        m_pendingTransform  = transform;
+        m_pendingRenderList = &renderlist;
+
         // this is only a bit faster, but works without this block too.
         if (!m_layer->areInstancesVisible()) {
             FL_DBG(_log(), "Layer instances hidden");
@@ -393,88 +427,110 @@ namespace FIFE
             }
             m_entriesToUpdate.clear();
             renderlist.clear();
-            return;
+            return false;
         }
         // if transform is none then we have only to update the instances with an update info.
         if (transform == Camera::NoneTransform) {
-            if (!m_entriesToUpdate.empty()) {
-                std::set<int32_t> entryToRemove;
-                updateEntries(entryToRemove, renderlist);
-                // std::cout << "update entries: " << int32_t(m_entriesToUpdate.size()) << " remove entries: " <<
-                // int32_t(entryToRemove.size()) <<"\n";
-                if (!entryToRemove.empty()) {
-                    auto entry_it = entryToRemove.begin();
-                    for (; entry_it != entryToRemove.end(); ++entry_it) {
-                        m_entriesToUpdate.erase(*entry_it);
-                    }
-                }
+            if (m_entriesToUpdate.empty()) {
+                return false;
             }
+            prepareEntries();
+            m_pending = PendingEntries;
+            return true;
+        }
+
+        m_zoom         = m_camera->getZoom();
+        m_zoomed       = !Mathd::Equal(m_zoom, 1.0);
+        m_straightZoom = Mathd::Equal(fmod(m_zoom, 1.0), 0.0);
+        // clear old renderlist
+        renderlist.clear();
+        // update all entries
+        if ((transform & Camera::RotationTransform) == Camera::RotationTransform ||
+            (transform & Camera::TiltTransform) == Camera::TiltTransform ||
+            (transform & Camera::ZTransform) == Camera::ZTransform) {
+            prepareFullUpdate(transform);
+            m_pending = PendingFull;
         } else {
-            m_zoom         = m_camera->getZoom();
-            m_zoomed       = !Mathd::Equal(m_zoom, 1.0);
-            m_straightZoom = Mathd::Equal(fmod(m_zoom, 1.0), 0.0);
-            // clear old renderlist
-            renderlist.clear();
-            // update all entries
-            if ((transform & Camera::RotationTransform) == Camera::RotationTransform ||
-                (transform & Camera::TiltTransform) == Camera::TiltTransform ||
-                (transform & Camera::ZTransform) == Camera::ZTransform) {
-                fullUpdate(transform);
-            } else {
-                fullCoordinateUpdate(transform);
-            }
-
-            // create viewport coordinates to collect entries
-            Rect viewport                  = m_camera->getViewPort();
-            Rect const screenViewport      = viewport;
-            DoublePoint3D const viewport_a = m_camera->screenToVirtualScreen(Point3D(viewport.x, viewport.y));
-            DoublePoint3D const viewport_b =
-                m_camera->screenToVirtualScreen(Point3D(viewport.right(), viewport.bottom()));
-            viewport.x = static_cast<int32_t>(std::min(viewport_a.x, viewport_b.x));
-            viewport.y = static_cast<int32_t>(std::min(viewport_a.y, viewport_b.y));
-            viewport.w = static_cast<int32_t>(std::max(viewport_a.x, viewport_b.x) - viewport.x);
-            viewport.h = static_cast<int32_t>(std::max(viewport_a.y, viewport_b.y) - viewport.y);
-            m_zMin     = 0.0;
-            m_zMax     = 0.0;
-
-            // FL_LOG(_log(), std::format("camera-update viewport{}", viewport));
-            std::vector<int32_t> index_list;
-            collect(viewport, index_list);
-            // fill renderlist
-            for (int const i : index_list) {
-                Entry const * entry = m_entries.at(static_cast<size_t>(i)).get();
-                RenderItem* item    = m_renderItems.at(static_cast<size_t>(entry->instanceIndex)).get();
-                if (!item->image || !entry->visible) {
-                    continue;
-                }
+            prepareCoordinateUpdate();
+            m_pending = PendingCoordinates;
+        }
 
-                if (item->dimensions.intersects(screenViewport)) {
-                    renderlist.push_back(item);
-                }
+        m_zMin = 0.0;
+        m_zMax = 0.0;
+        if (!m_needSorting) {
+            // calculates zmin and zmax of the current viewport,
+            // the camera caches the map viewport so this stays on the main thread
+            Rect const r = m_camera->getMapViewPort();
+            std::vector<ExactModelCoordinate> coords;
+            coords.emplace_back(r.x, r.y);
+            coords.emplace_back(r.x, r.y + r.h);
+            coords.emplace_back(r.x + r.w, r.y);
+            coords.emplace_back(r.x + r.w, r.y + r.h);
+            for (uint8_t i = 0; i < 4; ++i) {
+                double const z = m_camera->toVirtualScreenCoordinates(coords.at(i)).z;
+                m_zMin         = std::min(z, m_zMin);
+                m_zMax         = std::max(z, m_zMax);
             }
+        }
+        return true;
+    }
 
-            if (m_needSorting) {
-                sortRenderList(renderlist);
-            } else {
-                // calculates zmin and zmax of the current viewport
-                Rect const r = m_camera->getMapViewPort();
-                std::vector<ExactModelCoordinate> coords;
-                coords.emplace_back(r.x, r.y);
-                coords.emplace_back(r.x, r.y + r.h);
-                coords.emplace_back(r.x + r.w, r.y);
-                coords.emplace_back(r.x + r.w, r.y + r.h);
-                for (uint8_t i = 0; i < 4; ++i) {
-                    double const z = m_camera->toVirtualScreenCoordinates(coords.at(i)).z;
-                    m_zMin         = std::min(z, m_zMin);
-                    m_zMax         = std::max(z, m_zMax);
-                }
+    void LayerCache::finishUpdate()
+    {
+        FIFE_PROFILE_ZONE("LayerCache::finishUpdate");
+        switch (m_pending) {
+        case PendingEntries:
+            finishEntries();
+            break;
+        case PendingFull:
+            finishFullUpdate();
+            fillRenderList();
+            break;
+        case PendingCoordinates:
+            finishCoordinateUpdate();
+            fillRenderList();
+            break;
+        default:
+            break;
+        }
+        m_pending = PendingNone;
+    }
 
-                sortRenderList(renderlist);
+    void LayerCache::fillRenderList()
+    {
+        collectRenderItems(m_camera->getViewPort(), *m_pendingRenderList);
+    }
+
+    void LayerCache::collectRenderItems(Rect const & area, RenderList& renderlist)
+    {
+        // create virtual screen coordinates to collect entries
+        Rect vsArea                  = area;
+        DoublePoint3D const corner_a = m_camera->screenToVirtualScreen(Point3D(area.x, area.y));
+        DoublePoint3D const corner_b = m_camera->screenToVirtualScreen(Point3D(area.right(), area.bottom()));
+        vsArea.x                     = static_cast<int32_t>(std::min(corner_a.x, corner_b.x));
+        vsArea.y                     = static_cast<int32_t>(std::min(corner_a.y, corner_b.y));
+        vsArea.w                     = static_cast<int32_t>(std::max(corner_a.x, corner_b.x) - vsArea.x);
+        vsArea.h                     = static_cast<int32_t>(std::max(corner_a.y, corner_b.y) - vsArea.y);
+
+        std::vector<int32_t> index_list;
+        collect(vsArea, index_list);
+        // fill renderlist
+        for (int const i : index_list) {
+            Entry const * entry = m_entries.at(static_cast<size_t>(i)).get();
+            RenderItem* item    = m_renderItems.at(static_cast<size_t>(entry->instanceIndex)).get();
+            if (!item->image || !entry->visible) {
+                continue;
+            }
+
+            if (item->dimensions.intersects(area)) {
+                renderlist.push_back(item);
             }
         }
+
+        sortRenderList(renderlist);
     }
 
-    void LayerCache::fullUpdate(Camera::Transform transform)
+    void LayerCache::prepareFullUpdate(Camera::Transform transform)
     {
         bool const rotationChange = (transform & Camera::RotationTransform) == Camera::RotationTransform;
         for (auto& entry : m_entries) {
@@ -492,23 +548,66 @@ namespace FIFE
                         m_entriesToUpdate.insert(entry->entryIndex);
                     }
                 }
-                updatePosition(entry.get());
             }
         }
     }
 
-    void LayerCache::fullCoordinateUpdate(Camera::Transform transform)
+    void LayerCache::finishFullUpdate()
     {
-        bool const zoomChange = (transform & Camera::ZoomTransform) == Camera::ZoomTransform;
+        // the instances are on this layer, so their positions go through the same transformations
+        m_positionsX.clear();
+        m_positionsY.clear();
+        m_positionsZ.clear();
+        for (auto const & entry : m_entries) {
+            if (entry->instanceIndex != -1) {
+                RenderItem const * item         = m_renderItems.at(static_cast<size_t>(entry->instanceIndex)).get();
+                ExactModelCoordinate const & pt = item->instance->getLocationRef().getExactLayerCoordinates();
+                m_positionsX.push_back(pt.x);
+                m_positionsY.push_back(pt.y);
+                m_positionsZ.push_back(pt.z);
+            }
+        }
+        m_layer->getCellGrid()->toMapCoordinates(m_positionsX, m_positionsY, m_positionsZ);
+        m_camera->toVirtualScreenCoordinates(m_positionsX, m_positionsY, m_positionsZ);
+
+        size_t index = 0;
         for (auto& entry : m_entries) {
             if (entry->instanceIndex != -1) {
-                if (entry->forceUpdate) {
-                    updateVisual(entry.get());
+                updatePosition(
+                    entry.get(), DoublePoint3D(m_positionsX[index], m_positionsY[index], m_positionsZ[index]));
+                ++index;
+            }
+        }
+    }
+
+    void LayerCache::prepareCoordinateUpdate()
+    {
+        for (auto& entry : m_entries) {
+            entry->positionUpdate = false;
+            if (entry->instanceIndex != -1 && entry->forceUpdate) {
+                if (entry->visible) {
+                    addDirtyArea(m_renderItems.at(static_cast<size_t>(entry->instanceIndex)).get(), true);
+                }
+                updateVisual(entry.get());
+                entry->positionUpdate = true;
+                if (!entry->forceUpdate) {
+                    // no action
+                    entry->updateInfo = EntryNoneUpdate;
+                    m_entriesToUpdate.erase(entry->entryIndex);
+                }
+            }
+        }
+    }
+
+    void LayerCache::finishCoordinateUpdate()
+    {
+        bool const zoomChange = (m_pendingTransform & Camera::ZoomTransform) == Camera::ZoomTransform;
+        for (auto& entry : m_entries) {
+            if (entry->instanceIndex != -1) {
+                if (entry->positionUpdate) {
                     updatePosition(entry.get());
-                    if (!entry->forceUpdate) {
-                        // no action
-                        entry->updateInfo = EntryNoneUpdate;
-                        m_entriesToUpdate.erase(entry->entryIndex);
+                    if (entry->visible) {
+                        addDirtyArea(m_renderItems.at(static_cast<size_t>(entry->instanceIndex)).get(), false);
                     }
                     continue;
                 }
@@ -517,9 +616,10 @@ namespace FIFE
         }
     }
 
-    void LayerCache::updateEntries(std::set<int32_t>& removes, RenderList& renderlist)
+    void LayerCache::prepareEntries()
     {
-        RenderList needSorting;
+        std::set<int32_t> removes;
+        m_pendingEntries.clear();
         Rect const viewport = m_camera->getViewPort();
         auto entry_it       = m_entriesToUpdate.begin();
         for (; entry_it != m_entriesToUpdate.end(); ++entry_it) {
@@ -530,15 +630,50 @@ namespace FIFE
                 removes.insert(*entry_it);
                 continue;
             }
-            RenderItem* item     = m_renderItems.at(static_cast<size_t>(entry->instanceIndex)).get();
-            bool const onScreenA = entry->visible && item->image && item->dimensions.intersects(viewport);
-            bool positionUpdate  = (entry->updateInfo & EntryPositionUpdate) == EntryPositionUpdate;
+            RenderItem const * item = m_renderItems.at(static_cast<size_t>(entry->instanceIndex)).get();
+            if (entry->visible) {
+                addDirtyArea(item, true);
+            }
+            entry->onScreen       = entry->visible && item->image && item->dimensions.intersects(viewport);
+            entry->positionUpdate = (entry->updateInfo & EntryPositionUpdate) == EntryPositionUpdate;
             if ((entry->updateInfo & EntryVisualUpdate) == EntryVisualUpdate) {
-                positionUpdate |= updateVisual(entry);
+                entry->positionUpdate |= updateVisual(entry);
             }
-            if (positionUpdate) {
+            m_pendingEntries.push_back(*entry_it);
+
+            if (!entry->forceUpdate) {
+                entry->forceUpdate = false;
+                entry->updateInfo  = EntryNoneUpdate;
+                removes.insert(*entry_it);
+            } else {
+                entry->updateInfo = EntryVisualUpdate;
+            }
+        }
+
+        for (int32_t const index : removes) {
+            m_entriesToUpdate.erase(index);
+        }
+    }
+
+    void LayerCache::finishEntries()
+    {
+        RenderList& renderlist = *m_pendingRenderList;
+        RenderList needSorting;
+        Rect const viewport = m_camera->getViewPort();
+        for (int32_t const index : m_pendingEntries) {
+            Entry* entry = m_entries.at(static_cast<size_t>(index)).get();
+            if (entry->instanceIndex == -1) {
+                // removed by an action frame listener
+                continue;
+            }
+            RenderItem* item     = m_renderItems.at(static_cast<size_t>(entry->instanceIndex)).get();
+            bool const onScreenA = entry->onScreen;
+            if (entry->positionUpdate) {
                 updatePosition(entry);
             }
+            if (entry->visible) {
+                addDirtyArea(item, false);
+            }
             bool const onScreenB = entry->visible && item->image && item->dimensions.intersects(viewport);
             if (onScreenA != onScreenB) {
                 if (!onScreenA) {
@@ -555,19 +690,12 @@ namespace FIFE
                         renderlist.erase(it);
                     }
                 }
-            } else if (onScreenA && positionUpdate) {
+            } else if (onScreenA && entry->positionUpdate) {
                 // sort
                 needSorting.push_back(item);
             }
-
-            if (!entry->forceUpdate) {
-                entry->forceUpdate = false;
-                entry->updateInfo  = EntryNoneUpdate;
-                removes.insert(*entry_it);
-            } else {
-                entry->updateInfo = EntryVisualUpdate;
-            }
         }
+        m_pendingEntries.clear();
 
         if (!needSorting.empty()) {
             if (m_needSorting) {
@@ -670,7 +798,8 @@ namespace FIFE
                 AnimationPtr const animation = action->getVisual<ActionVisual>()->getAnimationByAngle(angle);
                 uint64_t animationTime =
                     instance->getActionRuntime64() % SDLTimeCompat::fromLegacy32Ticks(animation->getDuration());
-                image = animation->getFrameByTimestamp64(animationTime);
+                int32_t const frame = animation->getFrameIndex64(animationTime);
+                image               = animation->getFrame(frame);
                 // if the action have an animation with only one frame (idle animation) then
                 // a forced update is not necessary.
                 if (animation->getFrameCount() <= 1) {
@@ -689,12 +818,11 @@ namespace FIFE
                 int32_t const actionFrame = animation->getActionFrame();
                 if (actionFrame != -1) {
                     if (item->image != image) {
-                        int32_t const newFrame = animation->getFrameIndex64(animationTime);
                         // Also notify if the action frame was skipped.
-                        if (actionFrame == newFrame || (newFrame > actionFrame && item->currentFrame < actionFrame)) {
+                        if (actionFrame == frame || (frame > actionFrame && item->currentFrame < actionFrame)) {
                             instance->callOnActionFrame(action, actionFrame);
                         }
-                        item->currentFrame = newFrame;
+                        item->currentFrame = frame;
                     }
                 }
             }
@@ -713,11 +841,15 @@ namespace FIFE
 
     void LayerCache::updatePosition(Entry* entry)
     {
-        RenderItem* item                     = m_renderItems.at(static_cast<size_t>(entry->instanceIndex)).get();
-        Instance* instance                   = item->instance;
+        Instance* instance                   = m_renderItems.at(static_cast<size_t>(entry->instanceIndex))->instance;
         ExactModelCoordinate const mapCoords = instance->getLocationRef().getMapCoordinates();
-        DoublePoint3D screenPosition         = m_camera->toVirtualScreenCoordinates(mapCoords);
-        ImagePtr const image                 = item->image;
+        updatePosition(entry, m_camera->toVirtualScreenCoordinates(mapCoords));
+    }
+
+    void LayerCache::updatePosition(Entry* entry, DoublePoint3D screenPosition)
+    {
+        RenderItem* item       = m_renderItems.at(static_cast<size_t>(entry->instanceIndex)).get();
+        ImagePtr const & image = item->image;
 
         if (image) {
             int32_t const w  = static_cast<int32_t>(image->getWidth());
@@ -836,4 +968,172 @@ namespace FIFE
     {
         m_cacheImage = image;
     }
+
+    StaticLayerTiles& LayerCache::getStaticTiles()
+    {
+        return m_staticTiles;
+    }
+
+    bool LayerCache::hasDirtyAreas() const
+    {
+        return !m_dirtyPrevious.empty() || !m_dirtyCurrent.empty() || m_tilesChanged;
+    }
+
+    void LayerCache::applyDirtyAreas(Point const & shift)
+    {
+        if (m_tilesChanged) {
+            m_staticTiles.invalidate();
+        }
+        for (Rect area : m_dirtyPrevious) {
+            area.x += shift.x;
+            area.y += shift.y;
+            m_staticTiles.markDirty(area);
+        }
+        for (Rect const & area : m_dirtyCurrent) {
+            m_staticTiles.markDirty(area);
+        }
+        clearDirtyAreas();
+    }
+
+    void LayerCache::clearDirtyAreas()
+    {
+        m_dirtyPrevious.clear();
+        m_dirtyCurrent.clear();
+        m_tilesChanged = false;
+    }
+
+    void LayerCache::addDirtyArea(RenderItem const * item, bool previous)
+    {
+        // only static layers are rendered from a cache
+        if (!item->image || !m_layer->isStatic()) {
+            return;
+        }
+        if (previous) {
+            m_dirtyPrevious.push_back(item->dimensions);
+        } else {
+            m_dirtyCurrent.push_back(item->dimensions);
+        }
+    }
+
+    void LayerCache::updateTile()
+    {
+        // tiles are changed by scripts now and then, so the whole cache is redrawn
+        if (m_layer->isStatic()) {
+            m_tilesChanged = true;
+        }
+    }
+
+    void LayerCache::updateTileImages(TileGrid const & grid)
+    {
+        int32_t const angle = static_cast<int32_t>(m_camera->getRotation());
+        if (angle != m_tileAngle) {
+            m_tileImages.clear();
+            m_tileAngle = angle;
+        }
+        if (m_tileImages.empty()) {
+            // index 0 is NO_TILE
+            m_tileImages.emplace_back();
+            m_tileImageSize = Point();
+        }
+        // the records of a grid do not change, only new ones are looked up
+        while (m_tileImages.size() <= grid.getRecordCount()) {
+            TileGrid::Record const & record = grid.getRecord(static_cast<uint16_t>(m_tileImages.size()));
+            auto* visual                    = record.object->getVisual<ObjectVisual>();
+            ImagePtr image;
+            if (visual != nullptr) {
+                // a tile faces like an instance that was loaded without rotation
+                std::vector<int32_t> angles;
+                visual->getStaticImageAngles(angles);
+                int32_t const facing   = angles.empty() ? 0 : angles.front();
+                int32_t const image_id = visual->getStaticImageIndexByAngle(angle + facing);
+                if (image_id != -1) {
+                    image = ImageManager::instance()->get(static_cast<ResourceHandle>(image_id));
+                    m_tileImageSize.x = std::max(m_tileImageSize.x, static_cast<int32_t>(image->getWidth()));
+                    m_tileImageSize.y = std::max(m_tileImageSize.y, static_cast<int32_t>(image->getHeight()));
+                }
+            }
+            m_tileImages.push_back(image);
+        }
+    }
+
+    void LayerCache::collectTiles(Rect const & area, std::vector<TileRenderItem>& tiles)
+    {
+        tiles.clear();
+        TileGrid const * grid = m_layer->getTileGrid();
+        if (grid == nullptr || grid->getTileCount() == 0 || !m_layer->areInstancesVisible()) {
+            return;
+        }
+        FIFE_PROFILE_ZONE("LayerCache::collectTiles");
+        updateTileImages(*grid);
+
+        // the cells under the corners of the area, widened by the cells the largest image can reach into it
+        CellGrid* cg                       = m_layer->getCellGrid();
+        std::array<ScreenPoint, 4> corners = {
+            ScreenPoint(area.x, area.y),
+            ScreenPoint(area.right(), area.y),
+            ScreenPoint(area.x, area.bottom()),
+            ScreenPoint(area.right(), area.bottom())};
+        ModelCoordinate min(std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::max());
+        ModelCoordinate max(std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::min());
+        for (ScreenPoint const & corner : corners) {
+            ModelCoordinate const cell = cg->toLayerCoordinates(m_camera->toMapCoordinates(corner, false));
+            min.x                      = std::min(min.x, cell.x);
+            min.y                      = std::min(min.y, cell.y);
+            max.x                      = std::max(max.x, cell.x);
+            max.y                      = std::max(max.y, cell.y);
+        }
+        Point const cellSize = m_camera->getCellImageDimensions(m_layer);
+        int32_t const margin = 1 + std::max(
+                                       m_tileImageSize.x / std::max(cellSize.x, 1),
+                                       m_tileImageSize.y / std::max(cellSize.y, 1));
+        Rect const & tileArea = grid->getArea();
+        int32_t const minX    = std::max(min.x - margin, tileArea.x);
+        int32_t const minY    = std::max(min.y - margin, tileArea.y);
+        int32_t const maxX    = std::min(max.x + margin, tileArea.right() - 1);
+        int32_t const maxY    = std::min(max.y + margin, tileArea.bottom() - 1);
+
+        m_tileCells.clear();
+        m_tileIndices.clear();
+        m_positionsX.clear();
+        m_positionsY.clear();
+        m_positionsZ.clear();
+        for (int32_t y = minY; y <= maxY; ++y) {
+            for (int32_t x = minX; x <= maxX; ++x) {
+                ModelCoordinate const cell(x, y);
+                uint16_t const index = grid->getTileIndex(cell);
+                if (index == TileGrid::NO_TILE || !m_tileImages[index]) {
+                    continue;
+                }
+                m_tileCells.push_back(cell);
+                m_tileIndices.push_back(index);
+                m_positionsX.push_back(static_cast<double>(x));
+                m_positionsY.push_back(static_cast<double>(y));
+                m_positionsZ.push_back(0.0);
+            }
+        }
+        cg->toMapCoordinates(m_positionsX, m_positionsY, m_positionsZ);
+        m_camera->toVirtualScreenCoordinates(m_positionsX, m_positionsY, m_positionsZ);
+
+        // the same placement as the image of a static instance, see updatePosition()
+        for (size_t i = 0; i < m_tileCells.size(); ++i) {
+            Image* image    = m_tileImages[m_tileIndices[i]].get();
+            int32_t const w = static_cast<int32_t>(image->getWidth());
+            int32_t const h = static_cast<int32_t>(image->getHeight());
+            DoublePoint3D const position(
+                (m_positionsX[i] - (w / 2.0)) + image->getXShift(),
+                (m_positionsY[i] - (h / 2.0)) + image->getYShift(),
+                m_positionsZ[i]);
+            Point3D const screenPoint = m_camera->virtualScreenToScreen(position);
+            Rect dimensions(screenPoint.x, screenPoint.y, w, h);
+            if (m_zoomed) {
+                dimensions.w = static_cast<int32_t>(round(static_cast<double>(w) * m_zoom));
+                dimensions.h = static_cast<int32_t>(round(static_cast<double>(h) * m_zoom));
+            }
+            if (dimensions.intersects(area)) {
+                tiles.push_back(TileRenderItem{
+                    .cell = m_tileCells[i], .image = image, .dimensions = dimensions, .z = m_positionsZ[i]});
+            }
+        }
+        std::ranges::stable_sort(tiles, std::less<>(), &TileRenderItem::z);
+    }
 } // namespace FIFE
@@ -8,6 +8,7 @@
 #include "platform.h"
 
 // Standard C++ library includes
+#include <cstdint>
 #include <deque>
 #include <map>
 #include <memory>
@@ -25,12 +26,28 @@
 #include "util/structures/quadtree.h"
 #include "util/structures/rect.h"
 #include "view/camera.h"
+#include "view/staticlayertiles.h"
 
 namespace FIFE
 {
 
     class Camera;
     class CacheLayerChangeListener;
+    class TileGrid;
+
+    /** A tile of the TileGrid of a layer on screen, see LayerCache::collectTiles().
+     */
+    struct FIFE_API TileRenderItem
+    {
+            //! layer coordinates of the tile
+            ModelCoordinate cell;
+            //! static image of the object, owned by the cache
+            Image* image;
+            //! screen area of the image
+            Rect dimensions;
+            //! virtual screen z, used for sorting
+            double z;
+    };
 
     class FIFE_API LayerCache
     {
@@ -43,15 +60,66 @@ namespace FIFE
 
             void setLayer(Layer* layer);
 
+            /** Updates the render list, same as prepareUpdate() followed by finishUpdate().
+             */
             void update(Camera::Transform transform, RenderList& renderlist);
 
+            /** First part of the update, has to run on the main thread.
+             *
+             * Updates the visuals of the entries. This loads images, advances animations
+             * and notifies action frame listeners, which may change the model.
+             * @return True if finishUpdate() has to be called before the render list is used.
+             */
+            bool prepareUpdate(Camera::Transform transform, RenderList& renderlist);
+
+            /** Second part of the update, recomputes positions and fills and sorts the render list.
+             *
+             * Only touches this cache and the render list passed to prepareUpdate(), so the
+             * caches of all layers and cameras can be finished in parallel.
+             */
+            void finishUpdate();
+
             void addInstance(Instance* instance);
             void removeInstance(Instance* instance);
             void updateInstance(Instance* instance);
 
+            /** Collects the visible render items overlapping a screen area, sorted for rendering.
+             * Unlike the render list this includes items outside the viewport.
+             */
+            void collectRenderItems(Rect const & area, RenderList& renderlist);
+
             ImagePtr getCacheImage();
             void setCacheImage(ImagePtr const & image);
 
+            /** Returns the tiled render cache, used if the layer is static.
+             */
+            StaticLayerTiles& getStaticTiles();
+
+            /** Returns true if instances of a static layer changed their screen area or look.
+             */
+            bool hasDirtyAreas() const;
+
+            /** Marks the static tiles the changed instances overlap as dirty and forgets the changes.
+             *
+             * @param shift Movement of the map on screen since the changes were recorded.
+             */
+            void applyDirtyAreas(Point const & shift);
+
+            /** Forgets the changes without applying them.
+             */
+            void clearDirtyAreas();
+
+            /** Collects the tiles of the layer that overlap a screen area, back to front.
+             *
+             * A tile shows the static image of its object for the camera rotation. The tiles are
+             * not part of the render list, they are computed for the area when they are needed.
+             */
+            void collectTiles(Rect const & area, std::vector<TileRenderItem>& tiles);
+
+            /** Notes that a tile of a static layer changed, so its cached image is redrawn.
+             */
+            void updateTile();
+
         private:
             enum RenderEntryUpdateType : uint8_t
             {
@@ -75,23 +143,55 @@ namespace FIFE
                     bool visible;
                     // Update info
                     RenderEntryUpdate updateInfo;
+                    // Position has to be recomputed by finishUpdate
+                    bool positionUpdate;
+                    // Was on screen before prepareUpdate
+                    bool onScreen;
+            };
+
+            enum PendingUpdateType : uint8_t
+            {
+                PendingNone,
+                PendingEntries,
+                PendingFull,
+                PendingCoordinates
             };
 
             void collect(Rect const & viewport, std::vector<int32_t>& index_list);
             void reset();
-            void fullUpdate(Camera::Transform transform);
-            void fullCoordinateUpdate(Camera::Transform transform);
-            void updateEntries(std::set<int32_t>& removes, RenderList& renderlist);
+            void prepareFullUpdate(Camera::Transform transform);
+            void prepareCoordinateUpdate();
+            void prepareEntries();
+            void finishFullUpdate();
+            void finishCoordinateUpdate();
+            void finishEntries();
+            void fillRenderList();
             bool updateVisual(Entry* entry);
             void updatePosition(Entry* entry);
+            void updatePosition(Entry* entry, DoublePoint3D screenPosition);
             void updateScreenCoordinate(RenderItem* item, bool changedZoom = true);
             void sortRenderList(RenderList& renderlist);
+            void addDirtyArea(RenderItem const * item, bool previous);
+            void updateTileImages(TileGrid const & grid);
 
             Camera* m_camera;
             Layer* m_layer;
             std::unique_ptr<CacheLayerChangeListener> m_layerObserver;
             std::unique_ptr<CacheTree> m_tree;
             ImagePtr m_cacheImage;
+            StaticLayerTiles m_staticTiles;
+            // Screen areas of changed instances of a static layer, before and after the update.
+            std::vector<Rect> m_dirtyPrevious;
+            std::vector<Rect> m_dirtyCurrent;
+            // A tile of a static layer changed, the whole cached image is redrawn.
+            bool m_tilesChanged;
+            // Static image per tile index for the camera rotation m_tileAngle, and the size of the largest one.
+            std::vector<ImagePtr> m_tileImages;
+            int32_t m_tileAngle;
+            Point m_tileImageSize;
+            // Tiles in the area of collectTiles, before they are transformed in one batch
+            std::vector<ModelCoordinate> m_tileCells;
+            std::vector<uint16_t> m_tileIndices;
 
             std::map<Instance*, int32_t> m_instance_map;
             std::vector<std::unique_ptr<Entry>> m_entries;
@@ -103,6 +203,17 @@ namespace FIFE
             double m_zMin;
             double m_zMax;
 
+            // Work left for finishUpdate
+            PendingUpdateType m_pending;
+            Camera::Transform m_pendingTransform;
+            RenderList* m_pendingRenderList;
+            // Entries visited by prepareEntries, in update order
+            std::vector<int32_t> m_pendingEntries;
+            // Positions of all entries during a full update or of the tiles of collectTiles, transformed in one batch
+            std::vector<double> m_positionsX;
+            std::vector<double> m_positionsY;
+            std::vector<double> m_positionsZ;
+
             double m_zoom;
             bool m_zoomed;
             bool m_straightZoom;
@@ -10,7 +10,9 @@
 #include <limits>
 #include <memory>
 #include <set>
+#include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 // 3rd party library includes
@@ -156,23 +158,23 @@ namespace FIFE
 
                     std::stringstream stream;
                     stream << cost;
-                    Image* img = m_font->getAsImage(stream.str());
+                    std::string const text = stream.str();
+                    Point const size       = m_font->getTextSize(text);
 
                     Rect r;
                     if (zoomed) {
                         double const zoom = cam->getZoom();
-                        r.x               = static_cast<int32_t>(drawpt.x - ((img->getWidth() / 2.0) * zoom));
-                        r.y               = static_cast<int32_t>(drawpt.y - ((img->getHeight() / 2.0) * zoom));
-                        r.w               = static_cast<int32_t>(img->getWidth() * zoom);
-                        r.h               = static_cast<int32_t>(img->getHeight() * zoom);
-                        img->render(r);
+                        r.x               = static_cast<int32_t>(drawpt.x - ((size.x / 2.0) * zoom));
+                        r.y               = static_cast<int32_t>(drawpt.y - ((size.y / 2.0) * zoom));
+                        r.w               = static_cast<int32_t>(size.x * zoom);
+                        r.h               = static_cast<int32_t>(size.y * zoom);
                     } else {
-                        r.x = static_cast<int32_t>(drawpt.x - (img->getWidth() / 2.0));
-                        r.y = static_cast<int32_t>(drawpt.y - (img->getHeight() / 2.0));
-                        r.w = static_cast<int32_t>(img->getWidth());
-                        r.h = static_cast<int32_t>(img->getHeight());
-                        img->render(r);
+                        r.x = static_cast<int32_t>(drawpt.x - (size.x / 2.0));
+                        r.y = static_cast<int32_t>(drawpt.y - (size.y / 2.0));
+                        r.w = size.x;
+                        r.h = size.y;
                     }
+                    m_font->renderText(text, r);
                 }
             }
         }
@@ -182,15 +184,14 @@ namespace FIFE
             for (; it != m_visualPaths.end(); ++it) {
                 Route* route = (*it)->getRoute();
                 if (route != nullptr) {
-                    Path path = route->getPath();
+                    std::span<ModelCoordinate const> const path = route->getPathCoordinates();
                     if (!path.empty()) {
-                        auto pit = path.begin();
-                        for (; pit != path.end(); ++pit) {
-                            if ((*pit).getLayer() != layer) {
+                        for (uint32_t i = 0; std::cmp_less(i, path.size()); ++i) {
+                            if (route->getPathLayer(i) != layer) {
                                 continue;
                             }
                             std::vector<ExactModelCoordinate> vertices;
-                            cg->getVertices(vertices, (*pit).getLayerCoordinates());
+                            cg->getVertices(vertices, path[i]);
                             auto vertIt               = vertices.begin();
                             ScreenPoint const firstpt = cam->toScreenCoordinates(cg->toMapCoordinates(*vertIt));
                             Point pt1(firstpt.x, firstpt.y);
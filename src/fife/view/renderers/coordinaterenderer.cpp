@@ -6,9 +6,9 @@
 
 // Standard C++ library includes
 #include <algorithm>
-#include <cassert>
-#include <limits>
+#include <format>
 #include <memory>
+#include <string>
 
 // 3rd party library includes
 
@@ -28,15 +28,6 @@
 
 namespace FIFE
 {
-    namespace
-    {
-        [[nodiscard]] int32_t toScreenSize(uint32_t const value)
-        {
-            assert(value <= static_cast<uint32_t>(std::numeric_limits<int32_t>::max()));
-            return static_cast<int32_t>(value);
-        }
-    } // namespace
-
     /** Logger to use for this source file.
      *  @relates Logger
      */
@@ -134,47 +125,19 @@ namespace FIFE
                     continue;
                 }
 
-                // we split the stringstream in three images, because so the TextRenderPool can reuse the most images.
-                // more to render but less images to generate
-                std::stringstream sts;
-                sts << mc.x;
-                Image* imgx = m_font->getAsImage(sts.str());
-                sts.str(",");
-                Image* imgc = m_font->getAsImage(sts.str());
-                sts.str("");
-                sts << mc.y;
-                Image* imgy              = m_font->getAsImage(sts.str());
-                int32_t const widthX     = toScreenSize(imgx->getWidth());
-                int32_t const widthComma = toScreenSize(imgc->getWidth());
-                int32_t const widthY     = toScreenSize(imgy->getWidth());
-                int32_t const heightX    = toScreenSize(imgx->getHeight());
-
+                std::string const text = std::format("{},{}", mc.x, mc.y);
+                Point const size       = m_font->getTextSize(text);
                 if (zoomed) {
                     double const zoom = cam->getZoom();
-                    r.x = static_cast<int32_t>(round(drawpt.x - (((widthX + widthComma + widthY) / 2.0) * zoom)));
-                    r.y = static_cast<int32_t>(round(drawpt.y - ((heightX / 2.0) * zoom)));
-                    r.w = static_cast<int32_t>(round(widthX * zoom));
-                    r.h = static_cast<int32_t>(round(heightX * zoom));
-                    imgx->render(r);
-                    r.x += r.w;
-                    r.w = static_cast<int32_t>(round(widthComma * zoom));
-                    imgc->render(r);
-                    r.x += r.w;
-                    r.w = static_cast<int32_t>(round(widthY * zoom));
-                    imgy->render(r);
+                    r.w               = static_cast<int32_t>(round(size.x * zoom));
+                    r.h               = static_cast<int32_t>(round(size.y * zoom));
                 } else {
-                    r.x = drawpt.x - ((widthX + widthComma + widthY) / 2);
-                    r.y = drawpt.y - (heightX / 2);
-                    r.w = widthX;
-                    r.h = heightX;
-                    imgx->render(r);
-                    r.x += r.w;
-                    r.w = widthComma;
-                    imgc->render(r);
-                    r.x += r.w;
-                    r.w = widthY;
-                    imgy->render(r);
+                    r.w = size.x;
+                    r.h = size.y;
                 }
+                r.x = drawpt.x - (r.w / 2);
+                r.y = drawpt.y - (r.h / 2);
+                m_font->renderText(text, r);
             }
         }
         if (m_font_color) {
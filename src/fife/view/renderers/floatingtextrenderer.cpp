@@ -29,12 +29,6 @@ namespace FIFE
 {
     namespace
     {
-        [[nodiscard]] int32_t toScreenSize(uint32_t const value)
-        {
-            assert(value <= static_cast<uint32_t>(std::numeric_limits<int32_t>::max()));
-            return static_cast<int32_t>(value);
-        }
-
         [[nodiscard]] uint16_t toRectExtent(int32_t const value)
         {
             assert(value >= 0);
@@ -104,15 +98,10 @@ namespace FIFE
             Instance const * instance   = (*instance_it)->instance;
             std::string const * saytext = instance->getSayText();
             if (saytext != nullptr) {
-                Rect const & ir = (*instance_it)->dimensions;
-                Image* img      = nullptr;
-                if (saytext->find('\n') != std::string::npos) {
-                    img = m_font->getAsImageMultiline(*saytext);
-                } else {
-                    img = m_font->getAsImage(*saytext);
-                }
-                int32_t const imageWidth  = toScreenSize(img->getWidth());
-                int32_t const imageHeight = toScreenSize(img->getHeight());
+                Rect const & ir           = (*instance_it)->dimensions;
+                Point const textSize      = m_font->getTextSize(*saytext);
+                int32_t const imageWidth  = textSize.x;
+                int32_t const imageHeight = textSize.y;
                 Rect r;
                 r.x = (ir.x + (ir.w / 2)) - (imageWidth / 2); // the center of the text rect is always aligned to the
                                                               // instance's rect center.
@@ -153,9 +142,9 @@ namespace FIFE
                             m_backbordercolor.a);
                     }
                 }
-                img->render(r);
+                uint32_t const glyphs = m_font->renderText(*saytext, r);
                 if (lm > 0) {
-                    uint16_t elements = 1;
+                    auto elements = static_cast<uint16_t>(glyphs);
                     if (m_background) {
                         ++elements;
                     }
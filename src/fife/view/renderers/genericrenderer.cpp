@@ -293,26 +293,24 @@ namespace FIFE
         static_cast<void>(instances);
         Point const p = m_anchor.getCalculatedPoint(cam, layer, m_zoomed);
         if (m_anchor.getLayer() == layer) {
-            Image* img = m_font->getAsImageMultiline(m_text);
+            Point const size = m_font->getTextSize(m_text);
             Rect r;
             Rect const viewport = cam->getViewPort();
-            int32_t width       = 0;
-            int32_t height      = 0;
+            int32_t width       = size.x;
+            int32_t height      = size.y;
             if (m_zoomed) {
-                width  = static_cast<int32_t>(round(img->getWidth() * cam->getZoom()));
-                height = static_cast<int32_t>(round(img->getHeight() * cam->getZoom()));
-            } else {
-                width  = toScreenSize(img->getWidth());
-                height = toScreenSize(img->getHeight());
+                width  = static_cast<int32_t>(round(size.x * cam->getZoom()));
+                height = static_cast<int32_t>(round(size.y * cam->getZoom()));
             }
             r.x = p.x - (width / 2);
             r.y = p.y - (height / 2);
             r.w = width;
             r.h = height;
             if (r.intersects(viewport)) {
-                img->render(r);
-                if (renderbackend->getLightingModel() > 0) {
-                    renderbackend->changeRenderInfos(RENDER_DATA_WITHOUT_Z, 1, 4, 5, false, false, 0, KEEP, ALWAYS);
+                uint32_t const glyphs = m_font->renderText(m_text, r);
+                if (glyphs > 0 && renderbackend->getLightingModel() > 0) {
+                    renderbackend->changeRenderInfos(
+                        RENDER_DATA_WITHOUT_Z, static_cast<uint16_t>(glyphs), 4, 5, false, false, 0, KEEP, ALWAYS);
                 }
             }
         }
@@ -6,6 +6,10 @@
 
 // Standard C++ library includes
 #include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
 #include <list>
 #include <map>
 #include <memory>
@@ -44,15 +48,73 @@ namespace FIFE
             static Logger log(LM_VIEWVIEW);
             return log;
         }
+
+        // the index buckets are 16x16 layer cells
+        constexpr int32_t BUCKET_SHIFT = 4;
+
+        uint64_t toBucketKey(int32_t x, int32_t y)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+        }
+
+        /** Returns the layer cells the camera shows, the corners of the map viewport are converted
+         * one by one as the layer can be rotated against the map.
+         */
+        Rect getVisibleCells(Camera* cam, Layer* layer)
+        {
+            Rect const & view = cam->getMapViewPort();
+            Location loc(layer);
+            int32_t minX = std::numeric_limits<int32_t>::max();
+            int32_t minY = std::numeric_limits<int32_t>::max();
+            int32_t maxX = std::numeric_limits<int32_t>::min();
+            int32_t maxY = std::numeric_limits<int32_t>::min();
+            for (int32_t const x : {view.x, view.x + view.w}) {
+                for (int32_t const y : {view.y, view.y + view.h}) {
+                    loc.setMapCoordinates(ExactModelCoordinate(x, y));
+                    ModelCoordinate const mc = loc.getLayerCoordinates();
+                    minX                     = std::min(minX, mc.x);
+                    minY                     = std::min(minY, mc.y);
+                    maxX                     = std::max(maxX, mc.x);
+                    maxY                     = std::max(maxY, mc.y);
+                }
+            }
+            return Rect(minX, minY, maxX - minX, maxY - minY);
+        }
+
+        bool isLocationAnchored(RendererNode& node)
+        {
+            return node.getInstance() == nullptr && node.getLocationRef().isValid();
+        }
     } // namespace
 
     LightRendererElementInfo::LightRendererElementInfo(RendererNode const & n, int32_t src, int32_t dst) :
-        m_anchor(n), m_src(src), m_dst(dst), m_stencil(false), m_stencil_ref(0)
+        m_anchor(n),
+        m_src(src),
+        m_dst(dst),
+        m_stencil(false),
+        m_stencil_ref(0),
+        m_renderer(nullptr),
+        m_group(nullptr),
+        m_order(0),
+        m_indexLayer(nullptr),
+        m_indexBucket(0),
+        m_queued(false)
     {
     }
 
+    void LightRendererElementInfo::changed()
+    {
+        if (m_renderer != nullptr && !m_queued) {
+            m_queued = true;
+            m_renderer->m_changed.push_back(this);
+        }
+    }
+
     void LightRendererElementInfo::setStencil(uint8_t stencil_ref)
     {
+        if (!m_stencil && m_renderer != nullptr) {
+            ++m_renderer->m_stencilLights;
+        }
         m_stencil     = true;
         m_stencil_ref = stencil_ref;
     }
@@ -67,6 +129,9 @@ namespace FIFE
 
     void LightRendererElementInfo::removeStencil()
     {
+        if (m_stencil && m_renderer != nullptr) {
+            --m_renderer->m_stencilLights;
+        }
         m_stencil     = false;
         m_stencil_ref = 0;
     }
@@ -79,6 +144,14 @@ namespace FIFE
 
     LightRendererImageInfo::~LightRendererImageInfo() = default;
 
+    int32_t LightRendererImageInfo::getExtent()
+    {
+        if (!m_image) {
+            return 0;
+        }
+        return static_cast<int32_t>((std::max(m_image->getWidth(), m_image->getHeight()) + 1) / 2);
+    }
+
     void LightRendererImageInfo::render(
         Camera* cam, Layer* layer, [[maybe_unused]] RenderList& instances, RenderBackend* renderbackend)
     {
@@ -118,6 +191,26 @@ namespace FIFE
 
     LightRendererAnimationInfo::~LightRendererAnimationInfo() = default;
 
+    int32_t LightRendererAnimationInfo::getExtent()
+    {
+        if (!m_animation) {
+            return 0;
+        }
+        uint32_t size = 0;
+        for (uint32_t i = 0; i < m_animation->getFrameCount(); ++i) {
+            ImagePtr const img = m_animation->getFrame(static_cast<int32_t>(i));
+            if (!img) {
+                continue;
+            }
+            // frames that are not loaded yet make the size unknown
+            if (img->getWidth() == 0) {
+                return 0;
+            }
+            size = std::max({size, img->getWidth(), img->getHeight()});
+        }
+        return static_cast<int32_t>((size + 1) / 2);
+    }
+
     void LightRendererAnimationInfo::render(
         Camera* cam, Layer* layer, [[maybe_unused]] RenderList& instances, RenderBackend* renderbackend)
     {
@@ -158,6 +251,11 @@ namespace FIFE
 
     LightRendererResizeInfo::~LightRendererResizeInfo() = default;
 
+    int32_t LightRendererResizeInfo::getExtent()
+    {
+        return (std::max(m_width, m_height) + 1) / 2;
+    }
+
     void LightRendererResizeInfo::render(
         Camera* cam, Layer* layer, [[maybe_unused]] RenderList& instances, RenderBackend* renderbackend)
     {
@@ -212,12 +310,23 @@ namespace FIFE
 
     LightRendererSimpleLightInfo::~LightRendererSimpleLightInfo() = default;
 
+    int32_t LightRendererSimpleLightInfo::getExtent()
+    {
+        return static_cast<int32_t>(std::ceil(m_radius * std::max(std::abs(m_xstretch), std::abs(m_ystretch))));
+    }
+
     void LightRendererSimpleLightInfo::render(
         Camera* cam, Layer* layer, [[maybe_unused]] RenderList& instances, RenderBackend* renderbackend)
     {
         Point const p = m_anchor.getCalculatedPoint(cam, layer, true);
         if (m_anchor.getLayer() == layer) {
             double const zoom = cam->getZoom();
+            auto const width  = static_cast<int32_t>(std::ceil(std::abs(m_radius * m_xstretch) * zoom));
+            auto const height = static_cast<int32_t>(std::ceil(std::abs(m_radius * m_ystretch) * zoom));
+            Rect const r(p.x - width, p.y - height, 2 * width, 2 * height);
+            if (!r.intersects(cam->getViewPort())) {
+                return;
+            }
 
             auto const lm = renderbackend->getLightingModel();
             renderbackend->drawLightPrimitive(
@@ -255,7 +364,8 @@ namespace FIFE
         return dynamic_cast<LightRenderer*>(cnt->getRenderer("LightRenderer"));
     }
 
-    LightRenderer::LightRenderer(RenderBackend* renderbackend, int32_t position) : RendererBase(renderbackend, position)
+    LightRenderer::LightRenderer(RenderBackend* renderbackend, int32_t position) :
+        RendererBase(renderbackend, position), m_nextOrder(0), m_stencilLights(0)
     {
         setEnabled(false);
     }
@@ -268,24 +378,31 @@ namespace FIFE
 
     LightRenderer::~LightRenderer() = default;
 
+    template <typename T>
+    T* LightRenderer::addLight(std::string const & group, std::unique_ptr<T> info)
+    {
+        T* ret          = info.get();
+        auto group_it   = m_groups.try_emplace(group).first;
+        ret->m_renderer = this;
+        ret->m_group    = &group_it->first;
+        ret->m_order    = m_nextOrder++;
+        group_it->second.push_back(std::move(info));
+        index(ret);
+        return ret;
+    }
+
     // Add a static lightmap
     LightRendererImageInfo* LightRenderer::addImage(
         std::string const & group, RendererNode const & n, ImagePtr const & image, int32_t src, int32_t dst)
     {
-        auto info                   = std::make_unique<LightRendererImageInfo>(n, image, src, dst);
-        LightRendererImageInfo* ret = info.get();
-        m_groups[group].push_back(std::move(info));
-        return ret;
+        return addLight(group, std::make_unique<LightRendererImageInfo>(n, image, src, dst));
     }
 
     // Add a animation lightmap
     LightRendererAnimationInfo* LightRenderer::addAnimation(
         std::string const & group, RendererNode const & n, AnimationPtr const & animation, int32_t src, int32_t dst)
     {
-        auto info                       = std::make_unique<LightRendererAnimationInfo>(n, animation, src, dst);
-        LightRendererAnimationInfo* ret = info.get();
-        m_groups[group].push_back(std::move(info));
-        return ret;
+        return addLight(group, std::make_unique<LightRendererAnimationInfo>(n, animation, src, dst));
     }
 
     // Add a simple light
@@ -303,11 +420,10 @@ namespace FIFE
         int32_t src,
         int32_t dst)
     {
-        auto info = std::make_unique<LightRendererSimpleLightInfo>(
-            n, intensity, radius, subdivisions, xstretch, ystretch, r, g, b, src, dst);
-        LightRendererSimpleLightInfo* ret = info.get();
-        m_groups[group].push_back(std::move(info));
-        return ret;
+        return addLight(
+            group,
+            std::make_unique<LightRendererSimpleLightInfo>(
+                n, intensity, radius, subdivisions, xstretch, ystretch, r, g, b, src, dst));
     }
 
     // Resize an Image
@@ -320,10 +436,7 @@ namespace FIFE
         int32_t src,
         int32_t dst)
     {
-        auto info                    = std::make_unique<LightRendererResizeInfo>(n, image, width, height, src, dst);
-        LightRendererResizeInfo* ret = info.get();
-        m_groups[group].push_back(std::move(info));
-        return ret;
+        return addLight(group, std::make_unique<LightRendererResizeInfo>(n, image, width, height, src, dst));
     }
 
     // Enable stencil test for the group
@@ -370,14 +483,41 @@ namespace FIFE
     // Remove the group
     void LightRenderer::removeAll(std::string const & group)
     {
-        m_groups[group].clear();
-        m_groups.erase(group);
+        auto group_it = m_groups.find(group);
+        if (group_it == m_groups.end()) {
+            return;
+        }
+        bool unindexed = false;
+        for (auto const & info : group_it->second) {
+            if (info->m_indexLayer != nullptr) {
+                unindex(info.get());
+            } else {
+                unindexed = true;
+            }
+            if (info->m_stencil) {
+                --m_stencilLights;
+            }
+        }
+        std::string const * key = &group_it->first;
+        if (unindexed) {
+            std::erase_if(m_unindexed, [key](LightRendererElementInfo const * info) {
+                return info->m_group == key;
+            });
+        }
+        std::erase_if(m_changed, [key](LightRendererElementInfo const * info) {
+            return info->m_group == key;
+        });
+        m_groups.erase(group_it);
     }
 
     // Remove all groups
     void LightRenderer::removeAll()
     {
         m_groups.clear();
+        m_layers.clear();
+        m_unindexed.clear();
+        m_changed.clear();
+        m_stencilLights = 0;
     }
 
     // Clear all groups
@@ -386,6 +526,120 @@ namespace FIFE
         removeAll();
     }
 
+    uint32_t LightRenderer::getCheckedLightCount() const
+    {
+        return static_cast<uint32_t>(m_visible.size());
+    }
+
+    void LightRenderer::index(LightRendererElementInfo* info)
+    {
+        RendererNode& node = info->m_anchor;
+        int32_t extent     = isLocationAnchored(node) ? info->getExtent() : 0;
+        if (extent <= 0) {
+            info->m_indexLayer = nullptr;
+            m_unindexed.push_back(info);
+            return;
+        }
+
+        Location const & location = node.getLocationRef();
+        Layer* layer              = node.getLayer() != nullptr ? node.getLayer() : location.getLayer();
+        Location loc(layer);
+        loc.setMapCoordinates(location.getMapCoordinates());
+        ModelCoordinate const mc = loc.getLayerCoordinates();
+        // the offset is given in screen pixels
+        Point const & offset = node.getPointRef();
+        extent += std::abs(offset.x) + std::abs(offset.y);
+
+        LayerLights& lights = m_layers[layer];
+        lights.extent       = std::max(lights.extent, extent);
+        info->m_indexLayer  = layer;
+        info->m_indexBucket = toBucketKey(mc.x >> BUCKET_SHIFT, mc.y >> BUCKET_SHIFT);
+        lights.buckets[info->m_indexBucket].push_back(info);
+    }
+
+    void LightRenderer::unindex(LightRendererElementInfo* info)
+    {
+        auto layer_it = m_layers.find(info->m_indexLayer);
+        assert(layer_it != m_layers.end());
+        auto bucket_it = layer_it->second.buckets.find(info->m_indexBucket);
+        assert(bucket_it != layer_it->second.buckets.end());
+        std::vector<LightRendererElementInfo*>& bucket = bucket_it->second;
+        auto it                                        = std::ranges::find(bucket, info);
+        *it                                            = bucket.back();
+        bucket.pop_back();
+        if (bucket.empty()) {
+            layer_it->second.buckets.erase(bucket_it);
+        }
+        info->m_indexLayer = nullptr;
+    }
+
+    void LightRenderer::updateIndex()
+    {
+        if (m_changed.empty()) {
+            return;
+        }
+        // take the changed lights out of the per frame list in one pass
+        std::erase_if(m_unindexed, [](LightRendererElementInfo const * info) {
+            return info->m_queued;
+        });
+        for (LightRendererElementInfo* info : m_changed) {
+            if (info->m_indexLayer != nullptr) {
+                unindex(info);
+            }
+            info->m_queued = false;
+            index(info);
+        }
+        m_changed.clear();
+    }
+
+    void LightRenderer::collectLights(Camera* cam, Layer* layer)
+    {
+        m_visible.clear();
+        m_visible.insert(m_visible.end(), m_unindexed.begin(), m_unindexed.end());
+
+        auto layer_it = m_layers.find(layer);
+        if (layer_it != m_layers.end() && !layer_it->second.buckets.empty()) {
+            LayerLights const & lights = layer_it->second;
+            // widen the visible cells by the largest light
+            Point const cell      = cam->getCellImageDimensions(layer);
+            double const cellSize = std::max(1, std::min(cell.x, cell.y));
+            auto const margin     = static_cast<int32_t>(std::ceil(lights.extent * cam->getZoom() / cellSize)) + 1;
+            Rect const cells      = getVisibleCells(cam, layer);
+            int32_t const firstX  = (cells.x - margin) >> BUCKET_SHIFT;
+            int32_t const firstY  = (cells.y - margin) >> BUCKET_SHIFT;
+            int32_t const lastX   = (cells.x + cells.w + margin) >> BUCKET_SHIFT;
+            int32_t const lastY   = (cells.y + cells.h + margin) >> BUCKET_SHIFT;
+            int64_t const area    = static_cast<int64_t>(lastX - firstX + 1) * (lastY - firstY + 1);
+            if (std::cmp_greater(area, lights.buckets.size())) {
+                // zoomed far out, there are fewer buckets than visible ones
+                for (auto const & [key, bucket] : lights.buckets) {
+                    auto const x = static_cast<int32_t>(key >> 32);
+                    auto const y = static_cast<int32_t>(key & 0xffffffff);
+                    if (x >= firstX && x <= lastX && y >= firstY && y <= lastY) {
+                        m_visible.insert(m_visible.end(), bucket.begin(), bucket.end());
+                    }
+                }
+            } else {
+                for (int32_t y = firstY; y <= lastY; ++y) {
+                    for (int32_t x = firstX; x <= lastX; ++x) {
+                        auto bucket_it = lights.buckets.find(toBucketKey(x, y));
+                        if (bucket_it != lights.buckets.end()) {
+                            m_visible.insert(m_visible.end(), bucket_it->second.begin(), bucket_it->second.end());
+                        }
+                    }
+                }
+            }
+        }
+
+        // groups are rendered by name, the lights of a group in the order they were added
+        std::ranges::sort(m_visible, [](LightRendererElementInfo const * a, LightRendererElementInfo const * b) {
+            if (a->m_group != b->m_group) {
+                return *a->m_group < *b->m_group;
+            }
+            return a->m_order < b->m_order;
+        });
+    }
+
     // Render
     void LightRenderer::render(Camera* cam, Layer* layer, RenderList& instances)
     {
@@ -395,18 +649,27 @@ namespace FIFE
             return;
         }
 
-        auto group_it = m_groups.begin();
-        for (; group_it != m_groups.end(); ++group_it) {
-            auto info_it = group_it->second.begin();
-            for (; info_it != group_it->second.end(); ++info_it) {
-                if (lm != 0) {
-                    if ((*info_it)->getStencil() != -1 && (*info_it)->getStencil() < 255) {
-                        if (info_it != group_it->second.begin()) {
-                            (*info_it)->setStencil(static_cast<uint8_t>((*info_it)->getStencil() + 1));
-                        }
+        if (lm != 0 && m_stencilLights > 0) {
+            for (auto& [name, infos] : m_groups) {
+                for (auto info_it = infos.begin(); info_it != infos.end(); ++info_it) {
+                    LightRendererElementInfo* info = info_it->get();
+                    if (info->m_stencil && info->m_stencil_ref < 255 && info_it != infos.begin()) {
+                        ++info->m_stencil_ref;
                     }
                 }
-                (*info_it)->render(cam, layer, instances, m_renderbackend);
+            }
+        }
+
+        updateIndex();
+        collectLights(cam, layer);
+        for (LightRendererElementInfo* info : m_visible) {
+            info->render(cam, layer, instances, m_renderbackend);
+        }
+
+        // lights whose images were not loaded are indexed once their size is known
+        for (LightRendererElementInfo* info : m_unindexed) {
+            if (!info->m_queued && isLocationAnchored(info->m_anchor) && info->getExtent() > 0) {
+                info->changed();
             }
         }
     }
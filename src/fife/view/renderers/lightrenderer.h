@@ -13,6 +13,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // 3rd party library includes
@@ -26,6 +27,7 @@ namespace FIFE
 {
     class RenderBackend;
     class IFont;
+    class LightRenderer;
 
     class FIFE_API LightRendererElementInfo
     {
@@ -36,8 +38,14 @@ namespace FIFE
             virtual void render(Camera* cam, Layer* layer, RenderList& instances, RenderBackend* renderbackend) = 0;
             virtual std::string getName()                                                                       = 0;
 
+            /** Returns the anchor of the light.
+             *
+             * The anchor can be changed through the pointer, so the light is placed again in the
+             * spatial index of its renderer before the next frame.
+             */
             RendererNode* getNode()
             {
+                changed();
                 return &m_anchor;
             }
             int32_t getSrcBlend() const
@@ -75,11 +83,35 @@ namespace FIFE
             }
 
         protected:
+            /** Returns half the size of the light in unzoomed screen pixels, 0 if it is not known yet.
+             */
+            virtual int32_t getExtent() = 0;
+
+            /** Queues the light to be placed again in the spatial index of its renderer.
+             */
+            void changed();
+
             RendererNode m_anchor;
             int32_t m_src;
             int32_t m_dst;
             bool m_stencil;
             uint8_t m_stencil_ref;
+
+        private:
+            friend class LightRenderer;
+
+            //! Renderer the light was added to, nullptr if it was created on its own.
+            LightRenderer* m_renderer;
+            //! Group the light belongs to, points to the key in the group map of the renderer.
+            std::string const * m_group;
+            //! Order in which the lights were added, lights of a group are rendered in this order.
+            uint64_t m_order;
+            //! Layer whose index holds the light, nullptr if it is checked every frame.
+            Layer* m_indexLayer;
+            //! Bucket of the index that holds the light.
+            uint64_t m_indexBucket;
+            //! True while the light waits to be placed again.
+            bool m_queued;
     };
 
     class FIFE_API LightRendererImageInfo : public LightRendererElementInfo
@@ -100,8 +132,12 @@ namespace FIFE
             void setImage(ImagePtr const & image)
             {
                 m_image = image;
+                changed();
             }
 
+        protected:
+            int32_t getExtent() override;
+
         private:
             ImagePtr m_image;
     };
@@ -125,8 +161,12 @@ namespace FIFE
             void setAnimation(AnimationPtr const & animation)
             {
                 m_animation = animation;
+                changed();
             }
 
+        protected:
+            int32_t getExtent() override;
+
         private:
             AnimationPtr m_animation;
             uint64_t m_start_time;
@@ -180,6 +220,7 @@ namespace FIFE
             void setRadius(float radius)
             {
                 m_radius = radius;
+                changed();
             }
             void setSubdivisions(int32_t subdivisions)
             {
@@ -188,10 +229,12 @@ namespace FIFE
             void setXStretch(float xstretch)
             {
                 m_xstretch = xstretch;
+                changed();
             }
             void setYStretch(float ystretch)
             {
                 m_ystretch = ystretch;
+                changed();
             }
             void setColor(uint8_t r, uint8_t g, uint8_t b)
             {
@@ -200,6 +243,9 @@ namespace FIFE
                 m_blue  = b;
             }
 
+        protected:
+            int32_t getExtent() override;
+
         private:
             uint8_t m_intensity;
             float m_radius;
@@ -236,6 +282,7 @@ namespace FIFE
             void setImage(ImagePtr const & image)
             {
                 m_image = image;
+                changed();
             }
             int32_t getWidth() const
             {
@@ -244,6 +291,7 @@ namespace FIFE
             void setWidth(int32_t width)
             {
                 m_width = width;
+                changed();
             }
             int32_t getHeight() const
             {
@@ -252,14 +300,24 @@ namespace FIFE
             void setHeight(int32_t height)
             {
                 m_height = height;
+                changed();
             }
 
+        protected:
+            int32_t getExtent() override;
+
         private:
             ImagePtr m_image;
             int32_t m_width;
             int32_t m_height;
     };
 
+    /** Renders lights anchored to instances, locations or the screen.
+     *
+     * Lights anchored to a location are kept in a spatial index of their layer, the lights of a
+     * layer are looked up by the part of the layer the camera shows. Lights that follow an instance
+     * or the screen are checked every frame.
+     */
     class FIFE_API LightRenderer : public RendererBase
     {
         public:
@@ -269,12 +327,11 @@ namespace FIFE
              */
             LightRenderer(RenderBackend* renderbackend, int32_t position);
 
-            // Non-copyable: owns element containers with unique_ptr
+            // Non-copyable and non-movable: the lights point back to their renderer
             LightRenderer(LightRenderer const &)            = delete;
             LightRenderer& operator=(LightRenderer const &) = delete;
-            // Allow move semantics
-            LightRenderer(LightRenderer&&) noexcept            = default;
-            LightRenderer& operator=(LightRenderer&&) noexcept = default;
+            LightRenderer(LightRenderer&&)                  = delete;
+            LightRenderer& operator=(LightRenderer&&)       = delete;
 
             std::unique_ptr<RendererBase> clone() override;
 
@@ -332,8 +389,40 @@ namespace FIFE
             void removeAll();
             void reset() override;
 
+            /** Returns the number of lights the last render call looked at.
+             */
+            uint32_t getCheckedLightCount() const;
+
         private:
+            friend class LightRendererElementInfo;
+
+            /** Index of the lights anchored to locations on one layer.
+             */
+            struct LayerLights
+            {
+                    //! Lights by bucket of layer cells.
+                    std::unordered_map<uint64_t, std::vector<LightRendererElementInfo*>> buckets;
+                    //! Largest extent of the lights added to the layer, in unzoomed pixels.
+                    int32_t extent = 0;
+            };
+
+            template <typename T>
+            T* addLight(std::string const & group, std::unique_ptr<T> info);
+            void index(LightRendererElementInfo* info);
+            void unindex(LightRendererElementInfo* info);
+            void updateIndex();
+            void collectLights(Camera* cam, Layer* layer);
+
             std::map<std::string, std::vector<std::unique_ptr<LightRendererElementInfo>>> m_groups;
+            std::unordered_map<Layer*, LayerLights> m_layers;
+            //! Lights that follow an instance or the screen, or whose size is not known yet.
+            std::vector<LightRendererElementInfo*> m_unindexed;
+            //! Lights that have to be placed again before the next frame.
+            std::vector<LightRendererElementInfo*> m_changed;
+            //! Lights found for the current layer, kept to avoid allocations.
+            std::vector<LightRendererElementInfo*> m_visible;
+            uint64_t m_nextOrder;
+            uint32_t m_stencilLights;
     };
 
 } // namespace FIFE
@@ -91,6 +91,7 @@ namespace FIFE {
 		std::vector<LightRendererElementInfo*> getLightInfo(const std::string &group);
 		void removeAll(const std::string &group);
 		void removeAll();
+		uint32_t getCheckedLightCount() const;
 	};
 }
 
@@ -202,17 +202,15 @@ namespace FIFE
     void OffRendererTextInfo::render(RenderBackend* renderbackend)
     {
         static_cast<void>(renderbackend);
-        Image* img = m_font->getAsImageMultiline(m_text);
+        Point const size = m_font->getTextSize(m_text);
 
         Rect r;
-        int32_t const width  = toScreenSize(img->getWidth());
-        int32_t const height = toScreenSize(img->getHeight());
-        r.x                  = m_anchor.x - (width / 2);
-        r.y                  = m_anchor.y - (height / 2);
-        r.w                  = width;
-        r.h                  = height;
+        r.x = m_anchor.x - (size.x / 2);
+        r.y = m_anchor.y - (size.y / 2);
+        r.w = size.x;
+        r.h = size.y;
 
-        img->render(r);
+        m_font->renderText(m_text, r);
     }
 
     OffRendererResizeInfo::OffRendererResizeInfo(
@@ -9,6 +9,8 @@
 #include <cassert>
 #include <cmath>
 #include <memory>
+#include <span>
+#include <utility>
 #include <vector>
 
 #include "model/metamodel/grids/cellgrid.h"
@@ -110,8 +112,8 @@ namespace FIFE
         }
 
         cache.screenPts.clear();
-        Path const & path = route->getPath();
-        CellGrid* cg      = layer->getCellGrid();
+        std::span<ModelCoordinate const> const path = route->getPathCoordinates();
+        CellGrid* cg                                = layer->getCellGrid();
         if (cg == nullptr) {
             // FL_WARN(_log(), "No cellgrid assigned to layer, cannot draw path");
             cache.dirty = false;
@@ -119,12 +121,12 @@ namespace FIFE
         }
         cache.screenPts.reserve(path.size());
 
-        for (auto const & loc : path) {
-            if (loc.getLayer() != layer) {
+        for (uint32_t i = 0; std::cmp_less(i, path.size()); ++i) {
+            if (route->getPathLayer(i) != layer) {
                 continue;
             }
 
-            ExactModelCoordinate const mapCenter = cg->toMapCoordinates(loc.getLayerCoordinates());
+            ExactModelCoordinate const mapCenter = cg->toMapCoordinates(path[i]);
             Point3D const screenPt               = cam->toScreenCoordinates(mapCenter);
 
             if (!isPointInView(screenPt, cam)) {
@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Corresponding header include
+#include "staticlayertiles.h"
+
+// Standard C++ library includes
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// 3rd party library includes
+
+// FIFE includes
+
+namespace FIFE
+{
+    namespace
+    {
+        int32_t floorDiv(int32_t value, int32_t divisor)
+        {
+            int32_t const quotient = value / divisor;
+            return (value % divisor != 0 && value < 0) ? quotient - 1 : quotient;
+        }
+    } // namespace
+
+    StaticLayerTiles::StaticLayerTiles(int32_t tileSize, uint32_t capacity) :
+        m_tileSize(std::max(tileSize, 1)), m_capacity(capacity), m_anchor(0, 0), m_frame(0)
+    {
+    }
+
+    int32_t StaticLayerTiles::getTileSize() const
+    {
+        return m_tileSize;
+    }
+
+    uint32_t StaticLayerTiles::getCapacity() const
+    {
+        return m_capacity;
+    }
+
+    size_t StaticLayerTiles::getTileCount() const
+    {
+        return m_tiles.size();
+    }
+
+    size_t StaticLayerTiles::getImageCount() const
+    {
+        size_t count = m_freeImages.size();
+        for (auto const & [tileKey, tile] : m_tiles) {
+            if (tile.image) {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    void StaticLayerTiles::setAnchor(Point const & anchor)
+    {
+        m_anchor = anchor;
+    }
+
+    Point const & StaticLayerTiles::getAnchor() const
+    {
+        return m_anchor;
+    }
+
+    void StaticLayerTiles::invalidate()
+    {
+        for (auto& [tileKey, tile] : m_tiles) {
+            if (tile.image) {
+                m_freeImages.push_back(tile.image);
+            }
+        }
+        m_tiles.clear();
+        m_visible.clear();
+    }
+
+    void StaticLayerTiles::markDirty(Rect const & area)
+    {
+        if (area.w <= 0 || area.h <= 0 || m_tiles.empty()) {
+            return;
+        }
+        int32_t x0 = 0;
+        int32_t y0 = 0;
+        int32_t x1 = 0;
+        int32_t y1 = 0;
+        tileRange(area, x0, y0, x1, y1);
+        // a huge area would visit more keys than there are tiles
+        if (static_cast<int64_t>(x1 - x0 + 1) * static_cast<int64_t>(y1 - y0 + 1) >
+            static_cast<int64_t>(m_tiles.size())) {
+            for (auto& [tileKey, tile] : m_tiles) {
+                if (tile.x >= x0 && tile.x <= x1 && tile.y >= y0 && tile.y <= y1) {
+                    tile.dirty = true;
+                }
+            }
+            return;
+        }
+        for (int32_t y = y0; y <= y1; ++y) {
+            for (int32_t x = x0; x <= x1; ++x) {
+                auto it = m_tiles.find(key(x, y));
+                if (it != m_tiles.end()) {
+                    it->second.dirty = true;
+                }
+            }
+        }
+    }
+
+    std::vector<StaticLayerTiles::Tile*> const & StaticLayerTiles::update(Rect const & viewport)
+    {
+        ++m_frame;
+        m_visible.clear();
+        if (viewport.w <= 0 || viewport.h <= 0) {
+            return m_visible;
+        }
+        int32_t x0 = 0;
+        int32_t y0 = 0;
+        int32_t x1 = 0;
+        int32_t y1 = 0;
+        tileRange(viewport, x0, y0, x1, y1);
+        for (int32_t y = y0; y <= y1; ++y) {
+            for (int32_t x = x0; x <= x1; ++x) {
+                auto it       = m_tiles.find(key(x, y));
+                Tile* tile    = it != m_tiles.end() ? &it->second : createTile(x, y);
+                tile->lastUse = m_frame;
+                m_visible.push_back(tile);
+            }
+        }
+        return m_visible;
+    }
+
+    std::vector<StaticLayerTiles::Tile*> const & StaticLayerTiles::getVisibleTiles() const
+    {
+        return m_visible;
+    }
+
+    Rect StaticLayerTiles::getScreenRect(Tile const & tile) const
+    {
+        return Rect(m_anchor.x + (tile.x * m_tileSize), m_anchor.y + (tile.y * m_tileSize), m_tileSize, m_tileSize);
+    }
+
+    uint64_t StaticLayerTiles::key(int32_t x, int32_t y)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+    }
+
+    void StaticLayerTiles::tileRange(Rect const & area, int32_t& x0, int32_t& y0, int32_t& x1, int32_t& y1) const
+    {
+        x0 = floorDiv(area.x - m_anchor.x, m_tileSize);
+        y0 = floorDiv(area.y - m_anchor.y, m_tileSize);
+        x1 = floorDiv(area.x + area.w - 1 - m_anchor.x, m_tileSize);
+        y1 = floorDiv(area.y + area.h - 1 - m_anchor.y, m_tileSize);
+    }
+
+    StaticLayerTiles::Tile* StaticLayerTiles::createTile(int32_t x, int32_t y)
+    {
+        ImagePtr image;
+        if (!m_freeImages.empty()) {
+            image = m_freeImages.back();
+            m_freeImages.pop_back();
+        } else if (m_tiles.size() >= m_capacity) {
+            // evicts the least recently shown tile, tiles of this update are never evicted
+            auto oldest      = m_tiles.end();
+            uint64_t lastUse = m_frame;
+            for (auto it = m_tiles.begin(); it != m_tiles.end(); ++it) {
+                if (it->second.lastUse < lastUse) {
+                    lastUse = it->second.lastUse;
+                    oldest  = it;
+                }
+            }
+            if (oldest != m_tiles.end()) {
+                image = oldest->second.image;
+                m_tiles.erase(oldest);
+            }
+        }
+        Tile& tile = m_tiles[key(x, y)];
+        tile       = {.x = x, .y = y, .image = image, .dirty = true, .lastUse = m_frame};
+        return &tile;
+    }
+
+} // namespace FIFE
@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+#ifndef FIFE_VIEW_STATICLAYERTILES_H
+#define FIFE_VIEW_STATICLAYERTILES_H
+
+// Platform specific includes
+#include "platform.h"
+
+// Standard C++ library includes
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// 3rd party library includes
+
+// FIFE includes
+#include "util/structures/rect.h"
+#include "video/image.h"
+
+namespace FIFE
+{
+
+    /** Tiled render cache of a static layer.
+     *
+     * The rendered layer is split into square, screen aligned tiles. A tile is
+     * keyed by its position relative to the anchor, the screen position of a fixed
+     * map point, so the keys stay valid while the camera only pans. Panning reuses
+     * the tiles that are already rendered and only the newly exposed ones have to
+     * be rendered, a changed instance only dirties the tiles it overlaps.
+     *
+     * The number of tiles is bounded, the least recently shown tile gives its
+     * image to the next new tile. Images are never created here, a tile without
+     * image has to get one from the caller before it is rendered.
+     */
+    class FIFE_API StaticLayerTiles
+    {
+        public:
+            struct Tile
+            {
+                    // Position in tiles, relative to the anchor.
+                    int32_t x;
+                    int32_t y;
+                    ImagePtr image;
+                    // The image has to be rendered again.
+                    bool dirty;
+                    // Last update() that returned the tile.
+                    uint64_t lastUse;
+            };
+
+            /** Tile edge length in pixels.
+             */
+            static constexpr int32_t DEFAULT_TILE_SIZE = 256;
+
+            /** Number of tiles kept by default.
+             */
+            static constexpr uint32_t DEFAULT_CAPACITY = 128;
+
+            /** Constructor.
+             *
+             * @param tileSize Edge length of the tiles in pixels.
+             * @param capacity Number of tiles kept, the tiles covering the viewport are always kept.
+             */
+            explicit StaticLayerTiles(int32_t tileSize = DEFAULT_TILE_SIZE, uint32_t capacity = DEFAULT_CAPACITY);
+
+            int32_t getTileSize() const;
+            uint32_t getCapacity() const;
+
+            /** Returns the number of tiles, including the ones outside the viewport.
+             */
+            size_t getTileCount() const;
+
+            /** Returns the number of images held by the tiles or kept for new tiles.
+             */
+            size_t getImageCount() const;
+
+            /** Sets the screen position of the anchor.
+             * The anchor moves with the map, so a pan only moves it.
+             */
+            void setAnchor(Point const & anchor);
+            Point const & getAnchor() const;
+
+            /** Forgets all tiles, e.g. after the zoom or rotation changed.
+             * The images are kept for the next tiles.
+             */
+            void invalidate();
+
+            /** Marks the tiles overlapping a screen area as dirty.
+             */
+            void markDirty(Rect const & area);
+
+            /** Returns the tiles covering the viewport, ordered by rows.
+             *
+             * Missing tiles are created dirty, with the image of an evicted tile if the
+             * cache is full. The pointers are valid until the next call.
+             */
+            std::vector<Tile*> const & update(Rect const & viewport);
+
+            /** Returns the tiles of the last update.
+             */
+            std::vector<Tile*> const & getVisibleTiles() const;
+
+            /** Returns the screen area of a tile.
+             */
+            Rect getScreenRect(Tile const & tile) const;
+
+        private:
+            static uint64_t key(int32_t x, int32_t y);
+
+            /** Returns the range of tiles overlapping a screen area.
+             */
+            void tileRange(Rect const & area, int32_t& x0, int32_t& y0, int32_t& x1, int32_t& y1) const;
+
+            Tile* createTile(int32_t x, int32_t y);
+
+            int32_t m_tileSize;
+            uint32_t m_capacity;
+            Point m_anchor;
+            uint64_t m_frame;
+            std::unordered_map<uint64_t, Tile> m_tiles;
+            // Images of forgotten tiles.
+            std::vector<ImagePtr> m_freeImages;
+            std::vector<Tile*> m_visible;
+    };
+
+} // namespace FIFE
+
+#endif
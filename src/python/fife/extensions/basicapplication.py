@@ -216,6 +216,7 @@ class ApplicationBase:
         self._log.setLevelFilter(
             self._setting.get("FIFE", "LogLevelFilter", fife.LogManager.LEVEL_DEBUG)
         )
+        self._log.setAsync(self._setting.get("FIFE", "LogAsync", False))
 
         if logmodules:
             self._log.setVisibleModules(*logmodules)
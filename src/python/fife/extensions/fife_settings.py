@@ -109,6 +109,7 @@ class Setting:
             "LogToFile": [True, False],
             "LogToPrompt": [True, False],
             "LogLevelFilter": [0, 1, 2, 3],
+            "LogAsync": [True, False],
             "LogModules": [
                 "all",
                 "controller",
@@ -175,6 +176,7 @@ class Setting:
             "LogToFile": False,
             "LogToPrompt": False,
             "LogLevelFilter": 0,
+            "LogAsync": False,
             "LogModules": ["controller", "script"],
             "FrameLimitEnabled": False,
             "FrameLimit": 60,
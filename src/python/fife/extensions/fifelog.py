@@ -182,6 +182,32 @@ class LogManager:
 
     logToFile = property(getLogToFile, setLogToFile)
 
+    def setAsync(self, asynclog, blocking=False):
+        """Set whether messages are written by a background thread.
+
+        Parameters
+        ----------
+        asynclog : bool
+            If True, logging threads only queue their messages.
+        blocking : bool
+            If True, logging waits while the queue is full, otherwise the
+            message is dropped.
+        """
+        self.lm.setOverflowPolicy(
+            fife.LogOverflowPolicy_Block if blocking else fife.LogOverflowPolicy_Drop
+        )
+        self.lm.setAsync(asynclog)
+
+    def getAsync(self):
+        """Get whether messages are written by a background thread.
+
+        Returns
+        -------
+        bool
+            True if asynchronous logging is enabled, False otherwise.
+        """
+        return self.lm.isAsync()
+
     def log_debug(self, message):
         """Log a debug message."""
         self.script_logger.log(fife.LogManager.LEVEL_DEBUG, message)
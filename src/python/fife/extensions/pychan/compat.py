@@ -87,6 +87,7 @@ def _munge_engine_hook(engine):
 
     hook.add_widget = guimanager.add
     hook.remove_widget = guimanager.remove
+    hook.invalidate_widget = guimanager.invalidateWidget
     hook.load_image = _fife_load_image
     hook.translate_mouse_event = guimanager.translateMouseEvent
     hook.translate_key_event = guimanager.translateKeyEvent
@@ -110,6 +110,17 @@ class Manager:
             widget._added = False
             self.allWidgets.remove(widget)
 
+    def invalidateWidget(self, widget):
+        """
+        Mark the cached window around a widget as changed.
+
+        Windows kept in textures by the render cache are drawn again
+        after one of their widgets was invalidated.
+        """
+        invalidate_widget = getattr(self.hook, "invalidate_widget", None)
+        if invalidate_widget is not None:
+            invalidate_widget(widget.real_widget)
+
     def setupModalExecution(self, mainLoop, breakFromMainLoop):
         """
         Set up synchronous execution of dialogs.
@@ -193,6 +193,7 @@ class Container(Widget):
 
         self.children.append(widget)
         self.real_widget.add(widget.real_widget)
+        self.invalidate()
 
         # add all to the manager
         def _add(added_widget):
@@ -252,6 +253,7 @@ class Container(Widget):
         if widget in self.children:
             self.children.remove(widget)
             self.real_widget.remove(widget.real_widget)
+            self.invalidate()
 
         widget.parent = None
 
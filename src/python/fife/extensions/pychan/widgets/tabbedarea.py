@@ -303,6 +303,7 @@ class TabbedArea(Container):
 
         # add real tab and real widget
         self.real_widget.addTab(widget.tab.real_widget, widget.real_widget)
+        self.invalidate()
 
         # add all to the manager
         def _add(added_widget):
@@ -337,6 +338,7 @@ class TabbedArea(Container):
 
         i = self.children.index(widget)
         self.real_widget.removeTabWithIndex(i)
+        self.invalidate()
         self.children.remove(widget)
         widget.parent = None
 
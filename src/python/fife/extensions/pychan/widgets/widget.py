@@ -636,6 +636,21 @@ class Widget:
             # On the first pass, diffH=0 because the container size is 0
             # and getChildrenArea also returns 0.
             self.real_widget.adaptLayout(recurse)
+        self.invalidate()
+
+    def invalidate(self):
+        """Mark the widget as changed, so a cached window around it is drawn again.
+
+        Setting an attribute of the widget invalidates it already. Call it
+        after changing the widget through a method of the real widget.
+        """
+        get_manager().invalidateWidget(self)
+
+    def __setattr__(self, name, value):
+        super().__setattr__(name, value)
+        # public attributes are properties that change the real widget
+        if not name.startswith("_") and "real_widget" in self.__dict__:
+            self.invalidate()
 
     def beforeShow(self):
         """
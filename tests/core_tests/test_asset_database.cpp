@@ -0,0 +1,268 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Standard C++ library includes
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <system_error>
+
+// Platform specific includes
+#include <catch2/catch_test_macros.hpp>
+
+// 3rd party library includes
+
+// FIFE includes
+#include "loaders/native/map/assetdatabase.h"
+#include "vfs/vfs.h"
+#include "vfs/vfsdirectory.h"
+
+using FIFE::AssetDatabase;
+using FIFE::AssetFileRecord;
+
+namespace
+{
+    char const * const ASSET_TEST_DIR = "fifeassetdbtest";
+
+    char const * const OBJECT_XML = R"(<?xml version="1.0"?>
+<assets speed="2.5">
+    <import file="other.xml"/>
+    <atlas source="tiles.png" atlas_width="64" atlas_height="32" subimage_width="32" subimage_height="32"/>
+    <animation id="walk" direction="90" delay="100" x_offset="3">
+        <frame source="walk0.png"/>
+        <frame source="walk1.png" delay="50" y_offset="-4"/>
+    </animation>
+    <object id="tree" namespace="test" blocking="1" static="1" cost_id="forest" cost="2.0">
+        <walkable_area id="grass"/>
+        <multipart id="tree:part">
+            <rotation rot="90">
+                <occupied_coord x="1" y="0"/>
+                <occupied_coord x="2"/>
+            </rotation>
+        </multipart>
+        <image source="tree.png" direction="0" x_offset="-16"/>
+        <action id="sway" default="1">
+            <sound source="wind.ogg" volume="0.5" looping="1"/>
+            <animation atlas="sway.png" width="16" height="24" frames="4" delay="80">
+                <direction dir="0"/>
+                <direction dir="90" frames="2" action_frame="1"/>
+            </animation>
+            <animation source="sway.xml" direction="180"/>
+        </action>
+    </object>
+</assets>
+)";
+
+    void writeFile(std::filesystem::path const & path, std::string const & content)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << content;
+    }
+} // namespace
+
+TEST_CASE("AssetDatabase::compile reads atlases, animations and objects", "[core][loaders]")
+{
+    AssetFileRecord const file = AssetDatabase::compile(OBJECT_XML);
+
+    REQUIRE(file.root == AssetFileRecord::RootAssets);
+    REQUIRE(file.imports.size() == 1);
+    CHECK(*file.imports[0].file == "other.xml");
+    CHECK(!file.imports[0].directory);
+
+    REQUIRE(file.atlases.size() == 1);
+    REQUIRE(file.atlases[0].regions.size() == 2);
+    CHECK(file.atlases[0].regions[1].name == "tiles.png:0001.png");
+    CHECK(file.atlases[0].regions[1].region == FIFE::Rect(32, 0, 32, 32));
+
+    REQUIRE(file.animations.size() == 1);
+    FIFE::AnimationRecord const & animation = file.animations[0];
+    CHECK(*animation.id == "walk");
+    CHECK(*animation.direction == 90);
+    CHECK(!animation.atlas);
+    REQUIRE(animation.frames.size() == 2);
+    CHECK(animation.frames[0].delay == 100);
+    CHECK(animation.frames[0].xOffset == 3);
+    CHECK(animation.frames[1].delay == 50);
+    CHECK(animation.frames[1].yOffset == -4);
+
+    REQUIRE(file.objects.size() == 1);
+    FIFE::ObjectRecord const & object = file.objects[0];
+    CHECK(*object.id == "tree");
+    CHECK(object.blocking);
+    CHECK(object.isStatic);
+    CHECK(*object.cost == 2.0);
+    CHECK(*object.speed == 2.5);
+    CHECK(object.walkableAreas.size() == 1);
+    // the second coordinate has no y and is skipped
+    REQUIRE(object.multiPartCoordinates.size() == 1);
+    CHECK(object.multiPartCoordinates[0].rotation == 90);
+    CHECK(*object.images[0].xOffset == -16);
+    CHECK(!object.images[0].yOffset);
+
+    REQUIRE(object.actions.size() == 1);
+    FIFE::ActionRecord const & action = object.actions[0];
+    CHECK(action.isDefault);
+    CHECK(*action.sound->volume == 0.5F);
+    CHECK(*action.sound->looping);
+    CHECK(!action.sound->pitch);
+    REQUIRE(action.animations.size() == 2);
+    REQUIRE(action.animations[0].directions.size() == 2);
+    CHECK(action.animations[0].directions[0].frames == 4);
+    CHECK(action.animations[0].directions[1].frames == 2);
+    CHECK(action.animations[0].directions[1].delay == 80);
+    CHECK(*action.animations[0].directions[1].actionFrame == 1);
+    CHECK(*action.animations[1].source == "sway.xml");
+    CHECK(*action.animations[1].direction == 180);
+}
+
+TEST_CASE("AssetDatabase::compile marks broken files invalid", "[core][loaders]")
+{
+    CHECK(AssetDatabase::compile("").root == AssetFileRecord::RootInvalid);
+    CHECK(AssetDatabase::compile("<assets><object></assets>").root == AssetFileRecord::RootInvalid);
+    CHECK(AssetDatabase::compile("<animation delay=\"10\"/>").root == AssetFileRecord::RootAnimation);
+}
+
+TEST_CASE("AssetDatabase reuses entries until the file changes", "[core][loaders]")
+{
+    std::filesystem::path const test_dir = std::filesystem::current_path() / ASSET_TEST_DIR;
+    std::error_code ec;
+    std::filesystem::remove_all(test_dir, ec);
+    std::filesystem::create_directories(test_dir / "nested");
+    writeFile(test_dir / "objects.xml", OBJECT_XML);
+    writeFile(test_dir / "nested" / "walk.xml", "<animation id=\"run\"><frame source=\"a.png\"/></animation>");
+
+    auto vfs = std::make_unique<FIFE::VFS>();
+    vfs->addSource(std::make_unique<FIFE::VFSDirectory>(vfs.get()));
+
+    std::string const directory  = ASSET_TEST_DIR;
+    std::string const objectFile = directory + "/objects.xml";
+
+    // no database file yet, imports parse the xml as before
+    CHECK(AssetDatabase::open(vfs.get(), directory) == nullptr);
+    CHECK(AssetDatabase::find(objectFile) == nullptr);
+
+    {
+        AssetDatabase database(vfs.get(), directory);
+        CHECK(!database.load());
+        database.compileDirectory();
+        CHECK(database.getCompileCount() == 2);
+        REQUIRE(database.save());
+        CHECK(database.getEntryCount() == 2);
+    }
+
+    {
+        auto database = AssetDatabase::open(vfs.get(), directory);
+        REQUIRE(database != nullptr);
+        CHECK(AssetDatabase::find(objectFile) == database.get());
+        CHECK(AssetDatabase::find("elsewhere/objects.xml") == nullptr);
+
+        AssetFileRecord const * file = database->get(objectFile);
+        REQUIRE(file != nullptr);
+        CHECK(file->objects.size() == 1);
+        CHECK(*file->objects[0].actions[0].animations[0].atlas == "sway.png");
+        // the second lookup is served from the session
+        CHECK(database->get(objectFile) == file);
+        CHECK(database->get(directory + "/missing.xml") == nullptr);
+        CHECK(database->getHitCount() == 1);
+        CHECK(database->getCompileCount() == 0);
+        // nothing was compiled, the file is left alone
+        auto const written = std::filesystem::last_write_time(test_dir / AssetDatabase::FILENAME);
+        CHECK(database->save());
+        CHECK(std::filesystem::last_write_time(test_dir / AssetDatabase::FILENAME) == written);
+    }
+    CHECK(AssetDatabase::find(objectFile) == nullptr);
+
+    writeFile(test_dir / "objects.xml", "<assets><object id=\"rock\" namespace=\"test\"/></assets>");
+    {
+        auto database = AssetDatabase::open(vfs.get(), directory);
+        REQUIRE(database != nullptr);
+        AssetFileRecord const * file = database->get(objectFile);
+        REQUIRE(file != nullptr);
+        CHECK(*file->objects[0].id == "rock");
+        CHECK(database->getCompileCount() == 1);
+        REQUIRE(database->save());
+    }
+    {
+        auto database = AssetDatabase::open(vfs.get(), directory);
+        REQUIRE(database != nullptr);
+        CHECK(database->getEntryCount() == 2);
+        CHECK(*database->get(objectFile)->objects[0].id == "rock");
+        CHECK(*database->get(directory + "/nested/walk.xml")->animations[0].id == "run");
+        CHECK(database->getHitCount() == 2);
+    }
+
+    // a damaged database is rebuilt
+    writeFile(test_dir / AssetDatabase::FILENAME, "garbage");
+    {
+        auto database = AssetDatabase::open(vfs.get(), directory);
+        REQUIRE(database != nullptr);
+        CHECK(database->getEntryCount() == 0);
+        CHECK(database->get(objectFile) != nullptr);
+        CHECK(database->getCompileCount() == 1);
+    }
+
+    std::filesystem::remove_all(test_dir, ec);
+}
+
+TEST_CASE("AssetDatabase skips files with an unchanged stamp", "[core][loaders]")
+{
+    std::filesystem::path const test_dir = std::filesystem::current_path() / ASSET_TEST_DIR;
+    std::error_code ec;
+    std::filesystem::remove_all(test_dir, ec);
+    std::filesystem::create_directories(test_dir);
+    std::filesystem::path const objectPath = test_dir / "objects.xml";
+    writeFile(objectPath, "<assets><object id=\"tree\" namespace=\"test\"/></assets>");
+    auto const written = std::filesystem::last_write_time(objectPath);
+
+    auto vfs = std::make_unique<FIFE::VFS>();
+    vfs->addSource(std::make_unique<FIFE::VFSDirectory>(vfs.get()));
+    std::string const directory  = ASSET_TEST_DIR;
+    std::string const objectFile = directory + "/objects.xml";
+    {
+        AssetDatabase database(vfs.get(), directory);
+        database.compileDirectory();
+        REQUIRE(database.save());
+    }
+
+    // same size and time: the file is not read, so the edit goes unnoticed
+    writeFile(objectPath, "<assets><object id=\"bush\" namespace=\"test\"/></assets>");
+    std::filesystem::last_write_time(objectPath, written);
+    {
+        auto database = AssetDatabase::open(vfs.get(), directory);
+        REQUIRE(database != nullptr);
+        CHECK(*database->get(objectFile)->objects[0].id == "tree");
+        CHECK(database->getHitCount() == 1);
+    }
+
+    // a touched file with the old content is hashed, still a hit, and its new stamp is stored
+    writeFile(objectPath, "<assets><object id=\"tree\" namespace=\"test\"/></assets>");
+    std::filesystem::last_write_time(objectPath, written + std::chrono::hours(1));
+    {
+        auto database = AssetDatabase::open(vfs.get(), directory);
+        REQUIRE(database != nullptr);
+        CHECK(*database->get(objectFile)->objects[0].id == "tree");
+        CHECK(database->getHitCount() == 1);
+        CHECK(database->getCompileCount() == 0);
+        REQUIRE(database->save());
+    }
+    writeFile(objectPath, "<assets><object id=\"bush\" namespace=\"test\"/></assets>");
+    std::filesystem::last_write_time(objectPath, written + std::chrono::hours(1));
+    {
+        auto database = AssetDatabase::open(vfs.get(), directory);
+        REQUIRE(database != nullptr);
+        CHECK(*database->get(objectFile)->objects[0].id == "tree");
+    }
+
+    // any other time is read again
+    std::filesystem::last_write_time(objectPath, written + std::chrono::hours(2));
+    {
+        auto database = AssetDatabase::open(vfs.get(), directory);
+        REQUIRE(database != nullptr);
+        CHECK(*database->get(objectFile)->objects[0].id == "bush");
+        CHECK(database->getCompileCount() == 1);
+    }
+
+    std::filesystem::remove_all(test_dir, ec);
+}
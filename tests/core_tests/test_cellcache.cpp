@@ -0,0 +1,330 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Standard C++ library includes
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+// 3rd party library includes
+#include <catch2/catch_test_macros.hpp>
+
+// FIFE includes
+#include "model/metamodel/grids/squaregrid.h"
+#include "model/metamodel/modelcoords.h"
+#include "model/metamodel/object.h"
+#include "model/structures/cell.h"
+#include "model/structures/cellcache.h"
+#include "model/structures/instance.h"
+#include "model/structures/layer.h"
+#include "util/base/exception.h"
+#include "util/structures/rect.h"
+#include "util/time/timemanager.h"
+
+using FIFE::Cell;
+using FIFE::CellCache;
+using FIFE::CellChangeListener;
+using FIFE::CellDeleteListener;
+using FIFE::CellNeighbors;
+using FIFE::CellTypeInfo;
+using FIFE::Instance;
+using FIFE::Layer;
+using FIFE::ModelCoordinate;
+using FIFE::Object;
+using FIFE::Rect;
+using FIFE::SquareGrid;
+using FIFE::TimeManager;
+
+namespace
+{
+
+    struct CellCacheFixture
+    {
+            TimeManager tm;
+            SquareGrid grid;
+            std::unique_ptr<Layer> layer;
+            std::unique_ptr<Object> ground;
+            std::unique_ptr<Object> tree;
+
+            explicit CellCacheFixture(int32_t size)
+            {
+                layer  = std::make_unique<Layer>("test_layer", nullptr, &grid);
+                layer->setPathingStrategy(FIFE::CELL_EDGES_AND_DIAGONALS);
+                ground = std::make_unique<Object>("ground", "test");
+                tree   = std::make_unique<Object>("tree", "test");
+                tree->setBlocking(true);
+                tree->setStatic(true);
+                for (int32_t y = 0; y < size; ++y) {
+                    for (int32_t x = 0; x < size; ++x) {
+                        layer->createInstance(ground.get(), ModelCoordinate(x, y, 0));
+                    }
+                }
+                layer->setWalkable(true);
+            }
+
+            CellCache* createCache()
+            {
+                layer->createCellCache();
+                layer->getCellCache()->createCells();
+                return layer->getCellCache();
+            }
+
+            ~CellCacheFixture()                                   = default;
+            CellCacheFixture(CellCacheFixture const &)            = delete;
+            CellCacheFixture& operator=(CellCacheFixture const &) = delete;
+            CellCacheFixture(CellCacheFixture&&)                  = delete;
+            CellCacheFixture& operator=(CellCacheFixture&&)       = delete;
+    };
+
+    class CountingListener : public CellChangeListener, public CellDeleteListener
+    {
+        public:
+            void onInstanceEnteredCell(Cell* /*cell*/, Instance* /*instance*/) override
+            {
+                ++entered;
+            }
+            void onInstanceExitedCell(Cell* /*cell*/, Instance* /*instance*/) override
+            {
+                ++exited;
+            }
+            void onBlockingChangedCell(Cell* /*cell*/, CellTypeInfo /*type*/, bool /*blocks*/) override
+            {
+            }
+            void onCellDeleted(Cell* /*cell*/) override
+            {
+                ++deleted;
+            }
+
+            int32_t entered = 0;
+            int32_t exited  = 0;
+            int32_t deleted = 0;
+    };
+
+} // namespace
+
+TEST_CASE("CellCache computes neighbors from the grid", "[core][cellcache]")
+{
+    CellCacheFixture f(8);
+    CellCache* cache = f.createCache();
+
+    Cell* center = cache->getCell(ModelCoordinate(3, 3));
+    REQUIRE(center != nullptr);
+    CellNeighbors const neighbors = center->getNeighbors();
+    CHECK(neighbors.size() == 8);
+    CHECK(center->isNeighbor(cache->getCell(ModelCoordinate(4, 4))));
+    CHECK(!center->isNeighbor(cache->getCell(ModelCoordinate(5, 3))));
+
+    // cells at the border only see the cells inside the cache
+    CHECK(cache->getCell(ModelCoordinate(0, 0))->getNeighbors().size() == 3);
+    CHECK(cache->getCell(ModelCoordinate(7, 3))->getNeighbors().size() == 5);
+}
+
+TEST_CASE("CellCache neighbors follow the pathing strategy", "[core][cellcache]")
+{
+    CellCacheFixture f(8);
+    f.layer->setPathingStrategy(FIFE::CELL_EDGES_ONLY);
+    CellCache* cache = f.createCache();
+
+    Cell* center = cache->getCell(ModelCoordinate(3, 3));
+    REQUIRE(center != nullptr);
+    CHECK(center->getNeighbors().size() == 4);
+    CHECK(!center->isNeighbor(cache->getCell(ModelCoordinate(4, 4))));
+}
+
+TEST_CASE("Cell keeps additional instances outside of the cell", "[core][cellcache]")
+{
+    CellCacheFixture f(4);
+    CellCache* cache = f.createCache();
+
+    Cell* cell = cache->getCell(ModelCoordinate(1, 1));
+    REQUIRE(cell != nullptr);
+    CHECK(cell->getInstanceCount() == 1);
+    CHECK(cell->getCellType() == FIFE::CTYPE_NO_BLOCKER);
+
+    Instance* first  = f.layer->createInstance(f.tree.get(), ModelCoordinate(1, 1, 0));
+    Instance* second = f.layer->createInstance(f.tree.get(), ModelCoordinate(1, 1, 0));
+    f.layer->update();
+    CHECK(cell->getInstanceCount() == 3);
+    std::span<Instance* const> const instances = cell->getInstances();
+    CHECK(instances.size() == 3);
+    CHECK(std::ranges::find(instances, first) != instances.end());
+    CHECK(std::ranges::find(instances, second) != instances.end());
+    CHECK(std::ranges::is_sorted(instances));
+    CHECK(cell->getCellType() == FIFE::CTYPE_STATIC_BLOCKER);
+
+    f.layer->deleteInstance(first);
+    f.layer->deleteInstance(second);
+    f.layer->update();
+    CHECK(cell->getInstanceCount() == 1);
+    CHECK(cell->getCellType() == FIFE::CTYPE_NO_BLOCKER);
+}
+
+TEST_CASE("Cell listeners and transitions live in the side table", "[core][cellcache]")
+{
+    CellCacheFixture f(8);
+    CellCache* cache = f.createCache();
+    std::size_t const plainUsage = cache->getMemoryUsage();
+
+    CountingListener listener;
+    Cell* cell = cache->getCell(ModelCoordinate(2, 2));
+    cell->addChangeListener(&listener);
+    Instance* instance = f.layer->createInstance(f.ground.get(), ModelCoordinate(2, 2, 0));
+    f.layer->update();
+    CHECK(listener.entered == 1);
+    CHECK(cache->getMemoryUsage() > plainUsage);
+
+    // a portal to a far cell adds the target to the neighbors
+    Cell* target = cache->getCell(ModelCoordinate(6, 6));
+    cell->createTransition(f.layer.get(), ModelCoordinate(6, 6));
+    REQUIRE(cell->getTransition() != nullptr);
+    CHECK(cell->isNeighbor(target));
+    CHECK(cell->getNeighbors().size() == 9);
+
+    target->addDeleteListener(&listener);
+    cache->setSize(Rect(0, 0, 5, 5));
+    CHECK(listener.deleted == 1);
+    CHECK(cell->getTransition() == nullptr);
+    CHECK(cell->getNeighbors().size() == 8);
+
+    cell->removeChangeListener(&listener);
+    f.layer->deleteInstance(instance);
+    f.layer->update();
+    CHECK(listener.exited == 0);
+}
+
+TEST_CASE("CellCache keeps cells in place when it grows", "[core][cellcache]")
+{
+    CellCacheFixture f(20);
+    CellCache* cache = f.createCache();
+
+    std::vector<Cell*> cells;
+    for (int32_t y = 0; y < 20; ++y) {
+        for (int32_t x = 0; x < 20; ++x) {
+            cells.push_back(cache->getCell(ModelCoordinate(x, y)));
+        }
+    }
+
+    cache->setSize(Rect(-17, -3, 40, 19));
+    CHECK(cache->getWidth() == 58);
+    CHECK(cache->getCell(ModelCoordinate(-17, -3)) != nullptr);
+    CHECK(cache->getCell(ModelCoordinate(40, 19)) != nullptr);
+    for (int32_t y = 0; y < 20; ++y) {
+        for (int32_t x = 0; x < 20; ++x) {
+            Cell* cell = cache->getCell(ModelCoordinate(x, y));
+            CHECK(cell == cells[static_cast<std::size_t>((y * 20) + x)]);
+            CHECK(cell->getCellId() == cache->convertCoordToInt(ModelCoordinate(x, y)));
+        }
+    }
+    CHECK(cache->getCell(ModelCoordinate(-1, 0))->getNeighbors().size() == 8);
+
+    cache->setSize(Rect(5, 5, 9, 9));
+    CHECK(cache->getCell(ModelCoordinate(4, 4)) == nullptr);
+    CHECK(cache->getCell(ModelCoordinate(7, 7)) == cells[(7 * 20) + 7]);
+}
+
+TEST_CASE("CellCache stores a plain cell in about its own size", "[core][cellcache]")
+{
+    CellCacheFixture f(64);
+    CellCache* cache = f.createCache();
+
+    std::size_t const cells = 64 * 64;
+    CHECK(cache->getMemoryUsage() / cells < 64);
+}
+
+TEST_CASE("CellCache keeps cell ids while it grows step by step", "[core][cellcache]")
+{
+    CellCacheFixture f(4);
+    CellCache* cache = f.createCache();
+
+    Cell* origin        = cache->getCell(ModelCoordinate(0, 0));
+    Cell* corner        = cache->getCell(ModelCoordinate(3, 3));
+    int32_t const first = origin->getCellId();
+    int32_t const last  = corner->getCellId();
+    for (int32_t x = 4; x < 400; ++x) {
+        f.layer->createInstance(f.ground.get(), ModelCoordinate(x, x / 4, 0));
+        REQUIRE(origin->getCellId() == first);
+        REQUIRE(corner->getCellId() == last);
+    }
+    CHECK(cache->getWidth() == 400);
+    CHECK(cache->getHeight() == 100);
+    CHECK(cache->getCell(ModelCoordinate(0, 0)) == origin);
+    // one id per slot of the created chunks, independent of the capacity
+    CHECK(cache->getMaxIndex() == 25 * 7 * 256);
+
+    for (ModelCoordinate const mc : {ModelCoordinate(0, 0), ModelCoordinate(399, 99), ModelCoordinate(17, 63)}) {
+        Cell const * cell = cache->getCell(mc);
+        REQUIRE(cell != nullptr);
+        CHECK(cell->getCellId() < cache->getMaxIndex());
+        CHECK(cache->convertIntToCoord(cell->getCellId()) == mc);
+    }
+    CHECK(cache->convertCoordToInt(ModelCoordinate(400, 0)) == -1);
+
+    // shrinking drops chunks, new chunks reuse their numbers
+    int32_t const maxIndex = cache->getMaxIndex();
+    cache->setSize(Rect(0, 0, 15, 15));
+    CHECK(origin->getCellId() == first);
+    cache->setSize(Rect(-64, -64, 15, 15));
+    CHECK(cache->getMaxIndex() == maxIndex);
+    Cell const * cell = cache->getCell(ModelCoordinate(-64, -64));
+    REQUIRE(cell != nullptr);
+    CHECK(cache->convertIntToCoord(cell->getCellId()) == ModelCoordinate(-64, -64));
+}
+
+TEST_CASE("CellCache defers blocking and zones during a bulk edit", "[core][cellcache]")
+{
+    CellCacheFixture f(8);
+    CellCache* cache = f.createCache();
+    REQUIRE(cache->getZones().size() == 1);
+
+    cache->beginBulkEdit();
+    cache->beginBulkEdit();
+    for (int32_t y = 0; y < 8; ++y) {
+        f.layer->createInstance(f.tree.get(), ModelCoordinate(4, y, 0));
+    }
+    Cell* wall = cache->getCell(ModelCoordinate(4, 3));
+    CHECK(wall->getInstanceCount() == 2);
+    CHECK(wall->getCellType() == FIFE::CTYPE_NO_BLOCKER);
+    cache->endBulkEdit();
+    CHECK(cache->isBulkEdit());
+    CHECK(wall->getCellType() == FIFE::CTYPE_NO_BLOCKER);
+    CHECK(cache->getZones().size() == 1);
+
+    cache->endBulkEdit();
+    CHECK(!cache->isBulkEdit());
+    CHECK(wall->getCellType() == FIFE::CTYPE_STATIC_BLOCKER);
+    REQUIRE(cache->getZones().size() == 2);
+    CHECK(cache->getCell(ModelCoordinate(0, 0))->getZone() != cache->getCell(ModelCoordinate(7, 7))->getZone());
+    CHECK(wall->getZone() == nullptr);
+}
+
+TEST_CASE("CellCache writes cell types and costs of a rect", "[core][cellcache]")
+{
+    CellCacheFixture f(8);
+    f.layer->createInstance(f.tree.get(), ModelCoordinate(2, 1, 0));
+    CellCache* cache = f.createCache();
+    cache->setDefaultCostMultiplier(2.0);
+    cache->getCell(ModelCoordinate(0, 0))->setCostMultiplier(3.0);
+    cache->registerCost("road", 0.5);
+    cache->addCellToCost("road", cache->getCell(ModelCoordinate(1, 0)));
+
+    // a 3x2 rect that reaches over the left border
+    Rect const rec(-1, 0, 3, 2);
+    std::vector<CellTypeInfo> types(6);
+    cache->getCellTypes(rec, types);
+    CHECK(types == std::vector<CellTypeInfo>{FIFE::CTYPE_CELL_BLOCKER, FIFE::CTYPE_NO_BLOCKER, FIFE::CTYPE_NO_BLOCKER,
+                                             FIFE::CTYPE_CELL_BLOCKER, FIFE::CTYPE_NO_BLOCKER, FIFE::CTYPE_NO_BLOCKER});
+    std::vector<CellTypeInfo> blocked(1);
+    cache->getCellTypes(Rect(2, 1, 1, 1), blocked);
+    CHECK(blocked.front() == FIFE::CTYPE_STATIC_BLOCKER);
+
+    std::vector<double> costs(6);
+    cache->getCostGrid(rec, costs);
+    CHECK(costs == std::vector<double>{-1.0, 3.0, 2.0, -1.0, 2.0, 2.0});
+    cache->getCostGrid(rec, costs, "road");
+    CHECK(costs == std::vector<double>{-1.0, 3.0, 0.5, -1.0, 2.0, 2.0});
+
+    std::vector<double> wrong(5);
+    CHECK_THROWS_AS(cache->getCostGrid(rec, wrong), FIFE::IndexOverflow);
+}
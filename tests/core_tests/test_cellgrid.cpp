@@ -0,0 +1,262 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Standard C++ library includes
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+// 3rd party library includes
+#include <catch2/catch_test_macros.hpp>
+
+// FIFE includes
+#include "model/metamodel/grids/hexgrid.h"
+#include "model/metamodel/grids/squaregrid.h"
+#include "model/metamodel/modelcoords.h"
+#include "model/metamodel/object.h"
+#include "model/structures/instance.h"
+#include "model/structures/layer.h"
+#include "model/structures/location.h"
+#include "util/time/timemanager.h"
+
+using FIFE::CellGrid;
+using FIFE::ExactModelCoordinate;
+using FIFE::HexGrid;
+using FIFE::Layer;
+using FIFE::Location;
+using FIFE::ModelCoordinate;
+using FIFE::Object;
+using FIFE::SquareGrid;
+using FIFE::TimeManager;
+
+namespace
+{
+    struct Points
+    {
+            std::vector<double> x;
+            std::vector<double> y;
+            std::vector<double> z;
+    };
+
+    Points randomPoints(size_t count, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> coord(-500.0, 500.0);
+        Points points;
+        for (size_t i = 0; i < count; ++i) {
+            points.x.push_back(coord(rng));
+            points.y.push_back(coord(rng));
+            points.z.push_back(coord(rng) / 100.0);
+        }
+        return points;
+    }
+
+    void transformGrid(CellGrid& grid)
+    {
+        grid.setRotation(30.0);
+        grid.setXScale(2.0);
+        grid.setYScale(1.5);
+        grid.setXShift(10.0);
+        grid.setYShift(-4.0);
+        grid.setZShift(1.0);
+    }
+
+    // places an instance at every point
+    void fillLayer(Layer& layer, Object& object, Points const & points)
+    {
+        for (size_t i = 0; i < points.x.size(); ++i) {
+            layer.createInstance(&object, ExactModelCoordinate(points.x[i], points.y[i], points.z[i]));
+        }
+    }
+
+    // the bounds of the instance cells, one location after the other
+    void minMaxOneByOne(Layer const & layer, ModelCoordinate& min, ModelCoordinate& max)
+    {
+        min = layer.getInstances().front()->getLocationRef().getLayerCoordinates();
+        max = min;
+        for (FIFE::Instance* instance : layer.getInstances()) {
+            ModelCoordinate const coord = instance->getLocationRef().getLayerCoordinates();
+            min.x                       = std::min(min.x, coord.x);
+            max.x                       = std::max(max.x, coord.x);
+            min.y                       = std::min(min.y, coord.y);
+            max.y                       = std::max(max.y, coord.y);
+        }
+    }
+
+    bool near(double a, double b)
+    {
+        return std::abs(a - b) < 1e-9;
+    }
+
+    // compares the batch transforms of the grid with one call per point
+    void checkBatch(CellGrid& grid)
+    {
+        Points const layer = randomPoints(1000, 3);
+
+        Points map = layer;
+        grid.toMapCoordinates(map.x, map.y, map.z);
+        Points exact = map;
+        grid.toExactLayerCoordinates(exact.x, exact.y, exact.z);
+        std::vector<ModelCoordinate> cells(layer.x.size());
+        grid.toLayerCoordinatesFromExactLayerCoordinates(layer.x, layer.y, layer.z, cells);
+
+        for (size_t i = 0; i < layer.x.size(); ++i) {
+            ExactModelCoordinate const pt(layer.x[i], layer.y[i], layer.z[i]);
+            ExactModelCoordinate const mapPt = grid.toMapCoordinates(pt);
+            CHECK(near(map.x[i], mapPt.x));
+            CHECK(near(map.y[i], mapPt.y));
+            CHECK(near(map.z[i], mapPt.z));
+            ExactModelCoordinate const exactPt = grid.toExactLayerCoordinates(mapPt);
+            CHECK(near(exact.x[i], exactPt.x));
+            CHECK(near(exact.y[i], exactPt.y));
+            CHECK(near(exact.z[i], exactPt.z));
+            CHECK(cells[i] == grid.toLayerCoordinatesFromExactLayerCoordinates(pt));
+        }
+    }
+} // namespace
+
+TEST_CASE("CellGrid batch transforms match the single point transforms", "[core][cellgrid]")
+{
+    SECTION("square grid")
+    {
+        SquareGrid grid;
+        transformGrid(grid);
+        checkBatch(grid);
+    }
+    SECTION("hex grid")
+    {
+        HexGrid grid;
+        transformGrid(grid);
+        checkBatch(grid);
+    }
+    SECTION("axial hex grid")
+    {
+        HexGrid grid(true);
+        transformGrid(grid);
+        checkBatch(grid);
+    }
+}
+
+TEST_CASE("CellGrid revision changes with the transformation", "[core][cellgrid]")
+{
+    SquareGrid grid;
+    SquareGrid other;
+    uint64_t const revision = grid.getRevision();
+    CHECK(revision != 0);
+    CHECK(revision != other.getRevision());
+    grid.setXScale(2.0);
+    CHECK(grid.getRevision() != revision);
+}
+
+TEST_CASE("Location keeps its cell coordinates up to date", "[core][cellgrid]")
+{
+    TimeManager tm;
+    SquareGrid grid;
+    Layer layer("test_layer", nullptr, &grid);
+    Location location(&layer);
+
+    location.setExactLayerCoordinates(ExactModelCoordinate(2.4, 3.6, 0.0));
+    CHECK(location.getLayerCoordinates() == ModelCoordinate(2, 4, 0));
+
+    // changes through the reference are seen
+    location.getExactLayerCoordinatesRef().x += 1.0;
+    CHECK(location.getLayerCoordinates() == ModelCoordinate(3, 4, 0));
+
+    Location const copy = location;
+    CHECK(copy.getLayerCoordinates() == ModelCoordinate(3, 4, 0));
+
+    // so are changes of the grid
+    location.setExactLayerCoordinates(ExactModelCoordinate(2.4, 3.6, 0.0));
+    grid.setXScale(2.0);
+    CHECK(location.getLayerCoordinates() == grid.toLayerCoordinatesFromExactLayerCoordinates(
+                                                ExactModelCoordinate(2.4, 3.6, 0.0)));
+
+    location.setMapCoordinates(ExactModelCoordinate(8.2, -1.0, 0.0));
+    CHECK(location.getLayerCoordinates() == ModelCoordinate(4, -1, 0));
+
+    // a location is only its layer and its exact coordinates
+    STATIC_CHECK(sizeof(Location) == sizeof(Layer*) + sizeof(ExactModelCoordinate));
+}
+
+TEST_CASE("CellGrid batch transform throughput", "[cellgrid][.benchmark]")
+{
+    TimeManager tm;
+    HexGrid grid;
+    transformGrid(grid);
+    Layer layer("test_layer", nullptr, &grid);
+    Points points = randomPoints(1000000, 5);
+    std::vector<Location> locations(points.x.size(), Location(&layer));
+    for (size_t i = 0; i < points.x.size(); ++i) {
+        locations[i].setExactLayerCoordinates(ExactModelCoordinate(points.x[i], points.y[i], points.z[i]));
+    }
+
+    // as the layer cache did for every instance
+    using Clock                = std::chrono::steady_clock;
+    Clock::time_point const t0 = Clock::now();
+    double sum                 = 0.0;
+    for (Location const & location : locations) {
+        sum += location.getMapCoordinates().x;
+    }
+    Clock::time_point const t1 = Clock::now();
+    grid.toMapCoordinates(points.x, points.y, points.z);
+    Clock::time_point const t2 = Clock::now();
+
+    double const single = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    double const batch  = std::chrono::duration<double, std::milli>(t2 - t1).count();
+    std::cout << "CellGrid: " << points.x.size() << " points, " << single << " ms one by one, " << batch
+              << " ms in a batch\n";
+    CHECK(std::isfinite(sum));
+}
+
+TEST_CASE("Layer bounds of the instances match the single point transforms", "[core][cellgrid]")
+{
+    TimeManager tm;
+    HexGrid grid;
+    transformGrid(grid);
+    Layer layer("test_layer", nullptr, &grid);
+    Object object("object", "test");
+    fillLayer(layer, object, randomPoints(1000, 7));
+
+    ModelCoordinate min;
+    ModelCoordinate max;
+    layer.getMinMaxCoordinates(min, max);
+    ModelCoordinate expectedMin;
+    ModelCoordinate expectedMax;
+    minMaxOneByOne(layer, expectedMin, expectedMax);
+    CHECK(min == expectedMin);
+    CHECK(max == expectedMax);
+}
+
+TEST_CASE("Layer bounds throughput", "[cellgrid][.benchmark]")
+{
+    TimeManager tm;
+    SquareGrid grid;
+    transformGrid(grid);
+    Layer layer("test_layer", nullptr, &grid);
+    Object object("object", "test");
+    fillLayer(layer, object, randomPoints(200000, 11));
+
+    // as the cell cache did to find its size, with a cell lookup per instance
+    using Clock                = std::chrono::steady_clock;
+    Clock::time_point const t0 = Clock::now();
+    ModelCoordinate singleMin;
+    ModelCoordinate singleMax;
+    minMaxOneByOne(layer, singleMin, singleMax);
+    Clock::time_point const t1 = Clock::now();
+    ModelCoordinate batchMin;
+    ModelCoordinate batchMax;
+    layer.getMinMaxCoordinates(batchMin, batchMax);
+    Clock::time_point const t2 = Clock::now();
+
+    double const single = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    double const batch  = std::chrono::duration<double, std::milli>(t2 - t1).count();
+    std::cout << "Layer: " << layer.getInstances().size() << " instances, " << single << " ms one by one, " << batch
+              << " ms in a batch\n";
+    CHECK(batchMin == singleMin);
+    CHECK(batchMax == singleMax);
+}
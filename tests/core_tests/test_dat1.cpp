@@ -3,10 +3,14 @@
 
 // Standard C++ library includes
 #include <algorithm>
+#include <array>
+#include <chrono>
 #include <cstdint>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <random>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -19,18 +23,151 @@
 #include "util/base/exception.h"
 #include "vfs/dat/dat1.h"
 #include "vfs/dat/dat2.h"
+#include "vfs/dat/lzssdecoder.h"
 #include "vfs/raw/rawdata.h"
+#include "vfs/raw/rawdatamemsource.h"
 #include "vfs/vfs.h"
 #include "vfs/vfsdirectory.h"
 
 using FIFE::DAT1;
+using FIFE::LZSSDecoder;
 using FIFE::RawData;
+using FIFE::RawDataMemSource;
 using FIFE::VFS;
 using FIFE::VFSDirectory;
 
 static char const * const COMPRESSED_FILE = "tests/data/dat1vfstest.dat";
 static char const * const RAW_FILE        = "tests/data/test.map";
 
+namespace
+{
+
+    void appendBlockHeader(std::vector<uint8_t>& stream, int32_t n)
+    {
+        auto const header = static_cast<uint16_t>(static_cast<int16_t>(n));
+        stream.push_back(static_cast<uint8_t>(header >> 8));
+        stream.push_back(static_cast<uint8_t>(header & 0xff));
+    }
+
+    /** Generates a stream of raw blocks and LZSS blocks with random literals and matches.
+     * The matches use random dictionary positions, so they also reach into the initial dictionary.
+     */
+    std::vector<uint8_t> generateLZSS(uint32_t outputSize, uint32_t seed)
+    {
+        std::mt19937 random(seed);
+        auto const next = [&random](uint32_t bound) {
+            return static_cast<uint32_t>(random() % bound);
+        };
+        std::vector<uint8_t> stream;
+        std::vector<uint8_t> block;
+        uint32_t produced = 0;
+        uint32_t blocks   = 0;
+        while (produced < outputSize) {
+            if (++blocks % 5 == 0) {
+                uint32_t const rawSize = std::min(outputSize - produced, 1 + next(1000));
+                appendBlockHeader(stream, -static_cast<int32_t>(rawSize));
+                for (uint32_t i = 0; i < rawSize; ++i) {
+                    stream.push_back(static_cast<uint8_t>('a' + next(26)));
+                }
+                produced += rawSize;
+                continue;
+            }
+            block.clear();
+            while (produced < outputSize && block.size() < 4000) {
+                size_t const flagIndex = block.size();
+                block.push_back(0);
+                for (uint32_t bit = 0; bit < 8 && produced < outputSize; ++bit) {
+                    uint32_t const length = 3 + next(16);
+                    if (next(4) == 0 || outputSize - produced < length) {
+                        block[flagIndex] |= static_cast<uint8_t>(1 << bit);
+                        block.push_back(static_cast<uint8_t>('a' + next(26)));
+                        ++produced;
+                    } else {
+                        uint32_t const offset = next(4096);
+                        block.push_back(static_cast<uint8_t>(offset & 0xff));
+                        block.push_back(static_cast<uint8_t>(((offset >> 4) & 0xf0) | (length - 3)));
+                        produced += length;
+                    }
+                }
+            }
+            appendBlockHeader(stream, static_cast<int32_t>(block.size()));
+            stream.insert(stream.end(), block.begin(), block.end());
+        }
+        appendBlockHeader(stream, 0);
+        return stream;
+    }
+
+    /** Decodes a stream with a 4096 byte ring buffer, like the original Fallout decoder.
+     */
+    std::vector<uint8_t> referenceDecode(std::vector<uint8_t> const & stream, uint32_t outputSize)
+    {
+        std::vector<uint8_t> out;
+        size_t pos = 0;
+        while (out.size() < outputSize) {
+            auto const n = static_cast<int16_t>((stream[pos] << 8) | stream[pos + 1]);
+            pos += 2;
+            if (n == 0) {
+                break;
+            }
+            if (n < 0) {
+                out.insert(out.end(), stream.begin() + static_cast<ptrdiff_t>(pos),
+                    stream.begin() + static_cast<ptrdiff_t>(pos) - n);
+                pos += static_cast<size_t>(-n);
+                continue;
+            }
+            size_t const end = pos + static_cast<size_t>(n);
+            auto const at    = [&](size_t i) -> uint32_t {
+                return i < end ? stream[i] : 0;
+            };
+            std::array<uint8_t, 4096> ring{};
+            std::fill_n(ring.begin(), 4078, ' ');
+            uint32_t r     = 4078;
+            uint32_t flags = 0;
+            while (pos < end) {
+                flags >>= 1;
+                if ((flags & 256) == 0) {
+                    flags = at(pos++) | 0xff00;
+                }
+                if ((flags & 1) != 0) {
+                    uint8_t const c = static_cast<uint8_t>(at(pos++));
+                    out.push_back(c);
+                    ring[r] = c;
+                    r       = (r + 1) & 4095;
+                } else {
+                    uint32_t const i = at(pos) | ((at(pos + 1) & 0xf0) << 4);
+                    uint32_t const j = (at(pos + 1) & 0x0f) + 2;
+                    pos += 2;
+                    for (uint32_t k = 0; k <= j; ++k) {
+                        uint8_t const c = ring[(i + k) & 4095];
+                        out.push_back(c);
+                        ring[r] = c;
+                        r       = (r + 1) & 4095;
+                    }
+                }
+            }
+            pos = end;
+        }
+        return out;
+    }
+
+    std::unique_ptr<RawData> toRawData(std::vector<uint8_t> const & bytes)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+        auto* source = new RawDataMemSource(static_cast<uint32_t>(bytes.size()));
+        std::ranges::copy(bytes, source->getRawData());
+        return std::make_unique<RawData>(source);
+    }
+
+    std::vector<uint8_t> readAll(RawData& data)
+    {
+        std::vector<uint8_t> bytes(data.getDataLength());
+        data.setIndex(0);
+        data.readInto(bytes.data(), bytes.size());
+        return bytes;
+    }
+
+} // namespace
+
 TEST_CASE("DAT1::open decompresses stored entry correctly", "[dat1][vfs]")
 {
 
@@ -67,3 +204,77 @@ TEST_CASE("DAT1::open decompresses stored entry correctly", "[dat1][vfs]")
     }
     // std::cout << "scanning finished" << '\n';
 }
+
+TEST_CASE("DAT1::open decodes LZSS entries on demand", "[dat1][vfs]")
+{
+    std::shared_ptr<VFS> const vfs = std::make_shared<VFS>();
+    vfs->addSource(std::make_unique<VFSDirectory>(vfs.get()));
+    vfs->addSource(std::make_unique<DAT1>(vfs.get(), COMPRESSED_FILE));
+
+    auto fraw                        = vfs->open(RAW_FILE);
+    std::vector<uint8_t> const bytes = readAll(*fraw);
+
+    // a prefix, a range in the middle and then the whole entry
+    auto fcomp = vfs->open("dat1vfstest.map");
+    REQUIRE(fcomp->getDataLength() == bytes.size());
+    std::vector<uint8_t> prefix(16);
+    fcomp->readInto(prefix.data(), prefix.size());
+    CHECK(std::ranges::equal(prefix, std::span(bytes).first(16)));
+    fcomp->setIndex(400000);
+    fcomp->readInto(prefix.data(), prefix.size());
+    CHECK(std::ranges::equal(prefix, std::span(bytes).subspan(400000, 16)));
+    CHECK(readAll(*fcomp) == bytes);
+
+    auto fstored = vfs->open("test.map");
+    CHECK(readAll(*fstored) == bytes);
+}
+
+TEST_CASE("LZSSDecoder matches the ring buffer decoder", "[dat1][vfs]")
+{
+    for (uint32_t seed = 1; seed <= 8; ++seed) {
+        uint32_t const size                    = 1000 + (seed * 37000);
+        std::vector<uint8_t> const stream      = generateLZSS(size, seed);
+        std::vector<uint8_t> const referenced  = referenceDecode(stream, size);
+        std::unique_ptr<RawData> const input   = toRawData(stream);
+        std::vector<uint8_t> decoded(size);
+        LZSSDecoder decoder;
+        decoder.decode(input.get(), decoded.data(), size);
+        CHECK(decoded == referenced);
+
+        // decoding in steps stops after the block with the requested byte
+        input->setIndex(0);
+        std::vector<uint8_t> stepped(size);
+        decoder.begin(stepped.data(), size);
+        uint32_t const first = decoder.decodeUntil(input.get(), 1);
+        CHECK(first >= 1);
+        CHECK(first < size);
+        CHECK(decoder.decodeUntil(input.get(), size) == size);
+        CHECK(stepped == referenced);
+    }
+}
+
+TEST_CASE("LZSSDecoder rejects streams that exceed the output", "[dat1][vfs]")
+{
+    std::vector<uint8_t> const stream    = generateLZSS(5000, 42);
+    std::unique_ptr<RawData> const input = toRawData(stream);
+    std::vector<uint8_t> decoded(4000);
+    LZSSDecoder decoder;
+    CHECK_THROWS_AS(decoder.decode(input.get(), decoded.data(), 4000), FIFE::InvalidFormat);
+}
+
+TEST_CASE("LZSSDecoder throughput", "[dat1][vfs][.benchmark]")
+{
+    uint32_t const size                  = 64 * 1024 * 1024;
+    std::vector<uint8_t> const stream    = generateLZSS(size, 7);
+    std::unique_ptr<RawData> const input = toRawData(stream);
+    std::vector<uint8_t> decoded(size);
+    LZSSDecoder decoder;
+
+    using Clock                  = std::chrono::steady_clock;
+    Clock::time_point const t0   = Clock::now();
+    decoder.decode(input.get(), decoded.data(), size);
+    double const seconds         = std::chrono::duration<double>(Clock::now() - t0).count();
+    std::cout << "LZSS: " << stream.size() << " -> " << size << " bytes in " << seconds * 1000.0 << " ms, "
+              << (static_cast<double>(size) / (1024.0 * 1024.0)) / seconds << " MiB/s\n";
+    CHECK(decoded == referenceDecode(stream, size));
+}
@@ -0,0 +1,234 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Standard C++ library includes
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// 3rd party library includes
+#include <SDL3/SDL.h>
+#include <catch2/catch_test_macros.hpp>
+
+// FIFE includes
+#include "eventchannel/eventmanager.h"
+#include "eventchannel/eventrecording.h"
+#include "eventchannel/mouse/imouselistener.h"
+#include "eventchannel/mouse/mouseevent.h"
+#include "eventchannel/sdl/isdleventlistener.h"
+#include "util/time/timemanager.h"
+
+using FIFE::EventManager;
+using FIFE::EventRecording;
+using FIFE::IMouseListener;
+using FIFE::ISdlEventListener;
+using FIFE::MouseEvent;
+using FIFE::TimeManager;
+
+namespace
+{
+
+    SDL_Event motionEvent(float x, float y, float xrel, float yrel)
+    {
+        SDL_Event event;
+        std::memset(&event, 0, sizeof(event));
+        event.type        = SDL_EVENT_MOUSE_MOTION;
+        event.motion.x    = x;
+        event.motion.y    = y;
+        event.motion.xrel = xrel;
+        event.motion.yrel = yrel;
+        return event;
+    }
+
+    SDL_Event wheelEvent(float y)
+    {
+        SDL_Event event;
+        std::memset(&event, 0, sizeof(event));
+        event.type    = SDL_EVENT_MOUSE_WHEEL;
+        event.wheel.y = y;
+        return event;
+    }
+
+    SDL_Event keyEvent(SDL_Keycode key)
+    {
+        SDL_Event event;
+        std::memset(&event, 0, sizeof(event));
+        event.type    = SDL_EVENT_KEY_DOWN;
+        event.key.key = key;
+        return event;
+    }
+
+    class CountingMouseListener : public IMouseListener
+    {
+        public:
+            void mouseEntered(MouseEvent& /*evt*/) override
+            {
+            }
+            void mouseExited(MouseEvent& /*evt*/) override
+            {
+            }
+            void mousePressed(MouseEvent& /*evt*/) override
+            {
+            }
+            void mouseReleased(MouseEvent& /*evt*/) override
+            {
+            }
+            void mouseClicked(MouseEvent& /*evt*/) override
+            {
+            }
+            void mouseWheelMovedUp(MouseEvent& /*evt*/) override
+            {
+                ++wheelUp;
+            }
+            void mouseWheelMovedDown(MouseEvent& /*evt*/) override
+            {
+                ++wheelDown;
+            }
+            void mouseWheelMovedRight(MouseEvent& /*evt*/) override
+            {
+            }
+            void mouseWheelMovedLeft(MouseEvent& /*evt*/) override
+            {
+            }
+            void mouseMoved(MouseEvent& evt) override
+            {
+                ++moved;
+                lastX = evt.getX();
+                if (manager != nullptr) {
+                    manager->removeMouseListener(removed);
+                    manager->addMouseListener(added);
+                }
+            }
+            void mouseDragged(MouseEvent& /*evt*/) override
+            {
+            }
+
+            int32_t moved     = 0;
+            int32_t wheelUp   = 0;
+            int32_t wheelDown = 0;
+            int32_t lastX     = 0;
+            // changes the listeners of the manager on mouse motion
+            EventManager* manager   = nullptr;
+            IMouseListener* removed = nullptr;
+            IMouseListener* added   = nullptr;
+    };
+
+    class MotionSumListener : public ISdlEventListener
+    {
+        public:
+            bool onSdlEvent(SDL_Event& evt) override
+            {
+                if (evt.type == SDL_EVENT_MOUSE_MOTION) {
+                    xrel += evt.motion.xrel;
+                    yrel += evt.motion.yrel;
+                }
+                return false;
+            }
+
+            float xrel = 0.0F;
+            float yrel = 0.0F;
+    };
+
+    // one frame with a key press between mouse motion and wheel events
+    EventRecording createFrame()
+    {
+        EventRecording recording;
+        recording.addFrame();
+        recording.addEvent(motionEvent(1, 1, 1, 1));
+        recording.addEvent(motionEvent(2, 2, 1, 1));
+        recording.addEvent(motionEvent(3, 3, 1, 1));
+        recording.addEvent(keyEvent(SDLK_A));
+        recording.addEvent(motionEvent(4, 4, 1, 1));
+        recording.addEvent(wheelEvent(1));
+        recording.addEvent(wheelEvent(1));
+        recording.addEvent(wheelEvent(-1));
+        recording.addEvent(motionEvent(5, 5, 1, 1));
+        return recording;
+    }
+
+    struct Dispatched
+    {
+            int32_t moved;
+            int32_t wheelUp;
+            int32_t wheelDown;
+            int32_t lastX;
+            float xrel;
+    };
+
+    Dispatched replay(uint8_t coalescing)
+    {
+        TimeManager tm;
+        EventRecording const recording = createFrame();
+        EventManager manager;
+        CountingMouseListener mouse;
+        MotionSumListener sdl;
+        manager.addMouseListener(&mouse);
+        manager.addSdlEventListener(&sdl);
+        manager.setEventCoalescing(coalescing);
+        manager.setReplay(&recording);
+        manager.processEvents();
+        return {mouse.moved, mouse.wheelUp, mouse.wheelDown, mouse.lastX, sdl.xrel};
+    }
+
+} // namespace
+
+TEST_CASE("EventManager merges mouse motion by default", "[core][eventmanager]")
+{
+    EventManager manager;
+    CHECK(manager.getEventCoalescing() == FIFE::COALESCE_MOUSE_MOTION);
+
+    Dispatched const dispatched = replay(FIFE::COALESCE_MOUSE_MOTION);
+    CHECK(dispatched.moved == 3);
+    CHECK(dispatched.wheelUp == 2);
+    CHECK(dispatched.wheelDown == 1);
+    CHECK(dispatched.lastX == 5);
+    CHECK(dispatched.xrel == 5.0F);
+}
+
+TEST_CASE("EventManager merges the configured kinds of events", "[core][eventmanager]")
+{
+    Dispatched const none = replay(FIFE::COALESCE_NONE);
+    CHECK(none.moved == 5);
+    CHECK(none.wheelUp == 2);
+    CHECK(none.wheelDown == 1);
+    CHECK(none.xrel == 5.0F);
+
+    // wheel moves in the same direction are merged, motion is not merged across the wheel
+    Dispatched const all = replay(FIFE::COALESCE_ALL);
+    CHECK(all.moved == 3);
+    CHECK(all.wheelUp == 1);
+    CHECK(all.wheelDown == 1);
+    CHECK(all.lastX == 5);
+    CHECK(all.xrel == 5.0F);
+}
+
+TEST_CASE("EventManager listeners can change during a dispatch", "[core][eventmanager]")
+{
+    EventRecording recording;
+    recording.addFrame();
+    recording.addEvent(motionEvent(1, 1, 1, 1));
+    recording.addFrame();
+    recording.addEvent(motionEvent(2, 2, 1, 1));
+
+    TimeManager tm;
+    EventManager manager;
+    CountingMouseListener changing;
+    CountingMouseListener removed;
+    CountingMouseListener added;
+    changing.manager = &manager;
+    changing.removed = &removed;
+    changing.added   = &added;
+    manager.addMouseListener(&changing);
+    manager.addMouseListener(&removed);
+    manager.setReplay(&recording);
+
+    // the removed listener is skipped, the added one gets the next event
+    manager.processEvents();
+    CHECK(changing.moved == 1);
+    CHECK(removed.moved == 0);
+    CHECK(added.moved == 0);
+    manager.processEvents();
+    CHECK(changing.moved == 2);
+    CHECK(removed.moved == 0);
+    CHECK(added.moved == 1);
+}
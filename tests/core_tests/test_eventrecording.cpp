@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Standard C++ library includes
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+
+// 3rd party library includes
+#include <SDL3/SDL.h>
+#include <catch2/catch_test_macros.hpp>
+
+// FIFE includes
+#include "eventchannel/eventrecording.h"
+#include "util/time/timemanager.h"
+
+using FIFE::EventRecording;
+using FIFE::TimeManager;
+
+namespace
+{
+    char const * const RECORDING_FILE = "fifeeventrecording.rec";
+
+    SDL_Event keyEvent(Uint32 type, SDL_Keycode key)
+    {
+        SDL_Event event;
+        std::memset(&event, 0, sizeof(event));
+        event.type    = type;
+        event.key.key = key;
+        return event;
+    }
+} // namespace
+
+TEST_CASE("EventRecording keeps frames and texts through a file", "[core][eventrecording]")
+{
+    char typed[] = "hello";
+    SDL_Event text;
+    std::memset(&text, 0, sizeof(text));
+    text.type      = SDL_EVENT_TEXT_INPUT;
+    text.text.text = typed;
+
+    EventRecording recording;
+    recording.addFrame();
+    recording.addEvent(keyEvent(SDL_EVENT_KEY_DOWN, SDLK_A));
+    recording.setTimeDelta(0);
+    recording.addFrame();
+    recording.setTimeDelta(16);
+    recording.addFrame();
+    recording.addEvent(keyEvent(SDL_EVENT_KEY_UP, SDLK_A));
+    recording.addEvent(text);
+    recording.setTimeDelta(17);
+    // the text of the SDL event is gone after the frame
+    typed[0] = 'j';
+
+    std::filesystem::path const path = std::filesystem::current_path() / RECORDING_FILE;
+    REQUIRE(recording.save(path.string()));
+
+    EventRecording loaded;
+    REQUIRE(loaded.load(path.string()));
+    REQUIRE(loaded.getFrameCount() == 3);
+    CHECK(loaded.getFrame(0).events.size() == 1);
+    CHECK(loaded.getFrame(1).events.empty());
+    CHECK(loaded.getFrame(1).timeDelta == 16);
+    REQUIRE(loaded.getFrame(2).events.size() == 2);
+    CHECK(loaded.getFrame(2).timeDelta == 17);
+
+    SDL_Event const key = EventRecording::restoreEvent(loaded.getFrame(2).events[0]);
+    CHECK(key.type == SDL_EVENT_KEY_UP);
+    CHECK(key.key.key == SDLK_A);
+    SDL_Event const replayed = EventRecording::restoreEvent(loaded.getFrame(2).events[1]);
+    CHECK(replayed.type == SDL_EVENT_TEXT_INPUT);
+    CHECK(std::string(replayed.text.text) == "hello");
+
+    // a truncated file leaves the recording empty
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    CHECK(!loaded.load(path.string()));
+    CHECK(loaded.getFrameCount() == 0);
+
+    // a text larger than the rest of the file is rejected before it is allocated
+    REQUIRE(recording.save(path.string()));
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(std::filesystem::file_size(path) - 5 - sizeof(uint32_t)));
+        uint32_t const textSize = 0xFFFFFFF0;
+        file.write(reinterpret_cast<char const *>(&textSize), sizeof(textSize));
+    }
+    CHECK(!loaded.load(path.string()));
+    CHECK(loaded.getFrameCount() == 0);
+
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << "not a recording";
+    }
+    CHECK(!loaded.load(path.string()));
+
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+}
+
+TEST_CASE("TimeManager advances a fixed delta per update", "[core][eventrecording]")
+{
+    TimeManager tm;
+    tm.setFixedTimeDelta(20);
+    CHECK(tm.getFixedTimeDelta() == 20);
+
+    tm.update();
+    CHECK(tm.getTimeDelta64() == 0);
+    uint64_t const start = tm.now64();
+    for (int32_t i = 0; i < 5; ++i) {
+        tm.update();
+        CHECK(tm.getTimeDelta64() == 20);
+    }
+    CHECK(tm.now64() == start + 100);
+    CHECK(tm.getTicks64() == tm.now64());
+    CHECK(tm.getAverageFrameTime() > 0.0);
+
+    // the time goes on from the virtual clock
+    tm.setFixedTimeDelta(0);
+    CHECK(tm.getFixedTimeDelta() == 0);
+    CHECK(tm.getTicks64() >= start + 100);
+    tm.update();
+    CHECK(tm.now64() >= start + 100);
+    CHECK(tm.getTimeDelta64() < 1000);
+}
@@ -0,0 +1,248 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Standard C++ library includes
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+// 3rd party library includes
+#include <catch2/catch_test_macros.hpp>
+
+// FIFE includes
+#include "model/metamodel/grids/cellgrid.h"
+#include "model/metamodel/grids/hexgrid.h"
+#include "model/metamodel/grids/squaregrid.h"
+#include "model/metamodel/modelcoords.h"
+#include "model/metamodel/object.h"
+#include "model/structures/cellcache.h"
+#include "model/structures/fieldofview.h"
+#include "model/structures/instance.h"
+#include "model/structures/layer.h"
+#include "model/structures/location.h"
+#include "util/time/timemanager.h"
+
+using FIFE::CellCache;
+using FIFE::CellGrid;
+using FIFE::FieldOfView;
+using FIFE::HexGrid;
+using FIFE::Instance;
+using FIFE::Layer;
+using FIFE::ModelCoordinate;
+using FIFE::Object;
+using FIFE::SquareGrid;
+using FIFE::TimeManager;
+using FIFE::VisibilityMap;
+
+namespace
+{
+
+    struct FieldOfViewFixture
+    {
+            TimeManager tm;
+            std::unique_ptr<Layer> layer;
+            std::unique_ptr<Object> ground;
+            std::unique_ptr<Object> tree;
+
+            // a walkable size x size square
+            FieldOfViewFixture(CellGrid* grid, int32_t size)
+            {
+                layer  = std::make_unique<Layer>("test_layer", nullptr, grid);
+                ground = std::make_unique<Object>("ground", "test");
+                tree   = std::make_unique<Object>("tree", "test");
+                tree->setBlocking(true);
+                tree->setStatic(true);
+                for (int32_t y = 0; y < size; ++y) {
+                    for (int32_t x = 0; x < size; ++x) {
+                        layer->createInstance(ground.get(), ModelCoordinate(x, y, 0));
+                    }
+                }
+                layer->setWalkable(true);
+                layer->createCellCache();
+                layer->getCellCache()->createCells();
+            }
+
+            ~FieldOfViewFixture()                                     = default;
+            FieldOfViewFixture(FieldOfViewFixture const &)            = delete;
+            FieldOfViewFixture& operator=(FieldOfViewFixture const &) = delete;
+            FieldOfViewFixture(FieldOfViewFixture&&)                  = delete;
+            FieldOfViewFixture& operator=(FieldOfViewFixture&&)       = delete;
+
+            FieldOfView* fov()
+            {
+                return layer->getCellCache()->getFieldOfView();
+            }
+
+            void addTree(int32_t x, int32_t y)
+            {
+                layer->createInstance(tree.get(), ModelCoordinate(x, y, 0));
+                layer->update();
+            }
+    };
+
+    uint32_t countInCircle(uint16_t radius)
+    {
+        uint32_t count = 0;
+        for (int32_t y = -radius; y <= radius; ++y) {
+            for (int32_t x = -radius; x <= radius; ++x) {
+                if ((x * x) + (y * y) <= radius * (radius + 1)) {
+                    ++count;
+                }
+            }
+        }
+        return count;
+    }
+
+} // namespace
+
+TEST_CASE("FieldOfView sees the whole circle on an open square grid", "[core][fieldofview]")
+{
+    SquareGrid grid;
+    FieldOfViewFixture f(&grid, 21);
+    ModelCoordinate const origin(10, 10);
+
+    VisibilityMap visibility;
+    f.fov()->computeVisibility(origin, 6, visibility);
+    CHECK(visibility.getVisibleCount() == countInCircle(6));
+    CHECK(visibility.isVisible(origin));
+    CHECK(visibility.isVisible(ModelCoordinate(16, 10)));
+    CHECK(!visibility.isVisible(ModelCoordinate(16, 16)));
+    CHECK(visibility.getVisibleCells().size() == visibility.getVisibleCount());
+
+    // the square ends at the border of the map, missing cells block the sight
+    f.fov()->computeVisibility(ModelCoordinate(0, 0), 3, visibility);
+    CHECK(visibility.getVisibleCount() == 4 + 4 + 3 + 2);
+    CHECK(!visibility.isVisible(ModelCoordinate(-1, 0)));
+}
+
+TEST_CASE("FieldOfView walls cast shadows", "[core][fieldofview]")
+{
+    SquareGrid grid;
+    FieldOfViewFixture f(&grid, 21);
+    for (int32_t y = 8; y <= 12; ++y) {
+        f.addTree(12, y);
+    }
+
+    VisibilityMap visibility;
+    f.fov()->computeVisibility(ModelCoordinate(10, 10), 8, visibility);
+    CHECK(visibility.isVisible(ModelCoordinate(12, 10)));
+    CHECK(!visibility.isVisible(ModelCoordinate(13, 10)));
+    CHECK(!visibility.isVisible(ModelCoordinate(17, 11)));
+    CHECK(visibility.isVisible(ModelCoordinate(4, 10)));
+    CHECK(visibility.isVisible(ModelCoordinate(10, 3)));
+
+    CHECK(f.fov()->isInLineOfSight(ModelCoordinate(10, 10), ModelCoordinate(12, 10)));
+    CHECK(!f.fov()->isInLineOfSight(ModelCoordinate(10, 10), ModelCoordinate(15, 10)));
+    CHECK(f.fov()->isInLineOfSight(ModelCoordinate(10, 10), ModelCoordinate(4, 4)));
+    CHECK(!f.fov()->isInLineOfSight(ModelCoordinate(10, 10), ModelCoordinate(40, 10)));
+}
+
+TEST_CASE("FieldOfView updates cached viewers on blocking changes", "[core][fieldofview]")
+{
+    SquareGrid grid;
+    FieldOfViewFixture f(&grid, 21);
+    Instance* viewer = f.layer->createInstance(f.ground.get(), ModelCoordinate(10, 10, 0));
+    f.layer->update();
+
+    VisibilityMap const & visibility = f.fov()->getVisibility(viewer, 5);
+    CHECK(visibility.isVisible(ModelCoordinate(13, 10)));
+    CHECK(f.fov()->getViewerCount() == 1);
+
+    f.addTree(11, 10);
+    CHECK(!f.fov()->getVisibility(viewer, 5).isVisible(ModelCoordinate(13, 10)));
+
+    // a moved viewer is computed again
+    FIFE::Location location(f.layer.get());
+    location.setLayerCoordinates(ModelCoordinate(10, 5, 0));
+    viewer->setLocation(location);
+    f.layer->update();
+    VisibilityMap const & moved = f.fov()->getVisibility(viewer, 5);
+    CHECK(moved.getOrigin() == ModelCoordinate(10, 5));
+    CHECK(moved.getVisibleCount() == countInCircle(5));
+
+    f.fov()->removeViewer(viewer);
+    CHECK(f.fov()->getViewerCount() == 0);
+}
+
+TEST_CASE("FieldOfView follows created cells and deleted viewers", "[core][fieldofview]")
+{
+    SquareGrid grid;
+    FieldOfViewFixture f(&grid, 21);
+    Instance* near = f.layer->createInstance(f.ground.get(), ModelCoordinate(1, 5, 0));
+    Instance* far  = f.layer->createInstance(f.ground.get(), ModelCoordinate(15, 15, 0));
+    f.layer->update();
+
+    CHECK(!f.fov()->getVisibility(near, 3).isVisible(ModelCoordinate(-1, 5)));
+    uint32_t const farCount = f.fov()->getVisibility(far, 3).getVisibleCount();
+
+    // a cell created in the range of a viewer is seen and observed
+    f.layer->getCellCache()->createCell(ModelCoordinate(-1, 5));
+    CHECK(f.fov()->getVisibility(near, 3).isVisible(ModelCoordinate(-1, 5)));
+    CHECK(f.fov()->getVisibility(far, 3).getVisibleCount() == farCount);
+    f.addTree(0, 5);
+    CHECK(!f.fov()->getVisibility(near, 3).isVisible(ModelCoordinate(-1, 5)));
+
+    f.layer->deleteInstance(far);
+    CHECK(f.fov()->getViewerCount() == 1);
+    f.fov()->removeViewer(near);
+    CHECK(f.fov()->getViewerCount() == 0);
+}
+
+TEST_CASE("FieldOfView unites the cells of many viewers", "[core][fieldofview]")
+{
+    SquareGrid grid;
+    FieldOfViewFixture f(&grid, 21);
+    std::vector<Instance*> viewers;
+    viewers.push_back(f.layer->createInstance(f.ground.get(), ModelCoordinate(4, 4, 0)));
+    viewers.push_back(f.layer->createInstance(f.ground.get(), ModelCoordinate(6, 4, 0)));
+    viewers.push_back(f.layer->createInstance(f.ground.get(), ModelCoordinate(6, 4, 0)));
+    viewers.push_back(f.layer->createInstance(f.ground.get(), ModelCoordinate(16, 16, 0)));
+    f.layer->update();
+
+    std::vector<ModelCoordinate> const cells = f.fov()->getVisibleCells(viewers, 3);
+    CHECK(f.fov()->getViewerCount() == 4);
+    size_t expected = 0;
+    for (int32_t y = 0; y < 21; ++y) {
+        for (int32_t x = 0; x < 21; ++x) {
+            ModelCoordinate const mc(x, y);
+            for (Instance* viewer : viewers) {
+                if (f.fov()->getVisibility(viewer, 3).isVisible(mc)) {
+                    ++expected;
+                    break;
+                }
+            }
+        }
+    }
+    CHECK(cells.size() == expected);
+    CHECK(cells.size() < 3 * countInCircle(3));
+    CHECK(f.fov()->getVisibility(viewers[1], 3).getBits() == f.fov()->getVisibility(viewers[2], 3).getBits());
+
+    f.fov()->clear();
+    CHECK(f.fov()->getViewerCount() == 0);
+}
+
+TEST_CASE("FieldOfView works on hex grids", "[core][fieldofview]")
+{
+    for (bool const axial : {false, true}) {
+        HexGrid grid(axial);
+        FieldOfViewFixture f(&grid, 21);
+        ModelCoordinate const origin(10, 10);
+
+        VisibilityMap visibility;
+        f.fov()->computeVisibility(origin, 3, visibility);
+        // the cells within three steps
+        CHECK(visibility.getVisibleCount() == 1 + (3 * 3 * 4));
+
+        // a ring of blockers around the origin hides everything behind it
+        std::vector<ModelCoordinate> ring;
+        grid.getAccessibleCoordinates(origin, ring);
+        for (ModelCoordinate const & mc : ring) {
+            if (mc != origin) {
+                f.addTree(mc.x, mc.y);
+            }
+        }
+        f.fov()->computeVisibility(origin, 3, visibility);
+        CHECK(visibility.getVisibleCount() == 7);
+    }
+}
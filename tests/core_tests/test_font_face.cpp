@@ -4,6 +4,7 @@
 // Standard C++ library includes
 #include <cstdlib>
 #include <fstream>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -13,15 +14,31 @@
 
 // FIFE includes
 #include "fixture.h"
+#include "util/structures/rect.h"
 #include "video/fonts/fontface.h"
+#include "video/fonts/fontinstance.h"
+#include "video/fonts/fontinstanceifontadapter.h"
 #include "video/fonts/fonttypes.h"
+#include "video/fonts/glyphatlas.h"
 #include "video/fonts/imagefontface.h"
 #include "video/fonts/truetypefontface.h"
+#include "video/sdl/renderbackendsdl.h"
+#include "video/window/window.h"
 
 using FIFE::AssetHandle;
 using FIFE::FontFace;
+using FIFE::FontInstanceIFontAdapter;
+using FIFE::GlyphAtlas;
+using FIFE::GlyphInfo;
 using FIFE::ImageFontFace;
+using FIFE::Point;
+using FIFE::Rect;
+using FIFE::RenderBackendSDL;
 using FIFE::TrueTypeFontFace;
+using FIFE::TrueTypeFontInstance;
+using FIFE::Window;
+using FIFE::WindowMode;
+using FIFE::WindowSettings;
 
 TEST_CASE("FontFace base class")
 {
@@ -127,6 +144,79 @@ TEST_CASE("TrueTypeFontFace memory constructor null data throws")
     REQUIRE_THROWS_AS(TrueTypeFontFace(handle, nullptr, 0, 12, "null"), std::exception);
 }
 
+TEST_CASE("TrueTypeFontFace renders single glyphs")
+{
+    FontTestFixture const fixture;
+    AssetHandle handle{11};
+    TrueTypeFontFace face(handle, "tests/data/FreeMono.ttf", 12);
+
+    SDL_Color const white{255, 255, 255, 255};
+    SDL_Surface* glyph = face.renderGlyph('A', white, true);
+    REQUIRE(glyph != nullptr);
+    REQUIRE(glyph->w > 0);
+    REQUIRE(glyph->h > 0);
+    SDL_DestroySurface(glyph);
+
+    // FreeMono is monospaced
+    REQUIRE(face.getGlyphAdvance('A') > 0);
+    REQUIRE(face.getGlyphAdvance('A') == face.getGlyphAdvance('i'));
+}
+
+TEST_CASE("FontFace base class renders no glyphs")
+{
+    AssetHandle handle{12};
+    FontFace face(handle);
+    SDL_Color const white{255, 255, 255, 255};
+    REQUIRE(face.renderGlyph('A', white, true) == nullptr);
+    REQUIRE(face.getGlyphAdvance('A') == 0);
+}
+
+TEST_CASE("GlyphAtlas packs glyphs once for all colors and renders one quad per glyph", "[sdl]")
+{
+    FontTestFixture const fixture;
+    Window window;
+    window.create(WindowSettings{.width = 320, .height = 240, .opengl = false, .windowMode = WindowMode::Windowed});
+    RenderBackendSDL renderbackend(SDL_Color{.r = 0, .g = 0, .b = 0, .a = 255});
+    renderbackend.init("");
+    renderbackend.setWindowObject(&window);
+    renderbackend.createMainScreen("FIFE", "");
+
+    // image fonts are pre-colored and ignore the antialias flag
+    std::string const glyphs =
+        " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~";
+    ImageFontFace imageFace(AssetHandle{13}, "tests/data/rpgfont.png", glyphs);
+    GlyphAtlas& imageAtlas  = imageFace.getGlyphAtlas();
+    GlyphInfo const * first = imageAtlas.getGlyph('A', true);
+    REQUIRE(first != nullptr);
+    CHECK_FALSE(first->tinted);
+    CHECK(imageAtlas.getGlyph('A', false) == first);
+    CHECK(imageAtlas.getGlyphCount() == 1);
+
+    auto ttfFace         = std::make_shared<TrueTypeFontFace>(AssetHandle{14}, "tests/data/FreeMono.ttf", 12);
+    GlyphAtlas& ttfAtlas = ttfFace->getGlyphAtlas();
+    GlyphInfo const * antialiased = ttfAtlas.getGlyph('A', true);
+    REQUIRE(antialiased != nullptr);
+    CHECK(antialiased->tinted);
+    REQUIRE(ttfAtlas.getGlyph('A', false) != nullptr);
+    CHECK(ttfAtlas.getGlyphCount() == 2);
+    CHECK(ttfAtlas.getPageCount() == 1);
+
+    FontInstanceIFontAdapter font(std::make_shared<TrueTypeFontInstance>(ttfFace, 12));
+    Point const size = font.getTextSize("abab");
+    renderbackend.startFrame();
+    CHECK(font.renderText("abab", Rect(10, 10, size.x, size.y)) == 4);
+    // off screen glyphs are not added
+    CHECK(font.renderText("abab", Rect(-1000, 10, size.x, size.y)) == 0);
+    // text in other colors reuses the same glyphs
+    for (int red = 0; red < 200; red += 10) {
+        font.setColor(static_cast<uint8_t>(red), 0, 255, 255);
+        CHECK(font.renderText("abab", Rect(10, 10, size.x, size.y)) == 4);
+    }
+    renderbackend.endFrame();
+    // a and b were added once, repeated glyphs reuse their atlas cell
+    CHECK(ttfAtlas.getGlyphCount() == 4);
+}
+
 TEST_CASE("FontFace invalid AssetHandle")
 {
     REQUIRE_THROWS_AS(FontFace(AssetHandle{0}), std::exception);
@@ -5,13 +5,16 @@
 #include <catch2/catch_test_macros.hpp>
 
 // Standard C++ library includes
+#include <cstdint>
 #include <memory>
 #include <stdexcept>
+#include <string>
 
 // FIFE includes
 #include "fixture.h"
 #include "video/fonts/fontfamily.h"
 #include "video/fonts/fontinstance.h"
+#include "video/fonts/fontinstanceifontadapter.h"
 #include "video/fonts/fonttypes.h"
 #include "video/fonts/imagefontface.h"
 #include "video/fonts/truetypefontface.h"
@@ -19,7 +22,9 @@
 using FIFE::AssetHandle;
 using FIFE::FontFace;
 using FIFE::FontFamily;
+using FIFE::FontInstanceIFontAdapter;
 using FIFE::FontWeight;
+using FIFE::Point;
 using FIFE::TrueTypeFontFace;
 using FIFE::TrueTypeFontInstance;
 
@@ -53,6 +58,35 @@ TEST_CASE("TrueTypeFontInstance invalid args throw")
     REQUIRE_THROWS_AS(TrueTypeFontInstance(nullptr, 0), std::invalid_argument);
 }
 
+TEST_CASE("FontInstanceIFontAdapter measures the layout it renders")
+{
+    FontTestFixture const fixture;
+    auto face = std::make_shared<TrueTypeFontFace>(AssetHandle{1}, "tests/data/FreeMono.ttf", 12);
+    FontInstanceIFontAdapter font(std::make_shared<TrueTypeFontInstance>(face, 12));
+    font.setGlyphSpacing(2);
+
+    int32_t const advance = face->getGlyphAdvance('a');
+    REQUIRE(advance > 0);
+    std::string const abc = "abc";
+    // FreeMono is monospaced and has no kerning
+    CHECK(font.getWidth(abc) == (3 * advance) + (2 * 2));
+    CHECK(font.getTextSize(abc).x == font.getWidth(abc));
+
+    Point const size = font.getTextSize("ab\nabcd");
+    CHECK(size.x == font.getWidth(std::string("abcd")));
+    CHECK(size.y == 2 * font.getHeight());
+
+    // the surface of GUI widgets and the images have the measured size
+    auto const surface = font.renderToSurface(abc);
+    REQUIRE(surface != nullptr);
+    CHECK(surface->w == font.getWidth(abc));
+    CHECK(surface->h == font.getHeight());
+
+    // wrapping and cursor positions use the same widths
+    CHECK(font.splitTextToWidth("aaa bbb", font.getWidth(std::string("aaa b"))) == "aaa\nbbb");
+    CHECK(font.getStringIndexAt(abc, advance + 1) == 2);
+}
+
 TEST_CASE("FontFamily basic operations")
 {
     FontFamily family("Test");
@@ -7,29 +7,38 @@
 #include <catch2/catch_test_macros.hpp>
 
 // Standard C++ library includes
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <cstdlib>
 #include <memory>
 #include <string>
+#include <vector>
 
 // Platform specific includes
 #include "fixture.h"
 
 // FIFE includes
 #include "gui/fifechan/base/gui_image.h"
+#include "gui/fifechan/base/gui_rendercache.h"
 #include "gui/fifechan/base/gui_imageloader.h"
 #include "gui/fifechan/base/opengl/opengl_gui_graphics.h"
 #include "gui/fifechan/base/sdl/sdl_gui_graphics.h"
 #include "util/structures/rect.h"
 #include "video/image.h"
 #include "video/imagemanager.h"
+#include "video/opengl/fife_opengl.h"
+#include "video/opengl/glimage.h"
 #include "video/opengl/renderbackendopengl.h"
 #include "video/sdl/renderbackendsdl.h"
 #include "video/window/window.h"
 
+using FIFE::GLImage;
 using FIFE::GuiImageLoader;
 using FIFE::ImageManager;
 using FIFE::ImagePtr;
 using FIFE::OpenGLGuiGraphics;
+using FIFE::Point;
 using FIFE::Rect;
 using FIFE::RenderBackend;
 using FIFE::RenderBackendOpenGL;
@@ -190,3 +199,180 @@ TEST_CASE("createImage converts BGRA8888 to RGBA32 in OpenGL backend", "[gui][op
     renderbackend.createMainScreen("FIFE", "");
     test_create_image_converts_format(renderbackend, SDL_PIXELFORMAT_RGBA32);
 }
+
+namespace
+{
+    // draws through the render cache of the graphics, like ResizableWindow
+    class CachedContainer : public fcn::Container
+    {
+        public:
+            void draw(fcn::Graphics* graphics) override
+            {
+                auto* cache = dynamic_cast<FIFE::IGuiRenderCache*>(graphics);
+                if (cache == nullptr) {
+                    fcn::Container::draw(graphics);
+                    return;
+                }
+                cache->drawCached(this, [this, graphics]() {
+                    ++draws;
+                    fcn::Container::draw(graphics);
+                });
+            }
+
+            // calls of the draw function given to the cache
+            int32_t draws = 0;
+    };
+
+    std::array<uint8_t, 4> readScreenPixel(RenderBackend const & renderbackend, int32_t x, int32_t y)
+    {
+        std::array<uint8_t, 4> pixel{};
+        auto const height = static_cast<GLint>(renderbackend.getHeight());
+        glReadPixels(x, height - 1 - y, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel.data());
+        return pixel;
+    }
+
+    bool nearlyEqual(std::array<uint8_t, 4> const & a, std::array<uint8_t, 4> const & b)
+    {
+        for (std::size_t i = 0; i < 3; ++i) {
+            if (std::abs(static_cast<int>(a.at(i)) - static_cast<int>(b.at(i))) > 2) {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace
+
+TEST_CASE("RenderBackendOpenGL lists the textures of batch segments", "[gui][opengl]")
+{
+    environment const env;
+    Window window;
+    try {
+        window.create(WindowSettings{.width = 800, .height = 600, .opengl = true, .windowMode = WindowMode::Windowed});
+    } catch (FIFE::SDLException const &) {
+        SKIP("OpenGL not available in this environment");
+    }
+    RenderBackendOpenGL renderbackend(SDL_Color{.r = 0, .g = 0, .b = 0, .a = 255});
+    renderbackend.init("");
+    renderbackend.setWindowObject(&window);
+    renderbackend.createMainScreen("FIFE", "");
+
+    ImagePtr img = ImageManager::instance()->load(IMAGE_FILE);
+    REQUIRE(img);
+    img->forceLoadInternal();
+    auto* glimage = dynamic_cast<GLImage*>(img.get());
+    REQUIRE(glimage != nullptr);
+
+    renderbackend.startFrame();
+    RenderBackendOpenGL::BatchMark const mark = renderbackend.markBatch();
+    img->render(Rect(0, 0, 32, 32));
+
+    // objects before the mark are not part of the segment, untextured ones add nothing
+    RenderBackendOpenGL::BatchMark const later = renderbackend.markBatch();
+    renderbackend.fillRectangle(Point(10, 10), 20, 20, 255, 0, 0);
+    CHECK(renderbackend.getBatchTextures(later).empty());
+    img->render(Rect(40, 0, 32, 32));
+    img->render(Rect(80, 0, 32, 32));
+    std::vector<GLuint> const textures = renderbackend.getBatchTextures(later);
+    REQUIRE(textures.size() == 1);
+    CHECK(textures.front() == glimage->getTexId());
+
+    renderbackend.discardBatch(later);
+    CHECK(renderbackend.markBatch().objects == later.objects);
+    CHECK(renderbackend.getBatchTextures(later).empty());
+
+    // texture changes are stamped in order
+    uint64_t const stamp = renderbackend.getTextureStamp(glimage->getTexId());
+    renderbackend.touchTexture(glimage->getTexId());
+    CHECK(renderbackend.getTextureStamp(glimage->getTexId()) > stamp);
+
+    // a flushed segment is already on the screen
+    CHECK(renderbackend.isBatchIntact(mark));
+    renderbackend.renderVertexArrays();
+    CHECK_FALSE(renderbackend.isBatchIntact(mark));
+    renderbackend.endFrame();
+}
+
+TEST_CASE("OpenGLGuiGraphics draws cached windows like direct ones", "[gui][opengl]")
+{
+    environment const env;
+    Window window;
+    try {
+        window.create(WindowSettings{.width = 800, .height = 600, .opengl = true, .windowMode = WindowMode::Windowed});
+    } catch (FIFE::SDLException const &) {
+        SKIP("OpenGL not available in this environment");
+    }
+    RenderBackendOpenGL renderbackend(SDL_Color{.r = 0, .g = 0, .b = 0, .a = 255});
+    renderbackend.init("");
+    renderbackend.setWindowObject(&window);
+    renderbackend.createMainScreen("FIFE", "");
+    OpenGLGuiGraphics graphics;
+    graphics.updateTarget();
+
+    auto top = std::make_unique<fcn::Container>();
+    top->setDimension(fcn::Rectangle(0, 0, 800, 600));
+    top->setOpaque(false);
+    auto cached = std::make_unique<CachedContainer>();
+    cached->setDimension(fcn::Rectangle(0, 0, 100, 80));
+    cached->setBaseColor(fcn::Color(200, 50, 50, 255));
+    // a translucent child checks that the texture composites like the direct drawing
+    auto child = std::make_unique<fcn::Container>();
+    child->setDimension(fcn::Rectangle(0, 0, 40, 40));
+    child->setBaseColor(fcn::Color(0, 0, 255, 128));
+    cached->add(child.get(), 20, 20);
+    top->add(cached.get(), 50, 60);
+
+    auto gui = std::make_unique<fcn::Gui>();
+    gui->setGraphics(&graphics);
+    gui->setTop(top.get());
+
+    std::array<Point, 3> const probes = {Point(55, 65), Point(90, 100), Point(140, 130)};
+    auto drawFrame = [&]() {
+        std::array<std::array<uint8_t, 4>, 3> pixels{};
+        renderbackend.startFrame();
+        gui->draw();
+        renderbackend.renderVertexArrays();
+        for (std::size_t i = 0; i < probes.size(); ++i) {
+            pixels.at(i) = readScreenPixel(renderbackend, probes.at(i).x, probes.at(i).y);
+        }
+        renderbackend.endFrame();
+        return pixels;
+    };
+
+    auto const direct = drawFrame();
+    CHECK(graphics.getRenderCacheSize() == 0);
+
+    graphics.setRenderCacheEnabled(true);
+    // the first frame renders the texture, the second draws it unchanged
+    auto const rendered = drawFrame();
+    if (!graphics.isRenderCacheEnabled()) {
+        SKIP("framebuffer objects not available in this environment");
+    }
+    int32_t const draws = cached->draws;
+    auto const reused   = drawFrame();
+    CHECK(cached->draws == draws);
+    CHECK(graphics.getRenderCacheSize() == 1);
+    for (std::size_t i = 0; i < probes.size(); ++i) {
+        CHECK(nearlyEqual(rendered.at(i), direct.at(i)));
+        CHECK(nearlyEqual(reused.at(i), direct.at(i)));
+    }
+
+    // a changed child is drawn again once it is invalidated
+    child->setBaseColor(fcn::Color(0, 255, 0, 128));
+    auto const stale = drawFrame();
+    CHECK(cached->draws == draws);
+    CHECK(nearlyEqual(stale.at(1), direct.at(1)));
+    graphics.invalidate(child.get());
+    auto const changed = drawFrame();
+    CHECK(cached->draws == draws + 1);
+    CHECK_FALSE(nearlyEqual(changed.at(1), direct.at(1)));
+
+    // a moved window keeps its texture
+    cached->setPosition(60, 60);
+    drawFrame();
+    CHECK(cached->draws == draws + 1);
+
+    // hidden windows lose their texture
+    cached->setVisible(false);
+    drawFrame();
+    CHECK(graphics.getRenderCacheSize() == 0);
+}
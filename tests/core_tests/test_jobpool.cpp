@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Standard C++ library includes
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+// Platform specific includes
+#include <catch2/catch_test_macros.hpp>
+
+// 3rd party library includes
+
+// FIFE includes
+#include "util/base/jobpool.h"
+
+using FIFE::JobPool;
+
+TEST_CASE("JobPool calls the job once for every index", "[jobpool]")
+{
+    for (uint32_t const workers : {0U, 1U, 3U}) {
+        JobPool pool(workers);
+        REQUIRE(pool.getWorkerCount() == workers);
+
+        for (size_t const count : {size_t{0}, size_t{1}, size_t{7}, size_t{1000}}) {
+            std::vector<std::atomic<uint32_t>> calls(count);
+            pool.parallelFor(count, [&calls](size_t index) {
+                calls[index].fetch_add(1, std::memory_order_relaxed);
+            });
+            for (auto const & call : calls) {
+                REQUIRE(call.load() == 1);
+            }
+        }
+    }
+}
+
+TEST_CASE("JobPool rethrows the exception of a job after the batch", "[jobpool]")
+{
+    JobPool pool(2);
+    std::atomic<uint32_t> finished{0};
+    REQUIRE_THROWS_AS(
+        pool.parallelFor(
+            64,
+            [&finished](size_t index) {
+                if (index == 5) {
+                    throw std::runtime_error("job failed");
+                }
+                finished.fetch_add(1, std::memory_order_relaxed);
+            }),
+        std::runtime_error);
+    REQUIRE(finished.load() < 64);
+
+    // the pool stays usable
+    std::atomic<uint32_t> calls{0};
+    pool.parallelFor(16, [&calls](size_t) {
+        calls.fetch_add(1, std::memory_order_relaxed);
+    });
+    REQUIRE(calls.load() == 16);
+}
@@ -0,0 +1,228 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Standard C++ library includes
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// 3rd party library includes
+#include <catch2/catch_test_macros.hpp>
+
+// FIFE includes
+#include "model/metamodel/grids/squaregrid.h"
+#include "model/metamodel/modelcoords.h"
+#include "model/metamodel/object.h"
+#include "model/structures/instance.h"
+#include "model/structures/layer.h"
+#include "model/structures/location.h"
+#include "util/base/exception.h"
+#include "util/math/angles.h"
+#include "util/time/timemanager.h"
+
+using FIFE::ExactModelCoordinate;
+using FIFE::Instance;
+using FIFE::Layer;
+using FIFE::ModelCoordinate;
+using FIFE::Object;
+using FIFE::SquareGrid;
+using FIFE::TimeManager;
+
+namespace
+{
+
+    struct LayerQueryFixture
+    {
+            TimeManager tm;
+            SquareGrid grid;
+            std::unique_ptr<Layer> layer;
+            std::unique_ptr<Object> object;
+
+            // one instance on every cell of a size x size square, centered at the origin
+            explicit LayerQueryFixture(int32_t size)
+            {
+                layer  = std::make_unique<Layer>("test_layer", nullptr, &grid);
+                object = std::make_unique<Object>("object", "test");
+                for (int32_t y = -size / 2; y < size / 2; ++y) {
+                    for (int32_t x = -size / 2; x < size / 2; ++x) {
+                        layer->createInstance(object.get(), ModelCoordinate(x, y, 0));
+                    }
+                }
+            }
+
+            ~LayerQueryFixture()                                    = default;
+            LayerQueryFixture(LayerQueryFixture const &)            = delete;
+            LayerQueryFixture& operator=(LayerQueryFixture const &) = delete;
+            LayerQueryFixture(LayerQueryFixture&&)                  = delete;
+            LayerQueryFixture& operator=(LayerQueryFixture&&)       = delete;
+
+            template <typename Predicate>
+            std::vector<Instance*> bruteForce(Predicate predicate) const
+            {
+                std::vector<Instance*> instances;
+                for (auto* instance : layer->getInstances()) {
+                    if (predicate(instance->getLocationRef().getLayerCoordinates())) {
+                        instances.push_back(instance);
+                    }
+                }
+                return instances;
+            }
+    };
+
+    int64_t distance(ModelCoordinate const & a, ModelCoordinate const & b)
+    {
+        int64_t const dx = a.x - b.x;
+        int64_t const dy = a.y - b.y;
+        return (dx * dx) + (dy * dy);
+    }
+
+    std::vector<Instance*> sorted(std::vector<Instance*> instances)
+    {
+        std::ranges::sort(instances);
+        return instances;
+    }
+
+} // namespace
+
+TEST_CASE("Layer circle queries match the cells of the circle", "[core][layer]")
+{
+    LayerQueryFixture fixture(40);
+    ModelCoordinate const center(3, -2);
+
+    for (uint16_t const radius : {0, 1, 5, 12}) {
+        std::vector<Instance*> const found = fixture.layer->getInstancesInCircle(center, radius);
+        auto const expected                = fixture.bruteForce([&](ModelCoordinate const & coords) {
+            return distance(coords, center) <= static_cast<int64_t>(radius) * (radius + 1);
+        });
+        CHECK(sorted(found) == sorted(expected));
+    }
+    CHECK(fixture.layer->getInstancesInCircle(center, 0).size() == 1);
+}
+
+TEST_CASE("Layer annulus queries leave out the inner circle", "[core][layer]")
+{
+    LayerQueryFixture fixture(40);
+    ModelCoordinate const center(-4, 5);
+
+    std::vector<Instance*> const found = fixture.layer->getInstancesInAnnulus(center, 3, 8);
+    auto const expected                = fixture.bruteForce([&](ModelCoordinate const & coords) {
+        int64_t const d = distance(coords, center);
+        return d <= 8 * 9 && d > 2 * 3;
+    });
+    CHECK(sorted(found) == sorted(expected));
+
+    CHECK(
+        sorted(fixture.layer->getInstancesInAnnulus(center, 0, 8)) ==
+        sorted(fixture.layer->getInstancesInCircle(center, 8)));
+}
+
+TEST_CASE("Layer circle segment queries filter by angle", "[core][layer]")
+{
+    LayerQueryFixture fixture(40);
+    ModelCoordinate const center(0, 0);
+    ExactModelCoordinate const exactCenter(0, 0);
+
+    auto const inSegment = [&](ModelCoordinate const & coords, int32_t s, int32_t e) {
+        if (distance(coords, center) > 10 * 11) {
+            return false;
+        }
+        int32_t const angle = FIFE::getAngleBetween(exactCenter, FIFE::intPt2doublePt(coords));
+        return s > e ? (angle >= s || angle <= e) : (angle >= s && angle <= e);
+    };
+
+    auto const found = fixture.layer->getInstancesInCircleSegment(center, 10, 30, 120);
+    auto expected    = fixture.bruteForce([&](ModelCoordinate const & coords) {
+        return inSegment(coords, 30, 120);
+    });
+    CHECK(!found.empty());
+    CHECK(sorted(found) == sorted(expected));
+
+    // wraps around 0
+    auto const wrapped = fixture.layer->getInstancesInCircleSegment(center, 10, -45, 45);
+    expected           = fixture.bruteForce([&](ModelCoordinate const & coords) {
+        return inSegment(coords, 315, 45);
+    });
+    CHECK(sorted(wrapped) == sorted(expected));
+}
+
+TEST_CASE("Layer line queries return the instances in line order", "[core][layer]")
+{
+    LayerQueryFixture fixture(40);
+    ModelCoordinate const start(-10, -3);
+    ModelCoordinate const end(12, 7);
+
+    std::vector<ModelCoordinate> const cells = fixture.grid.getCoordinatesInLine(start, end);
+    std::vector<Instance*> const found       = fixture.layer->getInstancesInLine(start, end);
+    REQUIRE(found.size() == cells.size());
+    for (size_t i = 0; i < cells.size(); ++i) {
+        CHECK(found[i]->getLocationRef().getLayerCoordinates() == cells[i]);
+    }
+}
+
+TEST_CASE("Layer batch circle queries match single queries", "[core][layer]")
+{
+    LayerQueryFixture fixture(40);
+    std::vector<ModelCoordinate> const centers = {
+        ModelCoordinate(0, 0), ModelCoordinate(-15, 10), ModelCoordinate(18, 18), ModelCoordinate(100, 100)};
+
+    auto const results = fixture.layer->getInstancesInCircles(centers, 6);
+    REQUIRE(results.size() == centers.size());
+    for (size_t i = 0; i < centers.size(); ++i) {
+        CHECK(sorted(results[i]) == sorted(fixture.layer->getInstancesInCircle(centers[i], 6)));
+    }
+    CHECK(results.back().empty());
+}
+
+TEST_CASE("Layer bulk accessors follow the order of the instances", "[core][layer]")
+{
+    LayerQueryFixture fixture(10);
+    std::vector<Instance*> const & instances = fixture.layer->getInstances();
+    instances[7]->setRotation(90);
+    FIFE::Location location(fixture.layer.get());
+    location.setExactLayerCoordinates(ExactModelCoordinate(1.5, -2.25, 0.0));
+    instances[8]->setLocation(location);
+
+    std::vector<uint64_t> ids(instances.size());
+    std::vector<double> positions(instances.size() * 3);
+    std::vector<int32_t> rotations(instances.size());
+    fixture.layer->getInstanceIds(ids);
+    fixture.layer->getInstancePositions(positions);
+    fixture.layer->getInstanceRotations(rotations);
+    for (size_t i = 0; i < instances.size(); ++i) {
+        ExactModelCoordinate const pos = instances[i]->getLocationRef().getExactLayerCoordinates();
+        CHECK(ids[i] == instances[i]->getId());
+        CHECK(positions[(i * 3)] == pos.x);
+        CHECK(positions[(i * 3) + 1] == pos.y);
+        CHECK(rotations[i] == instances[i]->getRotation());
+    }
+    CHECK(rotations[7] == 90);
+    CHECK(positions[(8 * 3) + 1] == -2.25);
+
+    std::vector<double> wrong(instances.size());
+    CHECK_THROWS_AS(fixture.layer->getInstancePositions(wrong), FIFE::IndexOverflow);
+}
+
+TEST_CASE("Layer bulk setters move and rotate the instances", "[core][layer]")
+{
+    LayerQueryFixture fixture(10);
+    std::vector<Instance*> const & instances = fixture.layer->getInstances();
+    std::vector<double> positions(instances.size() * 3);
+    std::vector<int32_t> rotations(instances.size());
+    fixture.layer->getInstancePositions(positions);
+    fixture.layer->getInstanceRotations(rotations);
+
+    positions[(3 * 3)]     = 20.0;
+    positions[(3 * 3) + 1] = 21.5;
+    rotations[4]           = -90;
+    fixture.layer->setInstancePositions(positions);
+    fixture.layer->setInstanceRotations(rotations);
+
+    CHECK(instances[3]->getLocationRef().getExactLayerCoordinates() == ExactModelCoordinate(20.0, 21.5, 0.0));
+    CHECK(instances[3]->getLocationRef().getLayer() == fixture.layer.get());
+    CHECK(instances[4]->getRotation() == 270);
+    CHECK(fixture.layer->getInstancesAt(instances[3]->getLocationRef()).front() == instances[3]);
+
+    std::vector<int32_t> const wrong(1);
+    CHECK_THROWS_AS(fixture.layer->setInstanceRotations(wrong), FIFE::IndexOverflow);
+}
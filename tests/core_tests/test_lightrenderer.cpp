@@ -0,0 +1,384 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Standard C++ library includes
+#include <memory>
+#include <string>
+#include <vector>
+
+// 3rd party library includes
+#include <catch2/catch_test_macros.hpp>
+
+// FIFE includes
+#include "model/metamodel/grids/squaregrid.h"
+#include "model/metamodel/object.h"
+#include "model/structures/instance.h"
+#include "model/structures/layer.h"
+#include "model/structures/location.h"
+#include "model/structures/map.h"
+#include "model/structures/renderernode.h"
+#include "util/time/timemanager.h"
+#include "video/renderbackend.h"
+#include "view/camera.h"
+#include "view/renderers/lightrenderer.h"
+
+using FIFE::Camera;
+using FIFE::LightRenderer;
+using FIFE::Location;
+using FIFE::ModelCoordinate;
+using FIFE::Rect;
+using FIFE::RendererNode;
+
+namespace
+{
+    struct MockRenderBackend : FIFE::RenderBackend
+    {
+            MockRenderBackend() : FIFE::RenderBackend(SDL_Color{.r = 0, .g = 0, .b = 0, .a = 255})
+            {
+            }
+
+            std::string const & getName() const override
+            {
+                static std::string const n = "MockRenderBackend";
+                return n;
+            }
+            void init(std::string const & driver) override
+            {
+            }
+            void clearBackBuffer() override
+            {
+            }
+            void setLightingModel(uint32_t lighting) override
+            {
+            }
+            uint32_t getLightingModel() const override
+            {
+                return 0;
+            }
+            void setLighting(float red, float green, float blue) override
+            {
+            }
+            void resetLighting() override
+            {
+            }
+            void resetStencilBuffer(uint8_t buffer) override
+            {
+            }
+            void changeBlending(int32_t scr, int32_t dst) override
+            {
+            }
+            void createMainScreen(std::string const & title, std::string const & icon) override
+            {
+            }
+            std::unique_ptr<FIFE::Image> createImage(FIFE::IResourceLoader* loader) override
+            {
+                return nullptr;
+            }
+            std::unique_ptr<FIFE::Image> createImage(std::string const & name, FIFE::IResourceLoader* loader) override
+            {
+                return nullptr;
+            }
+            std::unique_ptr<FIFE::Image> createImage(uint8_t const * data, uint32_t width, uint32_t height) override
+            {
+                return nullptr;
+            }
+            std::unique_ptr<FIFE::Image> createImage(SDL_Surface* surface) override
+            {
+                return nullptr;
+            }
+            std::unique_ptr<FIFE::Image> createImage(std::string const & name, SDL_Surface* surface) override
+            {
+                return nullptr;
+            }
+            void renderVertexArrays() override
+            {
+            }
+            void captureScreen(std::string const & filename) override
+            {
+            }
+            void captureScreen(std::string const & filename, uint32_t width, uint32_t height) override
+            {
+            }
+            bool putPixel(int32_t x, int32_t y, uint8_t r, uint8_t g, uint8_t b, uint8_t a) override
+            {
+                return true;
+            }
+            void drawLine(
+                FIFE::Point const & p1, FIFE::Point const & p2, uint8_t r, uint8_t g, uint8_t b, uint8_t a) override
+            {
+            }
+            void drawThickLine(
+                FIFE::Point const & p1,
+                FIFE::Point const & p2,
+                uint8_t width,
+                uint8_t r,
+                uint8_t g,
+                uint8_t b,
+                uint8_t a) override
+            {
+            }
+            void drawPolyLine(
+                std::vector<FIFE::Point> const & points, uint8_t width, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+                override
+            {
+            }
+            void drawBezier(
+                std::vector<FIFE::Point> const & points,
+                int32_t steps,
+                uint8_t width,
+                uint8_t r,
+                uint8_t g,
+                uint8_t b,
+                uint8_t a) override
+            {
+            }
+            std::unique_ptr<FIFE::Image> createImage(
+                std::string const & name, uint8_t const * data, uint32_t width, uint32_t height) override
+            {
+                return nullptr;
+            }
+            void drawTriangle(
+                FIFE::Point const & p1,
+                FIFE::Point const & p2,
+                FIFE::Point const & p3,
+                uint8_t r,
+                uint8_t g,
+                uint8_t b,
+                uint8_t a) override
+            {
+            }
+            void drawRectangle(
+                FIFE::Point const & p, uint16_t w, uint16_t h, uint8_t r, uint8_t g, uint8_t b, uint8_t a) override
+            {
+            }
+            void fillRectangle(
+                FIFE::Point const & p, uint16_t w, uint16_t h, uint8_t r, uint8_t g, uint8_t b, uint8_t a) override
+            {
+            }
+            void drawQuad(
+                FIFE::Point const & p1,
+                FIFE::Point const & p2,
+                FIFE::Point const & p3,
+                FIFE::Point const & p4,
+                uint8_t r,
+                uint8_t g,
+                uint8_t b,
+                uint8_t a) override
+            {
+            }
+            void drawVertex(FIFE::Point const & p, uint8_t size, uint8_t r, uint8_t g, uint8_t b, uint8_t a) override
+            {
+            }
+            void drawCircle(FIFE::Point const & p, uint32_t radius, uint8_t r, uint8_t g, uint8_t b, uint8_t a) override
+            {
+            }
+            void drawFillCircle(
+                FIFE::Point const & p, uint32_t radius, uint8_t r, uint8_t g, uint8_t b, uint8_t a) override
+            {
+            }
+            void drawCircleSegment(
+                FIFE::Point const & p,
+                uint32_t radius,
+                int32_t sangle,
+                int32_t eangle,
+                uint8_t r,
+                uint8_t g,
+                uint8_t b,
+                uint8_t a) override
+            {
+            }
+            void drawFillCircleSegment(
+                FIFE::Point const & p,
+                uint32_t radius,
+                int32_t sangle,
+                int32_t eangle,
+                uint8_t r,
+                uint8_t g,
+                uint8_t b,
+                uint8_t a) override
+            {
+            }
+            void drawLightPrimitive(
+                FIFE::Point const & p,
+                uint8_t intensity,
+                float radius,
+                int32_t subdivisions,
+                float xstretch,
+                float ystretch,
+                uint8_t red,
+                uint8_t green,
+                uint8_t blue) override
+            {
+                lights.push_back(intensity);
+            }
+            void addImageToArray(
+                uint32_t id, FIFE::Rect const & rec, float const * st, uint8_t alpha, uint8_t const * rgba) override
+            {
+            }
+            void changeRenderInfos(
+                FIFE::RenderDataType type,
+                uint16_t elements,
+                int32_t src,
+                int32_t dst,
+                bool light,
+                bool stentest,
+                uint8_t stenref,
+                FIFE::GLConstants stenop,
+                FIFE::GLConstants stenfunc,
+                FIFE::OverlayType otype) override
+            {
+            }
+            void renderGuiGeometry(
+                std::vector<FIFE::GuiVertex> const & vertices,
+                std::vector<int> const & indices,
+                FIFE::DoublePoint const & translation,
+                FIFE::ImagePtr texture) override
+            {
+            }
+            void enableScissorTest() override
+            {
+            }
+            void disableScissorTest() override
+            {
+            }
+            void attachRenderTarget(FIFE::ImagePtr& img, bool discard) override
+            {
+            }
+            void detachRenderTarget() override
+            {
+            }
+
+        protected:
+            void setClipArea(FIFE::Rect const & cliparea, bool clear) override
+            {
+            }
+
+        public:
+            std::vector<uint8_t> lights;
+    };
+
+    struct LightFixture
+    {
+            FIFE::TimeManager tm;
+            MockRenderBackend backend;
+            FIFE::SquareGrid grid;
+            std::unique_ptr<FIFE::Map> map;
+            FIFE::Layer* layer;
+            Camera* camera;
+            std::unique_ptr<LightRenderer> renderer;
+
+            LightFixture()
+            {
+                map    = std::make_unique<FIFE::Map>("map", &backend, std::vector<FIFE::RendererBase*>());
+                layer  = map->createLayer("ground", &grid);
+                camera = map->addCamera("main", Rect(0, 0, 800, 600));
+                camera->setCellImageDimensions(32, 32);
+                camera->setLocation(location(0, 0));
+                renderer = std::make_unique<LightRenderer>(&backend, 90);
+            }
+
+            Location location(int32_t x, int32_t y) const
+            {
+                Location loc(layer);
+                loc.setLayerCoordinates(ModelCoordinate(x, y));
+                return loc;
+            }
+
+            void addTorch(std::string const & group, int32_t x, int32_t y, uint8_t intensity = 255) const
+            {
+                renderer->addSimpleLight(group, RendererNode(location(x, y)), intensity, 16, 8, 1, 1, 255, 200, 0);
+            }
+
+            // counts the lights whose circle reaches into the viewport
+            uint32_t countVisible(int32_t from, int32_t to) const
+            {
+                uint32_t count = 0;
+                for (int32_t y = from; y < to; ++y) {
+                    for (int32_t x = from; x < to; ++x) {
+                        FIFE::ScreenPoint const p = camera->toScreenCoordinates(location(x, y).getMapCoordinates());
+                        if (Rect(p.x - 16, p.y - 16, 32, 32).intersects(camera->getViewPort())) {
+                            ++count;
+                        }
+                    }
+                }
+                return count;
+            }
+
+            void render()
+            {
+                backend.lights.clear();
+                FIFE::RenderList instances;
+                renderer->render(camera, layer, instances);
+            }
+
+            ~LightFixture()                               = default;
+            LightFixture(LightFixture const &)            = delete;
+            LightFixture& operator=(LightFixture const &) = delete;
+            LightFixture(LightFixture&&)                  = delete;
+            LightFixture& operator=(LightFixture&&)       = delete;
+    };
+} // namespace
+
+TEST_CASE("LightRenderer only checks the lights near the camera", "[lightrenderer]")
+{
+    LightFixture f;
+    for (int32_t y = -100; y < 100; ++y) {
+        for (int32_t x = -100; x < 100; ++x) {
+            f.addTorch("torches", x, y);
+        }
+    }
+
+    f.render();
+    uint32_t const visible = f.countVisible(-100, 100);
+    REQUIRE(visible > 0);
+    CHECK(f.backend.lights.size() == visible);
+    CHECK(f.renderer->getCheckedLightCount() < 40000 / 10);
+
+    // far away the camera sees no torch at all
+    f.camera->setLocation(f.location(1000, 1000));
+    f.render();
+    CHECK(f.backend.lights.empty());
+    CHECK(f.renderer->getCheckedLightCount() == 0);
+}
+
+TEST_CASE("LightRenderer follows lights that are moved", "[lightrenderer]")
+{
+    LightFixture f;
+    f.addTorch("torches", 0, 0);
+    f.render();
+    CHECK(f.backend.lights.size() == 1);
+
+    LightRenderer& renderer = *f.renderer;
+    renderer.getLightInfo("torches").front()->getNode()->setAttached(f.location(500, 500));
+    f.render();
+    CHECK(f.backend.lights.empty());
+
+    f.camera->setLocation(f.location(500, 500));
+    f.render();
+    CHECK(f.backend.lights.size() == 1);
+
+    renderer.removeAll("torches");
+    f.render();
+    CHECK(f.backend.lights.empty());
+}
+
+TEST_CASE("LightRenderer keeps the group order", "[lightrenderer]")
+{
+    LightFixture f;
+    f.addTorch("b", 1, 0, 3);
+    f.addTorch("a", 0, 0, 1);
+    f.addTorch("b", 0, 1, 4);
+    f.addTorch("a", 1, 1, 2);
+
+    // a light that follows an instance is checked every frame
+    FIFE::Object object("lamp", "test");
+    FIFE::Instance* lamp = f.layer->createInstance(&object, ModelCoordinate(0, 0));
+    f.renderer->addSimpleLight("c", RendererNode(lamp), 5, 16, 8, 1, 1, 255, 255, 255);
+
+    f.render();
+    CHECK(f.backend.lights == std::vector<uint8_t>{1, 2, 3, 4, 5});
+    f.camera->setLocation(f.location(1000, 1000));
+    f.render();
+    CHECK(f.backend.lights.empty());
+    CHECK(f.renderer->getCheckedLightCount() == 1);
+}
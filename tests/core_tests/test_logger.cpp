@@ -5,7 +5,12 @@
 #include "util/log/logger.h"
 
 // Standard C++ library includes
+#include <atomic>
+#include <format>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 // Platform specific includes
 #include <catch2/catch_test_macros.hpp>
@@ -16,6 +21,26 @@
 using FIFE::LogConfig;
 using FIFE::Logger;
 using FIFE::LogManager;
+using FIFE::LogOverflowPolicy;
+using FIFE::LogQueue;
+
+namespace
+{
+    // counts how often it is formatted
+    struct Counted
+    {
+            static inline int formatted = 0;
+    };
+} // namespace
+
+template <>
+struct std::formatter<Counted> : std::formatter<int>
+{
+        auto format(Counted const & /*unused*/, std::format_context& ctx) const
+        {
+            return std::formatter<int>::format(++Counted::formatted, ctx);
+        }
+};
 
 TEST_CASE("LogManager singleton", "[core][logger]")
 {
@@ -151,3 +176,133 @@ TEST_CASE("LogManager configure sets sinks correctly", "[core][logger]")
     CHECK(lm.isLogToPrompt());
     CHECK(!lm.isLogToFile());
 }
+
+TEST_CASE("FL_* formats lazily", "[core][logger]")
+{
+    Logger log(LM_CONTROLLER);
+    auto& lm        = LogManager::instance();
+    bool const prev = lm.isLogToPrompt();
+    lm.setLogToPrompt(false);
+    lm.clearVisibleModules();
+    Counted::formatted = 0;
+
+    FL_DBG(log, "value {}", Counted{});
+    CHECK(Counted::formatted == 0);
+
+    lm.addVisibleModule(LM_CONTROLLER);
+    lm.setLevelFilter(LogManager::LEVEL_WARN);
+    CHECK(!lm.isLogged(LM_CONTROLLER, LogManager::LEVEL_LOG));
+    CHECK(lm.isLogged(LM_CONTROLLER, LogManager::LEVEL_ERROR));
+    FL_LOG(log, "value {}", Counted{});
+    CHECK(Counted::formatted == 0);
+    FL_WARN(log, "value {} of {}", Counted{}, std::string("text"));
+    CHECK((!FIFE::kLogEnabled || Counted::formatted == 1));
+
+    lm.setLevelFilter(LogManager::LEVEL_DEBUG);
+    lm.clearVisibleModules();
+    lm.setLogToPrompt(prev);
+}
+
+TEST_CASE("LogQueue hands messages over in order", "[core][logger]")
+{
+    std::mutex mutex;
+    std::vector<std::string> received;
+    {
+        LogQueue queue(3, [&](LogQueue::Entry const & entry) {
+            std::scoped_lock const lock(mutex);
+            received.emplace_back(entry.text, entry.length);
+        });
+        CHECK(queue.getCapacity() == 4);
+        queue.setOverflowPolicy(LogOverflowPolicy::Block);
+
+        // Catch2 assertions are not thread-safe, the producers only count their failures
+        std::atomic<int> failedPushes{0};
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&queue, &failedPushes, t]() {
+                for (int i = 0; i < 250; ++i) {
+                    if (!queue.push(LM_AUDIO, LogManager::LEVEL_LOG, std::format("{} {}", t, i))) {
+                        ++failedPushes;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        CHECK(failedPushes == 0);
+        queue.flush();
+        std::scoped_lock const lock(mutex);
+        CHECK(received.size() == 1000);
+        CHECK(queue.getDroppedCount() == 0);
+
+        // a long message is truncated
+        queue.push(LM_AUDIO, LogManager::LEVEL_LOG, std::string(LogQueue::MESSAGE_CAPACITY + 10, 'y'));
+    }
+    // the destructor wrote the rest
+    REQUIRE(received.size() == 1001);
+    CHECK(received.back() == std::string(LogQueue::MESSAGE_CAPACITY, 'y'));
+
+    // the messages of every thread keep their order
+    for (int t = 0; t < 4; ++t) {
+        int next = 0;
+        for (auto const & message : received) {
+            if (message.starts_with(std::format("{} ", t))) {
+                CHECK(message == std::format("{} {}", t, next));
+                ++next;
+            }
+        }
+        CHECK(next == 250);
+    }
+}
+
+TEST_CASE("LogQueue drops messages while full", "[core][logger]")
+{
+    std::atomic<bool> release{false};
+    std::atomic<int> consumed{0};
+    LogQueue queue(2, [&](LogQueue::Entry const & /*unused*/) {
+        release.wait(false);
+        ++consumed;
+    });
+    CHECK(queue.getOverflowPolicy() == LogOverflowPolicy::Drop);
+
+    // a slot is only free after the flush thread wrote its message
+    int accepted = 0;
+    for (int i = 0; i < 10; ++i) {
+        accepted += queue.push(LM_AUDIO, LogManager::LEVEL_LOG, "message") ? 1 : 0;
+    }
+    CHECK(accepted == 2);
+    CHECK(queue.getDroppedCount() == 8);
+
+    release = true;
+    release.notify_all();
+    queue.flush();
+    CHECK(consumed == accepted);
+}
+
+TEST_CASE("LogManager writes asynchronously", "[core][logger]")
+{
+    auto& lm        = LogManager::instance();
+    bool const prev = lm.isLogToPrompt();
+    lm.setLogToPrompt(false);
+    lm.addVisibleModule(LM_CONTROLLER);
+    Logger log(LM_CONTROLLER);
+
+    lm.setAsync(true);
+    CHECK(lm.isAsync());
+    lm.setOverflowPolicy(LogOverflowPolicy::Block);
+    CHECK(lm.getOverflowPolicy() == LogOverflowPolicy::Block);
+    for (int i = 0; i < 100; ++i) {
+        FL_LOG(log, "async {}", i);
+    }
+    lm.flush();
+    CHECK(lm.getDroppedMessageCount() == 0);
+
+    lm.setOverflowPolicy(LogOverflowPolicy::Drop);
+    lm.setAsync(false);
+    CHECK(!lm.isAsync());
+    FL_LOG(log, "sync");
+
+    lm.clearVisibleModules();
+    lm.setLogToPrompt(prev);
+}
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Standard C++ library includes
+#include <chrono>
+#include <string>
+#include <thread>
+
+// 3rd party library includes
+#include <catch2/catch_test_macros.hpp>
+
+// FIFE includes
+#include "util/time/profiler.h"
+
+using FIFE::Profiler;
+
+namespace
+{
+    void busyWait(std::chrono::microseconds duration)
+    {
+        auto const end = std::chrono::steady_clock::now() + duration;
+        while (std::chrono::steady_clock::now() < end) {
+        }
+    }
+
+    void zoneWork()
+    {
+        FIFE_PROFILE_ZONE("test::zoneWork");
+        busyWait(std::chrono::microseconds(200));
+    }
+} // namespace
+
+TEST_CASE("Profiler keeps nothing while disabled", "[core][profiler]")
+{
+    Profiler profiler;
+    CHECK(!Profiler::isEnabled());
+    profiler.beginFrame();
+    zoneWork();
+    CHECK(profiler.getZoneNames().empty());
+    CHECK(profiler.getZoneAverage("test::zoneWork", 1) == 0.0);
+}
+
+TEST_CASE("Profiler averages zones over frames", "[core][profiler]")
+{
+    Profiler profiler;
+    profiler.setEnabled(true);
+    for (int32_t frame = 0; frame < 4; ++frame) {
+        profiler.beginFrame();
+        FIFE_PROFILE_ZONE("test::frame");
+        zoneWork();
+        zoneWork();
+        std::string const name = "test::dynamic" + std::to_string(frame % 2);
+        FIFE_PROFILE_ZONE_DYNAMIC(name);
+    }
+    profiler.setEnabled(false);
+
+    CHECK(profiler.getFrameCount() == 4);
+    auto const names = profiler.getZoneNames();
+    REQUIRE(names.size() == 4);
+    CHECK(names[0] == "test::dynamic0");
+    CHECK(names[1] == "test::dynamic1");
+    CHECK(names[2] == "test::frame");
+    CHECK(names[3] == "test::zoneWork");
+
+    // two zones of at least 0.2 ms per frame
+    double const average = profiler.getZoneAverage("test::zoneWork", 4);
+    CHECK(average >= 0.4);
+    CHECK(profiler.getZoneAverage("test::frame", 4) >= average);
+    CHECK(profiler.getZoneAverage("test::unknown", 4) == 0.0);
+
+    std::string const trace = profiler.getChromeTrace(2);
+    CHECK(trace.find(R"("name":"test::zoneWork","ph":"X")") != std::string::npos);
+    CHECK(trace.find(R"("name":"frame 3")") != std::string::npos);
+    CHECK(trace.find(R"("name":"frame 1")") == std::string::npos);
+
+    profiler.clear();
+    CHECK(profiler.getFrameCount() == 0);
+    CHECK(profiler.getZoneNames().empty());
+}
+
+TEST_CASE("Profiler keeps a buffer per thread", "[core][profiler]")
+{
+    Profiler profiler(8);
+    profiler.setEnabled(true);
+    profiler.beginFrame();
+    zoneWork();
+    std::thread worker([]() {
+        zoneWork();
+    });
+    worker.join();
+    // the ring keeps the last zones of the thread
+    for (int32_t i = 0; i < 20; ++i) {
+        FIFE_PROFILE_ZONE("test::short");
+    }
+    profiler.setEnabled(false);
+
+    std::string const trace = profiler.getChromeTrace(1);
+    CHECK(trace.find(R"("name":"thread_name","ph":"M","pid":1,"tid":1)") != std::string::npos);
+    CHECK(trace.find(R"("name":"test::zoneWork","ph":"X","pid":1,"tid":1)") != std::string::npos);
+    // overwritten by the short zones of the main thread
+    CHECK(trace.find(R"("name":"test::zoneWork","ph":"X","pid":1,"tid":0)") == std::string::npos);
+    CHECK(profiler.getZoneAverage("test::short", 1) >= 0.0);
+}
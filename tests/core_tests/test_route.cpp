@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Standard C++ library includes
+#include <memory>
+#include <vector>
+
+// 3rd party library includes
+#include <catch2/catch_test_macros.hpp>
+
+// FIFE includes
+#include "model/metamodel/grids/squaregrid.h"
+#include "model/metamodel/modelcoords.h"
+#include "model/structures/layer.h"
+#include "model/structures/location.h"
+#include "pathfinder/route.h"
+#include "util/time/timemanager.h"
+
+using FIFE::ExactModelCoordinate;
+using FIFE::Layer;
+using FIFE::Location;
+using FIFE::ModelCoordinate;
+using FIFE::Path;
+using FIFE::Route;
+using FIFE::SquareGrid;
+using FIFE::TimeManager;
+
+namespace
+{
+
+    struct RouteFixture
+    {
+            TimeManager tm;
+            SquareGrid grid;
+            std::unique_ptr<Layer> ground;
+            std::unique_ptr<Layer> bridge;
+
+            RouteFixture()
+            {
+                ground = std::make_unique<Layer>("ground", nullptr, &grid);
+                bridge = std::make_unique<Layer>("bridge", nullptr, &grid);
+            }
+
+            Location location(Layer* layer, int32_t x, int32_t y) const
+            {
+                Location loc(layer);
+                loc.setLayerCoordinates(ModelCoordinate(x, y));
+                return loc;
+            }
+
+            ~RouteFixture()                               = default;
+            RouteFixture(RouteFixture const &)            = delete;
+            RouteFixture& operator=(RouteFixture const &) = delete;
+            RouteFixture(RouteFixture&&)                  = delete;
+            RouteFixture& operator=(RouteFixture&&)       = delete;
+    };
+
+} // namespace
+
+TEST_CASE("Route keeps the layers and the exact start of a path", "[core][route]")
+{
+    RouteFixture f;
+    Location start(f.ground.get());
+    start.setExactLayerCoordinates(ExactModelCoordinate(0.25, 0.0));
+
+    Path path;
+    path.push_back(start);
+    path.push_back(f.location(f.ground.get(), 1, 0));
+    path.push_back(f.location(f.bridge.get(), 2, 0));
+    path.push_back(f.location(f.bridge.get(), 3, 0));
+    path.push_back(f.location(f.ground.get(), 4, 0));
+
+    Route route(start, path.back());
+    route.setPath(path);
+    REQUIRE(route.getPathLength() == 5);
+    CHECK(route.getRouteStatus() == FIFE::ROUTE_SOLVED);
+    CHECK(route.getPathCoordinates()[3] == ModelCoordinate(3, 0));
+    CHECK(route.getPathLayer(0) == f.ground.get());
+    CHECK(route.getPathLayer(2) == f.bridge.get());
+    CHECK(route.getPathLayer(4) == f.ground.get());
+    CHECK(route.getPathNode(0).getExactLayerCoordinates() == ExactModelCoordinate(0.25, 0.0));
+    CHECK(route.getPath() == path);
+    CHECK(route.getEndNode() == path.back());
+
+    CHECK(route.getCurrentNode() == start);
+    CHECK(route.getPreviousNode() == start);
+    CHECK(route.getNextNode().getLayerCoordinates() == ModelCoordinate(1, 0));
+    CHECK(route.walkToNextNode(2));
+    CHECK(route.getCurrentNode() == f.location(f.bridge.get(), 2, 0));
+    CHECK(route.getPreviousNode() == f.location(f.ground.get(), 1, 0));
+    CHECK(!route.walkToNextNode(2));
+    CHECK(route.getWalkedLength() == 3);
+    CHECK(!route.reachedEnd());
+
+    // keep two more steps from the walked part
+    route.cutPath(2);
+    CHECK(route.getPathLength() == 4);
+    CHECK(route.getEndNode() == f.location(f.bridge.get(), 3, 0));
+    CHECK(route.getPathLayer(3) == f.bridge.get());
+    CHECK(route.isReplanned());
+
+    route.cutPath(0);
+    CHECK(route.getPathLength() == 0);
+    CHECK(route.getStartNode() == f.location(f.bridge.get(), 2, 0));
+    CHECK(route.getRouteStatus() == FIFE::ROUTE_CREATED);
+    CHECK(route.reachedEnd());
+}
+
+TEST_CASE("Route takes the coordinates of a single layer path", "[core][route]")
+{
+    RouteFixture f;
+    f.ground->setWalkable(true);
+    f.ground->createCellCache();
+    Location start(f.ground.get());
+    start.setExactLayerCoordinates(ExactModelCoordinate(0.0, -0.25));
+
+    std::vector<ModelCoordinate> coordinates;
+    for (int32_t x = 0; x < 6; ++x) {
+        coordinates.emplace_back(x, 0);
+    }
+
+    Route route(start, f.location(f.ground.get(), 5, 0));
+    route.setPath(f.ground.get(), coordinates, start.getExactLayerCoordinatesRef());
+    REQUIRE(route.getPathLength() == 6);
+    CHECK(route.getStartNode() == start);
+    CHECK(route.getEndNode() == f.location(f.ground.get(), 5, 0));
+    CHECK(route.getPathLayer(5) == f.ground.get());
+    CHECK(route.getTotalCost() == 5.0);
+    // the step onto the given position is part of the remaining cost
+    CHECK(route.getRemainingCostFrom(f.location(f.ground.get(), 3, 0)) == 3.0);
+}
+
+TEST_CASE("Route continues a replaced path from the nearest node", "[core][route]")
+{
+    RouteFixture f;
+    Location const start = f.location(f.ground.get(), 0, 0);
+
+    Path path;
+    for (int32_t x = 0; x < 5; ++x) {
+        path.push_back(f.location(f.ground.get(), x, 0));
+    }
+    Route route(start, path.back());
+    route.setPath(path);
+    route.walkToNextNode(2);
+
+    // the detour passes the current position in the middle
+    Path detour;
+    detour.push_back(f.location(f.ground.get(), 2, 1));
+    detour.push_back(f.location(f.ground.get(), 2, 0));
+    detour.push_back(f.location(f.ground.get(), 3, 1));
+    detour.push_back(f.location(f.ground.get(), 4, 0));
+    REQUIRE(route.replacePathKeepingProgress(detour, f.location(f.ground.get(), 2, 0)));
+    CHECK(route.getPathLength() == 4);
+    CHECK(route.isReplanned());
+    CHECK(route.getCurrentNode() == f.location(f.ground.get(), 2, 0));
+    CHECK(route.getNextNode() == f.location(f.ground.get(), 3, 1));
+    CHECK(route.getWalkedLength() == 2);
+}
@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Standard C++ library includes
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// Platform specific includes
+#include <catch2/catch_test_macros.hpp>
+
+// 3rd party library includes
+
+// FIFE includes
+#include "audio/soundemittergrid.h"
+
+using FIFE::AudioSpaceCoordinate;
+using FIFE::SoundEmitterGrid;
+
+namespace
+{
+    std::vector<uint32_t> queryGrid(SoundEmitterGrid const & grid, AudioSpaceCoordinate const & center, double radius)
+    {
+        std::vector<uint32_t> ids;
+        grid.query(center, radius, ids);
+        std::ranges::sort(ids);
+        return ids;
+    }
+} // namespace
+
+TEST_CASE("SoundEmitterGrid returns emitters of the touched cells and all global ones", "[audio]")
+{
+    SoundEmitterGrid grid(10.0);
+    grid.update(0, AudioSpaceCoordinate(0.0, 0.0, 0.0), true);
+    grid.update(1, AudioSpaceCoordinate(5.0, 5.0, 0.0), false);
+    grid.update(2, AudioSpaceCoordinate(-5.0, 3.0, 0.0), false);
+    grid.update(3, AudioSpaceCoordinate(100.0, 100.0, 0.0), false);
+    REQUIRE(grid.size() == 4);
+
+    REQUIRE(queryGrid(grid, AudioSpaceCoordinate(0.0, 0.0, 0.0), 10.0) == std::vector<uint32_t>{0, 1, 2});
+    REQUIRE(queryGrid(grid, AudioSpaceCoordinate(100.0, 100.0, 0.0), 10.0) == std::vector<uint32_t>{0, 3});
+    // far larger than the used cells
+    REQUIRE(queryGrid(grid, AudioSpaceCoordinate(0.0, 0.0, 0.0), 1.0e9) == std::vector<uint32_t>{0, 1, 2, 3});
+}
+
+TEST_CASE("SoundEmitterGrid follows moved, removed and resized emitters", "[audio]")
+{
+    SoundEmitterGrid grid(10.0);
+    grid.update(1, AudioSpaceCoordinate(5.0, 5.0, 0.0), false);
+    grid.update(2, AudioSpaceCoordinate(500.0, 5.0, 0.0), false);
+
+    grid.update(1, AudioSpaceCoordinate(505.0, 5.0, 0.0), false);
+    REQUIRE(queryGrid(grid, AudioSpaceCoordinate(0.0, 0.0, 0.0), 10.0).empty());
+    REQUIRE(queryGrid(grid, AudioSpaceCoordinate(500.0, 0.0, 0.0), 10.0) == std::vector<uint32_t>{1, 2});
+
+    grid.update(2, AudioSpaceCoordinate(0.0, 0.0, 0.0), true);
+    REQUIRE(queryGrid(grid, AudioSpaceCoordinate(-1000.0, 0.0, 0.0), 10.0) == std::vector<uint32_t>{2});
+
+    grid.remove(2);
+    REQUIRE(grid.size() == 1);
+    REQUIRE(queryGrid(grid, AudioSpaceCoordinate(-1000.0, 0.0, 0.0), 10.0).empty());
+
+    grid.setCellSize(1000.0);
+    REQUIRE(grid.getCellSize() == 1000.0);
+    REQUIRE(queryGrid(grid, AudioSpaceCoordinate(0.0, 0.0, 0.0), 1000.0) == std::vector<uint32_t>{1});
+}
@@ -0,0 +1,213 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Standard C++ library includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Platform specific includes
+#include <catch2/catch_test_macros.hpp>
+
+// 3rd party library includes
+
+// FIFE includes
+#include "audio/fife_openal.h"
+#include "audio/sounddecoder.h"
+#include "audio/soundstreamer.h"
+
+using FIFE::SoundDecoder;
+using FIFE::SoundStreamer;
+using FIFE::SoundStreamStatus;
+
+namespace
+{
+    // 16 bit mono silence, handed out in chunks of CHUNK_BYTES
+    constexpr uint64_t SAMPLE_RATE = 22050;
+    constexpr uint64_t CHUNK_BYTES = 4410;
+    constexpr uint64_t CHUNK_COUNT = 5;
+
+    class SilenceDecoder : public SoundDecoder
+    {
+        public:
+            explicit SilenceDecoder(std::shared_ptr<std::atomic<uint64_t>> decoded) :
+                m_decoded(std::move(decoded)), m_cursor(0)
+            {
+                m_samplerate = SAMPLE_RATE;
+            }
+
+            uint64_t getDecodedLength() const override
+            {
+                return CHUNK_BYTES * CHUNK_COUNT;
+            }
+
+            bool setCursor(uint64_t pos) override
+            {
+                m_cursor = pos;
+                return true;
+            }
+
+            bool decode(uint64_t length) override
+            {
+                uint64_t const size = std::min({length, CHUNK_BYTES, getDecodedLength() - m_cursor});
+                m_buffer.assign(size, 0);
+                m_cursor += size;
+                m_decoded->fetch_add(size);
+                return false;
+            }
+
+            void* getBuffer() const override
+            {
+                return const_cast<uint8_t*>(m_buffer.data());
+            }
+
+            uint64_t getBufferSize() override
+            {
+                return m_buffer.size();
+            }
+
+            std::unique_ptr<SoundDecoder> clone() const override
+            {
+                return std::make_unique<SilenceDecoder>(m_decoded);
+            }
+
+            void releaseBuffer() override
+            {
+                m_buffer.clear();
+            }
+
+        private:
+            std::shared_ptr<std::atomic<uint64_t>> m_decoded;
+            uint64_t m_cursor;
+            std::vector<uint8_t> m_buffer;
+    };
+
+    /** Polls the streamer until a message of the given type arrives, all messages are kept in received.
+     */
+    bool waitForStatus(
+        SoundStreamer& streamer, FIFE::SoundStreamStatusType type, std::vector<SoundStreamStatus>& received)
+    {
+        auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (std::chrono::steady_clock::now() < deadline) {
+            SoundStreamStatus status;
+            while (streamer.pollStatus(status)) {
+                received.push_back(status);
+                if (status.type == type) {
+                    return true;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(FIFE::STREAM_POLL_INTERVAL));
+        }
+        return false;
+    }
+
+    /** OpenAL device and context for the duration of a test.
+     */
+    struct OpenALContext
+    {
+            ALCdevice* device{alcOpenDevice(nullptr)};
+            ALCcontext* context{device != nullptr ? alcCreateContext(device, nullptr) : nullptr};
+
+            OpenALContext()
+            {
+                if (context != nullptr) {
+                    alcMakeContextCurrent(context);
+                }
+            }
+
+            ~OpenALContext()
+            {
+                alcMakeContextCurrent(nullptr);
+                if (context != nullptr) {
+                    alcDestroyContext(context);
+                }
+                if (device != nullptr) {
+                    alcCloseDevice(device);
+                }
+            }
+
+            OpenALContext(OpenALContext const &)            = delete;
+            OpenALContext& operator=(OpenALContext const &) = delete;
+    };
+} // namespace
+
+TEST_CASE("SoundStreamer answers a source release after all earlier commands", "[audio]")
+{
+    SoundStreamer streamer;
+    // commands for unknown streams are dropped, they must not hold up the release
+    streamer.play(42);
+    streamer.stop(42);
+    streamer.releaseSource(7);
+
+    std::vector<SoundStreamStatus> received;
+    REQUIRE(waitForStatus(streamer, FIFE::SSS_SOURCE_RELEASED, received));
+    REQUIRE(received.size() == 1);
+    REQUIRE(received.back().source == 7);
+}
+
+TEST_CASE("SoundStreamer reports a stream without buffers as an error", "[audio]")
+{
+    // no current context, alGenBuffers() cannot hand out names
+    alcMakeContextCurrent(nullptr);
+    auto decoded = std::make_shared<std::atomic<uint64_t>>(0);
+
+    SoundStreamer streamer;
+    uint32_t const stream = streamer.open(5, 9, std::make_unique<SilenceDecoder>(decoded), false);
+    streamer.play(stream);
+    streamer.releaseSource(9);
+
+    std::vector<SoundStreamStatus> received;
+    REQUIRE(waitForStatus(streamer, FIFE::SSS_SOURCE_RELEASED, received));
+    REQUIRE(received.size() == 2);
+    REQUIRE(received.front().type == FIFE::SSS_ERROR);
+    REQUIRE(received.front().stream == stream);
+    REQUIRE(received.front().emitter == 5);
+    REQUIRE(decoded->load() == 0);
+}
+
+TEST_CASE("SoundStreamer feeds a decoder through the source until it finishes", "[audio]")
+{
+    OpenALContext const openal;
+    if (openal.context == nullptr) {
+        SKIP("OpenAL not available in this environment");
+    }
+    ALuint source = 0;
+    alGenSources(1, &source);
+    REQUIRE(alGetError() == AL_NO_ERROR);
+
+    auto decoded = std::make_shared<std::atomic<uint64_t>>(0);
+    {
+        SoundStreamer streamer;
+        uint32_t const stream = streamer.open(3, source, std::make_unique<SilenceDecoder>(decoded), false);
+        REQUIRE(stream != 0);
+        streamer.play(stream);
+
+        std::vector<SoundStreamStatus> received;
+        REQUIRE(waitForStatus(streamer, FIFE::SSS_FINISHED, received));
+
+        // more chunks than buffers, so the worker had to refill the played ones
+        REQUIRE(decoded->load() == CHUNK_BYTES * CHUNK_COUNT);
+        float samples = 0.0F;
+        for (SoundStreamStatus const & status : received) {
+            REQUIRE(status.type != FIFE::SSS_ERROR);
+            REQUIRE(status.stream == stream);
+            REQUIRE(status.emitter == 3);
+            if (status.type == FIFE::SSS_PROCESSED) {
+                samples += status.samples;
+            }
+        }
+        REQUIRE(samples == static_cast<float>(CHUNK_BYTES * CHUNK_COUNT / 2));
+
+        streamer.close(stream);
+        streamer.releaseSource(source);
+        received.clear();
+        REQUIRE(waitForStatus(streamer, FIFE::SSS_SOURCE_RELEASED, received));
+        REQUIRE(received.back().source == source);
+    }
+    alDeleteSources(1, &source);
+}
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Standard C++ library includes
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+// Platform specific includes
+#include <catch2/catch_test_macros.hpp>
+
+// 3rd party library includes
+
+// FIFE includes
+#include "util/structures/spscqueue.h"
+
+using FIFE::SpscQueue;
+
+TEST_CASE("SpscQueue keeps FIFO order and reports full and empty", "[spscqueue]")
+{
+    SpscQueue<uint32_t, 4> queue;
+    uint32_t value = 0;
+
+    REQUIRE(queue.empty());
+    REQUIRE_FALSE(queue.pop(value));
+
+    for (uint32_t i = 0; i < 4; ++i) {
+        REQUIRE(queue.push(i));
+    }
+    REQUIRE(queue.size() == 4);
+    REQUIRE_FALSE(queue.push(99));
+
+    REQUIRE(queue.pop(value));
+    REQUIRE(value == 0);
+    REQUIRE(queue.push(4));
+
+    for (uint32_t i = 1; i < 5; ++i) {
+        REQUIRE(queue.pop(value));
+        REQUIRE(value == i);
+    }
+    REQUIRE(queue.empty());
+}
+
+TEST_CASE("SpscQueue transfers values between two threads", "[spscqueue]")
+{
+    SpscQueue<uint64_t, 64> queue;
+    constexpr uint64_t count = 100000;
+
+    // size() asked on the producer side while the consumer pops
+    size_t largestSize = 0;
+    std::thread producer([&queue, &largestSize] {
+        for (uint64_t i = 1; i <= count; ++i) {
+            while (!queue.push(i)) {
+                std::this_thread::yield();
+            }
+            largestSize = std::max(largestSize, queue.size());
+        }
+    });
+
+    uint64_t expected = 1;
+    uint64_t value    = 0;
+    while (expected <= count) {
+        if (queue.pop(value)) {
+            REQUIRE(value == expected);
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    REQUIRE(queue.empty());
+    REQUIRE(largestSize <= queue.capacity());
+}
@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Standard C++ library includes
+#include <algorithm>
+#include <vector>
+
+// 3rd party library includes
+#include <catch2/catch_test_macros.hpp>
+
+// FIFE includes
+#include "util/structures/rect.h"
+#include "video/image.h"
+#include "view/staticlayertiles.h"
+
+using FIFE::ImagePtr;
+using FIFE::Point;
+using FIFE::Rect;
+using FIFE::StaticLayerTiles;
+
+namespace
+{
+    class TileImage : public FIFE::Image
+    {
+        public:
+            TileImage() : Image(static_cast<FIFE::IResourceLoader*>(nullptr)) { }
+
+            void invalidate() override { }
+            void render(Rect const & /*rect*/, uint8_t /*alpha*/, uint8_t const * /*rgb*/) override { }
+            void setSurface(SDL_Surface* /*surface*/) override { }
+            void useSharedImage(ImagePtr const & /*shared*/, Rect const & /*region*/) override { }
+            void forceLoadInternal() override { }
+    };
+
+    // gives every tile without image a new one, as the camera does
+    void renderTiles(std::vector<StaticLayerTiles::Tile*> const & tiles)
+    {
+        for (StaticLayerTiles::Tile* tile : tiles) {
+            if (!tile->image) {
+                tile->image = ImagePtr(new TileImage());
+            }
+            tile->dirty = false;
+        }
+    }
+
+    size_t countDirty(std::vector<StaticLayerTiles::Tile*> const & tiles)
+    {
+        return static_cast<size_t>(std::ranges::count_if(tiles, [](auto const * tile) {
+            return tile->dirty;
+        }));
+    }
+} // namespace
+
+TEST_CASE("StaticLayerTiles covers the viewport with dirty tiles", "[core][view]")
+{
+    StaticLayerTiles tiles(100, 16);
+    auto const & visible = tiles.update(Rect(0, 0, 250, 150));
+    REQUIRE(visible.size() == 6);
+    CHECK(countDirty(visible) == 6);
+    CHECK(tiles.getScreenRect(*visible.front()) == Rect(0, 0, 100, 100));
+    CHECK(tiles.getScreenRect(*visible.back()) == Rect(200, 100, 100, 100));
+    renderTiles(visible);
+    CHECK(tiles.getImageCount() == 6);
+
+    CHECK(countDirty(tiles.update(Rect(0, 0, 250, 150))) == 0);
+}
+
+TEST_CASE("StaticLayerTiles keeps the tiles while panning", "[core][view]")
+{
+    StaticLayerTiles tiles(100, 16);
+    renderTiles(tiles.update(Rect(0, 0, 200, 100)));
+
+    // the map moved 100 pixels to the left, so the anchor did too
+    tiles.setAnchor(Point(-100, 0));
+    auto const & visible = tiles.update(Rect(0, 0, 200, 100));
+    REQUIRE(visible.size() == 2);
+    CHECK(!visible.at(0)->dirty);
+    CHECK(visible.at(1)->dirty);
+    CHECK(tiles.getScreenRect(*visible.at(0)) == Rect(0, 0, 100, 100));
+
+    // negative positions belong to the tiles left of the anchor
+    tiles.setAnchor(Point(50, 0));
+    auto const & shifted = tiles.update(Rect(0, 0, 100, 100));
+    REQUIRE(shifted.size() == 2);
+    CHECK(tiles.getScreenRect(*shifted.at(0)) == Rect(-50, 0, 100, 100));
+}
+
+TEST_CASE("StaticLayerTiles only dirties overlapped tiles", "[core][view]")
+{
+    StaticLayerTiles tiles(100, 16);
+    auto const & visible = tiles.update(Rect(0, 0, 300, 300));
+    renderTiles(visible);
+
+    tiles.markDirty(Rect(150, 150, 10, 10));
+    CHECK(countDirty(visible) == 1);
+    CHECK(visible.at(4)->dirty);
+
+    renderTiles(visible);
+    tiles.markDirty(Rect(90, 90, 20, 20));
+    CHECK(countDirty(visible) == 4);
+
+    renderTiles(visible);
+    tiles.markDirty(Rect(-1000, -1000, 5000, 5000));
+    CHECK(countDirty(visible) == 9);
+
+    renderTiles(visible);
+    tiles.markDirty(Rect(100, 100, 0, 10));
+    CHECK(countDirty(visible) == 0);
+}
+
+TEST_CASE("StaticLayerTiles reuses the images of evicted tiles", "[core][view]")
+{
+    StaticLayerTiles tiles(100, 4);
+    renderTiles(tiles.update(Rect(0, 0, 200, 200)));
+    REQUIRE(tiles.getTileCount() == 4);
+
+    tiles.setAnchor(Point(-200, 0));
+    auto const & visible = tiles.update(Rect(0, 0, 200, 200));
+    REQUIRE(visible.size() == 4);
+    CHECK(tiles.getTileCount() == 4);
+    for (auto const * tile : visible) {
+        CHECK(tile->dirty);
+        CHECK(tile->image);
+    }
+    CHECK(tiles.getImageCount() == 4);
+}
+
+TEST_CASE("StaticLayerTiles never evicts visible tiles", "[core][view]")
+{
+    StaticLayerTiles tiles(100, 2);
+    auto const & visible = tiles.update(Rect(0, 0, 300, 100));
+    REQUIRE(visible.size() == 3);
+    CHECK(tiles.getTileCount() == 3);
+    renderTiles(visible);
+    CHECK(tiles.getImageCount() == 3);
+}
+
+TEST_CASE("StaticLayerTiles keeps the images of invalidated tiles", "[core][view]")
+{
+    StaticLayerTiles tiles(100, 16);
+    renderTiles(tiles.update(Rect(0, 0, 200, 200)));
+    tiles.invalidate();
+    CHECK(tiles.getTileCount() == 0);
+    CHECK(tiles.getVisibleTiles().empty());
+    CHECK(tiles.getImageCount() == 4);
+
+    auto const & visible = tiles.update(Rect(0, 0, 200, 200));
+    CHECK(countDirty(visible) == 4);
+    for (auto const * tile : visible) {
+        CHECK(tile->image);
+    }
+    CHECK(tiles.getImageCount() == 4);
+}
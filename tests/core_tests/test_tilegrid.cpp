@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Standard C++ library includes
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// 3rd party library includes
+#include <catch2/catch_test_macros.hpp>
+
+// FIFE includes
+#include "model/metamodel/grids/squaregrid.h"
+#include "model/metamodel/modelcoords.h"
+#include "model/metamodel/object.h"
+#include "model/structures/cell.h"
+#include "model/structures/cellcache.h"
+#include "model/structures/instance.h"
+#include "model/structures/layer.h"
+#include "model/structures/tilegrid.h"
+#include "util/base/exception.h"
+#include "util/time/timemanager.h"
+
+using FIFE::Cell;
+using FIFE::CellCache;
+using FIFE::Instance;
+using FIFE::Layer;
+using FIFE::ModelCoordinate;
+using FIFE::Object;
+using FIFE::SquareGrid;
+using FIFE::TileGrid;
+using FIFE::TimeManager;
+
+TEST_CASE("TileGrid shares one record per object", "[core][tilegrid]")
+{
+    Object ground("ground", "test");
+    Object wall("wall", "test");
+    wall.setBlocking(true);
+
+    TileGrid tiles;
+    CHECK(tiles.getTileCount() == 0);
+    for (int32_t y = 0; y < 20; ++y) {
+        for (int32_t x = 0; x < 30; ++x) {
+            tiles.setTile(ModelCoordinate(x, y), x == 0 ? &wall : &ground);
+        }
+    }
+    CHECK(tiles.getTileCount() == 600);
+    CHECK(tiles.getRecordCount() == 2);
+    CHECK(tiles.getTile(ModelCoordinate(5, 5)) == &ground);
+    CHECK(tiles.getTile(ModelCoordinate(0, 5)) == &wall);
+    CHECK(tiles.getTile(ModelCoordinate(30, 5)) == nullptr);
+    CHECK(tiles.isBlocking(ModelCoordinate(0, 19)));
+    CHECK_FALSE(tiles.isBlocking(ModelCoordinate(1, 19)));
+    CHECK(tiles.getRecord(tiles.getTileIndex(ModelCoordinate(0, 0))).object == &wall);
+
+    // setting the same tile again is no change
+    CHECK_FALSE(tiles.setTile(ModelCoordinate(5, 5), &ground));
+
+    ModelCoordinate min;
+    ModelCoordinate max;
+    REQUIRE(tiles.getBounds(min, max));
+    CHECK(min == ModelCoordinate(0, 0));
+    CHECK(max == ModelCoordinate(29, 19));
+
+    // growing keeps the tiles
+    tiles.setTile(ModelCoordinate(-7, -3), &wall);
+    CHECK(tiles.getTile(ModelCoordinate(-7, -3)) == &wall);
+    CHECK(tiles.getTile(ModelCoordinate(29, 19)) == &ground);
+    CHECK(tiles.getTile(ModelCoordinate(0, 7)) == &wall);
+    REQUIRE(tiles.getBounds(min, max));
+    CHECK(min == ModelCoordinate(-7, -3));
+
+    // removing the tile on the border shrinks the bounds
+    CHECK(tiles.setTile(ModelCoordinate(-7, -3), nullptr));
+    CHECK(tiles.getTileCount() == 600);
+    CHECK(tiles.hasTilesOf(&wall));
+    REQUIRE(tiles.getBounds(min, max));
+    CHECK(min == ModelCoordinate(0, 0));
+    CHECK(max == ModelCoordinate(29, 19));
+
+    // the record stays, but no cell uses it
+    for (int32_t y = 0; y < 20; ++y) {
+        tiles.setTile(ModelCoordinate(0, y), &ground);
+    }
+    CHECK_FALSE(tiles.hasTilesOf(&wall));
+    CHECK(tiles.hasTilesOf(&ground));
+    CHECK(tiles.getRecordCount() == 2);
+
+    tiles.clear();
+    CHECK(tiles.getTileCount() == 0);
+    CHECK(tiles.getRecordCount() == 0);
+    CHECK_FALSE(tiles.getBounds(min, max));
+}
+
+TEST_CASE("TileGrid holds at most 65535 objects", "[core][tilegrid]")
+{
+    std::vector<std::unique_ptr<Object>> objects;
+    TileGrid tiles;
+    for (int32_t i = 0; i < 65535; ++i) {
+        objects.push_back(std::make_unique<Object>("object" + std::to_string(i), "test"));
+        tiles.setTile(ModelCoordinate(i % 256, i / 256), objects.back().get());
+    }
+    Object extra("extra", "test");
+    CHECK_THROWS_AS(tiles.setTile(ModelCoordinate(0, 300), &extra), FIFE::IndexOverflow);
+    // objects with a record can still be placed
+    CHECK(tiles.setTile(ModelCoordinate(0, 300), objects.front().get()));
+}
+
+TEST_CASE("Layer tiles block like static instances", "[core][tilegrid]")
+{
+    TimeManager tm;
+    SquareGrid grid;
+    Layer layer("test_layer", nullptr, &grid);
+    Object ground("ground", "test");
+    Object wall("wall", "test");
+    wall.setBlocking(true);
+    wall.setStatic(true);
+    for (int32_t y = 0; y < 10; ++y) {
+        for (int32_t x = 0; x < 10; ++x) {
+            layer.setTile(ModelCoordinate(x, y), &ground);
+        }
+    }
+    layer.setTile(ModelCoordinate(4, 4), &wall);
+    CHECK(layer.hasTiles());
+    CHECK_FALSE(layer.hasInstances());
+    CHECK(layer.cellContainsBlockingInstance(ModelCoordinate(4, 4)));
+
+    ModelCoordinate min;
+    ModelCoordinate max;
+    layer.getMinMaxCoordinates(min, max);
+    CHECK(min == ModelCoordinate(0, 0));
+    CHECK(max == ModelCoordinate(9, 9));
+
+    layer.setWalkable(true);
+    layer.createCellCache();
+    CellCache* cache = layer.getCellCache();
+    cache->createCells();
+    REQUIRE(cache->getCell(ModelCoordinate(9, 9)) != nullptr);
+    CHECK(cache->getCell(ModelCoordinate(4, 4))->getCellType() == FIFE::CTYPE_STATIC_BLOCKER);
+    CHECK(cache->getCell(ModelCoordinate(3, 4))->getCellType() == FIFE::CTYPE_NO_BLOCKER);
+
+    SECTION("changed tiles update the cells")
+    {
+        layer.setTile(ModelCoordinate(3, 4), &wall);
+        CHECK(cache->getCell(ModelCoordinate(3, 4))->getCellType() == FIFE::CTYPE_STATIC_BLOCKER);
+        layer.setTile(ModelCoordinate(3, 4), nullptr);
+        CHECK(cache->getCell(ModelCoordinate(3, 4))->getCellType() == FIFE::CTYPE_NO_BLOCKER);
+
+        // a tile outside of the cache creates its cell
+        layer.setTile(ModelCoordinate(12, 3), &wall);
+        REQUIRE(cache->getCell(ModelCoordinate(12, 3)) != nullptr);
+        CHECK(cache->getCell(ModelCoordinate(12, 3))->getCellType() == FIFE::CTYPE_STATIC_BLOCKER);
+    }
+
+    SECTION("instances above the tile decide")
+    {
+        Instance* bridge = layer.createInstance(&ground, ModelCoordinate(4, 4, 0));
+        bridge->setCellStackPosition(1);
+        cache->getCell(ModelCoordinate(4, 4))->updateCellInfo();
+        CHECK(cache->getCell(ModelCoordinate(4, 4))->getCellType() == FIFE::CTYPE_NO_BLOCKER);
+    }
+
+    SECTION("a touched tile becomes an instance")
+    {
+        Instance* instance = layer.createTileInstance(ModelCoordinate(4, 4), "door");
+        REQUIRE(instance != nullptr);
+        CHECK(instance->getObject() == &wall);
+        CHECK(instance->getName() == "door");
+        CHECK(instance->getLocationRef().getLayerCoordinates() == ModelCoordinate(4, 4));
+        CHECK(layer.getTile(ModelCoordinate(4, 4)) == nullptr);
+        CHECK(layer.getTileGrid()->getTileCount() == 99);
+        CHECK(cache->getCell(ModelCoordinate(4, 4))->getCellType() == FIFE::CTYPE_STATIC_BLOCKER);
+        CHECK(layer.createTileInstance(ModelCoordinate(4, 4)) == nullptr);
+    }
+}
+
+TEST_CASE("TileGrid fill throughput", "[tilegrid][.benchmark]")
+{
+    TimeManager tm;
+    SquareGrid grid;
+    Layer tileLayer("tiles", nullptr, &grid);
+    Layer instanceLayer("instances", nullptr, &grid);
+    Object ground("ground", "test");
+    int32_t const size = 1000;
+
+    using Clock                = std::chrono::steady_clock;
+    Clock::time_point const t0 = Clock::now();
+    for (int32_t y = 0; y < size; ++y) {
+        for (int32_t x = 0; x < size; ++x) {
+            tileLayer.setTile(ModelCoordinate(x, y), &ground);
+        }
+    }
+    Clock::time_point const t1 = Clock::now();
+    // a tenth of the cells, instances are too slow for the full map
+    for (int32_t y = 0; y < size / 10; ++y) {
+        for (int32_t x = 0; x < size; ++x) {
+            instanceLayer.createInstance(&ground, ModelCoordinate(x, y, 0));
+        }
+    }
+    Clock::time_point const t2 = Clock::now();
+
+    double const tiles     = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    double const instances = std::chrono::duration<double, std::milli>(t2 - t1).count();
+    std::cout << "TileGrid: " << size * size << " tiles in " << tiles << " ms, " << size * size / 10
+              << " instances in " << instances << " ms, " << sizeof(Instance) << " bytes per instance object\n";
+    CHECK(tileLayer.getTileGrid()->getTileCount() == static_cast<std::size_t>(size) * size);
+}
@@ -0,0 +1,198 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+// SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+// Standard C++ library includes
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// 3rd party library includes
+#include <catch2/catch_test_macros.hpp>
+
+// FIFE includes
+#include "model/metamodel/grids/squaregrid.h"
+#include "model/metamodel/modelcoords.h"
+#include "model/metamodel/object.h"
+#include "model/structures/cell.h"
+#include "model/structures/cellcache.h"
+#include "model/structures/instance.h"
+#include "model/structures/layer.h"
+#include "model/structures/location.h"
+#include "model/structures/trigger.h"
+#include "model/structures/triggercellindex.h"
+#include "model/structures/triggercontroller.h"
+#include "util/structures/rect.h"
+#include "util/time/timemanager.h"
+
+using FIFE::Instance;
+using FIFE::Layer;
+using FIFE::ModelCoordinate;
+using FIFE::Object;
+using FIFE::Rect;
+using FIFE::SquareGrid;
+using FIFE::TimeManager;
+using FIFE::Trigger;
+using FIFE::TriggerCellIndex;
+using FIFE::TriggerController;
+
+namespace
+{
+
+    struct TriggerFixture
+    {
+            TimeManager tm;
+            SquareGrid grid;
+            std::unique_ptr<Layer> layer;
+            std::unique_ptr<Object> ground;
+            std::unique_ptr<Object> walker;
+            TriggerController controller{nullptr};
+
+            // a walkable size x size square
+            explicit TriggerFixture(int32_t size)
+            {
+                layer  = std::make_unique<Layer>("test_layer", nullptr, &grid);
+                ground = std::make_unique<Object>("ground", "test");
+                walker = std::make_unique<Object>("walker", "test");
+                for (int32_t y = 0; y < size; ++y) {
+                    for (int32_t x = 0; x < size; ++x) {
+                        layer->createInstance(ground.get(), ModelCoordinate(x, y, 0));
+                    }
+                }
+                layer->setWalkable(true);
+                layer->createCellCache();
+                layer->getCellCache()->createCells();
+            }
+
+            ~TriggerFixture()
+            {
+                // the triggers observe the cells of the layer
+                for (std::string const & name : controller.getAllTriggerNames()) {
+                    controller.deleteTrigger(name);
+                }
+            }
+
+            TriggerFixture(TriggerFixture const &)            = delete;
+            TriggerFixture& operator=(TriggerFixture const &) = delete;
+            TriggerFixture(TriggerFixture&&)                  = delete;
+            TriggerFixture& operator=(TriggerFixture&&)       = delete;
+
+            Instance* createWalker(int32_t x, int32_t y)
+            {
+                Instance* instance = layer->createInstance(walker.get(), ModelCoordinate(x, y, 0));
+                layer->update();
+                return instance;
+            }
+
+            void moveTo(Instance* instance, int32_t x, int32_t y)
+            {
+                FIFE::Location location(layer.get());
+                location.setLayerCoordinates(ModelCoordinate(x, y, 0));
+                instance->setLocation(location);
+                layer->update();
+            }
+
+            FIFE::Cell* cell(int32_t x, int32_t y) const
+            {
+                return layer->getCellCache()->getCell(ModelCoordinate(x, y));
+            }
+    };
+
+} // namespace
+
+TEST_CASE("TriggerController indexes the cells of a rect", "[core][trigger]")
+{
+    TriggerFixture f(20);
+    Trigger* trigger = f.controller.createTriggerOnRect("area", f.layer.get(), Rect(2, 2, 10, 10));
+    trigger->addTriggerCondition(FIFE::CELL_TRIGGER_ENTER);
+    trigger->enableForAllInstances();
+
+    TriggerCellIndex* index = f.controller.getCellIndex();
+    CHECK(index->getTriggerCount() == 1);
+    CHECK(index->getCellCount() == trigger->getAssignedCells().size());
+    CHECK(index->getTriggers(f.cell(5, 5)).size() == 1);
+    CHECK(index->getTriggers(f.cell(15, 15)).empty());
+
+    Instance* instance = f.createWalker(0, 0);
+    CHECK(!trigger->isTriggered());
+    f.moveTo(instance, 15, 15);
+    CHECK(!trigger->isTriggered());
+    f.moveTo(instance, 5, 5);
+    CHECK(trigger->isTriggered());
+}
+
+TEST_CASE("TriggerController checks conditions and enabled instances", "[core][trigger]")
+{
+    TriggerFixture f(20);
+    Trigger* enter = f.controller.createTriggerOnCell("enter", f.cell(5, 5));
+    enter->addTriggerCondition(FIFE::CELL_TRIGGER_ENTER);
+    Trigger* exit = f.controller.createTriggerOnCell("exit", f.cell(5, 5));
+    exit->addTriggerCondition(FIFE::CELL_TRIGGER_EXIT);
+    exit->enableForAllInstances();
+    CHECK(f.controller.getCellIndex()->getTriggers(f.cell(5, 5)).size() == 2);
+    CHECK(f.controller.getCellIndex()->getCellCount() == 1);
+
+    Instance* stranger = f.createWalker(4, 5);
+    Instance* hero     = f.createWalker(6, 5);
+    enter->enableForInstance(hero);
+    CHECK(enter->isEnabledForInstance(hero));
+    CHECK(!enter->isEnabledForInstance(stranger));
+
+    f.moveTo(stranger, 5, 5);
+    CHECK(!enter->isTriggered());
+    CHECK(!exit->isTriggered());
+    f.moveTo(stranger, 4, 5);
+    CHECK(exit->isTriggered());
+
+    f.moveTo(hero, 5, 5);
+    CHECK(enter->isTriggered());
+
+    enter->removeTriggerCondition(FIFE::CELL_TRIGGER_ENTER);
+    CHECK(!enter->hasTriggerCondition(FIFE::CELL_TRIGGER_ENTER));
+    CHECK(enter->getTriggerConditions().empty());
+}
+
+TEST_CASE("TriggerController frees the cells of deleted triggers", "[core][trigger]")
+{
+    TriggerFixture f(20);
+    for (int32_t i = 0; i < 100; ++i) {
+        Trigger* trigger =
+            f.controller.createTriggerOnRect("trigger" + std::to_string(i), f.layer.get(), Rect(0, 0, 4, 4));
+        trigger->addTriggerCondition(FIFE::CELL_TRIGGER_ENTER);
+        trigger->enableForAllInstances();
+    }
+    TriggerCellIndex* index = f.controller.getCellIndex();
+    CHECK(index->getTriggerCount() == 100);
+    CHECK(index->getTriggers(f.cell(1, 1)).size() == 100);
+
+    Instance* instance = f.createWalker(10, 10);
+    f.moveTo(instance, 1, 1);
+    for (Trigger* trigger : f.controller.getAllTriggers()) {
+        CHECK(trigger->isTriggered());
+    }
+
+    for (int32_t i = 0; i < 100; ++i) {
+        f.controller.deleteTrigger("trigger" + std::to_string(i));
+    }
+    CHECK(index->getTriggerCount() == 0);
+    CHECK(index->getCellCount() == 0);
+
+    // the slots are reused
+    Trigger* trigger = f.controller.createTriggerOnCell("again", f.cell(3, 3));
+    CHECK(index->getTriggers(f.cell(3, 3)).front() == trigger);
+}
+
+TEST_CASE("TriggerController moves the cells of attached triggers", "[core][trigger]")
+{
+    TriggerFixture f(20);
+    Instance* carrier = f.createWalker(5, 5);
+    Trigger* trigger  = f.controller.createTriggerOnRect("aura", f.layer.get(), Rect(4, 4, 3, 3));
+    trigger->attach(carrier);
+    TriggerCellIndex* index = f.controller.getCellIndex();
+    CHECK(index->getCellCount() == 9);
+
+    f.moveTo(carrier, 10, 5);
+    CHECK(index->getCellCount() == 9);
+    CHECK(index->getTriggers(f.cell(5, 5)).empty());
+    CHECK(index->getTriggers(f.cell(10, 5)).size() == 1);
+    CHECK(trigger->getAssignedCells().size() == 9);
+}
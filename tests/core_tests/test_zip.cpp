@@ -14,19 +14,34 @@
 #include <catch2/catch_test_macros.hpp>
 
 // FIFE includes
+#include "util/base/jobpool.h"
 #include "vfs/raw/rawdata.h"
 #include "vfs/vfs.h"
 #include "vfs/vfsdirectory.h"
+#include "vfs/zip/zipentrycache.h"
 #include "vfs/zip/zipsource.h"
 
+using FIFE::JobPool;
 using FIFE::NotFound;
 using FIFE::RawData;
 using FIFE::VFS;
 using FIFE::VFSDirectory;
+using FIFE::ZipCacheStats;
+using FIFE::ZipEntryCache;
 using FIFE::ZipSource;
 
 static char const * const COMPRESSED_FILE = "tests/data/testmap.zip";
 static char const * const RAW_FILE        = "tests/data/test.map";
+static char const * const MAP_FILE        = "ziptest_content/maps/test.map";
+static char const * const OTHER_MAP_FILE  = "content/maps/test.map";
+
+static std::vector<uint8_t> readAll(RawData& data)
+{
+    std::vector<uint8_t> bytes(data.getDataLength());
+    data.setIndex(0);
+    data.readInto(bytes.data(), data.getDataLength());
+    return bytes;
+}
 
 TEST_CASE("ZipSource::open decompresses stored and deflated entries correctly", "[core][zip]")
 {
@@ -77,3 +92,119 @@ TEST_CASE("ZipSource::open decompresses stored and deflated entries correctly",
         CHECK((rawc) == (compc));
     }
 }
+
+TEST_CASE("ZipSource caches decompressed entries", "[core][zip]")
+{
+    std::shared_ptr<VFS> const vfs = std::make_shared<VFS>();
+    vfs->addSource(std::make_unique<VFSDirectory>(vfs.get()));
+    ZipSource zip(vfs.get(), COMPRESSED_FILE);
+
+    ZipEntryCache& cache = vfs->getZipCache();
+
+    auto first                       = zip.open(MAP_FILE);
+    std::vector<uint8_t> const bytes = readAll(*first);
+    CHECK(cache.getStats().misses == 1);
+    CHECK(cache.getStats().hits == 0);
+    CHECK(cache.getStats().bytesInflated == bytes.size());
+    CHECK(cache.getSize() == bytes.size());
+
+    auto second = zip.open(MAP_FILE);
+    CHECK(cache.getStats().misses == 1);
+    CHECK(cache.getStats().hits == 1);
+    CHECK(cache.getStats().bytesInflated == bytes.size());
+    CHECK(readAll(*second) == bytes);
+
+    // only one of the two maps fits, the least recently opened one is dropped
+    cache.setLimit(bytes.size() + 1024);
+    zip.open(OTHER_MAP_FILE);
+    CHECK(cache.getSize() == bytes.size());
+    zip.open(MAP_FILE);
+    CHECK(cache.getStats().misses == 3);
+
+    cache.setLimit(0);
+    CHECK(cache.getSize() == 0);
+    cache.resetStats();
+    zip.open(MAP_FILE);
+    zip.open(MAP_FILE);
+    CHECK(cache.getStats().misses == 2);
+    CHECK(cache.getStats().hits == 0);
+    // files that were opened before keep their data
+    CHECK(readAll(*first) == bytes);
+}
+
+TEST_CASE("ZipSources of a VFS share one cache budget", "[core][zip]")
+{
+    std::shared_ptr<VFS> const vfs = std::make_shared<VFS>();
+    vfs->addSource(std::make_unique<VFSDirectory>(vfs.get()));
+    ZipEntryCache& cache = vfs->getZipCache();
+
+    auto zip                         = std::make_unique<ZipSource>(vfs.get(), COMPRESSED_FILE);
+    std::vector<uint8_t> const bytes = readAll(*zip->open(MAP_FILE));
+    cache.setLimit(bytes.size() + 1024);
+
+    // the entry of the second archive drops the one of the first
+    ZipSource other(vfs.get(), COMPRESSED_FILE);
+    other.open(MAP_FILE);
+    CHECK(cache.getSize() == bytes.size());
+    zip->open(MAP_FILE);
+    CHECK(cache.getStats().misses == 3);
+    CHECK(cache.getSize() == bytes.size());
+
+    // a destroyed archive leaves nothing behind
+    zip.reset();
+    CHECK(cache.getSize() == 0);
+}
+
+TEST_CASE("ZipSource::openBatch decompresses entries in parallel", "[core][zip]")
+{
+    JobPool const pool(2);
+    std::shared_ptr<VFS> const vfs = std::make_shared<VFS>();
+    vfs->addSource(std::make_unique<VFSDirectory>(vfs.get()));
+    ZipSource zip(vfs.get(), COMPRESSED_FILE);
+
+    std::vector<std::string> const paths = {
+        MAP_FILE, OTHER_MAP_FILE, "ziptest_content/testdir1/file-a", MAP_FILE, "does-not-exist"};
+    std::vector<std::unique_ptr<RawData>> files = zip.openBatch(paths);
+    REQUIRE(files.size() == paths.size());
+    REQUIRE(files[0] != nullptr);
+    REQUIRE(files[1] != nullptr);
+    REQUIRE(files[2] != nullptr);
+    REQUIRE(files[3] != nullptr);
+    CHECK(files[4] == nullptr);
+
+    auto raw                         = vfs->open(RAW_FILE);
+    std::vector<uint8_t> const bytes = readAll(*raw);
+    CHECK(readAll(*files[0]) == bytes);
+    CHECK(readAll(*files[1]) == bytes);
+    CHECK(files[2]->getDataLength() == 0);
+    CHECK(readAll(*files[3]) == bytes);
+    ZipCacheStats const & stats = vfs->getZipCache().getStats();
+    CHECK(stats.misses == 3);
+    CHECK(stats.bytesInflated == 2 * bytes.size());
+
+    std::vector<std::unique_ptr<RawData>> const again = zip.openBatch({MAP_FILE, OTHER_MAP_FILE});
+    CHECK(stats.hits == 2);
+    CHECK(stats.misses == 3);
+}
+
+TEST_CASE("VFS::openBatch opens the files of every source", "[core][zip]")
+{
+    JobPool const pool(2);
+    std::shared_ptr<VFS> const vfs = std::make_shared<VFS>();
+    vfs->addSource(std::make_unique<VFSDirectory>(vfs.get()));
+    vfs->addSource(std::make_unique<ZipSource>(vfs.get(), COMPRESSED_FILE));
+
+    std::vector<std::string> const paths = {MAP_FILE, RAW_FILE, "does-not-exist", OTHER_MAP_FILE};
+    std::vector<std::unique_ptr<RawData>> files = vfs->openBatch(paths);
+    REQUIRE(files.size() == paths.size());
+    REQUIRE(files[0] != nullptr);
+    REQUIRE(files[1] != nullptr);
+    CHECK(files[2] == nullptr);
+    REQUIRE(files[3] != nullptr);
+
+    // the directory source opens its file one by one, the archive decompresses its two together
+    std::vector<uint8_t> const bytes = readAll(*files[1]);
+    CHECK(readAll(*files[0]) == bytes);
+    CHECK(readAll(*files[3]) == bytes);
+    CHECK(vfs->getZipCache().getStats().misses == 2);
+}
@@ -105,3 +105,36 @@ def test_camera(engine):
     engine.finalizePumping()
 
     gc.collect()
+
+
+def test_frame_lookup(engine):
+    img_mgr = engine.getImageManager()
+    anim_mgr = engine.getAnimationManager()
+    img = img_mgr.load("tests/data/crate/full_s_000.png")
+
+    uniform = anim_mgr.create("frame_lookup_uniform")
+    for _ in range(4):
+        uniform.addFrame(img, 100)
+    assert uniform.getDuration() == 400
+    assert uniform.getFrameIndex64(0) == 0
+    assert uniform.getFrameIndex64(99) == 0
+    assert uniform.getFrameIndex64(100) == 1
+    assert uniform.getFrameIndex64(399) == 3
+    # the end time still belongs to the last frame
+    assert uniform.getFrameIndex64(400) == 3
+    assert uniform.getFrameIndex64(401) == -1
+
+    mixed = anim_mgr.create("frame_lookup_mixed")
+    mixed.addFrame(img, 50)
+    # a frame without duration is hidden by the next one
+    mixed.addFrame(img, 0)
+    mixed.addFrame(img, 200)
+    mixed.addFrame(img, 10)
+    assert mixed.getDuration() == 260
+    assert mixed.getFrameIndex64(49) == 0
+    assert mixed.getFrameIndex64(50) == 2
+    assert mixed.getFrameIndex64(249) == 2
+    assert mixed.getFrameIndex64(250) == 3
+    assert mixed.getFrameIndex64(260) == 3
+    assert mixed.getFrameIndex64(261) == -1
+    assert mixed.getFrameByTimestamp64(120)
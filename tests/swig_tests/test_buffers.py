@@ -0,0 +1,95 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+# SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+import array
+
+import pytest
+
+from fife import fife
+
+
+def _create_layer(engine, name):
+    model = engine.getModel()
+    map_obj = model.createMap(name)
+    layer = map_obj.createLayer("layer", model.getCellGrid("square"))
+    ground = model.createObject("ground", name)
+    for y in range(2):
+        for x in range(3):
+            layer.createInstance(ground, fife.ModelCoordinate(x, y))
+    return model, layer
+
+
+def test_instance_buffers(engine_minimized):
+    model, layer = _create_layer(engine_minimized, "buffers001")
+    instances = layer.getInstances()
+
+    ids = layer.getInstanceIds()
+    assert isinstance(ids, memoryview)
+    assert ids.format == "Q"
+    assert ids.shape == (6,)
+    assert ids.tolist() == [instance.getId() for instance in instances]
+
+    positions = layer.getInstancePositions()
+    assert positions.format == "d"
+    assert positions.shape == (6, 3)
+    assert positions.tolist()[4] == [1.0, 1.0, 0.0]
+
+    rotations = layer.getInstanceRotations()
+    assert rotations.format == "i"
+    assert rotations.shape == (6,)
+
+    # the setters take any C-contiguous buffer with the item format
+    moved = array.array("d", [value + 10.0 for row in positions.tolist() for value in row])
+    layer.setInstancePositions(moved)
+    coords = instances[4].getLocation().getLayerCoordinates()
+    assert (coords.x, coords.y) == (11, 11)
+
+    layer.setInstanceRotations(array.array("i", [90] * 6))
+    assert instances[0].getRotation() == 90
+    layer.setInstanceRotations(memoryview(array.array("i", range(0, 360, 60))))
+    assert [instance.getRotation() for instance in instances] == list(range(0, 360, 60))
+
+    model.deleteMaps()
+
+
+def test_instance_buffer_errors(engine_minimized):
+    model, layer = _create_layer(engine_minimized, "buffers002")
+
+    with pytest.raises(fife.InvalidFormat):
+        layer.setInstancePositions([0.0] * 18)
+    with pytest.raises(fife.InvalidFormat):
+        layer.setInstancePositions(array.array("f", [0.0] * 18))
+    with pytest.raises(fife.InvalidFormat):
+        layer.setInstanceRotations(array.array("d", [0.0] * 6))
+    with pytest.raises(fife.IndexOverflow):
+        layer.setInstancePositions(array.array("d", [0.0] * 17))
+    with pytest.raises(fife.IndexOverflow):
+        layer.setInstanceRotations(array.array("i", [0] * 5))
+
+    model.deleteMaps()
+
+
+def test_cell_buffers(engine_minimized):
+    model, layer = _create_layer(engine_minimized, "buffers003")
+    layer.setWalkable(True)
+    layer.createCellCache()
+    cache = layer.getCellCache()
+    cache.createCells()
+
+    # a 4x2 rect that reaches over the right border
+    rect = fife.Rect(0, 0, 4, 2)
+    types = cache.getCellTypes(rect)
+    assert types.format == "B"
+    assert types.shape == (2, 4)
+    assert types[0, 0] == fife.CTYPE_NO_BLOCKER
+    assert types[1, 3] == fife.CTYPE_CELL_BLOCKER
+
+    costs = cache.getCostGrid(rect)
+    assert costs.format == "d"
+    assert costs.shape == (2, 4)
+    assert costs[0, 0] > 0.0
+    assert costs[0, 3] == -1.0
+
+    assert cache.getCellTypes(fife.Rect(0, 0, 0, 0)).tolist() == []
+
+    model.deleteMaps()
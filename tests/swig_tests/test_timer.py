@@ -24,3 +24,37 @@ def test_events(engine_minimized):
         timemanager.update()
 
     timemanager.unregisterEvent(e)
+
+
+def test_due_events_in_schedule_order(engine_minimized):
+    order = []
+
+    class OrderedEvent(fife.TimeEvent):
+        def __init__(self, period, name):
+            fife.TimeEvent.__init__(self, period)
+            self.name = name
+
+        def updateEvent(self, curtime):
+            order.append(self.name)
+
+    timemanager = engine_minimized.getTimeManager()
+    timemanager.update()
+    events = [OrderedEvent(1, name) for name in ("a", "b", "c", "d")]
+    idle = OrderedEvent(10**9, "idle")
+    for event in [*events, idle]:
+        event.setLastUpdateTime64(0)
+        timemanager.registerEvent(event)
+    timemanager.unregisterEvent(events[2])
+    assert timemanager.getEventCount() >= 4
+
+    time.sleep(0.01)
+    timemanager.update()
+    assert order == ["a", "b", "d"]
+    assert timemanager.getFiredEventCount() == 3
+
+    for event in [*events, idle]:
+        timemanager.unregisterEvent(event)
+    order.clear()
+    time.sleep(0.01)
+    timemanager.update()
+    assert order == []
@@ -22,3 +22,21 @@ def test_read_bytes(engine_minimized):
     vfs = engine_minimized.getVFS()
     data = vfs.open("run_tests.py")
     assert data.getDataInBytes()
+
+
+def test_zip_cache_stats(engine_minimized):
+    vfs = engine_minimized.getVFS()
+    vfs.addNewSource("tests/data/testmap.zip")
+    cache = vfs.getZipCache()
+    cache.resetStats()
+    first = vfs.open("ziptest_content/maps/test.map")
+    second = vfs.open("ziptest_content/maps/test.map")
+    assert first.getDataInBytes() == second.getDataInBytes()
+    stats = cache.getStats()
+    assert stats.misses == 1
+    assert stats.hits == 1
+    assert stats.bytesInflated == first.getDataLength()
+    assert 0 < cache.getSize() <= cache.getLimit()
+    cache.clear()
+    assert cache.getSize() == 0
+    vfs.removeSource("tests/data/testmap.zip")
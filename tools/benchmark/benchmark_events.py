@@ -0,0 +1,301 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+# SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+"""Time of the event phase of Engine::pump under bursts of mouse input.
+
+Every frame a burst of synthetic mouse motion and wheel events is pushed into
+the SDL queue, as a high rate mouse would deliver them, and the engine is
+pumped once. The time of the event phase of Engine.getFrameStats() is measured
+for every coalescing mode of EventManager.setEventCoalescing(), with and
+without Python mouse listeners. The results are printed as JSON.
+
+Axis motion is not generated, the joystick manager only dispatches events of
+opened devices.
+"""
+
+import argparse
+import ctypes
+import ctypes.util
+import json
+import os
+import sys
+from pathlib import Path
+
+SDL_EVENT_MOUSE_MOTION = 0x400
+SDL_EVENT_MOUSE_WHEEL = 0x403
+
+MODES = ("none", "motion", "wheel", "all")
+
+
+class SDLMouseMotionEvent(ctypes.Structure):
+    _fields_ = [
+        ("type", ctypes.c_uint32),
+        ("reserved", ctypes.c_uint32),
+        ("timestamp", ctypes.c_uint64),
+        ("windowID", ctypes.c_uint32),
+        ("which", ctypes.c_uint32),
+        ("state", ctypes.c_uint32),
+        ("x", ctypes.c_float),
+        ("y", ctypes.c_float),
+        ("xrel", ctypes.c_float),
+        ("yrel", ctypes.c_float),
+    ]
+
+
+class SDLMouseWheelEvent(ctypes.Structure):
+    _fields_ = [
+        ("type", ctypes.c_uint32),
+        ("reserved", ctypes.c_uint32),
+        ("timestamp", ctypes.c_uint64),
+        ("windowID", ctypes.c_uint32),
+        ("which", ctypes.c_uint32),
+        ("x", ctypes.c_float),
+        ("y", ctypes.c_float),
+        ("direction", ctypes.c_uint32),
+        ("mouse_x", ctypes.c_float),
+        ("mouse_y", ctypes.c_float),
+        ("integer_x", ctypes.c_int32),
+        ("integer_y", ctypes.c_int32),
+    ]
+
+
+class SDLEvent(ctypes.Union):
+    _fields_ = [
+        ("type", ctypes.c_uint32),
+        ("motion", SDLMouseMotionEvent),
+        ("wheel", SDLMouseWheelEvent),
+        ("padding", ctypes.c_uint8 * 128),
+    ]
+
+
+def _prepend_env_path(var_name, path):
+    path_str = str(path)
+    current = os.environ.get(var_name, "")
+    parts = [p for p in current.split(os.pathsep) if p]
+    if path_str in parts:
+        return
+    os.environ[var_name] = path_str if not current else path_str + os.pathsep + current
+
+
+def _bootstrap_runtime_paths(repo_root):
+    local_build = repo_root / "out" / "build" / "clang22-x64-linux-dbg-cov"
+    if local_build.is_dir() and str(local_build) not in sys.path:
+        sys.path.insert(0, str(local_build))
+        _prepend_env_path("PYTHONPATH", local_build)
+
+    dependency_lib = (
+        repo_root / "out" / "fife-dependencies" / "x64-linux" / "install" / "lib"
+    )
+    if dependency_lib.is_dir():
+        _prepend_env_path("LD_LIBRARY_PATH", dependency_lib)
+
+
+def _set_headless_defaults():
+    os.environ.setdefault("SDL_VIDEODRIVER", "dummy")
+    os.environ.setdefault("SDL_AUDIODRIVER", "dummy")
+
+
+def _preload_native_libs(repo_root):
+    lib_dir = repo_root / "out" / "fife-dependencies" / "x64-linux" / "install" / "lib"
+    build_dir = repo_root / "out" / "build" / "clang22-x64-linux-dbg-cov"
+    candidates = [
+        lib_dir / "libfifechan.so.0.2.0",
+        lib_dir / "libfifechan.so",
+        build_dir / "libfifengine.so.0.5.0",
+        build_dir / "libfifengine.so",
+    ]
+    for lib in candidates:
+        if lib.is_file():
+            ctypes.CDLL(str(lib), mode=ctypes.RTLD_GLOBAL)
+
+
+def _load_sdl(repo_root):
+    lib_dir = repo_root / "out" / "fife-dependencies" / "x64-linux" / "install" / "lib"
+    candidates = [lib_dir / "libSDL3.so.0", lib_dir / "libSDL3.so"]
+    found = ctypes.util.find_library("SDL3")
+    if found:
+        candidates.append(found)
+    for lib in candidates:
+        try:
+            sdl = ctypes.CDLL(str(lib), mode=ctypes.RTLD_GLOBAL)
+        except OSError:
+            continue
+        sdl.SDL_PushEvent.argtypes = [ctypes.POINTER(SDLEvent)]
+        sdl.SDL_PushEvent.restype = ctypes.c_bool
+        return sdl
+    raise RuntimeError("could not load the SDL3 library")
+
+
+def _build_engine(fife, repo_root):
+    engine = fife.Engine()
+    settings = engine.getSettings()
+    settings.setRenderBackend("SDL")
+    settings.setScreenWidth(1024)
+    settings.setScreenHeight(768)
+    settings.setFullScreen(False)
+    settings.setFrameLimitEnabled(False)
+    settings.setVSync(False)
+    settings.setDefaultFontPath(str(repo_root / "tests" / "data" / "FreeMono.ttf"))
+    settings.setDefaultFontGlyphs(
+        " abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+    )
+    settings.setDefaultFontSize(12)
+    settings.setWindowTitle("FIFE event benchmark")
+    engine.init()
+    return engine
+
+
+def _make_listener(fife):
+    class MouseListener(fife.IMouseListener):
+        def __init__(self):
+            fife.IMouseListener.__init__(self)
+            self.moved = 0
+            self.wheel = 0
+
+        def mouseEntered(self, evt):
+            pass
+
+        def mouseExited(self, evt):
+            pass
+
+        def mousePressed(self, evt):
+            pass
+
+        def mouseReleased(self, evt):
+            pass
+
+        def mouseClicked(self, evt):
+            pass
+
+        def mouseWheelMovedUp(self, evt):
+            self.wheel += 1
+
+        def mouseWheelMovedDown(self, evt):
+            self.wheel += 1
+
+        def mouseWheelMovedRight(self, evt):
+            pass
+
+        def mouseWheelMovedLeft(self, evt):
+            pass
+
+        def mouseMoved(self, evt):
+            self.moved += 1
+
+        def mouseDragged(self, evt):
+            pass
+
+    return MouseListener()
+
+
+def _push_burst(sdl, frame, burst):
+    event = SDLEvent()
+    for i in range(burst):
+        ctypes.memset(ctypes.byref(event), 0, ctypes.sizeof(event))
+        if i % 8 == 7:
+            # wheel ticks in one direction per frame
+            event.wheel.type = SDL_EVENT_MOUSE_WHEEL
+            event.wheel.y = 1.0 if frame % 2 == 0 else -1.0
+            event.wheel.integer_y = 1 if frame % 2 == 0 else -1
+            event.wheel.mouse_x = float(i % 1024)
+            event.wheel.mouse_y = float(frame % 768)
+        else:
+            event.motion.type = SDL_EVENT_MOUSE_MOTION
+            event.motion.x = float(i % 1024)
+            event.motion.y = float(frame % 768)
+            event.motion.xrel = 1.0
+        sdl.SDL_PushEvent(ctypes.byref(event))
+
+
+def _summary(samples):
+    ordered = sorted(samples)
+    return {
+        "mean_ms": sum(ordered) / len(ordered),
+        "median_ms": ordered[len(ordered) // 2],
+        "p95_ms": ordered[min(len(ordered) - 1, (len(ordered) * 95) // 100)],
+        "max_ms": ordered[-1],
+    }
+
+
+def _run_mode(fife, engine, sdl, mode, listeners, frames, burst):
+    coalescing = {
+        "none": fife.COALESCE_NONE,
+        "motion": fife.COALESCE_MOUSE_MOTION,
+        "wheel": fife.COALESCE_MOUSE_MOTION | fife.COALESCE_MOUSE_WHEEL,
+        "all": fife.COALESCE_ALL,
+    }[mode]
+    manager = engine.getEventManager()
+    manager.setEventCoalescing(coalescing)
+    attached = [_make_listener(fife) for _ in range(listeners)]
+    for listener in attached:
+        manager.addMouseListener(listener)
+
+    samples = []
+    for frame in range(frames):
+        _push_burst(sdl, frame, burst)
+        engine.pump()
+        samples.append(engine.getFrameStats().events)
+
+    for listener in attached:
+        manager.removeMouseListener(listener)
+    # let the removed listeners leave the lists before they are collected
+    engine.pump()
+    return {
+        "mode": mode,
+        "listeners": listeners,
+        "dispatched": sum(l.moved + l.wheel for l in attached),
+        "events": _summary(samples),
+    }
+
+
+def main():
+    repo_root = Path(__file__).resolve().parents[2]
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--frames", type=int, default=600)
+    parser.add_argument(
+        "--burst", type=int, default=64, help="synthetic mouse events per frame"
+    )
+    parser.add_argument(
+        "--listeners", type=int, default=4, help="Python mouse listeners"
+    )
+    parser.add_argument(
+        "--modes",
+        default=",".join(MODES),
+        help="comma separated coalescing modes, of " + ", ".join(MODES),
+    )
+    args = parser.parse_args()
+
+    modes = [m for m in args.modes.split(",") if m]
+    unknown = [m for m in modes if m not in MODES]
+    if unknown:
+        parser.error(f"unknown modes: {', '.join(unknown)}")
+
+    _bootstrap_runtime_paths(repo_root)
+    _set_headless_defaults()
+    _preload_native_libs(repo_root)
+
+    src_python = repo_root / "src" / "python"
+    if src_python.is_dir() and str(src_python) not in sys.path:
+        sys.path.insert(0, str(src_python))
+
+    from fife import fife  # noqa: PLC0415
+
+    sdl = _load_sdl(repo_root)
+    engine = _build_engine(fife, repo_root)
+    results = []
+    try:
+        engine.initializePumping()
+        for mode in modes:
+            for listeners in sorted({0, args.listeners}):
+                results.append(
+                    _run_mode(fife, engine, sdl, mode, listeners, args.frames, args.burst)
+                )
+        engine.finalizePumping()
+    finally:
+        engine.destroy()
+
+    print(json.dumps(results, indent=2))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,268 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+# SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+"""Render list build of a demo map with many layers and three cameras.
+
+The map is loaded once per job thread count, each in its own process since the
+thread count is an engine setting. Besides the frame times every run reports a
+digest of the render lists, the runs have to agree on it.
+"""
+
+import argparse
+import ctypes
+import hashlib
+import json
+import os
+import subprocess
+import sys
+import time
+from pathlib import Path
+
+
+def _prepend_env_path(var_name, path):
+    path_str = str(path)
+    current = os.environ.get(var_name, "")
+    parts = [p for p in current.split(os.pathsep) if p]
+    if path_str in parts:
+        return
+    os.environ[var_name] = path_str if not current else path_str + os.pathsep + current
+
+
+def _bootstrap_runtime_paths(repo_root):
+    local_build = repo_root / "out" / "build" / "clang22-x64-linux-dbg-cov"
+    if local_build.is_dir() and str(local_build) not in sys.path:
+        sys.path.insert(0, str(local_build))
+        _prepend_env_path("PYTHONPATH", local_build)
+
+    dependency_lib = (
+        repo_root / "out" / "fife-dependencies" / "x64-linux" / "install" / "lib"
+    )
+    if dependency_lib.is_dir():
+        _prepend_env_path("LD_LIBRARY_PATH", dependency_lib)
+
+
+def _set_headless_defaults():
+    os.environ.setdefault("SDL_VIDEODRIVER", "dummy")
+    os.environ.setdefault("SDL_AUDIODRIVER", "dummy")
+
+
+def _preload_native_libs(repo_root):
+    candidates = [
+        repo_root
+        / "out"
+        / "fife-dependencies"
+        / "x64-linux"
+        / "install"
+        / "lib"
+        / "libfifechan.so.0.2.0",
+        repo_root
+        / "out"
+        / "fife-dependencies"
+        / "x64-linux"
+        / "install"
+        / "lib"
+        / "libfifechan.so",
+        repo_root
+        / "out"
+        / "build"
+        / "clang22-x64-linux-dbg-cov"
+        / "libfifengine.so.0.5.0",
+        repo_root / "out" / "build" / "clang22-x64-linux-dbg-cov" / "libfifengine.so",
+    ]
+    for lib in candidates:
+        if lib.is_file():
+            ctypes.CDLL(str(lib), mode=ctypes.RTLD_GLOBAL)
+
+
+def _build_engine(fife, repo_root, threads):
+    engine = fife.Engine()
+    settings = engine.getSettings()
+    settings.setRenderBackend("SDL")
+    settings.setScreenWidth(1024)
+    settings.setScreenHeight(768)
+    settings.setFullScreen(False)
+    settings.setDisplay(0)
+    settings.setJobThreads(threads)
+    settings.setDefaultFontPath(str(repo_root / "tests" / "data" / "FreeMono.ttf"))
+    settings.setDefaultFontGlyphs(
+        " abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+        + ".,!?-+/:();%`'*#=[]"
+    )
+    settings.setDefaultFontSize(12)
+    settings.setWindowTitle("FIFE layer cache benchmark")
+    engine.init()
+    return engine
+
+
+def _add_layers(fife, engine, fife_map, count):
+    """Copy the instances of the densest layer into count new layers."""
+    source = max(fife_map.getLayers(), key=lambda layer: len(layer.getInstances()))
+    source_grid = source.getCellGrid()
+    for index in range(count):
+        grid = engine.getModel().getCellGrid(source_grid.getType())
+        grid.setXScale(source_grid.getXScale())
+        grid.setYScale(source_grid.getYScale())
+        grid.setRotation(source_grid.getRotation())
+        layer = fife_map.createLayer(f"benchmark_layer_{index}", grid)
+        shift = 0.25 * (index + 1)
+        for instance in source.getInstances():
+            coords = instance.getLocationRef().getExactLayerCoordinates()
+            coords.x += shift
+            coords.y -= shift
+            copy = layer.createInstance(instance.getObject(), coords)
+            fife.InstanceVisual.create(copy)
+
+
+def _add_picture_in_picture(fife, fife_map, main):
+    dims = main.getCellImageDimensions()
+    camera = fife_map.addCamera("benchmark_pip", fife.Rect(624, 10, 390, 290))
+    camera.setCellImageDimensions(dims.x, dims.y)
+    camera.setRotation(main.getRotation())
+    camera.setTilt(main.getTilt())
+    camera.setZoom(0.5)
+    camera.setLocation(main.getLocation())
+    return camera
+
+
+def _move(camera, dx, dy):
+    location = camera.getLocation()
+    coords = location.getExactLayerCoordinates()
+    coords.x += dx
+    coords.y += dy
+    location.setExactLayerCoordinates(coords)
+    camera.setLocation(location)
+
+
+def _digest(fife_map, cameras):
+    digest = hashlib.sha1()
+    for camera in cameras:
+        for layer in fife_map.getLayers():
+            for instance in camera.getMatchingInstances(camera.getViewPort(), layer):
+                coords = instance.getLocationRef().getExactLayerCoordinates()
+                entry = (
+                    camera.getName(),
+                    layer.getId(),
+                    instance.getObject().getId(),
+                    round(coords.x, 4),
+                    round(coords.y, 4),
+                )
+                digest.update(repr(entry).encode())
+    return digest.hexdigest()
+
+
+def _run(args, repo_root):
+    _bootstrap_runtime_paths(repo_root)
+    _set_headless_defaults()
+    _preload_native_libs(repo_root)
+
+    src_python = repo_root / "src" / "python"
+    if src_python.is_dir() and str(src_python) not in sys.path:
+        sys.path.insert(0, str(src_python))
+
+    from fife import fife  # noqa: PLC0415
+    from fife.extensions.loaders import loadMapFile  # noqa: PLC0415
+
+    map_path = Path(args.map).resolve()
+    engine = _build_engine(fife, repo_root, args.threads)
+    try:
+        # map files import their objects relative to the demo directory
+        os.chdir(map_path.parent.parent)
+        fife_map = loadMapFile(
+            str(map_path.relative_to(map_path.parent.parent)), engine, debug=False
+        )
+        _add_layers(fife, engine, fife_map, args.extra_layers)
+        cameras = list(fife_map.getCameras())
+        main = cameras[0]
+        cameras.append(_add_picture_in_picture(fife, fife_map, main))
+
+        engine.initializePumping()
+        digests = []
+        frame_times = []
+        for frame in range(args.frames):
+            if frame % 60 == 59:
+                # rotation rebuilds the visuals of every entry
+                for camera in cameras:
+                    camera.setRotation((camera.getRotation() + 90.0) % 360.0)
+            elif frame % 4 != 3:
+                # every fourth frame the cameras stand still
+                _move(main, 0.05, 0.02)
+                _move(cameras[-1], -0.03, 0.04)
+            start = time.perf_counter()
+            engine.pump()
+            frame_times.append(time.perf_counter() - start)
+            if frame % args.digest_every == args.digest_every - 1:
+                digests.append(_digest(fife_map, cameras))
+        engine.finalizePumping()
+
+        layer_count = len(list(fife_map.getLayers()))
+    finally:
+        engine.destroy()
+
+    frame_times.sort()
+    return {
+        "threads": args.threads,
+        "layers": layer_count,
+        "cameras": len(cameras),
+        "mean_ms": sum(frame_times) / len(frame_times) * 1000.0,
+        "median_ms": frame_times[len(frame_times) // 2] * 1000.0,
+        "digests": digests,
+    }
+
+
+def main():
+    repo_root = Path(__file__).resolve().parents[2]
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        "--map", default=str(repo_root / "demos" / "rio_de_hola" / "maps" / "shrine.xml")
+    )
+    parser.add_argument("--extra-layers", type=int, default=12)
+    parser.add_argument("--frames", type=int, default=600)
+    parser.add_argument("--digest-every", type=int, default=100)
+    parser.add_argument(
+        "--thread-counts",
+        default=f"0,{max((os.cpu_count() or 1) - 1, 1)}",
+        help="comma separated job thread counts to compare",
+    )
+    parser.add_argument("--threads", type=int, help=argparse.SUPPRESS)
+    args = parser.parse_args()
+
+    if args.threads is not None:
+        print(json.dumps(_run(args, repo_root)))
+        return
+
+    results = []
+    for threads in (int(t) for t in args.thread_counts.split(",")):
+        command = [
+            sys.executable,
+            __file__,
+            "--map",
+            args.map,
+            "--extra-layers",
+            str(args.extra_layers),
+            "--frames",
+            str(args.frames),
+            "--digest-every",
+            str(args.digest_every),
+            "--threads",
+            str(threads),
+        ]
+        output = subprocess.run(command, check=True, capture_output=True, text=True)
+        results.append(json.loads(output.stdout.strip().splitlines()[-1]))
+
+    print("layer cache benchmark results")
+    first = results[0]
+    print(f"- map: {args.map}")
+    print(f"- layers: {first['layers']}, cameras: {first['cameras']}, frames: {args.frames}")
+    for result in results:
+        print(
+            f"- {result['threads']} job threads: {result['mean_ms']:.3f} ms/frame mean, "
+            f"{result['median_ms']:.3f} ms/frame median"
+        )
+    identical = all(result["digests"] == first["digests"] for result in results)
+    print(f"- render lists identical: {identical}")
+    if not identical:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,288 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+# SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+"""Frame times of Engine::pump per subsystem on scripted scenarios.
+
+Every scenario runs in its own headless process on a fixed virtual clock, so two
+runs of the same build process the same frames. The camera moves are scripted
+per frame, the input either comes from nothing or from a recording made with
+Engine.startRecording(), e.g. of a play session of the demo. The results are
+printed as JSON, one object per scenario with the statistics of every phase of
+Engine.getFrameStats().
+"""
+
+import argparse
+import ctypes
+import json
+import os
+import subprocess
+import sys
+from pathlib import Path
+
+PHASES = ("events", "time", "audio", "model", "renderList", "render", "gui", "total")
+
+
+def _prepend_env_path(var_name, path):
+    path_str = str(path)
+    current = os.environ.get(var_name, "")
+    parts = [p for p in current.split(os.pathsep) if p]
+    if path_str in parts:
+        return
+    os.environ[var_name] = path_str if not current else path_str + os.pathsep + current
+
+
+def _bootstrap_runtime_paths(repo_root):
+    local_build = repo_root / "out" / "build" / "clang22-x64-linux-dbg-cov"
+    if local_build.is_dir() and str(local_build) not in sys.path:
+        sys.path.insert(0, str(local_build))
+        _prepend_env_path("PYTHONPATH", local_build)
+
+    dependency_lib = (
+        repo_root / "out" / "fife-dependencies" / "x64-linux" / "install" / "lib"
+    )
+    if dependency_lib.is_dir():
+        _prepend_env_path("LD_LIBRARY_PATH", dependency_lib)
+
+
+def _set_headless_defaults(backend):
+    if backend == "OpenGL":
+        # Mesa llvmpipe without a display
+        os.environ.setdefault("SDL_VIDEODRIVER", "offscreen")
+        os.environ.setdefault("LIBGL_ALWAYS_SOFTWARE", "1")
+    else:
+        os.environ.setdefault("SDL_VIDEODRIVER", "dummy")
+    os.environ.setdefault("SDL_AUDIODRIVER", "dummy")
+
+
+def _preload_native_libs(repo_root):
+    candidates = [
+        repo_root
+        / "out"
+        / "fife-dependencies"
+        / "x64-linux"
+        / "install"
+        / "lib"
+        / "libfifechan.so.0.2.0",
+        repo_root
+        / "out"
+        / "fife-dependencies"
+        / "x64-linux"
+        / "install"
+        / "lib"
+        / "libfifechan.so",
+        repo_root
+        / "out"
+        / "build"
+        / "clang22-x64-linux-dbg-cov"
+        / "libfifengine.so.0.5.0",
+        repo_root / "out" / "build" / "clang22-x64-linux-dbg-cov" / "libfifengine.so",
+    ]
+    for lib in candidates:
+        if lib.is_file():
+            ctypes.CDLL(str(lib), mode=ctypes.RTLD_GLOBAL)
+
+
+def _build_engine(fife, repo_root, backend):
+    engine = fife.Engine()
+    settings = engine.getSettings()
+    settings.setRenderBackend(backend)
+    settings.setScreenWidth(1024)
+    settings.setScreenHeight(768)
+    settings.setFullScreen(False)
+    settings.setDisplay(0)
+    # frames must not wait for the wall clock
+    settings.setFrameLimitEnabled(False)
+    settings.setVSync(False)
+    settings.setDefaultFontPath(str(repo_root / "tests" / "data" / "FreeMono.ttf"))
+    settings.setDefaultFontGlyphs(
+        " abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+        + ".,!?-+/:();%`'*#=[]"
+    )
+    settings.setDefaultFontSize(12)
+    settings.setWindowTitle("FIFE replay benchmark")
+    engine.init()
+    return engine
+
+
+def _move(camera, dx, dy):
+    location = camera.getLocation()
+    coords = location.getExactLayerCoordinates()
+    coords.x += dx
+    coords.y += dy
+    location.setExactLayerCoordinates(coords)
+    camera.setLocation(location)
+
+
+def _idle(_camera, _frame):
+    pass
+
+
+def _pan(camera, frame):
+    # back and forth, so the camera stays on the map
+    direction = 1.0 if (frame // 200) % 2 == 0 else -1.0
+    _move(camera, 0.05 * direction, 0.02 * direction)
+
+
+def _zoom(camera, frame):
+    step = frame % 120
+    camera.setZoom(0.5 + (step if step < 60 else 120 - step) / 40.0)
+
+
+def _rotate(camera, frame):
+    if frame % 60 == 59:
+        camera.setRotation((camera.getRotation() + 90.0) % 360.0)
+
+
+def _tour(camera, frame):
+    _pan(camera, frame)
+    _rotate(camera, frame)
+    if frame % 300 == 0:
+        camera.setZoom(1.0 if (frame // 300) % 2 == 0 else 0.75)
+
+
+SCENARIOS = {
+    "idle": _idle,
+    "pan": _pan,
+    "zoom": _zoom,
+    "rotate": _rotate,
+    "tour": _tour,
+}
+
+
+def _summary(samples):
+    ordered = sorted(samples)
+    return {
+        "mean_ms": sum(ordered) / len(ordered),
+        "median_ms": ordered[len(ordered) // 2],
+        "p95_ms": ordered[min(len(ordered) - 1, (len(ordered) * 95) // 100)],
+        "max_ms": ordered[-1],
+    }
+
+
+def _run(args, repo_root):
+    _bootstrap_runtime_paths(repo_root)
+    _set_headless_defaults(args.backend)
+    _preload_native_libs(repo_root)
+
+    src_python = repo_root / "src" / "python"
+    if src_python.is_dir() and str(src_python) not in sys.path:
+        sys.path.insert(0, str(src_python))
+
+    from fife import fife  # noqa: PLC0415
+    from fife.extensions.loaders import loadMapFile  # noqa: PLC0415
+
+    map_path = Path(args.map).resolve()
+    replay = str(Path(args.replay).resolve()) if args.replay else None
+    record = str(Path(args.record).resolve()) if args.record else None
+    engine = _build_engine(fife, repo_root, args.backend)
+    try:
+        # map files import their objects relative to the demo directory
+        os.chdir(map_path.parent.parent)
+        fife_map = loadMapFile(
+            str(map_path.relative_to(map_path.parent.parent)), engine, debug=False
+        )
+        camera = list(fife_map.getCameras())[0]
+        scenario = SCENARIOS[args.scenario]
+
+        if replay is not None:
+            if not engine.startReplay(replay):
+                raise RuntimeError(f"could not load the recording {replay}")
+        else:
+            engine.getTimeManager().setFixedTimeDelta(args.delta)
+            if record is not None:
+                engine.startRecording()
+
+        engine.initializePumping()
+        samples = {phase: [] for phase in PHASES}
+        frame = 0
+        while engine.isReplaying() if replay is not None else frame < args.frames:
+            scenario(camera, frame)
+            engine.pump()
+            stats = engine.getFrameStats()
+            for phase in PHASES:
+                samples[phase].append(getattr(stats, phase))
+            frame += 1
+        engine.finalizePumping()
+
+        if record is not None and not engine.stopRecording(record):
+            raise RuntimeError(f"could not write the recording {record}")
+        instances = sum(len(layer.getInstances()) for layer in fife_map.getLayers())
+    finally:
+        engine.destroy()
+
+    return {
+        "map": str(map_path),
+        "scenario": args.scenario,
+        "backend": args.backend,
+        "replay": replay,
+        "frames": frame,
+        "instances": instances,
+        "phases": {phase: _summary(values) for phase, values in samples.items()},
+    }
+
+
+def main():
+    repo_root = Path(__file__).resolve().parents[2]
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        "--map", default=str(repo_root / "demos" / "rio_de_hola" / "maps" / "shrine.xml")
+    )
+    parser.add_argument(
+        "--scenarios",
+        default="idle,pan,zoom,rotate,tour",
+        help="comma separated scenarios, of " + ", ".join(SCENARIOS),
+    )
+    parser.add_argument("--frames", type=int, default=600)
+    parser.add_argument(
+        "--delta", type=int, default=16, help="virtual milliseconds per frame"
+    )
+    parser.add_argument("--backend", choices=("SDL", "OpenGL"), default="SDL")
+    parser.add_argument(
+        "--record", help="write the input and time deltas of the run to this file"
+    )
+    parser.add_argument(
+        "--replay",
+        help="replay a recording instead of the fixed delta, it sets the frame count",
+    )
+    parser.add_argument("--scenario", help=argparse.SUPPRESS)
+    args = parser.parse_args()
+
+    if args.scenario is not None:
+        print(json.dumps(_run(args, repo_root)))
+        return
+
+    scenarios = [s for s in args.scenarios.split(",") if s]
+    unknown = [s for s in scenarios if s not in SCENARIOS]
+    if unknown:
+        parser.error(f"unknown scenarios: {', '.join(unknown)}")
+    if args.record and len(scenarios) != 1:
+        parser.error("--record needs a single scenario")
+
+    results = []
+    for scenario in scenarios:
+        command = [
+            sys.executable,
+            __file__,
+            "--map",
+            args.map,
+            "--frames",
+            str(args.frames),
+            "--delta",
+            str(args.delta),
+            "--backend",
+            args.backend,
+            "--scenario",
+            scenario,
+        ]
+        if args.record:
+            command += ["--record", args.record]
+        if args.replay:
+            command += ["--replay", args.replay]
+        output = subprocess.run(command, check=True, capture_output=True, text=True)
+        results.append(json.loads(output.stdout.strip().splitlines()[-1]))
+
+    print(json.dumps(results, indent=2))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,173 @@
+# SPDX-License-Identifier: LGPL-2.1-or-later
+# SPDX-FileCopyrightText: 2005 - 2026 Fifengine contributors
+
+"""SoundManager::update() with thousands of positional emitters.
+
+OpenAL Soft is told to use its null backend (or the wave writer with
+--backend wave), so the benchmark neither needs nor disturbs a sound card.
+"""
+
+import argparse
+import ctypes
+import os
+import random
+import sys
+import tempfile
+import time
+from pathlib import Path
+
+
+def _prepend_env_path(var_name, path):
+    path_str = str(path)
+    current = os.environ.get(var_name, "")
+    parts = [p for p in current.split(os.pathsep) if p]
+    if path_str in parts:
+        return
+    os.environ[var_name] = path_str if not current else path_str + os.pathsep + current
+
+
+def _bootstrap_runtime_paths(repo_root):
+    local_build = repo_root / "out" / "build" / "clang22-x64-linux-dbg-cov"
+    if local_build.is_dir() and str(local_build) not in sys.path:
+        sys.path.insert(0, str(local_build))
+        _prepend_env_path("PYTHONPATH", local_build)
+
+    dependency_lib = (
+        repo_root / "out" / "fife-dependencies" / "x64-linux" / "install" / "lib"
+    )
+    if dependency_lib.is_dir():
+        _prepend_env_path("LD_LIBRARY_PATH", dependency_lib)
+
+
+def _set_headless_defaults(backend, wave_file):
+    os.environ.setdefault("SDL_VIDEODRIVER", "dummy")
+    os.environ.setdefault("SDL_AUDIODRIVER", "dummy")
+    os.environ["ALSOFT_DRIVERS"] = backend
+    if backend == "wave":
+        # the wave writer takes its output file only from a config file
+        conf = Path(tempfile.gettempdir()) / "fife_benchmark_alsoft.conf"
+        conf.write_text(f"[wave]\nfile = {wave_file}\n")
+        os.environ["ALSOFT_CONF"] = str(conf)
+
+
+def _preload_native_libs(repo_root):
+    candidates = [
+        repo_root
+        / "out"
+        / "fife-dependencies"
+        / "x64-linux"
+        / "install"
+        / "lib"
+        / "libfifechan.so.0.2.0",
+        repo_root
+        / "out"
+        / "fife-dependencies"
+        / "x64-linux"
+        / "install"
+        / "lib"
+        / "libfifechan.so",
+        repo_root
+        / "out"
+        / "build"
+        / "clang22-x64-linux-dbg-cov"
+        / "libfifengine.so.0.5.0",
+        repo_root / "out" / "build" / "clang22-x64-linux-dbg-cov" / "libfifengine.so",
+    ]
+    for lib in candidates:
+        if lib.is_file():
+            ctypes.CDLL(str(lib), mode=ctypes.RTLD_GLOBAL)
+
+
+def _build_engine(fife, repo_root):
+    engine = fife.Engine()
+    settings = engine.getSettings()
+    settings.setRenderBackend("SDL")
+    settings.setScreenWidth(1)
+    settings.setScreenHeight(1)
+    settings.setFullScreen(False)
+    settings.setDisplay(0)
+    settings.setDefaultFontPath(str(repo_root / "tests" / "data" / "FreeMono.ttf"))
+    settings.setDefaultFontGlyphs(
+        " abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+        + ".,!?-+/:();%`'*#=[]"
+    )
+    settings.setDefaultFontSize(12)
+    settings.setWindowTitle("FIFE sound emitter benchmark")
+    engine.init()
+    return engine
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--emitters", type=int, default=5000)
+    parser.add_argument("--frames", type=int, default=1000)
+    parser.add_argument("--map-size", type=float, default=2000.0)
+    parser.add_argument("--max-distance", type=float, default=50.0)
+    parser.add_argument("--backend", choices=("null", "wave"), default="null")
+    parser.add_argument("--wave-file", default="fife_benchmark.wav")
+    args = parser.parse_args()
+
+    repo_root = Path(__file__).resolve().parents[2]
+    _bootstrap_runtime_paths(repo_root)
+    _set_headless_defaults(args.backend, args.wave_file)
+    _preload_native_libs(repo_root)
+
+    src_python = repo_root / "src" / "python"
+    if src_python.is_dir() and str(src_python) not in sys.path:
+        sys.path.insert(0, str(src_python))
+
+    from fife import fife  # noqa: PLC0415
+
+    engine = _build_engine(fife, repo_root)
+
+    try:
+        rng = random.Random(9001)
+        soundmanager = engine.getSoundManager()
+        if not soundmanager.isActive():
+            soundmanager.init()
+        soundmanager.setListenerMaxDistance(args.max_distance)
+
+        clip = engine.getSoundClipManager().load(
+            str(repo_root / "tests" / "data" / "left_right_test.ogg")
+        )
+        emitters = []
+        for _ in range(args.emitters):
+            emitter = soundmanager.createEmitter()
+            emitter.setSoundClip(clip)
+            emitter.setLooping(True)
+            emitter.setGain(rng.uniform(0.2, 1.0))
+            emitter.setPosition(
+                fife.AudioSpaceCoordinate(
+                    rng.uniform(1.0, args.map_size), rng.uniform(1.0, args.map_size), 0.0
+                )
+            )
+            emitter.play()
+            emitters.append(emitter)
+
+        # the listener walks diagonally over the map
+        step = args.map_size / args.frames
+        active = 0
+        start = time.perf_counter()
+        for frame in range(args.frames):
+            soundmanager.setListenerPosition(
+                fife.AudioSpaceCoordinate(frame * step, frame * step, 0.0)
+            )
+            soundmanager.update()
+            active += soundmanager.getActiveEmitterCount()
+        elapsed = time.perf_counter() - start
+
+        print("sound emitter benchmark results")
+        print(f"- backend: {args.backend}")
+        print(f"- emitters: {args.emitters}, frames: {args.frames}")
+        print(f"- update: {elapsed / args.frames * 1000.0:.4f} ms/frame")
+        print(f"- active emitters: {active / args.frames:.1f} per frame")
+
+        for emitter in emitters:
+            soundmanager.deleteEmitter(emitter)
+
+    finally:
+        engine.destroy()
+
+
+if __name__ == "__main__":
+    main()